@@ -5,10 +5,14 @@
 #ifndef ABRAHAM_ARRAY_HPP
 #define ABRAHAM_ARRAY_HPP
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <sstream>
+#include <utility>
+#include "ContainerStats.hpp"
 #include "Exception.hpp"
+#include "Hash.hpp"
 
 
 namespace abraham {
@@ -18,13 +22,18 @@ namespace abraham {
      * @tparam T - The type of the Array.
      */
     template<typename T>
-    class Array {
+    class Array : private details::ContainerTracker<ContainerType::ARRAY> {
     protected:
         /**
          * The internal std::vector object that this class wraps.
          */
         std::vector<T> _data;
 
+        /**
+         * Reports the storage of this Array to ContainerStats. Does nothing unless ABRAHAM_CONTAINER_STATS is defined.
+         */
+        void updateStats();
+
     public:
         /**
          * Default constructor that creates an empty Array.
@@ -151,6 +160,11 @@ namespace abraham {
          */
         bool isEmpty() const;
 
+        /**
+         * @return A hash of the elements in order, combined from each element's Hash.
+         */
+        size_t hash() const;
+
         /**
          * Appends an object to the end of the Array.
          * @param object - The object to add to the Array.
@@ -395,31 +409,40 @@ namespace abraham {
     template<typename T>
     Array<T>::Array() {
         this->_data = std::vector<T>();
+        this->updateStats();
     }
 
     template<typename T>
     Array<T>::Array(size_t size) {
         this->_data = std::vector<T>(size);
+        this->updateStats();
     }
 
     template<typename T>
     Array<T>::Array(std::initializer_list<T> i_list) {
         this->_data = std::vector<T>(i_list);
+        this->updateStats();
     }
 
     template<typename T>
     Array<T>::Array(const std::vector<T>& vector) {
         this->_data = vector;
+        this->updateStats();
     }
 
     template<typename T>
-    Array<T>::Array(const Array<T>& array) {
+    Array<T>::Array(const Array<T>& array) : details::ContainerTracker<ContainerType::ARRAY>() {
         this->_data = array._data;
+        this->recordCopy();
+        this->updateStats();
     }
 
     template<typename T>
     Array<T>::Array(Array<T>&& array) noexcept {
-        this->_data = array._data;
+        this->_data = std::move(array._data);
+        this->recordMove();
+        this->updateStats();
+        array.updateStats();
     }
 
     template<typename T>
@@ -434,13 +457,18 @@ namespace abraham {
     template<typename T>
     Array<T>& Array<T>::operator=(const Array<T>& array) {
         this->_data = array._data;
+        this->recordCopy();
+        this->updateStats();
         return *this;
     }
 
     template<typename T>
     Array<T>& Array<T>::operator=(Array<T>&& array) noexcept {
         if (this == &array) return *this;
-        this->_data = array._data;
+        this->_data = std::move(array._data);
+        this->recordMove();
+        this->updateStats();
+        array.updateStats();
         return *this;
     }
 
@@ -449,6 +477,7 @@ namespace abraham {
         Array<T> buffer = Array();
         buffer._data.insert(buffer._data.begin(), this->_data.begin(), this->_data.end());
         buffer._data.insert(buffer._data.end(), array._data.begin(), array._data.end());
+        buffer.updateStats();
         return buffer;
     }
 
@@ -456,6 +485,7 @@ namespace abraham {
     Array<T>& Array<T>::operator+=(const Array<T>& array) {
         if (this == &array) return *this;
         this->_data.insert(this->_data.end(), array._data.begin(), array._data.end());
+        this->updateStats();
         return *this;
     }
 
@@ -520,9 +550,20 @@ namespace abraham {
         return this->_data.empty();
     }
 
+    template<typename T>
+    size_t Array<T>::hash() const {
+        uint64_t hash = Hasher::hashInteger(this->_data.size());
+        for (const T& element : this->_data) {
+            hash = Hasher::combine(hash, Hash<T>()(element));
+        }
+
+        return static_cast<size_t>(hash);
+    }
+
     template<typename T>
     Array<T>& Array<T>::add(const T& object) {
         this->_data.push_back(object);
+        this->updateStats();
         return *this;
     }
 
@@ -532,6 +573,7 @@ namespace abraham {
             this->_data.push_back(object);
         }
 
+        this->updateStats();
         return *this;
     }
 
@@ -539,6 +581,7 @@ namespace abraham {
     Array<T>& Array<T>::insert(const T& object, size_t index) {
         if (index < this->_data.size()) {
             this->_data.insert(this->_data.begin() + index, object);
+            this->updateStats();
             return *this;
         } else {
             throw OutOfBoundsException(index);
@@ -553,6 +596,7 @@ namespace abraham {
             this->_data.erase(this->_data.begin() + index);
         }
 
+        this->updateStats();
         return *this;
     }
 
@@ -560,6 +604,7 @@ namespace abraham {
     Array<T>& Array<T>::removeIndex(size_t index) {
         if (index < this->_data.size()) {
             this->_data.erase(this->_data.begin() + index);
+            this->updateStats();
             return *this;
         } else {
             throw OutOfBoundsException(index);
@@ -574,6 +619,7 @@ namespace abraham {
 
         if (from_index < this->_data.size() && to_index < this->_data.size()) {
             this->_data.erase(this->_data.begin() + from_index, this->_data.begin() + to_index);
+            this->updateStats();
             return *this;
         } else {
             throw OutOfBoundsException(to_index);
@@ -583,6 +629,7 @@ namespace abraham {
     template<typename T>
     Array<T>& Array<T>::removeAll(const T& object) {
         this->_data.erase(std::remove(this->_data.begin(), this->_data.end(), object), this->_data.end());
+        this->updateStats();
         return *this;
     }
 
@@ -598,6 +645,7 @@ namespace abraham {
     template<typename T>
     Array<T>& Array<T>::removeAll() {
         this->_data.clear();
+        this->updateStats();
         return *this;
     }
 
@@ -612,6 +660,7 @@ namespace abraham {
         }
 
         this->_data = new_array;
+        this->updateStats();
         return *this;
     }
 
@@ -678,6 +727,7 @@ namespace abraham {
             Array<T> subarray = Array<T>();
             std::copy(this->_data.begin() + from_index, this->_data.begin() + to_index + 1,
                       std::back_inserter(subarray._data));
+            subarray.updateStats();
             return subarray;
         } else {
             throw OutOfBoundsException(to_index);
@@ -689,6 +739,7 @@ namespace abraham {
         if (index < this->_data.size()) {
             Array<T> subarray = Array<T>();
             std::copy(this->_data.begin() + index, this->_data.end(), std::back_inserter(subarray._data));
+            subarray.updateStats();
             return subarray;
         } else {
             throw OutOfBoundsException(index);
@@ -700,6 +751,7 @@ namespace abraham {
         if (index < this->_data.size()) {
             Array<T> subarray = Array<T>();
             std::copy(this->_data.begin(), this->_data.begin() + index, std::back_inserter(subarray._data));
+            subarray.updateStats();
             return subarray;
         } else {
             throw OutOfBoundsException(index);
@@ -835,8 +887,20 @@ namespace abraham {
         return this->_data.cend();
     }
 
+    template<typename T>
+    void Array<T>::updateStats() {
+        this->recordStorage(this->_data.capacity() * sizeof(T), this->_data.size() * sizeof(T));
+    }
+
     template<typename T>
     const size_t Array<T>::NO_INDEX = -1;
+
+    template<typename T>
+    struct Hash<Array<T>> {
+        size_t operator()(const Array<T>& array) const {
+            return array.hash();
+        }
+    };
 }
 
 #endif //ABRAHAM_ARRAY_HPP
@@ -0,0 +1,225 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_CHARSET_HPP
+#define ABRAHAM_CHARSET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * A set of byte values stored as a 256 bit bitmap, so membership is a single lookup. A CharSet can be built at
+     * compile time, and finds the first or last character in or out of the set in one pass over a string.
+     *
+     * Example:
+     *     constexpr CharSet SEPARATORS = CharSet(",;|");
+     *     size_t index = SEPARATORS.findFirst(line);
+     */
+    class CharSet {
+    protected:
+        /**
+         * One bit per byte value.
+         */
+        uint64_t _bits[4];
+
+    public:
+        /**
+         * Default constructor that creates an empty CharSet.
+         */
+        constexpr CharSet() : _bits{0, 0, 0, 0} {}
+
+        /**
+         * Constructor that creates a CharSet of the characters of a C style string.
+         * @param characters - The null terminated characters the set should contain.
+         */
+        explicit constexpr CharSet(const char* characters) : _bits{0, 0, 0, 0} {
+            for (; *characters != '\0'; ++characters) {
+                this->add(*characters);
+            }
+        }
+
+        /**
+         * Constructor that creates a CharSet of a range of characters, which may include null characters.
+         * @param characters - The characters the set should contain.
+         */
+        explicit CharSet(const StringView& characters);
+
+        /**
+         * @param first - The first character in the range.
+         * @param last - The last character in the range, inclusive.
+         * @return A CharSet of every character from first to last.
+         */
+        static constexpr CharSet range(char first, char last) {
+            CharSet set = CharSet();
+            for (unsigned c = static_cast<unsigned char>(first); c <= static_cast<unsigned char>(last); ++c) {
+                set.add(static_cast<char>(c));
+            }
+            return set;
+        }
+
+        constexpr bool operator==(const CharSet& set) const {
+            return this->_bits[0] == set._bits[0] && this->_bits[1] == set._bits[1] &&
+                   this->_bits[2] == set._bits[2] && this->_bits[3] == set._bits[3];
+        }
+
+        constexpr bool operator!=(const CharSet& set) const {
+            return !(*this == set);
+        }
+
+        /**
+         * @return The union of the two sets.
+         */
+        constexpr CharSet operator|(const CharSet& set) const {
+            CharSet result = *this;
+            for (size_t i = 0; i < 4; ++i) result._bits[i] |= set._bits[i];
+            return result;
+        }
+
+        /**
+         * @return The intersection of the two sets.
+         */
+        constexpr CharSet operator&(const CharSet& set) const {
+            CharSet result = *this;
+            for (size_t i = 0; i < 4; ++i) result._bits[i] &= set._bits[i];
+            return result;
+        }
+
+        /**
+         * @return A CharSet of every character not in this one.
+         */
+        constexpr CharSet operator~() const {
+            CharSet result = *this;
+            for (size_t i = 0; i < 4; ++i) result._bits[i] = ~result._bits[i];
+            return result;
+        }
+
+        /**
+         * @param c - The character to add.
+         * @return A self reference.
+         */
+        constexpr CharSet& add(char c) {
+            const unsigned char byte = static_cast<unsigned char>(c);
+            this->_bits[byte >> 6] |= uint64_t(1) << (byte & 63);
+            return *this;
+        }
+
+        /**
+         * @param c - The character to remove.
+         * @return A self reference.
+         */
+        constexpr CharSet& remove(char c) {
+            const unsigned char byte = static_cast<unsigned char>(c);
+            this->_bits[byte >> 6] &= ~(uint64_t(1) << (byte & 63));
+            return *this;
+        }
+
+        /**
+         * @param c - The character to look for.
+         * @return true if the character is in the set; false otherwise.
+         */
+        constexpr bool contains(char c) const {
+            const unsigned char byte = static_cast<unsigned char>(c);
+            return ((this->_bits[byte >> 6] >> (byte & 63)) & 1) != 0;
+        }
+
+        /**
+         * @return The number of characters in the set.
+         */
+        size_t size() const;
+
+        /**
+         * @return true if the set has no characters; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @param string - The characters to search.
+         * @return The index of the first character in the set. StringView::NO_INDEX if there isn't one.
+         */
+        size_t findFirst(const StringView& string) const;
+
+        /**
+         * @param string - The characters to search.
+         * @return The index of the first character not in the set. StringView::NO_INDEX if there isn't one.
+         */
+        size_t findFirstNot(const StringView& string) const;
+
+        /**
+         * @param string - The characters to search.
+         * @return The index of the last character in the set. StringView::NO_INDEX if there isn't one.
+         */
+        size_t findLast(const StringView& string) const;
+
+        /**
+         * @param string - The characters to search.
+         * @return The index of the last character not in the set. StringView::NO_INDEX if there isn't one.
+         */
+        size_t findLastNot(const StringView& string) const;
+
+        /**
+         * Removes every character in the set from a run of characters in place, keeping the rest in order. The
+         * vector state for the set is prepared at most once, however many runs there are.
+         * @param data - The characters to remove from.
+         * @param length - The number of characters.
+         * @return The number of characters kept, at the front of data.
+         */
+        size_t removeFrom(char* data, size_t length) const;
+    };
+
+    /**
+     * The ASCII upper case letters.
+     */
+    constexpr CharSet ASCII_UPPERCASE_SET = CharSet::range('A', 'Z');
+
+    /**
+     * The ASCII lower case letters.
+     */
+    constexpr CharSet ASCII_LOWERCASE_SET = CharSet::range('a', 'z');
+
+    /**
+     * The ASCII alphabetic letters.
+     */
+    constexpr CharSet ASCII_LETTERS_SET = ASCII_UPPERCASE_SET | ASCII_LOWERCASE_SET;
+
+    /**
+     * The ASCII whitespace characters, as in String::ASCII_WHITESPACE.
+     */
+    constexpr CharSet ASCII_WHITESPACE_SET = CharSet(" \t\r\n\v\f");
+
+    /**
+     * The ASCII punctuation characters, as in String::ASCII_PUNCTUATION.
+     */
+    constexpr CharSet ASCII_PUNCTUATION_SET = CharSet("!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~");
+
+    /**
+     * The ASCII numeric digits.
+     */
+    constexpr CharSet ASCII_DIGITS_SET = CharSet::range('0', '9');
+
+    /**
+     * The ASCII alphabetic letters and digits.
+     */
+    constexpr CharSet ASCII_ALPHANUMERIC_SET = ASCII_LETTERS_SET | ASCII_DIGITS_SET;
+
+    /**
+     * The ASCII hexadecimal letters and digits.
+     */
+    constexpr CharSet ASCII_HEX_DIGITS_SET = ASCII_DIGITS_SET | CharSet::range('a', 'f') | CharSet::range('A', 'F');
+
+    /**
+     * The ASCII octal digits.
+     */
+    constexpr CharSet ASCII_OCT_DIGITS_SET = CharSet::range('0', '7');
+
+    /**
+     * The ASCII printable characters, including whitespace.
+     */
+    constexpr CharSet ASCII_PRINTABLE_SET = ASCII_ALPHANUMERIC_SET | ASCII_PUNCTUATION_SET | ASCII_WHITESPACE_SET;
+}
+
+#endif //ABRAHAM_CHARSET_HPP
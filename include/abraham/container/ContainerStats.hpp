@@ -0,0 +1,276 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_CONTAINERSTATS_HPP
+#define ABRAHAM_CONTAINERSTATS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef ABRAHAM_CONTAINER_STATS
+#include <atomic>
+#endif
+
+
+namespace abraham {
+
+    class String;
+
+    /**
+     * The container types that ContainerStats records figures for.
+     */
+    enum class ContainerType {
+        ARRAY = 0,
+        DICTIONARY,
+        QUEUE,
+        STACK,
+        STRING
+    };
+
+    /**
+     * The figures recorded for one container type.
+     */
+    struct ContainerCounters {
+        /**
+         * The number of containers constructed, including copies and moves.
+         */
+        uint64_t constructions = 0;
+
+        /**
+         * The number of containers destroyed.
+         */
+        uint64_t destructions = 0;
+
+        /**
+         * The number of copy constructions and copy assignments.
+         */
+        uint64_t copies = 0;
+
+        /**
+         * The number of move constructions and move assignments.
+         */
+        uint64_t moves = 0;
+
+        /**
+         * The number of times storage was allocated, including regrowths and map nodes.
+         */
+        uint64_t allocations = 0;
+
+        /**
+         * The number of times storage that was already allocated had to grow.
+         */
+        uint64_t regrowths = 0;
+
+        /**
+         * The number of bytes currently reserved by live containers.
+         */
+        int64_t bytesReserved = 0;
+
+        /**
+         * The number of bytes currently holding elements of live containers.
+         */
+        int64_t bytesUsed = 0;
+
+        /**
+         * The number of map nodes currently held by live containers.
+         */
+        int64_t nodes = 0;
+    };
+
+    /**
+     * A copy of the figures recorded for every container type at one point in time.
+     */
+    struct ContainerStatsSnapshot {
+        /**
+         * The figures of each container type, indexed by ContainerType.
+         */
+        ContainerCounters counters[5];
+
+        /**
+         * @param type - The container type to get figures for.
+         * @return The figures recorded for the container type.
+         */
+        const ContainerCounters& countersForType(ContainerType type) const;
+
+        /**
+         * @return A table of the figures, one line per container type.
+         */
+        String toString() const;
+    };
+
+
+    /**
+     * Counts allocations, storage reserved versus used, regrowths, copies and moves, and map nodes for Array,
+     * Dictionary, Queue, Stack and String.
+     *
+     * Recording is compiled in only when ABRAHAM_CONTAINER_STATS is defined (the CMake option of the same name).
+     * Otherwise the hooks in the containers are empty and snapshot() returns zeros. The definition must be the same
+     * for the library and everything that includes its headers. Queue, Stack and Dictionary storage is estimated
+     * from their element counts, since the standard containers they wrap don't expose their capacity.
+     */
+    class ContainerStats {
+    public:
+        /**
+         * @return true if the library was built with ABRAHAM_CONTAINER_STATS; false otherwise.
+         */
+        static bool isEnabled();
+
+        /**
+         * @return The figures recorded so far.
+         */
+        static ContainerStatsSnapshot snapshot();
+
+        /**
+         * Clears the event counters. The bytes and nodes held by live containers are kept, since those containers
+         * will release them later.
+         */
+        static void reset();
+
+        /**
+         * Returns the name of a container type.
+         * @param type - The container type to get the name of.
+         * @return The name of the container type.
+         */
+        static String stringForContainerType(ContainerType type);
+    };
+
+
+    /// \cond IGNORE
+    namespace details {
+
+#ifdef ABRAHAM_CONTAINER_STATS
+
+        /**
+         * The live counters of one container type.
+         */
+        struct AtomicContainerCounters {
+            std::atomic<uint64_t> constructions;
+            std::atomic<uint64_t> destructions;
+            std::atomic<uint64_t> copies;
+            std::atomic<uint64_t> moves;
+            std::atomic<uint64_t> allocations;
+            std::atomic<uint64_t> regrowths;
+            std::atomic<int64_t> bytesReserved;
+            std::atomic<int64_t> bytesUsed;
+            std::atomic<int64_t> nodes;
+        };
+
+        /**
+         * @param type - The container type to get counters for.
+         * @return The live counters of the container type.
+         */
+        AtomicContainerCounters& containerCounters(ContainerType type);
+
+        /**
+         * A base class of each container that records its figures. Each instance remembers what it last reported,
+         * so only the difference is added to the shared counters.
+         */
+        template<ContainerType TYPE>
+        class ContainerTracker {
+        private:
+            size_t _reserved;
+            size_t _used;
+            size_t _nodes;
+
+        protected:
+            ContainerTracker() : _reserved(0), _used(0), _nodes(0) {
+                containerCounters(TYPE).constructions.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            ContainerTracker(const ContainerTracker&) : ContainerTracker() {}
+
+            ContainerTracker& operator=(const ContainerTracker&) {
+                return *this;
+            }
+
+            ~ContainerTracker() {
+                this->recordStorage(0, 0);
+                this->recordNodes(0, 0, 0);
+                containerCounters(TYPE).destructions.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void recordCopy() const {
+                containerCounters(TYPE).copies.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void recordMove() const {
+                containerCounters(TYPE).moves.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void recordStorage(size_t reserved, size_t used) {
+                AtomicContainerCounters& counters = containerCounters(TYPE);
+                if (reserved > this->_reserved) {
+                    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+                    if (this->_reserved != 0) {
+                        counters.regrowths.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+
+                this->recordBytes(reserved, used);
+            }
+
+            void recordNodes(size_t nodes, size_t node_size, size_t element_size) {
+                AtomicContainerCounters& counters = containerCounters(TYPE);
+                if (nodes > this->_nodes) {
+                    counters.allocations.fetch_add(nodes - this->_nodes, std::memory_order_relaxed);
+                }
+
+                counters.nodes.fetch_add(static_cast<int64_t>(nodes) - static_cast<int64_t>(this->_nodes),
+                                         std::memory_order_relaxed);
+                this->_nodes = nodes;
+                this->recordBytes(nodes * node_size, nodes * element_size);
+            }
+
+        private:
+            void recordBytes(size_t reserved, size_t used) {
+                AtomicContainerCounters& counters = containerCounters(TYPE);
+                counters.bytesReserved.fetch_add(static_cast<int64_t>(reserved) - static_cast<int64_t>(this->_reserved),
+                                                 std::memory_order_relaxed);
+                counters.bytesUsed.fetch_add(static_cast<int64_t>(used) - static_cast<int64_t>(this->_used),
+                                             std::memory_order_relaxed);
+                this->_reserved = reserved;
+                this->_used = used;
+            }
+        };
+
+#else
+
+        /**
+         * Recording is disabled: an empty base class whose hooks compile to nothing.
+         */
+        template<ContainerType TYPE>
+        class ContainerTracker {
+        protected:
+            void recordCopy() const {}
+
+            void recordMove() const {}
+
+            void recordStorage(size_t, size_t) {}
+
+            void recordNodes(size_t, size_t, size_t) {}
+        };
+
+#endif
+
+        /**
+         * Estimates the bytes a std::deque reserves for a number of elements, from libstdc++'s 512 byte blocks.
+         * @tparam T - The element type of the std::deque.
+         * @param count - The number of elements.
+         * @return The estimated number of bytes reserved.
+         */
+        template<typename T>
+        size_t dequeReservedBytes(size_t count) {
+            const size_t per_block = sizeof(T) < 512 ? 512 / sizeof(T) : 1;
+            return (count / per_block + 1) * per_block * sizeof(T);
+        }
+
+        /**
+         * The estimated bytes each std::map node needs besides its element: a color, and parent, left and right links.
+         */
+        const size_t MAP_NODE_OVERHEAD = 4 * sizeof(void*);
+    }
+    /// \endcond IGNORE
+}
+
+#endif //ABRAHAM_CONTAINERSTATS_HPP
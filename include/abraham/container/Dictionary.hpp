@@ -7,7 +7,9 @@
 
 #include <map>
 #include <unordered_map>
+#include <utility>
 #include "Array.hpp"
+#include "ContainerStats.hpp"
 
 
 namespace abraham {
@@ -18,7 +20,7 @@ namespace abraham {
      * @tparam V - The value type of the Dictionary.
      */
     template<typename K, typename V>
-    class Dictionary {
+    class Dictionary : private details::ContainerTracker<ContainerType::DICTIONARY> {
     protected:
         /**
          * The internal std::map object that this class wraps.
@@ -35,6 +37,11 @@ namespace abraham {
          */
         V _defaultValue;
 
+        /**
+         * Reports the nodes of this Dictionary to ContainerStats. Does nothing unless ABRAHAM_CONTAINER_STATS is defined.
+         */
+        void updateStats();
+
     public:
         /**
          * Default constructor that creates an empty Dictionary.
@@ -150,6 +157,11 @@ namespace abraham {
          */
         bool isEmpty() const;
 
+        /**
+         * @return A hash of the key/value pairs in key order, combined from the keys' and values' Hash.
+         */
+        size_t hash() const;
+
         /**
          * @return true if a default value has been set; false otherwise.
          */
@@ -297,6 +309,7 @@ namespace abraham {
     Dictionary<K, V>::Dictionary(const std::map<K, V>& map) {
         this->_data = map;
         this->_hasDefault = false;
+        this->updateStats();
     }
 
     template<typename K, typename V>
@@ -305,49 +318,63 @@ namespace abraham {
             this->_data[it->first] = it->second;
         }
         this->_hasDefault = false;
+        this->updateStats();
     }
 
     template<typename K, typename V>
-    Dictionary<K, V>::Dictionary(const Dictionary<K, V>& dictionary) {
+    Dictionary<K, V>::Dictionary(const Dictionary<K, V>& dictionary)
+            : details::ContainerTracker<ContainerType::DICTIONARY>() {
         this->_data = dictionary._data;
         this->_hasDefault = dictionary._hasDefault;
         this->_defaultValue = dictionary._defaultValue;
+        this->recordCopy();
+        this->updateStats();
     }
 
     template<typename K, typename V>
     Dictionary<K, V>::Dictionary(Dictionary<K, V>&& dictionary) noexcept {
-        this->_data = dictionary._data;
+        this->_data = std::move(dictionary._data);
         this->_hasDefault = dictionary._hasDefault;
-        this->_defaultValue = dictionary._defaultValue;
+        this->_defaultValue = std::move(dictionary._defaultValue);
+        this->recordMove();
+        this->updateStats();
+        dictionary.updateStats();
     }
 
     template<typename K, typename V>
     Dictionary<K, V>::Dictionary(std::initializer_list<std::pair<const K, V>> i_list) {
         this->_data = i_list;
         this->_hasDefault = false;
+        this->updateStats();
     }
 
     template<typename K, typename V>
     V& Dictionary<K, V>::operator[](const K& key) {
         if (this->_hasDefault && !this->containsKey(key)) {
             this->_data[key] = this->_defaultValue;
-            return this->_data[key];
-        } else {
-            return this->_data[key];
         }
+
+        V& value = this->_data[key];
+        this->updateStats();
+        return value;
     }
 
     template<typename K, typename V>
     Dictionary<K, V>& Dictionary<K, V>::operator=(const Dictionary<K, V>& dictionary) {
         if (this == &dictionary) return *this;
         this->_data = dictionary._data;
+        this->recordCopy();
+        this->updateStats();
         return *this;
     }
 
     template<typename K, typename V>
     Dictionary<K, V>& Dictionary<K, V>::operator=(Dictionary<K, V>&& dictionary) noexcept {
         if (this == &dictionary) return *this;
-        this->_data = dictionary._data;
+        this->_data = std::move(dictionary._data);
+        this->recordMove();
+        this->updateStats();
+        dictionary.updateStats();
         return *this;
     }
 
@@ -367,6 +394,7 @@ namespace abraham {
             this->_data[it.first] = it.second;
         }
 
+        this->updateStats();
         return *this;
     }
 
@@ -404,6 +432,17 @@ namespace abraham {
         return this->_data.size() == 0;
     }
 
+    template<typename K, typename V>
+    size_t Dictionary<K, V>::hash() const {
+        uint64_t hash = Hasher::hashInteger(this->_data.size());
+        for (const std::pair<const K, V>& pair : this->_data) {
+            hash = Hasher::combine(hash, Hash<K>()(pair.first));
+            hash = Hasher::combine(hash, Hash<V>()(pair.second));
+        }
+
+        return static_cast<size_t>(hash);
+    }
+
     template<typename K, typename V>
     bool Dictionary<K, V>::hasDefaultValue() const {
         return this->_hasDefault;
@@ -453,6 +492,7 @@ namespace abraham {
     Dictionary<K, V>& Dictionary<K, V>::addObject(const K& key, const V& value) {
         if (this->_data.count(key) == 0) {
             this->_data[key] = value;
+            this->updateStats();
             return *this;
         } else {
             throw InvalidArgumentException("Key already exists");
@@ -463,6 +503,7 @@ namespace abraham {
     template<typename K, typename V>
     Dictionary<K, V>& Dictionary<K, V>::remove(const K& key) {
         this->_data.erase(key);
+        this->updateStats();
         return *this;
     }
 
@@ -472,12 +513,14 @@ namespace abraham {
             this->_data.erase(key);
         }
 
+        this->updateStats();
         return *this;
     }
 
     template<typename K, typename V>
     Dictionary<K, V>& Dictionary<K, V>::removeAll() {
         this->_data.clear();
+        this->updateStats();
         return *this;
     }
 
@@ -558,6 +601,19 @@ namespace abraham {
     typename std::map<K, V>::const_iterator Dictionary<K, V>::cend() const {
         return this->_data.cend();
     }
+
+    template<typename K, typename V>
+    void Dictionary<K, V>::updateStats() {
+        this->recordNodes(this->_data.size(), sizeof(std::pair<const K, V>) + details::MAP_NODE_OVERHEAD,
+                          sizeof(std::pair<const K, V>));
+    }
+
+    template<typename K, typename V>
+    struct Hash<Dictionary<K, V>> {
+        size_t operator()(const Dictionary<K, V>& dictionary) const {
+            return dictionary.hash();
+        }
+    };
 }
 
 #endif //ABRAHAM_DICTIONARY_HPP
@@ -0,0 +1,138 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_FUZZYMATCHER_HPP
+#define ABRAHAM_FUZZYMATCHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Array.hpp"
+#include "String.hpp"
+#include "StringTable.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Compares one query against many strings by Levenshtein distance: the fewest single character insertions,
+     * deletions and substitutions that turn one into the other. Characters are bytes, as String's length is.
+     *
+     * Distances are computed with Myers' bit-parallel algorithm, which keeps a column of the edit distance table in
+     * the bits of machine words and advances it by one character of the other string with a handful of word
+     * operations. The bit masks it needs depend only on the query, so they are built once when the FuzzyMatcher is
+     * created. Queries longer than 64 characters span several words, and bounded comparisons only compute the words
+     * that overlap the band of the table a match within the bound could pass through.
+     *
+     * Example:
+     *     FuzzyMatcher matcher = FuzzyMatcher("kitten");
+     *     matcher.distance("sitting");                      // 3
+     *     matcher.findWithin(names, 2);                     // The indexes of the names within 2 edits
+     */
+    class FuzzyMatcher {
+    protected:
+        /**
+         * A copy of the query, so the FuzzyMatcher doesn't depend on the query's lifetime.
+         */
+        std::string _query;
+
+        /**
+         * The number of 64 bit words a column of the query spans.
+         */
+        size_t _wordCount;
+
+        /**
+         * For each byte, the positions it occurs at in the query, one bit per position. The words for byte c are
+         * [c * _wordCount, (c + 1) * _wordCount).
+         */
+        std::vector<uint64_t> _masks;
+
+    public:
+        /**
+         * Value for an unbounded distance.
+         */
+        static const size_t NO_LIMIT;
+
+        /**
+         * Constructor that creates a FuzzyMatcher for a query.
+         * @param query - The characters to compare against.
+         */
+        explicit FuzzyMatcher(const StringView& query);
+
+        /**
+         * @param text - The characters to compare the query to.
+         * @return The edit distance between the query and the text.
+         */
+        size_t distance(const StringView& text) const;
+
+        /**
+         * Computes the edit distance, stopping as soon as it must be more than a limit.
+         * @param text - The characters to compare the query to.
+         * @param max_distance - The largest distance of interest.
+         * @return The edit distance if it is at most max_distance; max_distance + 1 otherwise.
+         */
+        size_t distance(const StringView& text, size_t max_distance) const;
+
+        /**
+         * @param text - The characters to compare the query to.
+         * @param max_distance - The largest distance allowed.
+         * @return true if the edit distance is at most max_distance; false otherwise.
+         */
+        bool withinDistance(const StringView& text, size_t max_distance) const;
+
+        /**
+         * Computes the edit distance to every string, splitting the strings between threads.
+         * @param texts - The strings to compare the query to.
+         * @param thread_count - The most threads to use. 0 uses one per hardware thread. Default = 0.
+         * @return The edit distance to each string, in the same order.
+         */
+        Array<size_t> distances(const Array<String>& texts, size_t thread_count = 0) const;
+
+        /**
+         * Computes the edit distance to every string, splitting the strings between threads.
+         * @param texts - The strings to compare the query to.
+         * @param thread_count - The most threads to use. 0 uses one per hardware thread. Default = 0.
+         * @return The edit distance to each string, in the same order.
+         */
+        Array<size_t> distances(const StringTable& texts, size_t thread_count = 0) const;
+
+        /**
+         * Finds the strings within a distance of the query, splitting the strings between threads.
+         * @param texts - The strings to compare the query to.
+         * @param max_distance - The largest distance allowed.
+         * @param thread_count - The most threads to use. 0 uses one per hardware thread. Default = 0.
+         * @return The indexes of the strings within max_distance, in ascending order.
+         */
+        Array<size_t> findWithin(const Array<String>& texts, size_t max_distance, size_t thread_count = 0) const;
+
+        /**
+         * Finds the strings within a distance of the query, splitting the strings between threads.
+         * @param texts - The strings to compare the query to.
+         * @param max_distance - The largest distance allowed.
+         * @param thread_count - The most threads to use. 0 uses one per hardware thread. Default = 0.
+         * @return The indexes of the strings within max_distance, in ascending order.
+         */
+        Array<size_t> findWithin(const StringTable& texts, size_t max_distance, size_t thread_count = 0) const;
+
+        /**
+         * @return A view of the query.
+         */
+        StringView query() const;
+
+        /**
+         * Computes the edit distance between two strings without a FuzzyMatcher. The shorter string is used as the
+         * query, after any prefix and suffix the two share is removed.
+         * @param first - The characters of one string.
+         * @param second - The characters of the other string.
+         * @param max_distance - The largest distance of interest. Default = NO_LIMIT.
+         * @return The edit distance if it is at most max_distance; max_distance + 1 otherwise.
+         */
+        static size_t distanceBetween(const StringView& first, const StringView& second,
+                                      size_t max_distance = NO_LIMIT);
+    };
+}
+
+#endif //ABRAHAM_FUZZYMATCHER_HPP
@@ -0,0 +1,1571 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_INLINESTRING_HPP
+#define ABRAHAM_INLINESTRING_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "Ascii.hpp"
+#include "CharSet.hpp"
+#include "Exception.hpp"
+#include "Hash.hpp"
+#include "NumberFormatter.hpp"
+#include "NumberParser.hpp"
+#include "String.hpp"
+
+
+namespace abraham {
+
+    /**
+     * What an InlineString does when it's asked to hold more bytes than fit inline.
+     */
+    enum class InlineStringOverflow {
+        /**
+         * Keep the first N bytes and drop the rest. The InlineString never allocates.
+         */
+        TRUNCATE,
+
+        /**
+         * Move the contents to a heap buffer, like String does.
+         */
+        SPILL
+    };
+
+    /// \cond IGNORE
+    namespace details {
+        /**
+         * Converts a C string the way std::stold does, throwing an InvalidValueException on failure.
+         */
+        long double inlineStringToLongDouble(const char* cstring);
+    }
+    /// \endcond IGNORE
+
+
+    /**
+     * A String with room for N bytes inside the object itself, so short values such as log fields, metric names and
+     * IDs never touch the heap. The API mirrors String, and it converts to and from String with a single copy.
+     *
+     * When more than N bytes are needed the overflow policy decides what happens: SPILL (the default) moves the
+     * contents to the heap, and TRUNCATE keeps the first N bytes.
+     *
+     * @tparam N - The number of bytes stored inline, not including the terminating null.
+     * @tparam POLICY - What to do when the contents don't fit inline.
+     */
+    template<size_t N, InlineStringOverflow POLICY = InlineStringOverflow::SPILL>
+    class InlineString {
+    protected:
+        /**
+         * The inline buffer. Always null terminated while the contents are inline.
+         */
+        char _inline[N + 1];
+
+        /**
+         * The number of bytes in the InlineString.
+         */
+        size_t _length;
+
+        /**
+         * The heap buffer the contents spilled to, or nullptr while they're inline.
+         */
+        char* _heap;
+
+        /**
+         * The number of bytes the heap buffer holds, not including the terminating null.
+         */
+        size_t _heapCapacity;
+
+        /**
+         * @return The buffer currently holding the contents.
+         */
+        char* data();
+
+        /**
+         * Makes room for a number of bytes, spilling to the heap if the policy allows it.
+         * @param length - The number of bytes needed.
+         * @return The number of bytes that can be stored, which is less than length only when truncating.
+         */
+        size_t reserve(size_t length);
+
+        /**
+         * Replaces a range of the InlineString with other bytes. Every mutating function is built on this.
+         * @param index - The index the range starts at.
+         * @param count - The number of bytes to remove.
+         * @param bytes - The bytes to insert in their place.
+         * @param length - The number of bytes to insert.
+         */
+        void splice(size_t index, size_t count, const char* bytes, size_t length);
+
+        /**
+         * Inserts a byte string repeated a number of times, moving the bytes after the index only once.
+         * @param index - The index to insert at.
+         * @param bytes - The bytes to repeat.
+         * @param length - The number of bytes to repeat.
+         * @param count - The number of times to repeat them.
+         */
+        void spliceRepeated(size_t index, const char* bytes, size_t length, size_t count);
+
+        /**
+         * Finds a byte string in the InlineString.
+         * @param bytes - The bytes to find.
+         * @param length - The number of bytes to find.
+         * @param min_index - The index to start searching from.
+         * @return The index of the first occurrence at or after min_index. NO_INDEX if there isn't one.
+         */
+        size_t find(const char* bytes, size_t length, size_t min_index) const;
+
+        /**
+         * Finds the last occurrence of a byte string that starts at or before max_index.
+         * @param bytes - The bytes to find.
+         * @param length - The number of bytes to find.
+         * @param max_index - The last index an occurrence may start at.
+         * @return The index of the last occurrence. NO_INDEX if there isn't one.
+         */
+        size_t findLast(const char* bytes, size_t length, size_t max_index) const;
+
+    public:
+        /**
+         * Default constructor that creates an empty InlineString.
+         */
+        InlineString();
+
+        /**
+         * Constructor that creates an InlineString with a character value.
+         * @param character - The character the InlineString is constructed from.
+         */
+        InlineString(char character);
+
+        /**
+         * Constructor that creates an InlineString from a C style string.
+         * @param cstring - The C string the InlineString is constructed from.
+         */
+        InlineString(const char* cstring);
+
+        /**
+         * Constructor that creates an InlineString from a byte range.
+         * @param bytes - The bytes the InlineString is constructed from.
+         * @param length - The number of bytes.
+         */
+        InlineString(const char* bytes, size_t length);
+
+        /**
+         * Constructor that creates an InlineString from a std::string.
+         * @param string - The std::string the InlineString is constructed from.
+         */
+        InlineString(const std::string& string);
+
+        /**
+         * Constructor that creates an InlineString from a String.
+         * @param string - The String the InlineString is constructed from.
+         */
+        InlineString(const String& string);
+
+        /**
+         * Copy constructor.
+         * @param string - The InlineString to copy.
+         */
+        InlineString(const InlineString& string);
+
+        /**
+         * Move constructor. Takes over the heap buffer of a spilled InlineString.
+         * @param string - The InlineString to move.
+         */
+        InlineString(InlineString&& string) noexcept;
+
+        /**
+         * Destructor that releases the heap buffer, if any.
+         */
+        ~InlineString();
+
+        /**
+         * @param index - The index of the character.
+         * @return A reference to the character at the index.
+         */
+        char& operator[](size_t index);
+
+        /**
+         * Copy assignment.
+         * @param string - The InlineString to copy.
+         * @return A self reference.
+         */
+        InlineString& operator=(const InlineString& string);
+
+        /**
+         * Move assignment.
+         * @param string - The InlineString to move.
+         * @return A self reference.
+         */
+        InlineString& operator=(InlineString&& string) noexcept;
+
+        /**
+         * @param string - The InlineString to append.
+         * @return A new InlineString of this one followed by the other.
+         */
+        const InlineString operator+(const InlineString& string) const;
+
+        /**
+         * @param string - The InlineString to append.
+         * @return A self reference.
+         */
+        InlineString& operator+=(const InlineString& string);
+
+        /**
+         * Operator overload to check the equality of two InlineString objects using the '==' operator.
+         * @param string - The value to compare this InlineString to.
+         * @return true if the two InlineString objects are equal in value; false otherwise.
+         */
+        bool operator==(const InlineString& string) const;
+
+        /**
+         * Operator overload to check the inequality of two InlineString objects using the '!=' operator.
+         * @param string - The value to compare this InlineString to.
+         * @return true if the two InlineString objects are not equal in value; false otherwise.
+         */
+        bool operator!=(const InlineString& string) const;
+
+        /**
+         * Operator overload to check the lexicographical order of two InlineString objects using the '<' operator.
+         * @param string - The value to compare this InlineString to.
+         * @return true if this InlineString is lexicographically less than the provided one; false otherwise.
+         */
+        bool operator<(const InlineString& string) const;
+
+        /**
+         * Operator overload to check the lexicographical order of two InlineString objects using the '>' operator.
+         * @param string - The value to compare this InlineString to.
+         * @return true if this InlineString is lexicographically greater than the provided one; false otherwise.
+         */
+        bool operator>(const InlineString& string) const;
+
+        /**
+         * Operator overload to check the lexicographical order of two InlineString objects using the '<=' operator.
+         * @param string - The value to compare this InlineString to.
+         * @return true if this InlineString is lexicographically less than or equal to the provided one; false
+         * otherwise.
+         */
+        bool operator<=(const InlineString& string) const;
+
+        /**
+         * Operator overload to check the lexicographical order of two InlineString objects using the '>=' operator.
+         * @param string - The value to compare this InlineString to.
+         * @return true if this InlineString is lexicographically greater than or equal to the provided one; false
+         * otherwise.
+         */
+        bool operator>=(const InlineString& string) const;
+
+        /**
+         * @return The number of bytes in the InlineString.
+         */
+        size_t length() const;
+
+        /**
+         * @return A hash of the bytes, equal to the hash of a String or StringView holding them.
+         */
+        size_t hash() const;
+
+        /**
+         * @return The number of bytes the InlineString can hold without allocating.
+         */
+        size_t capacity() const;
+
+        /**
+         * @return true if the contents are stored inline; false if they spilled to the heap.
+         */
+        bool isInline() const;
+
+        /**
+         * @param index - The index of the character.
+         * @return The character at the index.
+         */
+        char characterAtIndex(size_t index) const;
+
+        /**
+         * @param c - The new character.
+         * @param index - The index of the character to set.
+         * @return A self reference.
+         */
+        InlineString& setCharacterAtIndex(char c, size_t index);
+
+        /**
+         * Replaces the contents of the InlineString.
+         * @param string - The new value.
+         * @return A self reference.
+         */
+        InlineString& setValue(const InlineString& string);
+
+        /**
+         * @return A self reference, with every character converted to lowercase.
+         */
+        InlineString& toLowerCase();
+
+        /**
+         * @return A self reference, with every character converted to uppercase.
+         */
+        InlineString& toUpperCase();
+
+        /**
+         * @return A self reference, with the first character of each word converted to uppercase.
+         */
+        InlineString& toCapitalCase();
+
+        /**
+         * @return A self reference, with the case of every character swapped.
+         */
+        InlineString& swapCase();
+
+        /**
+         * @param string - The InlineString to append.
+         * @return A self reference.
+         */
+        InlineString& append(const InlineString& string);
+
+        /**
+         * @param bytes - The bytes to append.
+         * @param length - The number of bytes to append.
+         * @return A self reference.
+         */
+        InlineString& append(const char* bytes, size_t length);
+
+        /**
+         * @param c - The character to append.
+         * @return A self reference.
+         */
+        InlineString& append(char c);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        InlineString& append(int value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        InlineString& append(long value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        InlineString& append(long long value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        InlineString& append(unsigned value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        InlineString& append(unsigned long value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        InlineString& append(unsigned long long value);
+
+        /**
+         * Appends the shortest decimal representation that reads back as the same number, as NumberFormatter
+         * writes it.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        InlineString& append(float value);
+
+        /**
+         * Appends the shortest decimal representation that reads back as the same number, as NumberFormatter
+         * writes it.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        InlineString& append(double value);
+
+        /**
+         * @param from_index - The index the substring starts at.
+         * @param to_index - The index the substring ends before.
+         * @return The substring.
+         */
+        InlineString substring(size_t from_index, size_t to_index) const;
+
+        /**
+         * @param index - The index the substring starts at.
+         * @return The substring from the index to the end.
+         */
+        InlineString substringFromIndex(size_t index) const;
+
+        /**
+         * @param index - The index the substring ends before.
+         * @return The substring from the start to the index.
+         */
+        InlineString substringToIndex(size_t index) const;
+
+        /**
+         * Splits the InlineString on a delimiter. An empty delimiter splits it into characters.
+         * @param delimiter - The delimiter to split on.
+         * @return The parts between the delimiters.
+         */
+        std::vector<InlineString> split(const InlineString& delimiter) const;
+
+        /**
+         * @param string - The InlineString to insert.
+         * @param index - The index to insert it at.
+         * @return A self reference.
+         */
+        InlineString& insert(const InlineString& string, size_t index);
+
+        /**
+         * @param characters - The characters to remove from both ends.
+         * @return A self reference.
+         */
+        InlineString& trim(const char* characters = " \t\r\n\v\f");
+
+        /**
+         * @param characters - The set of characters to remove from both ends.
+         * @return A self reference.
+         */
+        InlineString& trim(const CharSet& characters);
+
+        /**
+         * @param characters - The characters to remove from the start.
+         * @return A self reference.
+         */
+        InlineString& trimLeading(const char* characters = " \t\r\n\v\f");
+
+        /**
+         * @param characters - The set of characters to remove from the start.
+         * @return A self reference.
+         */
+        InlineString& trimLeading(const CharSet& characters);
+
+        /**
+         * @param characters - The characters to remove from the end.
+         * @return A self reference.
+         */
+        InlineString& trimTrailing(const char* characters = " \t\r\n\v\f");
+
+        /**
+         * @param characters - The set of characters to remove from the end.
+         * @return A self reference.
+         */
+        InlineString& trimTrailing(const CharSet& characters);
+
+        /**
+         * @return A self reference, with the characters in reverse order.
+         */
+        InlineString& reverse();
+
+        /**
+         * @param string - The InlineString to pad with.
+         * @param count - The number of times to add it on each side.
+         * @return A self reference.
+         */
+        InlineString& pad(const InlineString& string, size_t count);
+
+        /**
+         * @param string - The InlineString to pad with.
+         * @param count - The number of times to add it on the left.
+         * @return A self reference.
+         */
+        InlineString& padLeft(const InlineString& string, size_t count);
+
+        /**
+         * @param string - The InlineString to pad with.
+         * @param count - The number of times to add it on the right.
+         * @return A self reference.
+         */
+        InlineString& padRight(const InlineString& string, size_t count);
+
+        /**
+         * @param old_string - The InlineString to replace the first occurrence of.
+         * @param new_string - The InlineString to replace it with.
+         * @return A self reference.
+         */
+        InlineString& replace(const InlineString& old_string, const InlineString& new_string);
+
+        /**
+         * @param old_string - The InlineString to replace the last occurrence of.
+         * @param new_string - The InlineString to replace it with.
+         * @return A self reference.
+         */
+        InlineString& replaceLast(const InlineString& old_string, const InlineString& new_string);
+
+        /**
+         * @param old_string - The InlineString to replace every occurrence of.
+         * @param new_string - The InlineString to replace it with.
+         * @return A self reference.
+         */
+        InlineString& replaceAll(const InlineString& old_string, const InlineString& new_string);
+
+        /**
+         * @param string - The InlineString to remove the first occurrence of.
+         * @return A self reference.
+         */
+        InlineString& remove(const InlineString& string);
+
+        /**
+         * @param string - The InlineString to remove the last occurrence of.
+         * @return A self reference.
+         */
+        InlineString& removeLast(const InlineString& string);
+
+        /**
+         * @param string - The InlineString to remove every occurrence of.
+         * @return A self reference.
+         */
+        InlineString& removeAll(const InlineString& string);
+
+        /**
+         * @param from_index - The index the range starts at.
+         * @param to_index - The index the range ends before.
+         * @return A self reference.
+         */
+        InlineString& removeRange(size_t from_index, size_t to_index);
+
+        /**
+         * @param characters - The characters to remove.
+         * @return A self reference.
+         */
+        InlineString& removeCharacters(const char* characters);
+
+        /**
+         * @param characters - The set of characters to remove.
+         * @return A self reference.
+         */
+        InlineString& removeCharacters(const CharSet& characters);
+
+        /**
+         * @param string - The InlineString to find.
+         * @return true if the InlineString contains the other; false otherwise.
+         */
+        bool contains(const InlineString& string) const;
+
+        /**
+         * @param string - The InlineString to find.
+         * @return The index of the first occurrence. NO_INDEX if there isn't one.
+         */
+        size_t indexOf(const InlineString& string) const;
+
+        /**
+         * @param string - The InlineString to find.
+         * @param min_index - The index to start searching from.
+         * @return The index of the first occurrence at or after min_index. NO_INDEX if there isn't one.
+         */
+        size_t indexOf(const InlineString& string, size_t min_index) const;
+
+        /**
+         * @param string - The InlineString to find.
+         * @return The index of the last occurrence. NO_INDEX if there isn't one.
+         */
+        size_t indexOfLast(const InlineString& string) const;
+
+        /**
+         * @param string - The InlineString to find.
+         * @param max_index - The last index an occurrence may start at.
+         * @return The index of the last occurrence at or before max_index. NO_INDEX if there isn't one.
+         */
+        size_t indexOfLast(const InlineString& string, size_t max_index) const;
+
+        /**
+         * @param string - The InlineString to compare with.
+         * @param case_sensitive - Whether case is significant.
+         * @return true if the contents are equal; false otherwise.
+         */
+        bool isEqualTo(const InlineString& string, bool case_sensitive = true) const;
+
+        /**
+         * @param string - The InlineString to compare with.
+         * @param case_sensitive - Whether case is significant.
+         * @return A negative value, zero or a positive value as this sorts before, with or after the other.
+         */
+        int compare(const InlineString& string, bool case_sensitive = true) const;
+
+        /**
+         * Get the integer value of the number represented in the InlineString. An exception is thrown if the value
+         * isn't valid.
+         * @return The integer value represented in the InlineString.
+         */
+        int intValue() const;
+
+        /**
+         * Get the long value of the number represented in the InlineString. An exception is thrown if the value
+         * isn't valid.
+         * @return The long value represented in the InlineString.
+         */
+        long longValue() const;
+
+        /**
+         * Get the long long value of the number represented in the InlineString. An exception is thrown if the value
+         * isn't valid.
+         * @return The long long value represented in the InlineString.
+         */
+        long long longLongValue() const;
+
+        /**
+         * Get the unsigned value of the number represented in the InlineString. An exception is thrown if the value
+         * isn't valid.
+         * @return The unsigned value represented in the InlineString.
+         */
+        unsigned unsignedValue() const;
+
+        /**
+         * Get the unsigned long value of the number represented in the InlineString. An exception is thrown if the
+         * value isn't valid.
+         * @return The unsigned long value represented in the InlineString.
+         */
+        unsigned long unsignedLongValue() const;
+
+        /**
+         * Get the unsigned long long value of the number represented in the InlineString. An exception is thrown if the
+         * value isn't valid.
+         * @return The unsigned long long value represented in the InlineString.
+         */
+        unsigned long long unsignedLongLongValue() const;
+
+        /**
+         * Get the float value of the number represented in the InlineString. An exception is thrown if the value
+         * isn't valid.
+         * @return The float value represented in the InlineString.
+         */
+        float floatValue() const;
+
+        /**
+         * Get the double value of the number represented in the InlineString. An exception is thrown if the value
+         * isn't valid.
+         * @return The double value represented in the InlineString.
+         */
+        double doubleValue() const;
+
+        /**
+         * Get the long double value of the number represented in the InlineString. An exception is thrown if the value
+         * isn't valid.
+         * @return The long double value represented in the InlineString.
+         */
+        long double longDoubleValue() const;
+
+        /**
+         * Get the bool value represented in the InlineString. An exception is thrown if the value isn't valid.
+         * Valid values are: true, false, yes, no, n, y, 0, 1. Values are not case sensitive.
+         * @return The bool value represented in the InlineString.
+         */
+        bool boolValue() const;
+
+        /**
+         * Get the integer value of the number represented in the InlineString without throwing.
+         * @param value - Set to the integer value if the InlineString value is valid. Left unchanged otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryIntValue(int& value) const;
+
+        /**
+         * Get the long value of the number represented in the InlineString without throwing.
+         * @param value - Set to the long value if the InlineString value is valid. Left unchanged otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryLongValue(long& value) const;
+
+        /**
+         * Get the long long value of the number represented in the InlineString without throwing.
+         * @param value - Set to the long long value if the InlineString value is valid. Left unchanged otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryLongLongValue(long long& value) const;
+
+        /**
+         * Get the unsigned value of the number represented in the InlineString without throwing.
+         * @param value - Set to the unsigned value if the InlineString value is valid. Left unchanged otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryUnsignedValue(unsigned& value) const;
+
+        /**
+         * Get the unsigned long value of the number represented in the InlineString without throwing.
+         * @param value - Set to the unsigned long value if the InlineString value is valid. Left unchanged otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryUnsignedLongValue(unsigned long& value) const;
+
+        /**
+         * Get the unsigned long long value of the number represented in the InlineString without throwing.
+         * @param value - Set to the unsigned long long value if the InlineString value is valid. Left unchanged
+         * otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryUnsignedLongLongValue(unsigned long long& value) const;
+
+        /**
+         * Get the float value of the number represented in the InlineString without throwing.
+         * @param value - Set to the float value if the InlineString value is valid. Left unchanged otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryFloatValue(float& value) const;
+
+        /**
+         * Get the double value of the number represented in the InlineString without throwing.
+         * @param value - Set to the double value if the InlineString value is valid. Left unchanged otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryDoubleValue(double& value) const;
+
+        /**
+         * Get the bool value represented in the InlineString without throwing.
+         * @param value - Set to the bool value if the InlineString value is valid. Left unchanged otherwise.
+         * @return true if the InlineString value is valid; false otherwise.
+         */
+        bool tryBoolValue(bool& value) const;
+
+        /**
+         * @return A copy of the InlineString.
+         */
+        InlineString copy() const;
+
+        /**
+         * @return A String with the same contents.
+         */
+        String string() const;
+
+        /**
+         * @return A null terminated C string of the contents.
+         */
+        const char* c_string() const;
+
+        /**
+         * @return A std::string with the same contents.
+         */
+        std::string std_string() const;
+
+        /**
+         * @return Iterator to the first character.
+         */
+        char* begin();
+
+        /**
+         * @return Iterator past the last character.
+         */
+        char* end();
+
+        /**
+         * @return Const iterator to the first character.
+         */
+        const char* begin() const;
+
+        /**
+         * @return Const iterator past the last character.
+         */
+        const char* end() const;
+
+        /**
+         * Value representing a non-existent index.
+         */
+        static const size_t NO_INDEX = static_cast<size_t>(-1);
+    };
+
+
+/*
+ * Template Implementation
+ */
+
+    // Protected
+
+    template<size_t N, InlineStringOverflow POLICY>
+    char* InlineString<N, POLICY>::data() {
+        return this->_heap != nullptr ? this->_heap : this->_inline;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::reserve(size_t length) {
+        if (length <= this->capacity()) return length;
+        if (POLICY == InlineStringOverflow::TRUNCATE) return N;
+
+        size_t capacity = std::max(length, this->capacity() * 2);
+        char* heap = new char[capacity + 1];
+        std::memcpy(heap, this->c_string(), this->_length + 1);
+        delete[] this->_heap;
+        this->_heap = heap;
+        this->_heapCapacity = capacity;
+        return length;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    void InlineString<N, POLICY>::splice(size_t index, size_t count, const char* bytes, size_t length) {
+        // Inserting part of this InlineString into itself: copy it out before the buffer moves
+        const char* current = this->c_string();
+        if (length > 0 && bytes >= current && bytes <= current + this->_length) {
+            std::string buffer = std::string(bytes, length);
+            this->splice(index, count, buffer.data(), buffer.size());
+            return;
+        }
+
+        const size_t tail = this->_length - index - count;
+        const size_t allowed = this->reserve(this->_length - count + length);
+        const size_t keep_bytes = std::min(length, allowed - index);
+        const size_t keep_tail = std::min(tail, allowed - index - keep_bytes);
+
+        char* buffer = this->data();
+        std::memmove(buffer + index + keep_bytes, buffer + index + count, keep_tail);
+        if (keep_bytes > 0) {
+            std::memcpy(buffer + index, bytes, keep_bytes);
+        }
+        this->_length = index + keep_bytes + keep_tail;
+        buffer[this->_length] = '\0';
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    void InlineString<N, POLICY>::spliceRepeated(size_t index, const char* bytes, size_t length, size_t count) {
+        if (length == 0 || count == 0) return;
+
+        const char* current = this->c_string();
+        if (bytes >= current && bytes <= current + this->_length) {
+            std::string buffer = std::string(bytes, length);
+            this->spliceRepeated(index, buffer.data(), length, count);
+            return;
+        }
+
+        const size_t total = length * count;
+        const size_t tail = this->_length - index;
+        const size_t allowed = this->reserve(this->_length + total);
+        const size_t keep_bytes = std::min(total, allowed - index);
+        const size_t keep_tail = std::min(tail, allowed - index - keep_bytes);
+
+        char* buffer = this->data();
+        std::memmove(buffer + index + keep_bytes, buffer + index, keep_tail);
+        for (size_t offset = 0; offset < keep_bytes; offset += length) {
+            std::memcpy(buffer + index + offset, bytes, std::min(length, keep_bytes - offset));
+        }
+        this->_length = index + keep_bytes + keep_tail;
+        buffer[this->_length] = '\0';
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::find(const char* bytes, size_t length, size_t min_index) const {
+        if (min_index > this->_length || length > this->_length - min_index) return NO_INDEX;
+        if (length == 0) return min_index;
+
+        const char* begin = this->c_string();
+        const char* end = begin + this->_length;
+        const char* found = std::search(begin + min_index, end, bytes, bytes + length);
+        return found == end ? NO_INDEX : static_cast<size_t>(found - begin);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::findLast(const char* bytes, size_t length, size_t max_index) const {
+        if (length > this->_length) return NO_INDEX;
+
+        size_t index = std::min(max_index, this->_length - length);
+        const char* begin = this->c_string();
+        while (true) {
+            if (std::memcmp(begin + index, bytes, length) == 0) return index;
+            if (index == 0) return NO_INDEX;
+            --index;
+        }
+    }
+
+    // Constructors
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::InlineString() : _length(0), _heap(nullptr), _heapCapacity(0) {
+        this->_inline[0] = '\0';
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::InlineString(char character) : InlineString() {
+        this->splice(0, 0, &character, 1);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::InlineString(const char* cstring) : InlineString() {
+        this->splice(0, 0, cstring, std::strlen(cstring));
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::InlineString(const char* bytes, size_t length) : InlineString() {
+        this->splice(0, 0, bytes, length);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::InlineString(const std::string& string) : InlineString() {
+        this->splice(0, 0, string.data(), string.length());
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::InlineString(const String& string) : InlineString() {
+        this->splice(0, 0, string.c_string(), string.length());
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::InlineString(const InlineString& string) : InlineString() {
+        this->splice(0, 0, string.c_string(), string._length);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::InlineString(InlineString&& string) noexcept : InlineString() {
+        if (string._heap != nullptr) {
+            this->_heap = string._heap;
+            this->_heapCapacity = string._heapCapacity;
+            this->_length = string._length;
+            string._heap = nullptr;
+            string._heapCapacity = 0;
+            string._length = 0;
+            string._inline[0] = '\0';
+        } else {
+            std::memcpy(this->_inline, string._inline, string._length + 1);
+            this->_length = string._length;
+        }
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>::~InlineString() {
+        delete[] this->_heap;
+    }
+
+    // Operators
+
+    template<size_t N, InlineStringOverflow POLICY>
+    char& InlineString<N, POLICY>::operator[](size_t index) {
+        if (index < this->_length) {
+            return this->data()[index];
+        } else {
+            throw OutOfBoundsException(index);
+        }
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::operator=(const InlineString& string) {
+        if (this == &string) return *this;
+        this->splice(0, this->_length, string.c_string(), string._length);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::operator=(InlineString&& string) noexcept {
+        if (this == &string) return *this;
+        if (string._heap != nullptr) {
+            delete[] this->_heap;
+            this->_heap = string._heap;
+            this->_heapCapacity = string._heapCapacity;
+            this->_length = string._length;
+            string._heap = nullptr;
+            string._heapCapacity = 0;
+            string._length = 0;
+            string._inline[0] = '\0';
+        } else {
+            this->splice(0, this->_length, string._inline, string._length);
+        }
+
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    const InlineString<N, POLICY> InlineString<N, POLICY>::operator+(const InlineString& string) const {
+        InlineString result = *this;
+        result.append(string);
+        return result;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::operator+=(const InlineString& string) {
+        return this->append(string);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::operator==(const InlineString& string) const {
+        return this->_length == string._length && std::memcmp(this->c_string(), string.c_string(), this->_length) == 0;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::operator!=(const InlineString& string) const {
+        return !(*this == string);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::operator<(const InlineString& string) const {
+        return this->compare(string) < 0;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::operator>(const InlineString& string) const {
+        return this->compare(string) > 0;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::operator<=(const InlineString& string) const {
+        return this->compare(string) <= 0;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::operator>=(const InlineString& string) const {
+        return this->compare(string) >= 0;
+    }
+
+    // Properties
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::length() const {
+        return this->_length;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::hash() const {
+        return static_cast<size_t>(Hasher::hash(this->c_string(), this->_length));
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::capacity() const {
+        return this->_heap != nullptr ? this->_heapCapacity : N;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::isInline() const {
+        return this->_heap == nullptr;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    char InlineString<N, POLICY>::characterAtIndex(size_t index) const {
+        if (index < this->_length) {
+            return this->c_string()[index];
+        } else {
+            throw OutOfBoundsException(index);
+        }
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::setCharacterAtIndex(char c, size_t index) {
+        (*this)[index] = c;
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::setValue(const InlineString& string) {
+        return *this = string;
+    }
+
+    // Case
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::toLowerCase() {
+        Ascii::toLowerCase(this->data(), this->_length);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::toUpperCase() {
+        Ascii::toUpperCase(this->data(), this->_length);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::toCapitalCase() {
+        char* buffer = this->data();
+        for (size_t i = 0; i < this->_length; ++i) {
+            if (i == 0 || buffer[i - 1] == ' ') {
+                buffer[i] = Ascii::toUpperCase(buffer[i]);
+            }
+        }
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::swapCase() {
+        Ascii::swapCase(this->data(), this->_length);
+        return *this;
+    }
+
+    // Editing
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(const InlineString& string) {
+        this->splice(this->_length, 0, string.c_string(), string._length);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(const char* bytes, size_t length) {
+        this->splice(this->_length, 0, bytes, length);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(char c) {
+        this->splice(this->_length, 0, &c, 1);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(int value) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        this->splice(this->_length, 0, digits, NumberFormatter::format(value, digits));
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(long value) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        this->splice(this->_length, 0, digits, NumberFormatter::format(value, digits));
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(long long value) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        this->splice(this->_length, 0, digits, NumberFormatter::format(value, digits));
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(unsigned value) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        this->splice(this->_length, 0, digits, NumberFormatter::format(value, digits));
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(unsigned long value) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        this->splice(this->_length, 0, digits, NumberFormatter::format(value, digits));
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(unsigned long long value) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        this->splice(this->_length, 0, digits, NumberFormatter::format(value, digits));
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(float value) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        this->splice(this->_length, 0, digits, NumberFormatter::format(value, digits));
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::append(double value) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        this->splice(this->_length, 0, digits, NumberFormatter::format(value, digits));
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY> InlineString<N, POLICY>::substring(size_t from_index, size_t to_index) const {
+        if (from_index > to_index) throw InvalidArgumentException("from_index must be less than to_index");
+        if (to_index < this->_length) {
+            return InlineString(this->c_string() + from_index, to_index - from_index);
+        } else {
+            throw OutOfBoundsException(to_index);
+        }
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY> InlineString<N, POLICY>::substringFromIndex(size_t index) const {
+        if (index < this->_length) {
+            return InlineString(this->c_string() + index, this->_length - index);
+        } else {
+            throw OutOfBoundsException(index);
+        }
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY> InlineString<N, POLICY>::substringToIndex(size_t index) const {
+        if (index < this->_length) {
+            return InlineString(this->c_string(), index);
+        } else {
+            throw OutOfBoundsException(index);
+        }
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    std::vector<InlineString<N, POLICY>> InlineString<N, POLICY>::split(const InlineString& delimiter) const {
+        std::vector<InlineString> output;
+        const char* buffer = this->c_string();
+
+        if (delimiter._length == 0) {
+            for (size_t i = 0; i < this->_length; ++i) {
+                output.emplace_back(buffer[i]);
+            }
+
+            return output;
+        }
+
+        size_t element_begin = 0;
+        size_t element_end = 0;
+        while ((element_end = this->find(delimiter.c_string(), delimiter._length, element_end)) != NO_INDEX) {
+            output.emplace_back(buffer + element_begin, element_end - element_begin);
+            element_end += delimiter._length;
+            element_begin = element_end;
+        }
+
+        output.emplace_back(buffer + element_begin, this->_length - element_begin);
+        return output;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::insert(const InlineString& string, size_t index) {
+        if (index < this->_length) {
+            this->splice(index, 0, string.c_string(), string._length);
+            return *this;
+        } else {
+            throw OutOfBoundsException(index);
+        }
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::trim(const char* characters) {
+        return this->trim(CharSet(characters));
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::trim(const CharSet& characters) {
+        this->trimTrailing(characters);
+        this->trimLeading(characters);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::trimLeading(const char* characters) {
+        return this->trimLeading(CharSet(characters));
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::trimLeading(const CharSet& characters) {
+        size_t count = characters.findFirstNot(StringView(this->c_string(), this->_length));
+        if (count == NO_INDEX) count = this->_length;
+
+        this->splice(0, count, nullptr, 0);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::trimTrailing(const char* characters) {
+        return this->trimTrailing(CharSet(characters));
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::trimTrailing(const CharSet& characters) {
+        size_t last = characters.findLastNot(StringView(this->c_string(), this->_length));
+        size_t length = last == NO_INDEX ? 0 : last + 1;
+
+        this->splice(length, this->_length - length, nullptr, 0);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::reverse() {
+        std::reverse(this->begin(), this->end());
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::pad(const InlineString& string, size_t count) {
+        this->padLeft(string, count);
+        this->padRight(string, count);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::padLeft(const InlineString& string, size_t count) {
+        this->spliceRepeated(0, string.c_string(), string._length, count);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::padRight(const InlineString& string, size_t count) {
+        this->spliceRepeated(this->_length, string.c_string(), string._length, count);
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::replace(const InlineString& old_string,
+                                                              const InlineString& new_string) {
+        size_t index = this->find(old_string.c_string(), old_string._length, 0);
+        if (index != NO_INDEX) {
+            this->splice(index, old_string._length, new_string.c_string(), new_string._length);
+        }
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::replaceLast(const InlineString& old_string,
+                                                                  const InlineString& new_string) {
+        size_t index = this->findLast(old_string.c_string(), old_string._length, NO_INDEX);
+        if (index != NO_INDEX) {
+            this->splice(index, old_string._length, new_string.c_string(), new_string._length);
+        }
+        return *this;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::replaceAll(const InlineString& old_string,
+                                                                 const InlineString& new_string) {
+        if (old_string._length == 0) return *this;
+
+        size_t index = this->find(old_string.c_string(), old_string._length, 0);
+        if (index == NO_INDEX) return *this;
+
+        // Build the result in one pass rather than splicing, and shifting the tail, once per match
+        InlineString result;
+        size_t copied = 0;
+        do {
+            result.append(this->c_string() + copied, index - copied);
+            result.append(new_string.c_string(), new_string._length);
+            copied = index + old_string._length;
+        } while ((index = this->find(old_string.c_string(), old_string._length, copied)) != NO_INDEX);
+
+        result.append(this->c_string() + copied, this->_length - copied);
+        return *this = std::move(result);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::remove(const InlineString& string) {
+        return this->replace(string, InlineString());
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::removeLast(const InlineString& string) {
+        return this->replaceLast(string, InlineString());
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::removeAll(const InlineString& string) {
+        return this->replaceAll(string, InlineString());
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::removeRange(size_t from_index, size_t to_index) {
+        if (from_index > to_index) throw InvalidArgumentException("from_index must be less than to_index");
+        if (from_index < this->_length && to_index < this->_length) {
+            this->splice(from_index, to_index - from_index, nullptr, 0);
+            return *this;
+        } else {
+            throw OutOfBoundsException(to_index);
+        }
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::removeCharacters(const char* characters) {
+        return this->removeCharacters(CharSet(characters));
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY>& InlineString<N, POLICY>::removeCharacters(const CharSet& characters) {
+        char* buffer = this->data();
+        this->_length = characters.removeFrom(buffer, this->_length);
+        buffer[this->_length] = '\0';
+        return *this;
+    }
+
+    // Searching
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::contains(const InlineString& string) const {
+        return this->find(string.c_string(), string._length, 0) != NO_INDEX;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::indexOf(const InlineString& string) const {
+        return this->find(string.c_string(), string._length, 0);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::indexOf(const InlineString& string, size_t min_index) const {
+        return this->find(string.c_string(), string._length, min_index);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::indexOfLast(const InlineString& string) const {
+        return this->findLast(string.c_string(), string._length, NO_INDEX);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    size_t InlineString<N, POLICY>::indexOfLast(const InlineString& string, size_t max_index) const {
+        return this->findLast(string.c_string(), string._length, max_index);
+    }
+
+    // Comparison
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::isEqualTo(const InlineString& string, bool case_sensitive) const {
+        if (case_sensitive) return *this == string;
+        if (this->_length != string._length) return false;
+
+        return Ascii::isEqualIgnoringCase(this->c_string(), string.c_string(), this->_length);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    int InlineString<N, POLICY>::compare(const InlineString& string, bool case_sensitive) const {
+        if (!case_sensitive) {
+            return Ascii::compareIgnoringCase(this->c_string(), this->_length, string.c_string(), string._length);
+        }
+
+        const size_t length = std::min(this->_length, string._length);
+        int result = length == 0 ? 0 : std::memcmp(this->c_string(), string.c_string(), length);
+        if (result != 0) return result < 0 ? -1 : 1;
+
+        if (this->_length == string._length) return 0;
+        return this->_length < string._length ? -1 : 1;
+    }
+
+    // Conversions
+
+    template<size_t N, InlineStringOverflow POLICY>
+    int InlineString<N, POLICY>::intValue() const {
+        return NumberParser::valueOf<int>(StringView(this->c_string(), this->_length), "int");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    long InlineString<N, POLICY>::longValue() const {
+        return NumberParser::valueOf<long>(StringView(this->c_string(), this->_length), "long");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    long long InlineString<N, POLICY>::longLongValue() const {
+        return NumberParser::valueOf<long long>(StringView(this->c_string(), this->_length), "long long");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    unsigned InlineString<N, POLICY>::unsignedValue() const {
+        return NumberParser::valueOf<unsigned>(StringView(this->c_string(), this->_length), "unsigned");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    unsigned long InlineString<N, POLICY>::unsignedLongValue() const {
+        return NumberParser::valueOf<unsigned long>(StringView(this->c_string(), this->_length), "unsigned long");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    unsigned long long InlineString<N, POLICY>::unsignedLongLongValue() const {
+        return NumberParser::valueOf<unsigned long long>(StringView(this->c_string(), this->_length),
+                                                         "unsigned long long");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    float InlineString<N, POLICY>::floatValue() const {
+        return NumberParser::valueOf<float>(StringView(this->c_string(), this->_length), "float");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    double InlineString<N, POLICY>::doubleValue() const {
+        return NumberParser::valueOf<double>(StringView(this->c_string(), this->_length), "double");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    long double InlineString<N, POLICY>::longDoubleValue() const {
+        return details::inlineStringToLongDouble(this->c_string());
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::boolValue() const {
+        return NumberParser::valueOf<bool>(StringView(this->c_string(), this->_length), "bool");
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryIntValue(int& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryLongValue(long& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryLongLongValue(long long& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryUnsignedValue(unsigned& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryUnsignedLongValue(unsigned long& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryUnsignedLongLongValue(unsigned long long& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryFloatValue(float& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryDoubleValue(double& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    bool InlineString<N, POLICY>::tryBoolValue(bool& value) const {
+        return NumberParser::parseValue(StringView(this->c_string(), this->_length), value) == ParseError::NONE;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    InlineString<N, POLICY> InlineString<N, POLICY>::copy() const {
+        return InlineString(*this);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    String InlineString<N, POLICY>::string() const {
+        return String(this->std_string());
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    const char* InlineString<N, POLICY>::c_string() const {
+        return this->_heap != nullptr ? this->_heap : this->_inline;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    std::string InlineString<N, POLICY>::std_string() const {
+        return std::string(this->c_string(), this->_length);
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    char* InlineString<N, POLICY>::begin() {
+        return this->data();
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    char* InlineString<N, POLICY>::end() {
+        return this->data() + this->_length;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    const char* InlineString<N, POLICY>::begin() const {
+        return this->c_string();
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    const char* InlineString<N, POLICY>::end() const {
+        return this->c_string() + this->_length;
+    }
+
+    template<size_t N, InlineStringOverflow POLICY>
+    const size_t InlineString<N, POLICY>::NO_INDEX;
+}
+
+namespace std {
+    template<size_t N, abraham::InlineStringOverflow POLICY>
+    struct hash<abraham::InlineString<N, POLICY>> {
+        size_t operator()(const abraham::InlineString<N, POLICY>& string) const {
+            return string.hash();
+        }
+    };
+}
+
+#endif //ABRAHAM_INLINESTRING_HPP
@@ -0,0 +1,207 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_INTERNTABLE_HPP
+#define ABRAHAM_INTERNTABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Arena.hpp"
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    namespace details {
+        /**
+         * The single copy of an interned string, with its hash computed once.
+         */
+        struct AtomEntry {
+            uint64_t hash;
+            size_t length;
+            const char* data;
+        };
+    }
+
+    /**
+     * A handle to a string stored once in an InternTable. Two Atoms from the same InternTable are equal exactly when
+     * their text is equal, so comparing and hashing them is a pointer operation rather than a walk over the text.
+     *
+     * An Atom is valid for as long as the InternTable it came from. The default Atom is the empty string, and is equal
+     * to the Atom any InternTable returns for "".
+     */
+    class Atom {
+    protected:
+        friend class InternTable;
+
+        /**
+         * The stored text, or nullptr for the empty string.
+         */
+        const details::AtomEntry* _entry;
+
+        explicit Atom(const details::AtomEntry* entry);
+
+    public:
+        /**
+         * Constructor that creates the empty Atom.
+         */
+        Atom();
+
+        bool operator==(const Atom& atom) const;
+
+        bool operator!=(const Atom& atom) const;
+
+        /**
+         * Orders Atoms by where their text is stored, so they can key ordered containers. The order is consistent for
+         * the life of the InternTable, but isn't alphabetical.
+         */
+        bool operator<(const Atom& atom) const;
+
+        /**
+         * @return The hash of the text, computed when it was interned. It equals the hash of a StringView of the text.
+         */
+        size_t hash() const;
+
+        /**
+         * @return The number of characters in the text.
+         */
+        size_t length() const;
+
+        /**
+         * @return true if the text is empty; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @return The null terminated text, which lives as long as the InternTable.
+         */
+        const char* c_string() const;
+
+        /**
+         * @return A view of the text, which lives as long as the InternTable.
+         */
+        StringView view() const;
+
+        /**
+         * @return A String copy of the text.
+         */
+        String toString() const;
+    };
+
+    /**
+     * Stores each distinct string once and hands out Atoms for them, so repeated names like metric, file and function
+     * names are compared and hashed in constant time.
+     *
+     * Looking up a string that's already interned doesn't lock; only adding a new string does. The slots are
+     * published with atomic stores, and a table that's outgrown is kept rather than freed, so a reader that started
+     * on it can finish safely. Text is stored in an Arena and is never freed until the InternTable is destroyed.
+     *
+     * A table shared across the program can be had with Singleton<InternTable>::SharedInstance().
+     *
+     * Example:
+     *     InternTable names;
+     *     Atom name = names.intern(entry.function.view());
+     *     if (name == main_atom) { ... }
+     */
+    class InternTable {
+    protected:
+        /**
+         * An open addressing table of entries, probed linearly from the hash.
+         */
+        struct Table {
+            size_t mask;
+            std::unique_ptr<std::atomic<const details::AtomEntry*>[]> slots;
+
+            explicit Table(size_t capacity);
+        };
+
+        /**
+         * The table lookups use.
+         */
+        std::atomic<Table*> _table;
+
+        /**
+         * Every table created, including outgrown ones that readers may still be using.
+         */
+        std::vector<std::unique_ptr<Table>> _tables;
+
+        /**
+         * Where the entries and their text are stored.
+         */
+        Arena _arena;
+
+        std::atomic<size_t> _size;
+
+        /**
+         * Serializes adding strings.
+         */
+        std::mutex _mutex;
+
+        /**
+         * @return The entry for some text in a table, or nullptr if it isn't there.
+         */
+        static const details::AtomEntry* find(const Table& table, const char* data, size_t length, uint64_t hash);
+
+        /**
+         * Puts an entry in the first empty slot along its probe sequence.
+         */
+        static void insert(Table& table, const details::AtomEntry* entry);
+
+        /**
+         * Replaces the table with one twice the size. Must be called with _mutex held.
+         */
+        void grow();
+
+    public:
+        /**
+         * Constructor that creates an empty InternTable.
+         * @param capacity - The number of strings to make room for before the table first grows.
+         */
+        explicit InternTable(size_t capacity = 0);
+
+        InternTable(const InternTable& table) = delete;
+
+        InternTable& operator=(const InternTable& table) = delete;
+
+        /**
+         * @param string - The text to intern.
+         * @return The Atom for the text, adding it to the table if it isn't already there.
+         */
+        Atom intern(const StringView& string);
+
+        /**
+         * @param string - The text to look up.
+         * @return The Atom for the text if it's been interned; the empty Atom otherwise.
+         */
+        Atom find(const StringView& string) const;
+
+        /**
+         * @param string - The text to look up.
+         * @return true if the text has been interned; false otherwise.
+         */
+        bool contains(const StringView& string) const;
+
+        /**
+         * @return The number of distinct non-empty strings interned.
+         */
+        size_t size() const;
+    };
+}
+
+namespace std {
+    template<>
+    struct hash<abraham::Atom> {
+        size_t operator()(const abraham::Atom& atom) const {
+            return atom.hash();
+        }
+    };
+}
+
+#endif //ABRAHAM_INTERNTABLE_HPP
@@ -0,0 +1,1177 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_PERSISTENTDICTIONARY_HPP
+#define ABRAHAM_PERSISTENTDICTIONARY_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Array.hpp"
+#include "Dictionary.hpp"
+#include "Exception.hpp"
+#include "Hash.hpp"
+
+
+namespace abraham {
+
+    template<typename K, typename V>
+    class TransientDictionary;
+
+    /// \cond IGNORE
+    namespace details {
+        /**
+         * A node of the compressed hash array mapped prefix tree (CHAMP) that backs PersistentDictionary.
+         * Bitmap nodes keep their inline key/value pairs and their child nodes in two separately compressed arrays.
+         * Collision nodes only appear once all hash bits have been consumed and hold their pairs in a flat list.
+         */
+        template<typename K, typename V>
+        struct PersistentNode {
+            uint32_t dataMap = 0;
+            uint32_t nodeMap = 0;
+            bool isCollision = false;
+            uint64_t edit = 0;
+            std::vector<std::pair<K, V>> entries;
+            std::vector<std::shared_ptr<PersistentNode<K, V>>> children;
+        };
+
+        /**
+         * @return A process wide unique, never zero, token used to mark nodes owned by a transient.
+         */
+        inline uint64_t nextPersistentEdit() {
+            static std::atomic<uint64_t> counter(0);
+            return ++counter;
+        }
+    }
+    /// \endcond IGNORE
+
+
+    /**
+     * An immutable Dictionary backed by a hash array mapped trie, whose versions share structure with each other.
+     * Copying is O(1), and addObject, replace and remove return a new version that shares all untouched nodes with
+     * the original. Nodes are reference counted with std::shared_ptr, so versions can be handed across threads freely.
+     * Keys are hashed with Hash and iterated in hash order, not key order.
+     * @tparam K - The key type of the PersistentDictionary.
+     * @tparam V - The value type of the PersistentDictionary.
+     */
+    template<typename K, typename V>
+    class PersistentDictionary {
+        friend class TransientDictionary<K, V>;
+
+    public:
+        /// \cond IGNORE
+        typedef details::PersistentNode<K, V> Node;
+        typedef std::shared_ptr<Node> NodePtr;
+        /// \endcond IGNORE
+
+        /**
+         * Forward iterator over the key/value pairs of a PersistentDictionary.
+         */
+        class const_iterator {
+            friend class PersistentDictionary<K, V>;
+
+        protected:
+            /**
+             * A node on the traversal path, along with the next entry and child to visit.
+             */
+            struct Frame {
+                const Node* node;
+                size_t entry;
+                size_t child;
+            };
+
+            /**
+             * The traversal path from the root to the node holding the current pair.
+             */
+            std::vector<Frame> _stack;
+
+            /**
+             * Moves to the next pair, descending into child nodes once a node's own pairs are exhausted.
+             */
+            void advance();
+
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef std::pair<K, V> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const std::pair<K, V>* pointer;
+            typedef const std::pair<K, V>& reference;
+
+            const std::pair<K, V>& operator*() const;
+
+            const std::pair<K, V>* operator->() const;
+
+            const_iterator& operator++();
+
+            const_iterator operator++(int);
+
+            bool operator==(const const_iterator& iterator) const;
+
+            bool operator!=(const const_iterator& iterator) const;
+        };
+
+    protected:
+        /**
+         * The root node of the trie. Empty dictionaries share no root and hold nullptr.
+         */
+        NodePtr _root;
+
+        /**
+         * The number of key/value pairs in the PersistentDictionary.
+         */
+        size_t _size;
+
+        /**
+         * The number of hash bits consumed by each level of the trie.
+         */
+        static const unsigned BITS_PER_LEVEL = 5;
+
+        /**
+         * The shift at which all 64 hash bits have been consumed and collision nodes are used.
+         */
+        static const unsigned MAX_SHIFT = 64;
+
+        /**
+         * Constructor that wraps an existing root node.
+         */
+        PersistentDictionary<K, V>(const NodePtr& root, size_t size);
+
+        static uint64_t hashKey(const K& key);
+
+        static uint32_t bitFor(uint64_t hash, unsigned shift);
+
+        static size_t indexFor(uint32_t map, uint32_t bit);
+
+        static NodePtr editable(const NodePtr& node, uint64_t edit);
+
+        static NodePtr makePair(const K& key1, const V& value1, uint64_t hash1,
+                                const K& key2, const V& value2, uint64_t hash2, unsigned shift, uint64_t edit);
+
+        static const V* find(const Node* node, const K& key, uint64_t hash, unsigned shift);
+
+        static NodePtr assoc(const NodePtr& node, const K& key, const V& value, uint64_t hash, unsigned shift,
+                             uint64_t edit, bool& added);
+
+        static NodePtr dissoc(const NodePtr& node, const K& key, uint64_t hash, unsigned shift, uint64_t edit,
+                              bool& removed);
+
+        static uint64_t hashOfEntry(const Node* node, size_t index);
+
+    public:
+        /**
+         * Default constructor that creates an empty PersistentDictionary.
+         */
+        PersistentDictionary<K, V>();
+
+        /**
+         * Constructor that creates a PersistentDictionary from an initialization list.
+         * @param i_list - List of objects to initialize the PersistentDictionary with.
+         */
+        PersistentDictionary<K, V>(std::initializer_list<std::pair<const K, V>> i_list);
+
+        /**
+         * Constructor that creates a PersistentDictionary from a std::map.
+         * @param map - The std::map to create the PersistentDictionary from.
+         */
+        PersistentDictionary<K, V>(const std::map<K, V>& map);
+
+        /**
+         * Constructor that creates a PersistentDictionary from a Dictionary.
+         * @param dictionary - The Dictionary to create the PersistentDictionary from.
+         */
+        PersistentDictionary<K, V>(const Dictionary<K, V>& dictionary);
+
+        /**
+         * Constructor that creates a PersistentDictionary from another PersistentDictionary. This is O(1).
+         * @param dictionary - The PersistentDictionary that this PersistentDictionary shares its contents with.
+         */
+        PersistentDictionary<K, V>(const PersistentDictionary<K, V>& dictionary);
+
+        /**
+         * Move constructor.
+         * @param dictionary - The PersistentDictionary to move to this PersistentDictionary.
+         */
+        PersistentDictionary<K, V>(PersistentDictionary<K, V>&& dictionary) noexcept;
+
+        /**
+         * Operator overload to set new PersistentDictionary contents using the '=' operator. This is O(1).
+         * @param dictionary - The PersistentDictionary to share the new contents with.
+         * @return A self reference.
+         */
+        PersistentDictionary<K, V>& operator=(const PersistentDictionary<K, V>& dictionary);
+
+        /**
+         * Operator overload to set new PersistentDictionary contents by moving.
+         * @param dictionary - The PersistentDictionary to set the new contents from.
+         * @return A self reference.
+         */
+        PersistentDictionary<K, V>& operator=(PersistentDictionary<K, V>&& dictionary) noexcept;
+
+        /**
+         * Operator overload to check the equality of two PersistentDictionary objects using the '==' operator.
+         * @param dictionary - The PersistentDictionary to compare this PersistentDictionary to.
+         * @return true if the contents of the PersistentDictionary objects are equal in value; false otherwise.
+         */
+        bool operator==(const PersistentDictionary<K, V>& dictionary) const;
+
+        /**
+         * Operator overload to check the inequality of two PersistentDictionary objects using the '!=' operator.
+         * @param dictionary - The PersistentDictionary to compare this PersistentDictionary to.
+         * @return true if the contents of the PersistentDictionary objects are not equal in value; false otherwise.
+         */
+        bool operator!=(const PersistentDictionary<K, V>& dictionary) const;
+
+        /**
+         * Retrieves the element associated with the specified key.
+         * @param key - The key associated with the desired element.
+         * @return - The element associated with the specified key.
+         */
+        const V& objectForKey(const K& key) const;
+
+        /**
+         * Determines whether the specified key exists in the PersistentDictionary.
+         * @param key - The key to be found.
+         * @return true if the key is present in the PersistentDictionary; false otherwise.
+         */
+        bool containsKey(const K& key) const;
+
+        /**
+         * @return The number of key/value pairs in the PersistentDictionary.
+         */
+        size_t size() const;
+
+        /**
+         * @return true if the PersistentDictionary is empty; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @return An Array object containing all the keys of this PersistentDictionary.
+         */
+        Array<K> getKeys() const;
+
+        /**
+         * @return An Array object containing all the values of this PersistentDictionary.
+         */
+        Array<V> getValues() const;
+
+        /**
+         * Create a new version with an additional key/value pair.
+         * @param key - The key of the key/value pair.
+         * @param value - The value associated with the key.
+         * @return A new PersistentDictionary containing the key/value pair.
+         */
+        PersistentDictionary<K, V> addObject(const K& key, const V& value) const;
+
+        /**
+         * Create a new version where the key is associated with the value, whether or not the key already exists.
+         * @param key - The key of the key/value pair.
+         * @param value - The value associated with the key.
+         * @return A new PersistentDictionary containing the key/value pair.
+         */
+        PersistentDictionary<K, V> setObject(const K& key, const V& value) const;
+
+        /**
+         * Create a new version with the value of a pre-existing key replaced.
+         * @param key - The key whose value will be replaced.
+         * @param new_value - The new value to be set.
+         * @return A new PersistentDictionary containing the new value.
+         */
+        PersistentDictionary<K, V> replace(const K& key, const V& new_value) const;
+
+        /**
+         * Create a new version without a key/value pair.
+         * @param key - The key to remove, along with its associated value.
+         * @return A new PersistentDictionary without the key.
+         */
+        PersistentDictionary<K, V> remove(const K& key) const;
+
+        /**
+         * Create a new version without an Array of key/value pairs.
+         * @param keys - The Array of keys to remove.
+         * @return A new PersistentDictionary without the keys.
+         */
+        PersistentDictionary<K, V> removeObjects(const Array<K>& keys) const;
+
+        /**
+         * Checks the equality of two PersistentDictionary objects.
+         * @param dictionary - The other PersistentDictionary to compare this PersistentDictionary to.
+         * @return true if the contents of the PersistentDictionary objects are equal in value; false otherwise.
+         */
+        bool isEqualTo(const PersistentDictionary<K, V>& dictionary) const;
+
+        /**
+         * Determines whether two PersistentDictionary objects are the same version, without comparing contents.
+         * @param dictionary - The other PersistentDictionary.
+         * @return true if both share the same root node; false otherwise.
+         */
+        bool sharesStructureWith(const PersistentDictionary<K, V>& dictionary) const;
+
+        /**
+         * @return A TransientDictionary that can apply a batch of mutations in place, starting from this version.
+         */
+        TransientDictionary<K, V> transient() const;
+
+        /**
+         * @return A copy of the PersistentDictionary. This is O(1), as the contents are shared.
+         */
+        PersistentDictionary<K, V> copy() const;
+
+        /**
+         * @return A Dictionary containing the same key/value pairs.
+         */
+        Dictionary<K, V> dictionary() const;
+
+        /**
+         * @return A std::map containing the same key/value pairs.
+         */
+        std::map<K, V> std_map() const;
+
+        /**
+         * @return const iterator.
+         */
+        const_iterator begin() const;
+
+        /**
+         * @return const iterator.
+         */
+        const_iterator end() const;
+
+        /**
+         * @return const iterator.
+         */
+        const_iterator cbegin() const;
+
+        /**
+         * @return const iterator.
+         */
+        const_iterator cend() const;
+    };
+
+
+    /**
+     * A mutable view of a PersistentDictionary used to apply many changes without copying a path per change.
+     * Nodes created by the transient are updated in place; nodes shared with persistent versions are copied once.
+     * A TransientDictionary is not thread safe, and can't be used after persistent() has been called.
+     * @tparam K - The key type of the TransientDictionary.
+     * @tparam V - The value type of the TransientDictionary.
+     */
+    template<typename K, typename V>
+    class TransientDictionary {
+        friend class PersistentDictionary<K, V>;
+
+    protected:
+        /**
+         * The root node of the trie being edited.
+         */
+        typename PersistentDictionary<K, V>::NodePtr _root;
+
+        /**
+         * The number of key/value pairs in the TransientDictionary.
+         */
+        size_t _size;
+
+        /**
+         * The token marking nodes owned by this transient. Zero once persistent() has been called.
+         */
+        uint64_t _edit;
+
+        /**
+         * Constructor that starts editing from an existing root node.
+         */
+        TransientDictionary<K, V>(const typename PersistentDictionary<K, V>::NodePtr& root, size_t size);
+
+        /**
+         * Throws if the TransientDictionary has already been made persistent.
+         */
+        void ensureEditable() const;
+
+    public:
+        /**
+         * Default constructor that creates an empty TransientDictionary.
+         */
+        TransientDictionary<K, V>();
+
+        /**
+         * A TransientDictionary can't be copied, since a copy would share the token that lets it update nodes in
+         * place, and so could change nodes that already belong to a persistent version.
+         */
+        TransientDictionary<K, V>(const TransientDictionary<K, V>& transient) = delete;
+
+        /**
+         * Move constructor that takes over another TransientDictionary's edits. The other TransientDictionary can't
+         * be used afterwards.
+         * @param transient - The TransientDictionary to move from.
+         */
+        TransientDictionary<K, V>(TransientDictionary<K, V>&& transient) noexcept;
+
+        /**
+         * A TransientDictionary can't be copy assigned, for the same reason it can't be copied.
+         */
+        TransientDictionary<K, V>& operator=(const TransientDictionary<K, V>& transient) = delete;
+
+        /**
+         * Move assignment that takes over another TransientDictionary's edits. The other TransientDictionary can't
+         * be used afterwards.
+         * @param transient - The TransientDictionary to move from.
+         * @return A self reference.
+         */
+        TransientDictionary<K, V>& operator=(TransientDictionary<K, V>&& transient) noexcept;
+
+        /**
+         * Add a new key/value pair.
+         * @param key - The key of the key/value pair.
+         * @param value - The value associated with the key.
+         * @return A self reference.
+         */
+        TransientDictionary<K, V>& addObject(const K& key, const V& value);
+
+        /**
+         * Associate the key with the value, whether or not the key already exists.
+         * @param key - The key of the key/value pair.
+         * @param value - The value associated with the key.
+         * @return A self reference.
+         */
+        TransientDictionary<K, V>& setObject(const K& key, const V& value);
+
+        /**
+         * Replace the value of a pre-existing key with a new value.
+         * @param key - The key whose value will be replaced.
+         * @param new_value - The new value to be set.
+         * @return A self reference.
+         */
+        TransientDictionary<K, V>& replace(const K& key, const V& new_value);
+
+        /**
+         * Remove a key/value pair.
+         * @param key - The key to remove, along with its associated value.
+         * @return A self reference.
+         */
+        TransientDictionary<K, V>& remove(const K& key);
+
+        /**
+         * Retrieves the element associated with the specified key.
+         * @param key - The key associated with the desired element.
+         * @return - The element associated with the specified key.
+         */
+        const V& objectForKey(const K& key) const;
+
+        /**
+         * Determines whether the specified key exists in the TransientDictionary.
+         * @param key - The key to be found.
+         * @return true if the key is present; false otherwise.
+         */
+        bool containsKey(const K& key) const;
+
+        /**
+         * @return The number of key/value pairs in the TransientDictionary.
+         */
+        size_t size() const;
+
+        /**
+         * Ends the batch of mutations. The TransientDictionary can't be edited afterwards.
+         * @return A PersistentDictionary containing the result of the mutations.
+         */
+        PersistentDictionary<K, V> persistent();
+    };
+
+
+/*
+ * Template Implementation
+ */
+
+    // const_iterator
+
+    template<typename K, typename V>
+    void PersistentDictionary<K, V>::const_iterator::advance() {
+        while (!this->_stack.empty()) {
+            Frame& frame = this->_stack.back();
+
+            if (frame.entry + 1 < frame.node->entries.size()) {
+                ++frame.entry;
+                return;
+            }
+
+            if (frame.child < frame.node->children.size()) {
+                const Node* child = frame.node->children[frame.child].get();
+                ++frame.child;
+                frame.entry = frame.node->entries.size();
+                this->_stack.push_back({child, 0, 0});
+
+                if (!child->entries.empty()) return;
+                continue;
+            }
+
+            this->_stack.pop_back();
+        }
+    }
+
+    template<typename K, typename V>
+    const std::pair<K, V>& PersistentDictionary<K, V>::const_iterator::operator*() const {
+        const Frame& frame = this->_stack.back();
+        return frame.node->entries[frame.entry];
+    }
+
+    template<typename K, typename V>
+    const std::pair<K, V>* PersistentDictionary<K, V>::const_iterator::operator->() const {
+        const Frame& frame = this->_stack.back();
+        return &frame.node->entries[frame.entry];
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::const_iterator& PersistentDictionary<K, V>::const_iterator::operator++() {
+        this->advance();
+        return *this;
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::const_iterator PersistentDictionary<K, V>::const_iterator::operator++(int) {
+        const_iterator previous = *this;
+        this->advance();
+        return previous;
+    }
+
+    template<typename K, typename V>
+    bool PersistentDictionary<K, V>::const_iterator::operator==(const const_iterator& iterator) const {
+        if (this->_stack.empty() || iterator._stack.empty()) {
+            return this->_stack.empty() == iterator._stack.empty();
+        }
+
+        const Frame& first = this->_stack.back();
+        const Frame& second = iterator._stack.back();
+        return first.node == second.node && first.entry == second.entry;
+    }
+
+    template<typename K, typename V>
+    bool PersistentDictionary<K, V>::const_iterator::operator!=(const const_iterator& iterator) const {
+        return !(*this == iterator);
+    }
+
+    // Trie helpers
+
+    template<typename K, typename V>
+    uint64_t PersistentDictionary<K, V>::hashKey(const K& key) {
+        // Spread the bits so that identity hashes of small integers still fill every level of the trie
+        uint64_t hash = static_cast<uint64_t>(Hash<K>()(key));
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    template<typename K, typename V>
+    uint32_t PersistentDictionary<K, V>::bitFor(uint64_t hash, unsigned shift) {
+        return uint32_t(1) << ((hash >> shift) & 0x1F);
+    }
+
+    template<typename K, typename V>
+    size_t PersistentDictionary<K, V>::indexFor(uint32_t map, uint32_t bit) {
+        uint32_t below = map & (bit - 1);
+        size_t count = 0;
+        while (below) {
+            below &= below - 1;
+            ++count;
+        }
+        return count;
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::NodePtr
+    PersistentDictionary<K, V>::editable(const NodePtr& node, uint64_t edit) {
+        if (edit != 0 && node->edit == edit) return node;
+
+        NodePtr clone = std::make_shared<Node>(*node);
+        clone->edit = edit;
+        return clone;
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::NodePtr
+    PersistentDictionary<K, V>::makePair(const K& key1, const V& value1, uint64_t hash1,
+                                         const K& key2, const V& value2, uint64_t hash2,
+                                         unsigned shift, uint64_t edit) {
+        NodePtr node = std::make_shared<Node>();
+        node->edit = edit;
+
+        if (shift >= MAX_SHIFT) {
+            node->isCollision = true;
+            node->entries.emplace_back(key1, value1);
+            node->entries.emplace_back(key2, value2);
+            return node;
+        }
+
+        uint32_t bit1 = bitFor(hash1, shift);
+        uint32_t bit2 = bitFor(hash2, shift);
+
+        if (bit1 == bit2) {
+            node->nodeMap = bit1;
+            node->children.push_back(makePair(key1, value1, hash1, key2, value2, hash2, shift + BITS_PER_LEVEL, edit));
+        } else {
+            node->dataMap = bit1 | bit2;
+            if (bit1 < bit2) {
+                node->entries.emplace_back(key1, value1);
+                node->entries.emplace_back(key2, value2);
+            } else {
+                node->entries.emplace_back(key2, value2);
+                node->entries.emplace_back(key1, value1);
+            }
+        }
+
+        return node;
+    }
+
+    template<typename K, typename V>
+    const V* PersistentDictionary<K, V>::find(const Node* node, const K& key, uint64_t hash, unsigned shift) {
+        while (node != nullptr) {
+            if (node->isCollision) {
+                for (const std::pair<K, V>& entry : node->entries) {
+                    if (entry.first == key) return &entry.second;
+                }
+                return nullptr;
+            }
+
+            uint32_t bit = bitFor(hash, shift);
+
+            if (node->dataMap & bit) {
+                const std::pair<K, V>& entry = node->entries[indexFor(node->dataMap, bit)];
+                return entry.first == key ? &entry.second : nullptr;
+            }
+
+            if (node->nodeMap & bit) {
+                node = node->children[indexFor(node->nodeMap, bit)].get();
+                shift += BITS_PER_LEVEL;
+                continue;
+            }
+
+            return nullptr;
+        }
+
+        return nullptr;
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::NodePtr
+    PersistentDictionary<K, V>::assoc(const NodePtr& node, const K& key, const V& value, uint64_t hash,
+                                      unsigned shift, uint64_t edit, bool& added) {
+        if (node == nullptr) {
+            NodePtr leaf = std::make_shared<Node>();
+            leaf->edit = edit;
+            leaf->dataMap = bitFor(hash, shift);
+            leaf->entries.emplace_back(key, value);
+            added = true;
+            return leaf;
+        }
+
+        if (node->isCollision) {
+            NodePtr result = editable(node, edit);
+            for (std::pair<K, V>& entry : result->entries) {
+                if (entry.first == key) {
+                    entry.second = value;
+                    added = false;
+                    return result;
+                }
+            }
+
+            result->entries.emplace_back(key, value);
+            added = true;
+            return result;
+        }
+
+        uint32_t bit = bitFor(hash, shift);
+
+        if (node->dataMap & bit) {
+            size_t index = indexFor(node->dataMap, bit);
+            const std::pair<K, V>& existing = node->entries[index];
+
+            if (existing.first == key) {
+                NodePtr result = editable(node, edit);
+                result->entries[index].second = value;
+                added = false;
+                return result;
+            }
+
+            // Push the existing pair and the new pair down into a new child node
+            NodePtr child = makePair(existing.first, existing.second, hashOfEntry(node.get(), index),
+                                     key, value, hash, shift + BITS_PER_LEVEL, edit);
+            NodePtr result = editable(node, edit);
+            result->entries.erase(result->entries.begin() + index);
+            result->dataMap ^= bit;
+            result->nodeMap |= bit;
+            result->children.insert(result->children.begin() + indexFor(result->nodeMap, bit), child);
+            added = true;
+            return result;
+        }
+
+        if (node->nodeMap & bit) {
+            size_t index = indexFor(node->nodeMap, bit);
+            const NodePtr& child = node->children[index];
+            NodePtr new_child = assoc(child, key, value, hash, shift + BITS_PER_LEVEL, edit, added);
+            if (new_child == child) return node;
+
+            NodePtr result = editable(node, edit);
+            result->children[index] = new_child;
+            return result;
+        }
+
+        NodePtr result = editable(node, edit);
+        result->dataMap |= bit;
+        result->entries.insert(result->entries.begin() + indexFor(result->dataMap, bit), std::pair<K, V>(key, value));
+        added = true;
+        return result;
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::NodePtr
+    PersistentDictionary<K, V>::dissoc(const NodePtr& node, const K& key, uint64_t hash, unsigned shift,
+                                       uint64_t edit, bool& removed) {
+        removed = false;
+        if (node == nullptr) return node;
+
+        if (node->isCollision) {
+            for (size_t i = 0; i < node->entries.size(); ++i) {
+                if (node->entries[i].first == key) {
+                    NodePtr result = editable(node, edit);
+                    result->entries.erase(result->entries.begin() + i);
+                    removed = true;
+                    return result;
+                }
+            }
+
+            return node;
+        }
+
+        uint32_t bit = bitFor(hash, shift);
+
+        if (node->dataMap & bit) {
+            size_t index = indexFor(node->dataMap, bit);
+            if (!(node->entries[index].first == key)) return node;
+
+            removed = true;
+            if (node->entries.size() == 1 && node->children.empty()) return nullptr;
+
+            NodePtr result = editable(node, edit);
+            result->entries.erase(result->entries.begin() + index);
+            result->dataMap ^= bit;
+            return result;
+        }
+
+        if (node->nodeMap & bit) {
+            size_t index = indexFor(node->nodeMap, bit);
+            const NodePtr& child = node->children[index];
+            NodePtr new_child = dissoc(child, key, hash, shift + BITS_PER_LEVEL, edit, removed);
+            if (!removed) return node;
+
+            NodePtr result = editable(node, edit);
+
+            // A child left holding a single pair is folded back into this node, keeping the trie canonical
+            if (new_child == nullptr || (new_child->entries.size() == 1 && new_child->children.empty())) {
+                result->children.erase(result->children.begin() + index);
+                result->nodeMap ^= bit;
+
+                if (new_child != nullptr) {
+                    result->dataMap |= bit;
+                    result->entries.insert(result->entries.begin() + indexFor(result->dataMap, bit),
+                                           new_child->entries[0]);
+                }
+
+                if (result->entries.empty() && result->children.empty()) return nullptr;
+            } else {
+                result->children[index] = new_child;
+            }
+
+            return result;
+        }
+
+        return node;
+    }
+
+    template<typename K, typename V>
+    uint64_t PersistentDictionary<K, V>::hashOfEntry(const Node* node, size_t index) {
+        return hashKey(node->entries[index].first);
+    }
+
+    // PersistentDictionary
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>::PersistentDictionary() {
+        this->_root = nullptr;
+        this->_size = 0;
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>::PersistentDictionary(const NodePtr& root, size_t size) {
+        this->_root = root;
+        this->_size = size;
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>::PersistentDictionary(std::initializer_list<std::pair<const K, V>> i_list) {
+        TransientDictionary<K, V> transient = TransientDictionary<K, V>();
+        for (const std::pair<const K, V>& entry : i_list) {
+            transient.setObject(entry.first, entry.second);
+        }
+
+        *this = transient.persistent();
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>::PersistentDictionary(const std::map<K, V>& map) {
+        TransientDictionary<K, V> transient = TransientDictionary<K, V>();
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            transient.setObject(it->first, it->second);
+        }
+
+        *this = transient.persistent();
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>::PersistentDictionary(const Dictionary<K, V>& dictionary) {
+        TransientDictionary<K, V> transient = TransientDictionary<K, V>();
+        for (auto it = dictionary.begin(); it != dictionary.end(); ++it) {
+            transient.setObject(it->first, it->second);
+        }
+
+        *this = transient.persistent();
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>::PersistentDictionary(const PersistentDictionary<K, V>& dictionary) {
+        this->_root = dictionary._root;
+        this->_size = dictionary._size;
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>::PersistentDictionary(PersistentDictionary<K, V>&& dictionary) noexcept {
+        this->_root = std::move(dictionary._root);
+        this->_size = dictionary._size;
+        dictionary._size = 0;
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>& PersistentDictionary<K, V>::operator=(const PersistentDictionary<K, V>& dictionary) {
+        if (this == &dictionary) return *this;
+        this->_root = dictionary._root;
+        this->_size = dictionary._size;
+        return *this;
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V>& PersistentDictionary<K, V>::operator=(PersistentDictionary<K, V>&& dictionary) noexcept {
+        if (this == &dictionary) return *this;
+        this->_root = std::move(dictionary._root);
+        this->_size = dictionary._size;
+        dictionary._size = 0;
+        return *this;
+    }
+
+    template<typename K, typename V>
+    bool PersistentDictionary<K, V>::operator==(const PersistentDictionary<K, V>& dictionary) const {
+        return this->isEqualTo(dictionary);
+    }
+
+    template<typename K, typename V>
+    bool PersistentDictionary<K, V>::operator!=(const PersistentDictionary<K, V>& dictionary) const {
+        return !this->isEqualTo(dictionary);
+    }
+
+    template<typename K, typename V>
+    const V& PersistentDictionary<K, V>::objectForKey(const K& key) const {
+        const V* value = find(this->_root.get(), key, hashKey(key), 0);
+        if (value != nullptr) {
+            return *value;
+        } else {
+            throw InvalidArgumentException("Key does not exist");
+        }
+    }
+
+    template<typename K, typename V>
+    bool PersistentDictionary<K, V>::containsKey(const K& key) const {
+        return find(this->_root.get(), key, hashKey(key), 0) != nullptr;
+    }
+
+    template<typename K, typename V>
+    size_t PersistentDictionary<K, V>::size() const {
+        return this->_size;
+    }
+
+    template<typename K, typename V>
+    bool PersistentDictionary<K, V>::isEmpty() const {
+        return this->_size == 0;
+    }
+
+    template<typename K, typename V>
+    Array<K> PersistentDictionary<K, V>::getKeys() const {
+        Array<K> keys = Array<K>(this->_size);
+        size_t index = 0;
+        for (auto it = this->begin(); it != this->end(); ++it) {
+            keys[index] = it->first;
+            ++index;
+        }
+
+        return keys;
+    }
+
+    template<typename K, typename V>
+    Array<V> PersistentDictionary<K, V>::getValues() const {
+        Array<V> values = Array<V>(this->_size);
+        size_t index = 0;
+        for (auto it = this->begin(); it != this->end(); ++it) {
+            values[index] = it->second;
+            ++index;
+        }
+
+        return values;
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V> PersistentDictionary<K, V>::addObject(const K& key, const V& value) const {
+        if (this->containsKey(key)) {
+            throw InvalidArgumentException("Key already exists");
+        }
+
+        return this->setObject(key, value);
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V> PersistentDictionary<K, V>::setObject(const K& key, const V& value) const {
+        bool added = false;
+        NodePtr root = assoc(this->_root, key, value, hashKey(key), 0, 0, added);
+        return PersistentDictionary<K, V>(root, added ? this->_size + 1 : this->_size);
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V> PersistentDictionary<K, V>::replace(const K& key, const V& new_value) const {
+        if (!this->containsKey(key)) {
+            throw InvalidArgumentException("Cannot replace key that doesn't exist");
+        }
+
+        return this->setObject(key, new_value);
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V> PersistentDictionary<K, V>::remove(const K& key) const {
+        bool removed = false;
+        NodePtr root = dissoc(this->_root, key, hashKey(key), 0, 0, removed);
+        if (!removed) return *this;
+
+        return PersistentDictionary<K, V>(root, this->_size - 1);
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V> PersistentDictionary<K, V>::removeObjects(const Array<K>& keys) const {
+        TransientDictionary<K, V> transient = this->transient();
+        for (const K& key : keys) {
+            transient.remove(key);
+        }
+
+        return transient.persistent();
+    }
+
+    template<typename K, typename V>
+    bool PersistentDictionary<K, V>::isEqualTo(const PersistentDictionary<K, V>& dictionary) const {
+        if (this->_root == dictionary._root) return true;
+        if (this->_size != dictionary._size) return false;
+
+        for (auto it = this->begin(); it != this->end(); ++it) {
+            const V* value = find(dictionary._root.get(), it->first, hashKey(it->first), 0);
+            if (value == nullptr || !(*value == it->second)) return false;
+        }
+
+        return true;
+    }
+
+    template<typename K, typename V>
+    bool PersistentDictionary<K, V>::sharesStructureWith(const PersistentDictionary<K, V>& dictionary) const {
+        return this->_root == dictionary._root;
+    }
+
+    template<typename K, typename V>
+    TransientDictionary<K, V> PersistentDictionary<K, V>::transient() const {
+        return TransientDictionary<K, V>(this->_root, this->_size);
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V> PersistentDictionary<K, V>::copy() const {
+        return PersistentDictionary<K, V>(*this);
+    }
+
+    template<typename K, typename V>
+    Dictionary<K, V> PersistentDictionary<K, V>::dictionary() const {
+        return Dictionary<K, V>(this->std_map());
+    }
+
+    template<typename K, typename V>
+    std::map<K, V> PersistentDictionary<K, V>::std_map() const {
+        std::map<K, V> map = std::map<K, V>();
+        for (auto it = this->begin(); it != this->end(); ++it) {
+            map[it->first] = it->second;
+        }
+
+        return map;
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::const_iterator PersistentDictionary<K, V>::begin() const {
+        const_iterator iterator = const_iterator();
+        if (this->_root == nullptr) return iterator;
+
+        iterator._stack.push_back({this->_root.get(), 0, 0});
+        if (this->_root->entries.empty()) {
+            iterator.advance();
+        }
+
+        return iterator;
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::const_iterator PersistentDictionary<K, V>::end() const {
+        return const_iterator();
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::const_iterator PersistentDictionary<K, V>::cbegin() const {
+        return this->begin();
+    }
+
+    template<typename K, typename V>
+    typename PersistentDictionary<K, V>::const_iterator PersistentDictionary<K, V>::cend() const {
+        return this->end();
+    }
+
+    // TransientDictionary
+
+    template<typename K, typename V>
+    TransientDictionary<K, V>::TransientDictionary() {
+        this->_root = nullptr;
+        this->_size = 0;
+        this->_edit = details::nextPersistentEdit();
+    }
+
+    template<typename K, typename V>
+    TransientDictionary<K, V>::TransientDictionary(const typename PersistentDictionary<K, V>::NodePtr& root,
+                                                   size_t size) {
+        this->_root = root;
+        this->_size = size;
+        this->_edit = details::nextPersistentEdit();
+    }
+
+    template<typename K, typename V>
+    TransientDictionary<K, V>::TransientDictionary(TransientDictionary<K, V>&& transient) noexcept {
+        this->_root = std::move(transient._root);
+        this->_size = transient._size;
+        this->_edit = transient._edit;
+        transient._root = nullptr;
+        transient._size = 0;
+        transient._edit = 0;
+    }
+
+    template<typename K, typename V>
+    TransientDictionary<K, V>& TransientDictionary<K, V>::operator=(TransientDictionary<K, V>&& transient) noexcept {
+        if (this != &transient) {
+            this->_root = std::move(transient._root);
+            this->_size = transient._size;
+            this->_edit = transient._edit;
+            transient._root = nullptr;
+            transient._size = 0;
+            transient._edit = 0;
+        }
+
+        return *this;
+    }
+
+    template<typename K, typename V>
+    void TransientDictionary<K, V>::ensureEditable() const {
+        if (this->_edit == 0) {
+            throw InvalidValueException("TransientDictionary used after persistent() was called");
+        }
+    }
+
+    template<typename K, typename V>
+    TransientDictionary<K, V>& TransientDictionary<K, V>::addObject(const K& key, const V& value) {
+        if (this->containsKey(key)) {
+            throw InvalidArgumentException("Key already exists");
+        }
+
+        return this->setObject(key, value);
+    }
+
+    template<typename K, typename V>
+    TransientDictionary<K, V>& TransientDictionary<K, V>::setObject(const K& key, const V& value) {
+        this->ensureEditable();
+
+        bool added = false;
+        this->_root = PersistentDictionary<K, V>::assoc(this->_root, key, value,
+                                                        PersistentDictionary<K, V>::hashKey(key), 0, this->_edit,
+                                                        added);
+        if (added) ++this->_size;
+
+        return *this;
+    }
+
+    template<typename K, typename V>
+    TransientDictionary<K, V>& TransientDictionary<K, V>::replace(const K& key, const V& new_value) {
+        if (!this->containsKey(key)) {
+            throw InvalidArgumentException("Cannot replace key that doesn't exist");
+        }
+
+        return this->setObject(key, new_value);
+    }
+
+    template<typename K, typename V>
+    TransientDictionary<K, V>& TransientDictionary<K, V>::remove(const K& key) {
+        this->ensureEditable();
+
+        bool removed = false;
+        this->_root = PersistentDictionary<K, V>::dissoc(this->_root, key, PersistentDictionary<K, V>::hashKey(key),
+                                                         0, this->_edit, removed);
+        if (removed) --this->_size;
+
+        return *this;
+    }
+
+    template<typename K, typename V>
+    const V& TransientDictionary<K, V>::objectForKey(const K& key) const {
+        this->ensureEditable();
+
+        const V* value = PersistentDictionary<K, V>::find(this->_root.get(), key,
+                                                          PersistentDictionary<K, V>::hashKey(key), 0);
+        if (value != nullptr) {
+            return *value;
+        } else {
+            throw InvalidArgumentException("Key does not exist");
+        }
+    }
+
+    template<typename K, typename V>
+    bool TransientDictionary<K, V>::containsKey(const K& key) const {
+        this->ensureEditable();
+        return PersistentDictionary<K, V>::find(this->_root.get(), key,
+                                                PersistentDictionary<K, V>::hashKey(key), 0) != nullptr;
+    }
+
+    template<typename K, typename V>
+    size_t TransientDictionary<K, V>::size() const {
+        return this->_size;
+    }
+
+    template<typename K, typename V>
+    PersistentDictionary<K, V> TransientDictionary<K, V>::persistent() {
+        this->ensureEditable();
+        this->_edit = 0;
+
+        PersistentDictionary<K, V> result = PersistentDictionary<K, V>(this->_root, this->_size);
+        this->_root = nullptr;
+        this->_size = 0;
+        return result;
+    }
+}
+
+#endif //ABRAHAM_PERSISTENTDICTIONARY_HPP
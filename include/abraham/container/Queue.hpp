@@ -6,6 +6,8 @@
 #define ABRAHAM_QUEUE_HPP
 
 #include <queue>
+#include <utility>
+#include "ContainerStats.hpp"
 #include <Exception.hpp>
 
 
@@ -16,13 +18,19 @@ namespace abraham {
      * @tparam T - The type of the Queue.
      */
     template<typename T>
-    class Queue {
+    class Queue : private details::ContainerTracker<ContainerType::QUEUE> {
     protected:
         /**
          * The internal std::queue object that this class wraps.
          */
         std::queue<T> _data;
 
+        /**
+         * Reports the estimated storage of this Queue to ContainerStats. Does nothing unless ABRAHAM_CONTAINER_STATS
+         * is defined.
+         */
+        void updateStats();
+
     public:
         /**
          * Default constructor that creates and empty Queue.
@@ -131,31 +139,42 @@ namespace abraham {
     }
 
     template<typename T>
-    Queue<T>::Queue(const Queue<T>& queue) {
+    Queue<T>::Queue(const Queue<T>& queue) : details::ContainerTracker<ContainerType::QUEUE>() {
         this->_data = queue._data;
+        this->recordCopy();
+        this->updateStats();
     }
 
     template<typename T>
     Queue<T>::Queue(Queue<T>&& queue) noexcept {
-        this->_data = queue._data;
+        this->_data = std::move(queue._data);
+        this->recordMove();
+        this->updateStats();
+        queue.updateStats();
     }
 
     template<typename T>
     Queue<T>::Queue(const std::queue<T>& queue) {
         this->_data = queue;
+        this->updateStats();
     }
 
     template<typename T>
     Queue<T>& Queue<T>::operator=(const Queue<T>& queue) {
         if (this == &queue) return *this;
         this->_data = queue._data;
+        this->recordCopy();
+        this->updateStats();
         return *this;
     }
 
     template<typename T>
     Queue<T>& Queue<T>::operator=(Queue<T>&& queue) noexcept {
         if (this == &queue) return *this;
-        this->_data = queue._data;
+        this->_data = std::move(queue._data);
+        this->recordMove();
+        this->updateStats();
+        queue.updateStats();
         return *this;
     }
 
@@ -172,6 +191,7 @@ namespace abraham {
     template<typename T>
     Queue<T>& Queue<T>::push(const T& object) {
         this->_data.push(object);
+        this->updateStats();
         return *this;
     }
 
@@ -183,6 +203,7 @@ namespace abraham {
 
         T object = this->_data.front();
         this->_data.pop();
+        this->updateStats();
         return object;
     }
 
@@ -218,6 +239,7 @@ namespace abraham {
     Queue<T> Queue<T>::copy() const {
         Queue<T> copy = Queue<T>();
         copy._data = this->_data;
+        copy.updateStats();
         return copy;
     }
 
@@ -225,6 +247,12 @@ namespace abraham {
     std::queue<T> Queue<T>::std_queue() const {
         return this->_data;
     }
+
+    template<typename T>
+    void Queue<T>::updateStats() {
+        const size_t count = this->_data.size();
+        this->recordStorage(details::dequeReservedBytes<T>(count), count * sizeof(T));
+    }
 }
 
 #endif //ABRAHAM_QUEUE_HPP
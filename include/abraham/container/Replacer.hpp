@@ -0,0 +1,128 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_REPLACER_HPP
+#define ABRAHAM_REPLACER_HPP
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Dictionary.hpp"
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Replaces many patterns at once. The patterns are compiled into an Aho-Corasick automaton when the Replacer is
+     * created, after which a string is rewritten in time linear in its length no matter how many patterns there are.
+     *
+     * The automaton is built from the reversed patterns and run backwards over blocks of the string, which finds the
+     * longest pattern starting at each index directly. Matches are then taken from left to right, so overlapping
+     * candidates never have to be rescanned.
+     *
+     * Matches never overlap. Where matches overlap the one starting first wins, and of those starting at the same
+     * place the longest wins, so "password" is replaced before "pass" in "password=hunter2".
+     *
+     * A Replacer is immutable once created and can be shared between threads.
+     */
+    class Replacer {
+    protected:
+        /**
+         * The patterns, indexed by the automaton's match table.
+         */
+        std::vector<std::string> _patterns;
+
+        /**
+         * The replacement for each pattern.
+         */
+        std::vector<std::string> _replacements;
+
+        /**
+         * Maps each byte to its column in the transition table. Bytes that don't appear in any pattern share column 0.
+         */
+        uint16_t _byteClasses[256];
+
+        /**
+         * The number of columns in the transition table.
+         */
+        size_t _classCount;
+
+        /**
+         * The automaton of the reversed patterns as a full DFA: the next state for each state and byte class, failure
+         * links already applied.
+         */
+        std::vector<uint32_t> _transitions;
+
+        /**
+         * For each state, the index of the longest reversed pattern ending there, or -1.
+         */
+        std::vector<int32_t> _matches;
+
+        /**
+         * The length of the longest pattern.
+         */
+        size_t _maxLength;
+
+        /**
+         * Builds the automaton from the patterns. A repeated pattern keeps the last replacement given for it.
+         */
+        void compile();
+
+        /**
+         * Calls on_match(from_index, to_index, pattern) for each non overlapping match, in order, until it returns
+         * false.
+         */
+        template<typename F>
+        void forEachMatch(const StringView& source, F on_match) const;
+
+    public:
+        /**
+         * Constructor that creates a Replacer from pattern and replacement pairs.
+         * @param replacements - The patterns and the values that should replace them. Patterns can't be empty.
+         */
+        Replacer(std::initializer_list<std::pair<String, String>> replacements);
+
+        /**
+         * Constructor that creates a Replacer from a Dictionary of patterns to replacements.
+         * @param replacements - The patterns and the values that should replace them. Patterns can't be empty.
+         */
+        Replacer(const Dictionary<String, String>& replacements);
+
+        /**
+         * @param source - The characters to rewrite.
+         * @return A String of the source with every match replaced.
+         */
+        String replace(const StringView& source) const;
+
+        /**
+         * Rewrites the source onto the end of a caller owned buffer, so a reused buffer avoids allocating.
+         * @param source - The characters to rewrite.
+         * @param output - Receives the source with every match replaced.
+         */
+        void replace(const StringView& source, std::string& output) const;
+
+        /**
+         * @param source - The characters to search.
+         * @return The number of non overlapping matches replace would make.
+         */
+        size_t count(const StringView& source) const;
+
+        /**
+         * @param source - The characters to search.
+         * @return true if any pattern occurs in the source; false otherwise.
+         */
+        bool containsMatch(const StringView& source) const;
+
+        /**
+         * @return The number of patterns.
+         */
+        size_t size() const;
+    };
+}
+
+#endif //ABRAHAM_REPLACER_HPP
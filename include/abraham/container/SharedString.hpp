@@ -0,0 +1,221 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_SHAREDSTRING_HPP
+#define ABRAHAM_SHAREDSTRING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * An immutable string that's cheap to copy. Strings of up to INLINE_CAPACITY characters are stored in the object
+     * itself; longer ones are kept in a heap buffer with an atomic reference count, which copies share, so copying is
+     * constant time and safe across threads. Substrings of a shared buffer point into it rather than copying.
+     *
+     * A SharedString made from a String or std::string rvalue takes its buffer instead of copying the characters,
+     * and an rvalue SharedString that's the only owner of its whole buffer gives it back the same way.
+     *
+     * Example:
+     *     SharedString name = SharedString(std::move(long_name));
+     *     SharedString copy = name;                       // No copy of the characters
+     *     SharedString tail = name.substringFromIndex(8);  // Shares the buffer
+     */
+    class SharedString {
+    protected:
+        /**
+         * A heap buffer shared by every SharedString that refers to it.
+         */
+        struct Buffer {
+            std::atomic<size_t> references;
+            std::string text;
+        };
+
+        size_t _length;
+
+        union {
+            /**
+             * The characters of a short string, null terminated.
+             */
+            char _inline[24];
+
+            struct {
+                Buffer* buffer;
+                const char* data;
+            } _shared;
+        };
+
+        bool isInline() const;
+
+        /**
+         * Stores characters inline or in a new Buffer, depending on their length.
+         */
+        void assign(const char* data, size_t length);
+
+        /**
+         * Stores a std::string, taking its buffer if it's too long to store inline.
+         */
+        void assign(std::string&& string);
+
+        /**
+         * Refers to the same characters as another SharedString.
+         */
+        void share(const SharedString& string);
+
+        /**
+         * Drops this SharedString's reference to its Buffer, freeing the Buffer if it was the last.
+         */
+        void release();
+
+    public:
+        /**
+         * The longest string that's stored without a heap buffer.
+         */
+        static const size_t INLINE_CAPACITY = 23;
+
+        /**
+         * Constructor that creates an empty SharedString.
+         */
+        SharedString();
+
+        SharedString(const char* cstring);
+
+        SharedString(const char* data, size_t length);
+
+        SharedString(const StringView& string);
+
+        SharedString(const std::string& string);
+
+        /**
+         * Constructor that takes the buffer of a std::string rather than copying it.
+         */
+        SharedString(std::string&& string);
+
+        SharedString(const String& string);
+
+        /**
+         * Constructor that takes the buffer of a String rather than copying it.
+         */
+        SharedString(String&& string);
+
+        /**
+         * Constructor that shares the characters of another SharedString.
+         */
+        SharedString(const SharedString& string);
+
+        SharedString(SharedString&& string) noexcept;
+
+        ~SharedString();
+
+        SharedString& operator=(const SharedString& string);
+
+        SharedString& operator=(SharedString&& string) noexcept;
+
+        bool operator==(const SharedString& string) const;
+
+        bool operator!=(const SharedString& string) const;
+
+        bool operator<(const SharedString& string) const;
+
+        /**
+         * @param index - The 0-based index of a character.
+         * @return The character at the index.
+         */
+        char operator[](size_t index) const;
+
+        /**
+         * @return The number of characters in the SharedString.
+         */
+        size_t length() const;
+
+        /**
+         * @return true if the SharedString has no characters; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @return A pointer to the first character. The characters are not null terminated if the SharedString is
+         * a substring of a shared buffer.
+         */
+        const char* data() const;
+
+        /**
+         * @return A view of the characters, valid for as long as this SharedString or a copy of it.
+         */
+        StringView view() const;
+
+        /**
+         * @return true if the characters are in a heap buffer that other SharedStrings may share; false if they're
+         * stored inline.
+         */
+        bool isShared() const;
+
+        /**
+         * @param from_index - The index the substring starts at.
+         * @param to_index - The index the substring ends before, up to the length.
+         * @return The substring, sharing this SharedString's buffer unless it's short enough to store inline.
+         */
+        SharedString substring(size_t from_index, size_t to_index) const;
+
+        /**
+         * @param index - The index the substring starts at, up to the length.
+         * @return The substring from the index to the end.
+         */
+        SharedString substringFromIndex(size_t index) const;
+
+        /**
+         * @param index - The index the substring ends before, up to the length.
+         * @return The substring from the start to the index.
+         */
+        SharedString substringToIndex(size_t index) const;
+
+        /**
+         * @return A hash of the characters, equal to the hash of a String or StringView holding them.
+         */
+        size_t hash() const;
+
+        /**
+         * @return A String copy of the characters.
+         */
+        String toString() const &;
+
+        /**
+         * Moves the characters into a String, leaving this SharedString empty.
+         * @return A String of the characters, which takes the buffer without copying if this is its only owner and
+         * refers to all of it.
+         */
+        String toString() &&;
+
+        /**
+         * @return A std::string copy of the characters.
+         */
+        std::string std_string() const;
+    };
+
+    template<>
+    struct Formatter<SharedString> {
+        static size_t length(const SharedString& value) { return value.length(); }
+
+        static void append(std::string& output, const SharedString& value) {
+            output.append(value.data(), value.length());
+        }
+    };
+}
+
+namespace std {
+    template<>
+    struct hash<abraham::SharedString> {
+        size_t operator()(const abraham::SharedString& string) const {
+            return string.hash();
+        }
+    };
+}
+
+#endif //ABRAHAM_SHAREDSTRING_HPP
@@ -6,6 +6,8 @@
 #define ABRAHAM_STACK_HPP
 
 #include <stack>
+#include <utility>
+#include "ContainerStats.hpp"
 #include "Exception.hpp"
 
 
@@ -16,13 +18,19 @@ namespace abraham {
      * @tparam T - The type of the Stack.
      */
     template<typename T>
-    class Stack {
+    class Stack : private details::ContainerTracker<ContainerType::STACK> {
     protected:
         /**
          * The internal std::stack object that this class wraps.
          */
         std::stack<T> _data;
 
+        /**
+         * Reports the estimated storage of this Stack to ContainerStats. Does nothing unless ABRAHAM_CONTAINER_STATS
+         * is defined.
+         */
+        void updateStats();
+
     public:
         /**
          * Default constructor that creates an empty Stack.
@@ -125,30 +133,41 @@ namespace abraham {
     }
 
     template<typename T>
-    Stack<T>::Stack(const Stack<T>& stack) {
+    Stack<T>::Stack(const Stack<T>& stack) : details::ContainerTracker<ContainerType::STACK>() {
         this->_data = stack._data;
+        this->recordCopy();
+        this->updateStats();
     }
 
     template<typename T>
     Stack<T>::Stack(Stack<T>&& stack) noexcept {
-        this->_data = stack._data;
+        this->_data = std::move(stack._data);
+        this->recordMove();
+        this->updateStats();
+        stack.updateStats();
     }
 
     template<typename T>
     Stack<T>::Stack(const std::stack<T>& std_stack) {
         this->_data = std_stack;
+        this->updateStats();
     }
 
     template<typename T>
     Stack<T>& Stack<T>::operator=(const Stack<T>& stack) {
         this->_data = stack._data;
+        this->recordCopy();
+        this->updateStats();
         return *this;
     }
 
     template<typename T>
     Stack<T>& Stack<T>::operator=(Stack<T>&& stack) noexcept {
         if (this == & stack) return *this;
-        this->_data = stack._data;
+        this->_data = std::move(stack._data);
+        this->recordMove();
+        this->updateStats();
+        stack.updateStats();
         return *this;
     }
 
@@ -165,6 +184,7 @@ namespace abraham {
     template<typename T>
     Stack<T>& Stack<T>::push(const T& object) {
         this->_data.push(object);
+        this->updateStats();
         return *this;
     }
 
@@ -176,6 +196,7 @@ namespace abraham {
 
         T object = this->_data.top();
         this->_data.pop();
+        this->updateStats();
         return object;
     }
 
@@ -202,6 +223,7 @@ namespace abraham {
     Stack<T> Stack<T>::copy() const {
         Stack<T> copy = Stack<T>();
         copy._data = this->_data;
+        copy.updateStats();
         return copy;
     }
 
@@ -209,6 +231,12 @@ namespace abraham {
     std::stack<T> Stack<T>::std_stack() const {
         return this->_data;
     }
+
+    template<typename T>
+    void Stack<T>::updateStats() {
+        const size_t count = this->_data.size();
+        this->recordStorage(details::dequeReservedBytes<T>(count), count * sizeof(T));
+    }
 }
 
 #endif //ABRAHAM_STACK_HPP
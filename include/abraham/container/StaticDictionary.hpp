@@ -0,0 +1,515 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_STATICDICTIONARY_HPP
+#define ABRAHAM_STATICDICTIONARY_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Array.hpp"
+#include "Dictionary.hpp"
+#include "String.hpp"
+
+
+namespace abraham {
+
+    /// \cond IGNORE
+    namespace details {
+        /**
+         * The header at the beginning of every StaticDictionary file. All offsets are from the start of the file,
+         * and all integers are stored in native byte order.
+         */
+        struct StaticDictionaryHeader {
+            char magic[8];
+            uint32_t version;
+            uint32_t valueSize;
+            uint64_t count;
+            uint64_t bucketCount;
+            uint64_t seed;
+            uint64_t displacementOffset;
+            uint64_t slotOffset;
+            uint64_t valueOffset;
+            uint64_t blobOffset;
+            uint64_t fileSize;
+        };
+
+        /**
+         * A slot of the perfect hash table. Each key owns exactly one slot, which also indexes its value.
+         */
+        struct StaticDictionarySlot {
+            uint64_t keyOffset;
+            uint32_t keyLength;
+            uint32_t fingerprint;
+        };
+
+        /**
+         * A reference to a String value stored in the blob section of a StaticDictionary file.
+         */
+        struct StaticDictionaryStringRef {
+            uint64_t offset;
+            uint64_t length;
+        };
+
+        /**
+         * The read only memory a StaticDictionary file has been mapped into.
+         */
+        class StaticDictionaryMapping {
+        protected:
+            const char* _data;
+            size_t _size;
+            bool _isMapped;
+
+        public:
+            explicit StaticDictionaryMapping(const std::string& path);
+
+            StaticDictionaryMapping(const StaticDictionaryMapping&) = delete;
+
+            StaticDictionaryMapping& operator=(const StaticDictionaryMapping&) = delete;
+
+            ~StaticDictionaryMapping();
+
+            const char* data() const;
+
+            size_t size() const;
+        };
+
+        /**
+         * Computes the minimal perfect hash of a set of keys with the hash and displace (CHD) algorithm.
+         * @param keys - The distinct keys to place.
+         * @param seed - Receives the seed the key hashes were computed with.
+         * @param displacements - Receives one displacement per bucket.
+         * @param slots - Receives the slot assigned to each key, in the same order as the keys.
+         */
+        void buildStaticDictionaryHash(const std::vector<std::string>& keys, uint64_t& seed,
+                                       std::vector<uint32_t>& displacements, std::vector<uint64_t>& slots);
+
+        /**
+         * Writes a StaticDictionary file.
+         * @param path - The path of the file to write.
+         * @param keys - The keys, in insertion order.
+         * @param valueSize - The size of each value record, or 0 for String values.
+         * @param valueStride - The number of bytes each value record occupies in the values section.
+         * @param values - The value records, in the same order as the keys.
+         * @param blob - Additional bytes referenced by the value records, appended after the keys.
+         */
+        void writeStaticDictionary(const std::string& path, const std::vector<std::string>& keys,
+                                   uint32_t valueSize, size_t valueStride, const std::vector<char>& values,
+                                   const std::string& blob);
+
+        /**
+         * Encodes and decodes the value records of a StaticDictionary. Trivially copyable values are stored as raw
+         * bytes, so looking one up is a single copy out of the mapped file.
+         */
+        template<typename V, typename Enable = void>
+        struct StaticDictionaryValue {
+            static_assert(std::is_trivially_copyable<V>::value,
+                          "StaticDictionary values must be trivially copyable, or String");
+
+            static const uint32_t SIZE = sizeof(V);
+
+            static void encode(const V& value, char* record, std::string&) {
+                std::memcpy(record, &value, sizeof(V));
+            }
+
+            static V decode(const char* record, const char*) {
+                V value;
+                std::memcpy(&value, record, sizeof(V));
+                return value;
+            }
+
+            static bool isValid(const char*, uint64_t) {
+                return true;
+            }
+        };
+
+        /**
+         * String values are stored in the blob section, and referenced from the value record.
+         */
+        template<typename V>
+        struct StaticDictionaryValue<V, typename std::enable_if<std::is_same<V, String>::value>::type> {
+            static const uint32_t SIZE = 0;
+
+            static void encode(const String& value, char* record, std::string& blob) {
+                StaticDictionaryStringRef ref = {blob.size(), value.length()};
+                blob.append(value.c_string(), value.length());
+                std::memcpy(record, &ref, sizeof(ref));
+            }
+
+            static String decode(const char* record, const char* blob) {
+                StaticDictionaryStringRef ref;
+                std::memcpy(&ref, record, sizeof(ref));
+                return String(std::string(blob + ref.offset, ref.length));
+            }
+
+            static bool isValid(const char* record, uint64_t blob_size) {
+                StaticDictionaryStringRef ref;
+                std::memcpy(&ref, record, sizeof(ref));
+                return ref.offset <= blob_size && ref.length <= blob_size - ref.offset;
+            }
+        };
+    }
+    /// \endcond IGNORE
+
+
+    /**
+     * The untyped part of a StaticDictionary: maps a file and resolves keys to slots.
+     */
+    class StaticDictionaryBase {
+    protected:
+        /**
+         * The mapped file. Shared between copies of the StaticDictionary.
+         */
+        std::shared_ptr<details::StaticDictionaryMapping> _mapping;
+
+        /**
+         * The header of the mapped file.
+         */
+        const details::StaticDictionaryHeader* _header;
+
+        /**
+         * The displacement of each bucket.
+         */
+        const uint32_t* _displacements;
+
+        /**
+         * The slot table.
+         */
+        const details::StaticDictionarySlot* _slots;
+
+        /**
+         * The value records, indexed by slot.
+         */
+        const char* _values;
+
+        /**
+         * The keys and any other variable length data.
+         */
+        const char* _blob;
+
+        /**
+         * The number of bytes in the blob section.
+         */
+        uint64_t _blobSize;
+
+        /**
+         * The number of bytes each value record occupies.
+         */
+        size_t _valueStride;
+
+        /**
+         * Default constructor that creates an empty StaticDictionaryBase.
+         */
+        StaticDictionaryBase();
+
+        /**
+         * Constructor that maps a file and validates its header and the bounds of its sections. Slots and value
+         * records aren't read, so opening costs no more than mapping the file.
+         * @param path - The path of the file to map.
+         * @param value_size - The value size the file is expected to have been built with.
+         * @param value_stride - The number of bytes each value record occupies.
+         */
+        StaticDictionaryBase(const String& path, uint32_t value_size, size_t value_stride);
+
+        /**
+         * Resolves a key to its slot.
+         * @param key - The bytes of the key.
+         * @param length - The number of bytes in the key.
+         * @return The slot of the key. NO_INDEX if the key isn't present.
+         */
+        size_t slotForKey(const char* key, size_t length) const;
+
+        /**
+         * Finds the bytes of a slot's key, after checking they're within the blob section. An InvalidValueException
+         * is thrown if they aren't.
+         * @param slot - The slot of the key.
+         * @return The first byte of the key.
+         */
+        const char* keyAt(size_t slot) const;
+
+        /**
+         * Checks the key of every slot, as keyAt does.
+         */
+        void validateKeys() const;
+
+    public:
+        /**
+         * @return The number of key/value pairs in the StaticDictionary.
+         */
+        size_t size() const;
+
+        /**
+         * @return true if the StaticDictionary is empty; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * Determines whether the specified key exists in the StaticDictionary.
+         * @param key - The key to be found.
+         * @return true if the key is present in the StaticDictionary; false otherwise.
+         */
+        bool containsKey(const String& key) const;
+
+        /**
+         * @return An Array object containing all the keys of this StaticDictionary, in slot order.
+         */
+        Array<String> getKeys() const;
+
+        /**
+         * Value representing a non-existent slot.
+         */
+        static const size_t NO_INDEX;
+    };
+
+
+    /**
+     * A read only Dictionary<String, V> that is memory mapped from a file written by StaticDictionaryBuilder.
+     * Keys are placed with a minimal perfect hash, so a lookup reads one displacement, one slot and the key bytes,
+     * and opening a file costs no more than mapping it. Only the header is checked when the file is opened; each slot
+     * and value record is checked when it's read, and validate checks all of them up front. Values must be trivially
+     * copyable, or String.
+     * @tparam V - The value type of the StaticDictionary.
+     */
+    template<typename V>
+    class StaticDictionary : public StaticDictionaryBase {
+    protected:
+        /**
+         * Finds a slot's value record, after checking anything it refers to is within the blob section. An
+         * InvalidValueException is thrown if it isn't.
+         * @param slot - The slot of the value.
+         * @return The value decoded from the record.
+         */
+        V valueAt(size_t slot) const;
+
+    public:
+        /**
+         * Default constructor that creates an empty StaticDictionary.
+         */
+        StaticDictionary<V>();
+
+        /**
+         * Constructor that maps a file written by StaticDictionaryBuilder.
+         * An IOException is thrown if the file can't be read, and an InvalidValueException if it isn't valid.
+         * @param path - The path of the file to map.
+         */
+        explicit StaticDictionary<V>(const String& path);
+
+        /**
+         * Checks every key and value record in the file, reading all of it. Lookups check only what they read, so
+         * this is needed only to reject a corrupt file before it's used.
+         * An InvalidValueException is thrown if the file isn't valid.
+         */
+        void validate() const;
+
+        /**
+         * Retrieves the element associated with the specified key.
+         * @param key - The key associated with the desired element.
+         * @return - The element associated with the specified key.
+         */
+        V objectForKey(const String& key) const;
+
+        /**
+         * Retrieves the element associated with the specified key, if it exists.
+         * @param key - The key associated with the desired element.
+         * @param value - Set to the element associated with the key, if it exists.
+         * @return true if the key is present in the StaticDictionary; false otherwise.
+         */
+        bool tryObjectForKey(const String& key, V& value) const;
+
+        /**
+         * @return An Array object containing all the values of this StaticDictionary, in slot order.
+         */
+        Array<V> getValues() const;
+
+        /**
+         * @return A Dictionary containing the same key/value pairs.
+         */
+        Dictionary<String, V> dictionary() const;
+    };
+
+
+    /**
+     * Builds the file format read by StaticDictionary.
+     * @tparam V - The value type of the StaticDictionary.
+     */
+    template<typename V>
+    class StaticDictionaryBuilder {
+    protected:
+        /**
+         * The keys that have been added, in insertion order.
+         */
+        std::vector<std::string> _keys;
+
+        /**
+         * The values that have been added, in insertion order.
+         */
+        std::vector<V> _values;
+
+        /**
+         * The keys that have been added, used to reject duplicates.
+         */
+        Dictionary<String, size_t> _indexes;
+
+    public:
+        /**
+         * Default constructor that creates an empty StaticDictionaryBuilder.
+         */
+        StaticDictionaryBuilder<V>();
+
+        /**
+         * Constructor that creates a StaticDictionaryBuilder from the contents of a Dictionary.
+         * @param dictionary - The Dictionary whose key/value pairs will be written.
+         */
+        StaticDictionaryBuilder<V>(const Dictionary<String, V>& dictionary);
+
+        /**
+         * Add a new key/value pair.
+         * @param key - The key of the key/value pair.
+         * @param value - The value associated with the key.
+         * @return A self reference.
+         */
+        StaticDictionaryBuilder<V>& addObject(const String& key, const V& value);
+
+        /**
+         * @return The number of key/value pairs that have been added.
+         */
+        size_t size() const;
+
+        /**
+         * Computes the perfect hash and writes the StaticDictionary file. An IOException is thrown on failure.
+         * @param path - The path of the file to write.
+         */
+        void write(const String& path) const;
+    };
+
+
+/*
+ * Template Implementation
+ */
+
+#include "Exception.hpp"
+
+    // StaticDictionary
+
+    template<typename V>
+    StaticDictionary<V>::StaticDictionary() : StaticDictionaryBase() {}
+
+    template<typename V>
+    StaticDictionary<V>::StaticDictionary(const String& path)
+            : StaticDictionaryBase(path, details::StaticDictionaryValue<V>::SIZE,
+                                   details::StaticDictionaryValue<V>::SIZE == 0
+                                   ? sizeof(details::StaticDictionaryStringRef)
+                                   : sizeof(V)) {}
+
+    template<typename V>
+    V StaticDictionary<V>::valueAt(size_t slot) const {
+        const char* record = this->_values + slot * this->_valueStride;
+        if (!details::StaticDictionaryValue<V>::isValid(record, this->_blobSize)) {
+            throw InvalidValueException("Corrupt StaticDictionary file: value out of bounds");
+        }
+
+        return details::StaticDictionaryValue<V>::decode(record, this->_blob);
+    }
+
+    template<typename V>
+    void StaticDictionary<V>::validate() const {
+        this->validateKeys();
+        for (size_t i = 0; i < this->size(); ++i) {
+            this->valueAt(i);
+        }
+    }
+
+    template<typename V>
+    V StaticDictionary<V>::objectForKey(const String& key) const {
+        size_t slot = this->slotForKey(key.c_string(), key.length());
+        if (slot != NO_INDEX) {
+            return this->valueAt(slot);
+        } else {
+            throw InvalidArgumentException("Key does not exist");
+        }
+    }
+
+    template<typename V>
+    bool StaticDictionary<V>::tryObjectForKey(const String& key, V& value) const {
+        size_t slot = this->slotForKey(key.c_string(), key.length());
+        if (slot == NO_INDEX) return false;
+
+        value = this->valueAt(slot);
+        return true;
+    }
+
+    template<typename V>
+    Array<V> StaticDictionary<V>::getValues() const {
+        Array<V> values = Array<V>(this->size());
+        for (size_t i = 0; i < this->size(); ++i) {
+            values[i] = this->valueAt(i);
+        }
+
+        return values;
+    }
+
+    template<typename V>
+    Dictionary<String, V> StaticDictionary<V>::dictionary() const {
+        Dictionary<String, V> dictionary = Dictionary<String, V>();
+        Array<String> keys = this->getKeys();
+        for (size_t i = 0; i < keys.size(); ++i) {
+            dictionary[keys[i]] = this->valueAt(i);
+        }
+
+        return dictionary;
+    }
+
+    // StaticDictionaryBuilder
+
+    template<typename V>
+    StaticDictionaryBuilder<V>::StaticDictionaryBuilder() {
+        this->_keys = std::vector<std::string>();
+        this->_values = std::vector<V>();
+    }
+
+    template<typename V>
+    StaticDictionaryBuilder<V>::StaticDictionaryBuilder(const Dictionary<String, V>& dictionary) {
+        for (auto it = dictionary.begin(); it != dictionary.end(); ++it) {
+            this->addObject(it->first, it->second);
+        }
+    }
+
+    template<typename V>
+    StaticDictionaryBuilder<V>& StaticDictionaryBuilder<V>::addObject(const String& key, const V& value) {
+        if (this->_indexes.containsKey(key)) {
+            throw InvalidArgumentException("Key already exists");
+        }
+
+        this->_indexes[key] = this->_keys.size();
+        this->_keys.push_back(key.std_string());
+        this->_values.push_back(value);
+        return *this;
+    }
+
+    template<typename V>
+    size_t StaticDictionaryBuilder<V>::size() const {
+        return this->_keys.size();
+    }
+
+    template<typename V>
+    void StaticDictionaryBuilder<V>::write(const String& path) const {
+        const size_t stride = details::StaticDictionaryValue<V>::SIZE == 0
+                              ? sizeof(details::StaticDictionaryStringRef)
+                              : sizeof(V);
+
+        std::vector<char> records = std::vector<char>(stride * this->_values.size());
+        std::string blob = std::string();
+        for (size_t i = 0; i < this->_values.size(); ++i) {
+            details::StaticDictionaryValue<V>::encode(this->_values[i], records.data() + i * stride, blob);
+        }
+
+        details::writeStaticDictionary(path.std_string(), this->_keys, details::StaticDictionaryValue<V>::SIZE,
+                                       stride, records, blob);
+    }
+}
+
+#endif //ABRAHAM_STATICDICTIONARY_HPP
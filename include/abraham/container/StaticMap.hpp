@@ -0,0 +1,223 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_STATICMAP_HPP
+#define ABRAHAM_STATICMAP_HPP
+
+#include <cstddef>
+#include "Exception.hpp"
+
+
+namespace abraham {
+
+    /**
+     * A key/value pair of a StaticMap.
+     * @tparam K - The key type of the StaticMap.
+     * @tparam V - The value type of the StaticMap.
+     */
+    template<typename K, typename V>
+    struct StaticMapEntry {
+        K key;
+        V value;
+    };
+
+    /// \cond IGNORE
+    namespace details {
+        /**
+         * Orders and compares the keys of a StaticMap. Keys are compared with operator< and operator== by default.
+         */
+        template<typename K>
+        struct StaticMapKeyTraits {
+            static constexpr bool less(const K& left, const K& right) {
+                return left < right;
+            }
+
+            static constexpr bool equal(const K& left, const K& right) {
+                return left == right;
+            }
+        };
+
+        /**
+         * C string keys are compared by their contents, not their address.
+         */
+        template<>
+        struct StaticMapKeyTraits<const char*> {
+            static constexpr int compare(const char* left, const char* right) {
+                while (*left != '\0' && *left == *right) {
+                    ++left;
+                    ++right;
+                }
+
+                return static_cast<unsigned char>(*left) - static_cast<unsigned char>(*right);
+            }
+
+            static constexpr bool less(const char* left, const char* right) {
+                return compare(left, right) < 0;
+            }
+
+            static constexpr bool equal(const char* left, const char* right) {
+                return compare(left, right) == 0;
+            }
+        };
+    }
+    /// \endcond IGNORE
+
+
+    /**
+     * An immutable map over a fixed set of keys that is built entirely at compile time. The entries are sorted by
+     * the compiler, so a constexpr StaticMap needs no startup initialization and no heap, and a lookup is a short
+     * binary search the compiler can unroll. Duplicate keys in a constexpr StaticMap are a compile error.
+     *
+     * Keys and values must be literal types that are default constructible. C string keys are compared by contents.
+     * Use makeStaticMap() to deduce the size from a list of pairs:
+     *
+     * constexpr auto NAMES = makeStaticMap<int, const char*>({{2, "two"}, {1, "one"}});
+     *
+     * @tparam K - The key type of the StaticMap.
+     * @tparam V - The value type of the StaticMap.
+     * @tparam N - The number of entries in the StaticMap.
+     */
+    template<typename K, typename V, size_t N>
+    class StaticMap {
+        static_assert(N > 0, "A StaticMap must have at least one entry");
+
+    protected:
+        /**
+         * The entries, sorted by key.
+         */
+        StaticMapEntry<K, V> _entries[N];
+
+    public:
+        /**
+         * Value representing a non-existent index.
+         */
+        static constexpr size_t NO_INDEX = static_cast<size_t>(-1);
+
+        /**
+         * Constructor that creates a StaticMap from an array of entries, in any order.
+         * @param entries - The entries of the StaticMap.
+         */
+        constexpr explicit StaticMap(const StaticMapEntry<K, V> (&entries)[N]) : _entries() {
+            for (size_t i = 0; i < N; ++i) {
+                size_t j = i;
+                while (j > 0 && details::StaticMapKeyTraits<K>::less(entries[i].key, this->_entries[j - 1].key)) {
+                    this->_entries[j] = this->_entries[j - 1];
+                    --j;
+                }
+                this->_entries[j] = entries[i];
+            }
+
+            for (size_t i = 1; i < N; ++i) {
+                if (details::StaticMapKeyTraits<K>::equal(this->_entries[i - 1].key, this->_entries[i].key)) {
+                    throw InvalidArgumentException("Key already exists");
+                }
+            }
+        }
+
+        /**
+         * Finds the index of a key in the sorted entries.
+         * @param key - The key to be found.
+         * @return The index of the key. NO_INDEX if the key isn't present.
+         */
+        constexpr size_t indexOfKey(const K& key) const {
+            size_t low = 0;
+            size_t high = N;
+            while (low < high) {
+                size_t middle = low + (high - low) / 2;
+                if (details::StaticMapKeyTraits<K>::less(this->_entries[middle].key, key)) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+
+            if (low < N && details::StaticMapKeyTraits<K>::equal(this->_entries[low].key, key)) {
+                return low;
+            }
+
+            return NO_INDEX;
+        }
+
+        /**
+         * Determines whether the specified key exists in the StaticMap.
+         * @param key - The key to be found.
+         * @return true if the key is present in the StaticMap; false otherwise.
+         */
+        constexpr bool containsKey(const K& key) const {
+            return this->indexOfKey(key) != NO_INDEX;
+        }
+
+        /**
+         * Retrieves the element associated with the specified key.
+         * An InvalidArgumentException is thrown if the key doesn't exist.
+         * @param key - The key associated with the desired element.
+         * @return The element associated with the specified key.
+         */
+        constexpr const V& objectForKey(const K& key) const {
+            size_t index = this->indexOfKey(key);
+            if (index == NO_INDEX) {
+                throw InvalidArgumentException("Key does not exist");
+            }
+
+            return this->_entries[index].value;
+        }
+
+        /**
+         * Retrieves the element associated with the specified key, or a fallback value if it doesn't exist.
+         * @param key - The key associated with the desired element.
+         * @param default_value - The value returned if the key doesn't exist.
+         * @return The element associated with the specified key, or the default value.
+         */
+        constexpr V objectForKey(const K& key, const V& default_value) const {
+            size_t index = this->indexOfKey(key);
+            return index == NO_INDEX ? default_value : this->_entries[index].value;
+        }
+
+        /**
+         * @return The number of key/value pairs in the StaticMap.
+         */
+        constexpr size_t size() const {
+            return N;
+        }
+
+        /**
+         * @return true if the StaticMap is empty; false otherwise.
+         */
+        constexpr bool isEmpty() const {
+            return N == 0;
+        }
+
+        /**
+         * @return A pointer to the first entry, in key order.
+         */
+        constexpr const StaticMapEntry<K, V>* begin() const {
+            return this->_entries;
+        }
+
+        /**
+         * @return A pointer past the last entry.
+         */
+        constexpr const StaticMapEntry<K, V>* end() const {
+            return this->_entries + N;
+        }
+    };
+
+    template<typename K, typename V, size_t N>
+    constexpr size_t StaticMap<K, V, N>::NO_INDEX;
+
+
+    /**
+     * Creates a StaticMap, deducing its size from the list of entries.
+     * @tparam K - The key type of the StaticMap.
+     * @tparam V - The value type of the StaticMap.
+     * @param entries - The entries of the StaticMap, in any order.
+     * @return A StaticMap containing the entries.
+     */
+    template<typename K, typename V, size_t N>
+    constexpr StaticMap<K, V, N> makeStaticMap(const StaticMapEntry<K, V> (&entries)[N]) {
+        return StaticMap<K, V, N>(entries);
+    }
+}
+
+#endif //ABRAHAM_STATICMAP_HPP
@@ -7,20 +7,50 @@
 
 #include <string>
 #include <vector>
+#include "ContainerStats.hpp"
+#include "Format.hpp"
+#include "Hash.hpp"
+#include "StringView.hpp"
 
 
 namespace abraham {
 
+    class CharSet;
+
+    class Replacer;
+
+    class SharedString;
+
+    class StringSearcher;
+
     /**
      * A wrapper around std::string that provides more convenient and higher level functions.
      */
-    class String {
+    class String : private details::ContainerTracker<ContainerType::STRING> {
     protected:
+        friend class SharedString;
+
         /**
          * The internal std::string object that this class wraps.
          */
         std::string _data;
 
+        /**
+         * Reports the storage of this String to ContainerStats. Does nothing unless ABRAHAM_CONTAINER_STATS is defined.
+         */
+        void updateStats();
+
+        /**
+         * Formats a number directly onto the end of the String.
+         */
+        template<typename T>
+        String& appendNumber(T value);
+
+        /**
+         * Surrounds the String with copies of another String.
+         */
+        String& padString(const String& string, size_t left_count, size_t right_count);
+
     public:
         /**
          * Default constructor that creates an empty String object.
@@ -45,6 +75,12 @@ namespace abraham {
          */
         String(const std::string& string);
 
+        /**
+         * Constructor that creates a String object by taking the buffer of a std::string.
+         * @param string - The std::string whose buffer the String object takes.
+         */
+        String(std::string&& string);
+
         /**
          * Constructor that creates a String object from another String object.
          * @param string - The String object that this String object is constructed from.
@@ -57,6 +93,81 @@ namespace abraham {
          */
         String(String&& string) noexcept;
 
+        /**
+         * @param value - The number to format.
+         * @return A String of the number's decimal digits.
+         */
+        static String fromInt(long long value);
+
+        /**
+         * @param value - The number to format.
+         * @return A String of the number's decimal digits.
+         */
+        static String fromUnsigned(unsigned long long value);
+
+        /**
+         * @param value - The number to format.
+         * @return A String of the shortest decimal that parses back to the same value, as NumberFormatter writes it.
+         */
+        static String fromDouble(double value);
+
+        /**
+         * @param value - The number to format.
+         * @return A String of the shortest decimal that parses back to the same value, as NumberFormatter writes it.
+         */
+        static String fromFloat(float value);
+
+        /**
+         * Formats arguments into a new String, replacing each {} in the format with the next argument. {{ and }}
+         * write a literal brace. The String is sized once for the whole result and each argument is written
+         * straight into it by its Formatter.
+         *
+         * Example:
+         *     String message = String::format(ABRAHAM_FORMAT("{} took {}ms"), name, elapsed);
+         *
+         * @param format - A format string wrapped with ABRAHAM_FORMAT, checked against the arguments at compile time.
+         * @param args - The values to format.
+         * @return The formatted String.
+         */
+        template<typename Format, typename... Args,
+                 typename = typename std::enable_if<std::is_base_of<details::CompileTimeFormat, Format>::value>::type>
+        static String format(Format format, const Args&... args);
+
+        /**
+         * Formats arguments into a new String, as the compile time checked format does, for a format string that
+         * isn't known until runtime.
+         * @param format - The format string.
+         * @param args - The values to format.
+         * @return The formatted String.
+         * @throws InvalidArgumentException if the format has an unmatched brace or a different number of
+         * placeholders than arguments.
+         */
+        template<typename... Args>
+        static String format(const StringView& format, const Args&... args);
+
+        /**
+         * Formats arguments onto the end of an existing String.
+         * @param string - The String to append to.
+         * @param format - A format string wrapped with ABRAHAM_FORMAT, checked against the arguments at compile time.
+         * @param args - The values to format.
+         * @return The String that was appended to.
+         */
+        template<typename Format, typename... Args,
+                 typename = typename std::enable_if<std::is_base_of<details::CompileTimeFormat, Format>::value>::type>
+        static String& formatTo(String& string, Format format, const Args&... args);
+
+        /**
+         * Formats arguments onto the end of an existing String, for a format string that isn't known until runtime.
+         * @param string - The String to append to.
+         * @param format - The format string.
+         * @param args - The values to format.
+         * @return The String that was appended to.
+         * @throws InvalidArgumentException if the format has an unmatched brace or a different number of
+         * placeholders than arguments.
+         */
+        template<typename... Args>
+        static String& formatTo(String& string, const StringView& format, const Args&... args);
+
         /**
          * Operator overload to access String characters using the '[ ]' operator.
          * @param index - The 0-based index of the character in the String.
@@ -139,6 +250,12 @@ namespace abraham {
          */
         size_t length() const;
 
+        /**
+         * @return A hash of the characters, equal to the hash of a StringView of them. It's computed on each call,
+         * since a String can change; keys hashed repeatedly can be interned with InternTable instead.
+         */
+        size_t hash() const;
+
         /**
          * @param index - The 0-based index of a character in the String.
          * @return A char references of the character at the provided index.
@@ -191,6 +308,72 @@ namespace abraham {
          */
         String& append(const String& string);
 
+        /**
+         * Appends a character to the end of this String.
+         * @param character - The character to append.
+         * @return A self reference.
+         */
+        String& append(char character);
+
+        /**
+         * Appends the decimal digits of a number to the end of this String, formatted in place without a temporary.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        String& append(int value);
+
+        /**
+         * Appends the decimal digits of a number to the end of this String, formatted in place without a temporary.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        String& append(long value);
+
+        /**
+         * Appends the decimal digits of a number to the end of this String, formatted in place without a temporary.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        String& append(long long value);
+
+        /**
+         * Appends the decimal digits of a number to the end of this String, formatted in place without a temporary.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        String& append(unsigned value);
+
+        /**
+         * Appends the decimal digits of a number to the end of this String, formatted in place without a temporary.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        String& append(unsigned long value);
+
+        /**
+         * Appends the decimal digits of a number to the end of this String, formatted in place without a
+         * temporary.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        String& append(unsigned long long value);
+
+        /**
+         * Appends a number to the end of this String, with the fewest digits that parse back to the same float.
+         * Formatted as by NumberFormatter.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        String& append(float value);
+
+        /**
+         * Appends a number to the end of this String, with the fewest digits that parse back to the same double.
+         * Formatted as by NumberFormatter.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        String& append(double value);
+
         /**
          * Retrieve a subsection of the String.
          * @param from_index - The starting index of the desired substring.
@@ -213,6 +396,25 @@ namespace abraham {
          */
         String substringToIndex(size_t index) const;
 
+        /**
+         * Retrieve a subsection of the String by UTF-8 code point rather than byte. The String must be valid UTF-8.
+         * @param from_index - The index of the code point the substring starts at.
+         * @param to_index - The index of the code point the substring ends before, up to the number of code points.
+         * @return A new String whose value is that of the substring.
+         */
+        String codePointSubstring(size_t from_index, size_t to_index) const;
+
+        /**
+         * @return true if the String is valid UTF-8; false otherwise.
+         */
+        bool isValidUtf8() const;
+
+        /**
+         * @return The number of UTF-8 code points in the String, which must be valid UTF-8. length() is the number of
+         * bytes.
+         */
+        size_t codePointLength() const;
+
         /**
          * Splits the String into components at each provided delimeter.
          * If a delimeter of size 0 is provided, the String will be split on all characters.
@@ -221,6 +423,34 @@ namespace abraham {
          */
         std::vector<String> split(const String& delimiter) const;
 
+        /**
+         * @return A StringView of the whole String. It's invalidated when the String is modified.
+         */
+        StringView view() const;
+
+        /**
+         * Retrieve a subsection of the String without copying it.
+         * @param from_index - The starting index of the desired substring.
+         * @param to_index - The ending index of the desired substring.
+         * @return A StringView of the substring. It's invalidated when the String is modified.
+         */
+        StringView substringView(size_t from_index, size_t to_index) const;
+
+        /**
+         * Splits the String into components at each provided delimiter, without copying them.
+         * If a delimiter of size 0 is provided, the String will be split on all characters.
+         * @param delimiter - The value the String should be split on.
+         * @return A vector of StringView components. They're invalidated when the String is modified.
+         */
+        std::vector<StringView> splitViews(const StringView& delimiter) const;
+
+        /**
+         * Trims the provided characters from both ends of the String, without copying or modifying it.
+         * @param characters - The characters that should be trimmed.
+         * @return A StringView of the trimmed String. It's invalidated when the String is modified.
+         */
+        StringView trimmedView(const StringView& characters = ASCII_WHITESPACE) const;
+
         /**
          * Inserts a String at the provided index.
          * @param string - The value to be inserted.
@@ -236,6 +466,13 @@ namespace abraham {
          */
         String& trim(const String& characters = ASCII_WHITESPACE);
 
+        /**
+         * Trims a set of characters from both ends of the String.
+         * @param characters - The set of characters that should be trimmed.
+         * @return A self reference.
+         */
+        String& trim(const CharSet& characters);
+
         /**
          * Trims the provided characters from the beginning of the String.
          * @param characters - The characters that should be trimmed.
@@ -243,6 +480,13 @@ namespace abraham {
          */
         String& trimLeading(const String& characters = ASCII_WHITESPACE);
 
+        /**
+         * Trims a set of characters from the beginning of the String.
+         * @param characters - The set of characters that should be trimmed.
+         * @return A self reference.
+         */
+        String& trimLeading(const CharSet& characters);
+
         /**
          * Trims the provided characters from the end of the String.
          * @param characters - The characters that should be trimmed.
@@ -250,12 +494,26 @@ namespace abraham {
          */
         String& trimTrailing(const String& characters = ASCII_WHITESPACE);
 
+        /**
+         * Trims a set of characters from the end of the String.
+         * @param characters - The set of characters that should be trimmed.
+         * @return A self reference.
+         */
+        String& trimTrailing(const CharSet& characters);
+
         /**
          * Reverses the order of the characters in the String.
          * @return A self reference.
          */
         String& reverse();
 
+        /**
+         * Reverses the order of the UTF-8 code points in the String, keeping each one's bytes in order. The String
+         * must be valid UTF-8; reverse() reverses bytes, which breaks apart multi-byte code points.
+         * @return A self reference.
+         */
+        String& reverseCodePoints();
+
         /**
          * Pads both ends of the String with the provided value, the provided number of times.
          * @param string - The value to pad the String with.
@@ -304,6 +562,13 @@ namespace abraham {
          */
         String& replaceAll(const String& old_string, const String& new_string);
 
+        /**
+         * Replaces every match of a Replacer's patterns with its replacement, in a single scan of the String.
+         * @param replacer - The patterns and replacements.
+         * @return A self reference.
+         */
+        String& replaceAll(const Replacer& replacer);
+
         /**
          * Removes the first occurrence of a value from the String.
          * @param string - The value that should be removed.
@@ -340,6 +605,13 @@ namespace abraham {
          */
         String& removeCharacters(const String& characters);
 
+        /**
+         * Removes every character in a set from the String, in a single pass.
+         * @param characters - The set of characters that should be removed.
+         * @return A self reference.
+         */
+        String& removeCharacters(const CharSet& characters);
+
         /**
          * Determines if the provided value is present in the String.
          * @param string - The value to be found.
@@ -377,6 +649,43 @@ namespace abraham {
          */
         size_t indexOfLast(const String& string, size_t max_index) const;
 
+        /**
+         * Determines if a StringSearcher's needle is present in the String.
+         * @param searcher - The StringSearcher for the value to be found.
+         * @return true if the value is present in the String; false otherwise.
+         */
+        bool contains(const StringSearcher& searcher) const;
+
+        /**
+         * Returns the index of the first occurrence of a StringSearcher's needle.
+         * @param searcher - The StringSearcher for the value to be found.
+         * @return The index of the value. -1 if not found.
+         */
+        size_t indexOf(const StringSearcher& searcher) const;
+
+        /**
+         * Returns the index of the first occurrence of a StringSearcher's needle found after the specified index.
+         * @param searcher - The StringSearcher for the value to be found.
+         * @param min_index - The index to start search from.
+         * @return The index of the value. -1 if not found.
+         */
+        size_t indexOf(const StringSearcher& searcher, size_t min_index) const;
+
+        /**
+         * Returns the index of the last occurrence of a StringSearcher's needle.
+         * @param searcher - The StringSearcher for the value to be found.
+         * @return The index of the value. -1 if not found.
+         */
+        size_t indexOfLast(const StringSearcher& searcher) const;
+
+        /**
+         * Returns the index of the last occurrence of a StringSearcher's needle found before the specified index.
+         * @param searcher - The StringSearcher for the value to be found.
+         * @param max_index - The index where the search should stop.
+         * @return The index of the value. -1 if not found.
+         */
+        size_t indexOfLast(const StringSearcher& searcher, size_t max_index) const;
+
         /**
          * Checks the equality of two String objects.
          * @param string - The other String to compare this String to.
@@ -394,6 +703,23 @@ namespace abraham {
          */
         int compare(const String& string, bool case_sensitive = true) const;
 
+        /**
+         * Returns the Levenshtein distance to another String: the fewest single character insertions, deletions and
+         * substitutions that turn one into the other. Characters are compared as bytes.
+         * @param string - The value this String should be compared to.
+         * @return The edit distance between the two String objects.
+         */
+        size_t editDistance(const String& string) const;
+
+        /**
+         * Determines if the Levenshtein distance to another String is at most a limit. Stops comparing as soon as
+         * the distance must be more than the limit, so it is faster than editDistance for dissimilar values.
+         * @param string - The value this String should be compared to.
+         * @param max_distance - The largest distance allowed.
+         * @return true if the edit distance is at most max_distance; false otherwise.
+         */
+        bool withinDistance(const String& string, size_t max_distance) const;
+
         /**
          * Get the integer value of the number represented in the String. An exception is thrown if the String value isn't valid.
          * @return The integer value represented in the String.
@@ -455,6 +781,69 @@ namespace abraham {
          */
         bool boolValue() const;
 
+        /**
+         * Get the integer value of the number represented in the String without throwing.
+         * @param value - Set to the integer value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryIntValue(int& value) const;
+
+        /**
+         * Get the long value of the number represented in the String without throwing.
+         * @param value - Set to the long value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryLongValue(long& value) const;
+
+        /**
+         * Get the long long value of the number represented in the String without throwing.
+         * @param value - Set to the long long value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryLongLongValue(long long& value) const;
+
+        /**
+         * Get the unsigned value of the number represented in the String without throwing.
+         * @param value - Set to the unsigned value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryUnsignedValue(unsigned& value) const;
+
+        /**
+         * Get the unsigned long value of the number represented in the String without throwing.
+         * @param value - Set to the unsigned long value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryUnsignedLongValue(unsigned long& value) const;
+
+        /**
+         * Get the unsigned long long value of the number represented in the String without throwing.
+         * @param value - Set to the unsigned long long value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryUnsignedLongLongValue(unsigned long long& value) const;
+
+        /**
+         * Get the float value of the number represented in the String without throwing.
+         * @param value - Set to the float value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryFloatValue(float& value) const;
+
+        /**
+         * Get the double value of the number represented in the String without throwing.
+         * @param value - Set to the double value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryDoubleValue(double& value) const;
+
+        /**
+         * Get the bool value represented in the String without throwing.
+         * @param value - Set to the bool value if the String value is valid. Left unchanged otherwise.
+         * @return true if the String value is valid; false otherwise.
+         */
+        bool tryBoolValue(bool& value) const;
+
         /**
          * @return A new String object with the same value.
          */
@@ -555,6 +944,59 @@ namespace abraham {
          */
         static const std::string ASCII_PRINTABLE;
     };
+
+    template<>
+    struct Formatter<String> {
+        static size_t length(const String& value) { return value.length(); }
+
+        static void append(std::string& output, const String& value) { output.append(value.c_string(), value.length()); }
+    };
+
+
+    // Template Implementation
+
+    template<typename Format, typename... Args, typename>
+    String String::format(Format format, const Args&... args) {
+        String string;
+        formatTo(string, format, args...);
+        return string;
+    }
+
+    template<typename... Args>
+    String String::format(const StringView& format, const Args&... args) {
+        String string;
+        formatTo(string, format, args...);
+        return string;
+    }
+
+    template<typename Format, typename... Args, typename>
+    String& String::formatTo(String& string, Format, const Args&... args) {
+        static_assert(details::countPlaceholders(Format::data(), Format::length()) != details::MALFORMED_FORMAT,
+                      "Format string has an unmatched brace; write {{ or }} for a literal brace");
+        static_assert(details::countPlaceholders(Format::data(), Format::length()) == sizeof...(Args),
+                      "Format string doesn't have one {} placeholder per argument");
+
+        details::formatTo(string._data, Format::data(), Format::length(), args...);
+        string.updateStats();
+        return string;
+    }
+
+    template<typename... Args>
+    String& String::formatTo(String& string, const StringView& format, const Args&... args) {
+        details::checkFormat(format.data(), format.length(), sizeof...(Args));
+        details::formatTo(string._data, format.data(), format.length(), args...);
+        string.updateStats();
+        return string;
+    }
+}
+
+namespace std {
+    template<>
+    struct hash<abraham::String> {
+        size_t operator()(const abraham::String& string) const {
+            return string.hash();
+        }
+    };
 }
 
 #endif //ABRAHAM_STRING_HPP
@@ -0,0 +1,274 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_STRINGBUILDER_HPP
+#define ABRAHAM_STRINGBUILDER_HPP
+
+#include <cstddef>
+#include <string>
+#include "Arena.hpp"
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Assembles a String from many pieces in one growing buffer, so concatenating n pieces costs a few
+     * reallocations instead of n temporary Strings. The buffer grows geometrically, and reserve can size it up
+     * front when the final length is known.
+     *
+     * By default the buffer is heap allocated, and build moves it into the resulting String without copying. A
+     * StringBuilder can instead take its buffer from an Arena, for short lived text like log lines that's written out
+     * through view and then discarded when the Arena is reset.
+     *
+     * Example:
+     *     StringBuilder builder = StringBuilder(64);
+     *     builder.append("elapsed=").append(elapsed).append("ms");
+     *     String message = builder.build();
+     */
+    class StringBuilder {
+    protected:
+        /**
+         * The characters, when the StringBuilder isn't backed by an Arena.
+         */
+        std::string _buffer;
+
+        /**
+         * The Arena the characters are allocated from, or nullptr to use _buffer.
+         */
+        Arena* _arena;
+
+        /**
+         * The characters, when the StringBuilder is backed by an Arena.
+         */
+        char* _arenaData;
+
+        /**
+         * The number of characters in _arenaData.
+         */
+        size_t _arenaLength;
+
+        /**
+         * The number of characters _arenaData has room for.
+         */
+        size_t _arenaCapacity;
+
+        /**
+         * Makes room for at least a number of characters in total, at least doubling the capacity when it grows.
+         */
+        void grow(size_t capacity);
+
+        /**
+         * Lengthens the contents by a number of uninitialized characters.
+         * @return Where the new characters start.
+         */
+        char* extend(size_t count);
+
+        /**
+         * Shortens the contents to a length.
+         */
+        void truncate(size_t length);
+
+        /**
+         * Formats a number directly onto the end of the buffer.
+         */
+        template<typename T>
+        StringBuilder& appendNumber(T value);
+
+    public:
+        /**
+         * Constructor that creates an empty StringBuilder with a heap allocated buffer.
+         * @param capacity - The number of characters to reserve room for.
+         */
+        explicit StringBuilder(size_t capacity = 0);
+
+        /**
+         * Constructor that creates an empty StringBuilder whose buffer is allocated from an Arena. The Arena must
+         * outlive the StringBuilder, and resetting it invalidates the contents.
+         * @param arena - The Arena to allocate from.
+         * @param capacity - The number of characters to reserve room for.
+         */
+        explicit StringBuilder(Arena& arena, size_t capacity = 0);
+
+        /**
+         * Copy constructor that copies another StringBuilder's contents into a buffer of its own, allocated from the
+         * same Arena if the other StringBuilder uses one.
+         * @param builder - The StringBuilder to copy.
+         */
+        StringBuilder(const StringBuilder& builder);
+
+        /**
+         * Move constructor that takes over another StringBuilder's buffer, leaving the other StringBuilder empty.
+         * @param builder - The StringBuilder to move from.
+         */
+        StringBuilder(StringBuilder&& builder) noexcept;
+
+        /**
+         * Copy assignment that copies another StringBuilder's contents into a buffer of its own, allocated from the
+         * same Arena if the other StringBuilder uses one.
+         * @param builder - The StringBuilder to copy.
+         * @return A self reference.
+         */
+        StringBuilder& operator=(const StringBuilder& builder);
+
+        /**
+         * Move assignment that takes over another StringBuilder's buffer, leaving the other StringBuilder empty.
+         * @param builder - The StringBuilder to move from.
+         * @return A self reference.
+         */
+        StringBuilder& operator=(StringBuilder&& builder) noexcept;
+
+        /**
+         * Makes room for a number of characters, so appending up to that many doesn't reallocate.
+         * @param capacity - The total number of characters to make room for.
+         * @return A self reference.
+         */
+        StringBuilder& reserve(size_t capacity);
+
+        /**
+         * @param string - The characters to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(const String& string);
+
+        /**
+         * @param string - The characters to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(const StringView& string);
+
+        /**
+         * @param string - The characters to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(const std::string& string);
+
+        /**
+         * @param cstring - The null terminated characters to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(const char* cstring);
+
+        /**
+         * @param data - The first character to append.
+         * @param length - The number of characters to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(const char* data, size_t length);
+
+        /**
+         * @param c - The character to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(char c);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(int value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(long value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(long long value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(unsigned value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(unsigned long value);
+
+        /**
+         * Appends the decimal digits of a number, as NumberFormatter writes them.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(unsigned long long value);
+
+        /**
+         * Appends a number with the fewest digits that parse back to the same float, as NumberFormatter writes it.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(float value);
+
+        /**
+         * Appends a number with the fewest digits that parse back to the same double, as NumberFormatter writes it.
+         * @param value - The number to append.
+         * @return A self reference.
+         */
+        StringBuilder& append(double value);
+
+        /**
+         * Appends characters a number of times, growing the buffer at most once.
+         * @param string - The characters to repeat.
+         * @param count - The number of times to append them.
+         * @return A self reference.
+         */
+        StringBuilder& appendRepeated(const StringView& string, size_t count);
+
+        /**
+         * Appends a character a number of times, growing the buffer at most once.
+         * @param c - The character to repeat.
+         * @param count - The number of times to append it.
+         * @return A self reference.
+         */
+        StringBuilder& appendRepeated(char c, size_t count);
+
+        /**
+         * @return The number of characters appended.
+         */
+        size_t length() const;
+
+        /**
+         * @return The number of characters the buffer has room for.
+         */
+        size_t capacity() const;
+
+        /**
+         * @return true if nothing has been appended; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * Removes the contents, keeping the buffer for reuse.
+         * @return A self reference.
+         */
+        StringBuilder& clear();
+
+        /**
+         * @return A view of the contents. It's invalidated by the next append, and by build.
+         */
+        StringView view() const;
+
+        /**
+         * Moves the contents into a String and leaves the StringBuilder empty. A heap allocated buffer becomes the
+         * String's buffer without being copied; an Arena allocated one is copied once.
+         * @return The String that was built.
+         */
+        String build();
+    };
+}
+
+#endif //ABRAHAM_STRINGBUILDER_HPP
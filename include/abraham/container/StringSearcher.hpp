@@ -0,0 +1,169 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_STRINGSEARCHER_HPP
+#define ABRAHAM_STRINGSEARCHER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * How a StringSearcher looks for its needle.
+     */
+    enum class StringSearcherStrategy {
+        /**
+         * The needle is empty and matches everywhere.
+         */
+        EMPTY,
+
+        /**
+         * The needle is one character, found with a vectorized byte scan.
+         */
+        CHARACTER,
+
+        /**
+         * Candidates are found by comparing the needle's first and last characters against sixteen positions at a
+         * time, and only those are compared in full. Used for short needles.
+         */
+        FIRST_LAST_FILTER,
+
+        /**
+         * Boyer-Moore-Horspool, which skips ahead by up to the needle's length on a mismatch. Used for long needles.
+         */
+        HORSPOOL
+    };
+
+    /**
+     * Searches for one needle in many haystacks. The work that depends only on the needle, choosing a strategy and
+     * building skip tables, is done once when the StringSearcher is created.
+     *
+     * Example:
+     *     StringSearcher searcher = StringSearcher("ERROR");
+     *     for (const String& line : lines) { if (line.contains(searcher)) { ... } }
+     */
+    class StringSearcher {
+    protected:
+        /**
+         * A copy of the needle, so the StringSearcher doesn't depend on the needle's lifetime.
+         */
+        std::string _needle;
+
+        StringSearcherStrategy _strategy;
+
+        /**
+         * Forward Horspool shift for each byte: the distance from its last occurrence before the needle's end.
+         */
+        size_t _skip[256];
+
+        /**
+         * Reverse Horspool shift for each byte: the distance to its first occurrence after the needle's start.
+         */
+        size_t _reverseSkip[256];
+
+    public:
+        class Matches;
+
+        /**
+         * Needles of at least this many characters are searched with HORSPOOL.
+         */
+        static const size_t HORSPOOL_MIN_LENGTH;
+
+        /**
+         * Constructor that creates a StringSearcher for a needle.
+         * @param needle - The characters to search for.
+         */
+        explicit StringSearcher(const StringView& needle);
+
+        /**
+         * @param haystack - The characters to search.
+         * @param min_index - The index to start searching from.
+         * @return The index of the first occurrence at or after min_index. StringView::NO_INDEX if there isn't one.
+         */
+        size_t find(const StringView& haystack, size_t min_index = 0) const;
+
+        /**
+         * @param haystack - The characters to search.
+         * @param max_index - The last index an occurrence may start at.
+         * @return The index of the last occurrence at or before max_index. StringView::NO_INDEX if there isn't one.
+         */
+        size_t findLast(const StringView& haystack, size_t max_index = StringView::NO_INDEX) const;
+
+        /**
+         * @param haystack - The characters to search.
+         * @return A range over the indexes of the non overlapping occurrences, found lazily from first to last.
+         */
+        Matches findAll(const StringView& haystack) const;
+
+        /**
+         * @param haystack - The characters to search.
+         * @return true if the needle occurs in the haystack; false otherwise.
+         */
+        bool occursIn(const StringView& haystack) const;
+
+        /**
+         * @param haystack - The characters to search.
+         * @return The number of non overlapping occurrences.
+         */
+        size_t count(const StringView& haystack) const;
+
+        /**
+         * @return A view of the needle.
+         */
+        StringView needle() const;
+
+        /**
+         * @return The strategy chosen for the needle.
+         */
+        StringSearcherStrategy strategy() const;
+
+        /**
+         * An input range over the indexes of the non overlapping occurrences of a needle.
+         */
+        class Matches {
+        protected:
+            const StringSearcher* _searcher;
+            StringView _haystack;
+
+        public:
+            class Iterator {
+            protected:
+                const StringSearcher* _searcher;
+                StringView _haystack;
+                size_t _index;
+
+            public:
+                typedef std::input_iterator_tag iterator_category;
+                typedef size_t value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const size_t* pointer;
+                typedef const size_t& reference;
+
+                Iterator(const StringSearcher* searcher, const StringView& haystack, size_t index);
+
+                const size_t& operator*() const;
+
+                Iterator& operator++();
+
+                Iterator operator++(int);
+
+                bool operator==(const Iterator& iterator) const;
+
+                bool operator!=(const Iterator& iterator) const;
+            };
+
+            Matches(const StringSearcher* searcher, const StringView& haystack);
+
+            Iterator begin() const;
+
+            Iterator end() const;
+        };
+    };
+}
+
+#endif //ABRAHAM_STRINGSEARCHER_HPP
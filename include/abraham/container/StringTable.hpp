@@ -0,0 +1,159 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_STRINGTABLE_HPP
+#define ABRAHAM_STRINGTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * A list of strings packed end to end in one buffer, with an array of offsets marking where each starts. Storing
+     * a string costs its characters plus an 8 byte offset, rather than a heap allocation and a std::string header per
+     * string, so it suits large collections like vocabularies that are built once and then read.
+     *
+     * Strings are read back as StringViews into the buffer. Adding strings may move the buffer, so views are only
+     * valid until the next change to the StringTable.
+     *
+     * Example:
+     *     StringTable words;
+     *     words.add("pear");
+     *     words.add("apple");
+     *     words.sort();
+     *     size_t index = words.binarySearch("pear");  // 1
+     */
+    class StringTable {
+    protected:
+        /**
+         * The characters of every string, end to end.
+         */
+        std::string _bytes;
+
+        /**
+         * The offset of each string in _bytes, followed by the total length, so string i spans
+         * [_offsets[i], _offsets[i + 1]).
+         */
+        std::vector<uint64_t> _offsets;
+
+        /**
+         * @return The string at an index, without bounds checking.
+         */
+        StringView at(size_t index) const;
+
+    public:
+        /**
+         * Value representing a non-existent index.
+         */
+        static const size_t NO_INDEX;
+
+        /**
+         * Default constructor that creates an empty StringTable.
+         */
+        StringTable();
+
+        /**
+         * @param index - The 0-based index of a string.
+         * @return A view of the string at the index.
+         */
+        StringView operator[](size_t index) const;
+
+        /**
+         * Copies a string onto the end of the StringTable.
+         * @param string - The string to add.
+         * @return The index of the added string.
+         */
+        size_t add(const StringView& string);
+
+        /**
+         * @param index - The 0-based index of a string.
+         * @return A view of the string at the index.
+         */
+        StringView get(size_t index) const;
+
+        /**
+         * @return The number of strings in the StringTable.
+         */
+        size_t size() const;
+
+        /**
+         * @return true if the StringTable has no strings; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @return The total number of characters in all the strings.
+         */
+        size_t byteSize() const;
+
+        /**
+         * Allocates space ahead of time for strings that will be added.
+         * @param count - The number of strings to make room for.
+         * @param bytes - The number of characters to make room for.
+         */
+        void reserve(size_t count, size_t bytes);
+
+        /**
+         * Removes every string.
+         */
+        void clear();
+
+        /**
+         * @return The indexes of the strings in ascending byte order, leaving the StringTable unchanged. Equal strings
+         * keep their relative order.
+         */
+        std::vector<size_t> sortedOrder() const;
+
+        /**
+         * Rearranges the strings so that the string at index i is the one that was at order[i].
+         * @param order - The old index of each string in the new order, such as from sortedOrder.
+         */
+        void permute(const std::vector<size_t>& order);
+
+        /**
+         * Sorts the strings in ascending byte order. The strings are compared through the offsets, then copied into a
+         * new buffer once in their sorted order.
+         */
+        void sort();
+
+        /**
+         * @return true if the strings are in ascending byte order; false otherwise.
+         */
+        bool isSorted() const;
+
+        /**
+         * Finds a string in a sorted StringTable.
+         * @param string - The string to find.
+         * @return The index of the first string equal to it, or NO_INDEX if there is none. The result is undefined if
+         * the StringTable isn't sorted.
+         */
+        size_t binarySearch(const StringView& string) const;
+
+        /**
+         * Removes repeated strings, keeping the first of each in its place.
+         * @return The number of strings removed.
+         */
+        size_t dedupe();
+
+        /**
+         * @return The StringTable in a binary form that deserialize reads back. Numbers are written little endian,
+         * so the form is the same on every platform.
+         */
+        std::string serialize() const;
+
+        /**
+         * @param data - The output of serialize.
+         * @return The StringTable that was serialized.
+         * @throws InvalidValueException if the data isn't a serialized StringTable.
+         */
+        static StringTable deserialize(const StringView& data);
+    };
+}
+
+#endif //ABRAHAM_STRINGTABLE_HPP
@@ -0,0 +1,320 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_STRINGVIEW_HPP
+#define ABRAHAM_STRINGVIEW_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+
+namespace abraham {
+
+    class CharSet;
+
+    class String;
+
+    /**
+     * A read only view of a range of characters owned by something else: a pointer and a length. Slicing, splitting
+     * and trimming a StringView narrow the range without copying or allocating, which makes it suited to parsing.
+     *
+     * A StringView doesn't keep its characters alive. It must not outlive the String, std::string or buffer it was
+     * created from, and it's invalidated when that String is modified.
+     */
+    class StringView {
+    protected:
+        /**
+         * The first character of the view.
+         */
+        const char* _data;
+
+        /**
+         * The number of characters in the view.
+         */
+        size_t _length;
+
+        /**
+         * Finds a range of characters in the view.
+         */
+        size_t find(const char* bytes, size_t length, size_t min_index) const;
+
+    public:
+        /**
+         * Default constructor that creates an empty StringView.
+         */
+        StringView();
+
+        /**
+         * Constructor that creates a StringView of a C style string.
+         * @param cstring - The null terminated characters to view.
+         */
+        StringView(const char* cstring);
+
+        /**
+         * Constructor that creates a StringView of a range of characters.
+         * @param data - The first character to view.
+         * @param length - The number of characters to view.
+         */
+        StringView(const char* data, size_t length);
+
+        /**
+         * Constructor that creates a StringView of a std::string.
+         * @param string - The std::string to view.
+         */
+        StringView(const std::string& string);
+
+        /**
+         * Constructor that creates a StringView of a String.
+         * @param string - The String to view.
+         */
+        StringView(const String& string);
+
+        /**
+         * @param index - The index of the character.
+         * @return The character at the index.
+         */
+        char operator[](size_t index) const;
+
+        bool operator==(const StringView& view) const;
+
+        bool operator!=(const StringView& view) const;
+
+        bool operator<(const StringView& view) const;
+
+        bool operator>(const StringView& view) const;
+
+        bool operator<=(const StringView& view) const;
+
+        bool operator>=(const StringView& view) const;
+
+        /**
+         * @return The number of characters in the StringView.
+         */
+        size_t length() const;
+
+        /**
+         * @return true if the StringView has no characters; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @return A hash of the characters, equal to the hash of a String holding them.
+         */
+        size_t hash() const;
+
+        /**
+         * @return A pointer to the first character. The characters are not null terminated.
+         */
+        const char* data() const;
+
+        /**
+         * @param index - The index of the character.
+         * @return The character at the index.
+         */
+        char characterAtIndex(size_t index) const;
+
+        /**
+         * @param from_index - The index the substring starts at.
+         * @param to_index - The index the substring ends before.
+         * @return A StringView of the substring.
+         */
+        StringView substring(size_t from_index, size_t to_index) const;
+
+        /**
+         * @param index - The index the substring starts at.
+         * @return A StringView from the index to the end.
+         */
+        StringView substringFromIndex(size_t index) const;
+
+        /**
+         * @param index - The index the substring ends before.
+         * @return A StringView from the start to the index.
+         */
+        StringView substringToIndex(size_t index) const;
+
+        /**
+         * @return true if the characters are valid UTF-8; false otherwise.
+         */
+        bool isValidUtf8() const;
+
+        /**
+         * @return The number of UTF-8 code points in the StringView, which must be valid UTF-8.
+         */
+        size_t codePointLength() const;
+
+        /**
+         * @param from_index - The index of the code point the substring starts at.
+         * @param to_index - The index of the code point the substring ends before, up to the number of code points.
+         * @return A StringView of the substring. The StringView must be valid UTF-8.
+         */
+        StringView codePointSubstring(size_t from_index, size_t to_index) const;
+
+        /**
+         * Splits the StringView on a delimiter. An empty delimiter splits it into characters.
+         * @param delimiter - The delimiter to split on.
+         * @return Views of the parts between the delimiters.
+         */
+        std::vector<StringView> split(const StringView& delimiter) const;
+
+        /**
+         * Splits the StringView on a delimiter into a caller owned vector, which is cleared first. Reusing the same
+         * vector across calls avoids allocating once it has grown large enough.
+         * @param delimiter - The delimiter to split on.
+         * @param parts - Receives views of the parts between the delimiters.
+         */
+        void split(const StringView& delimiter, std::vector<StringView>& parts) const;
+
+        /**
+         * @param characters - The characters to remove from both ends.
+         * @return A StringView without the characters at either end.
+         */
+        StringView trim(const StringView& characters = " \t\r\n\v\f") const;
+
+        /**
+         * @param characters - The set of characters to remove from both ends.
+         * @return A StringView without the characters at either end.
+         */
+        StringView trim(const CharSet& characters) const;
+
+        /**
+         * @param characters - The characters to remove from the start.
+         * @return A StringView without the characters at the start.
+         */
+        StringView trimLeading(const StringView& characters = " \t\r\n\v\f") const;
+
+        /**
+         * @param characters - The set of characters to remove from the start.
+         * @return A StringView without the characters at the start.
+         */
+        StringView trimLeading(const CharSet& characters) const;
+
+        /**
+         * @param characters - The characters to remove from the end.
+         * @return A StringView without the characters at the end.
+         */
+        StringView trimTrailing(const StringView& characters = " \t\r\n\v\f") const;
+
+        /**
+         * @param characters - The set of characters to remove from the end.
+         * @return A StringView without the characters at the end.
+         */
+        StringView trimTrailing(const CharSet& characters) const;
+
+        /**
+         * @param view - The characters to find.
+         * @return true if the StringView contains the characters; false otherwise.
+         */
+        bool contains(const StringView& view) const;
+
+        /**
+         * @param view - The characters to find.
+         * @return The index of the first occurrence. NO_INDEX if there isn't one.
+         */
+        size_t indexOf(const StringView& view) const;
+
+        /**
+         * @param view - The characters to find.
+         * @param min_index - The index to start searching from.
+         * @return The index of the first occurrence at or after min_index. NO_INDEX if there isn't one.
+         */
+        size_t indexOf(const StringView& view, size_t min_index) const;
+
+        /**
+         * @param view - The characters to find.
+         * @return The index of the last occurrence. NO_INDEX if there isn't one.
+         */
+        size_t indexOfLast(const StringView& view) const;
+
+        /**
+         * @param view - The characters to find.
+         * @param max_index - The last index an occurrence may start at.
+         * @return The index of the last occurrence at or before max_index. NO_INDEX if there isn't one.
+         */
+        size_t indexOfLast(const StringView& view, size_t max_index) const;
+
+        /**
+         * @param view - The StringView to compare with.
+         * @param case_sensitive - Whether case is significant.
+         * @return true if the characters are equal; false otherwise.
+         */
+        bool isEqualTo(const StringView& view, bool case_sensitive = true) const;
+
+        /**
+         * @param view - The StringView to compare with.
+         * @param case_sensitive - Whether case is significant.
+         * @return A negative value, zero or a positive value as this sorts before, with or after the other.
+         */
+        int compare(const StringView& view, bool case_sensitive = true) const;
+
+        int intValue() const;
+
+        long longValue() const;
+
+        long long longLongValue() const;
+
+        unsigned unsignedValue() const;
+
+        unsigned long unsignedLongValue() const;
+
+        unsigned long long unsignedLongLongValue() const;
+
+        float floatValue() const;
+
+        double doubleValue() const;
+
+        long double longDoubleValue() const;
+
+        bool boolValue() const;
+
+        bool tryIntValue(int& value) const;
+
+        bool tryLongValue(long& value) const;
+
+        bool tryLongLongValue(long long& value) const;
+
+        bool tryUnsignedValue(unsigned& value) const;
+
+        bool tryUnsignedLongValue(unsigned long& value) const;
+
+        bool tryUnsignedLongLongValue(unsigned long long& value) const;
+
+        bool tryFloatValue(float& value) const;
+
+        bool tryDoubleValue(double& value) const;
+
+        bool tryBoolValue(bool& value) const;
+
+        /**
+         * @return A String holding a copy of the characters.
+         */
+        String string() const;
+
+        /**
+         * @return A std::string holding a copy of the characters.
+         */
+        std::string std_string() const;
+
+        const char* begin() const;
+
+        const char* end() const;
+
+        /**
+         * Value representing a non-existent index.
+         */
+        static const size_t NO_INDEX;
+    };
+}
+
+namespace std {
+    template<>
+    struct hash<abraham::StringView> {
+        size_t operator()(const abraham::StringView& view) const {
+            return view.hash();
+        }
+    };
+}
+
+#endif //ABRAHAM_STRINGVIEW_HPP
@@ -0,0 +1,281 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_TOKENIZER_HPP
+#define ABRAHAM_TOKENIZER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include "CharSet.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * The kinds of delimiter a Tokenizer can split on.
+     */
+    enum class TokenizerDelimiter {
+        CHARACTER,
+        STRING,
+        CHARACTER_SET
+    };
+
+    /**
+     * Lazily splits a range of characters into tokens. Tokens are StringViews of the source and are found one at a
+     * time as the Tokenizer is advanced, so splitting allocates nothing no matter how many tokens there are.
+     *
+     * The source isn't owned by the Tokenizer and must outlive it and the tokens it produces.
+     *
+     * Example:
+     *     for (StringView field : Tokenizer(line, ',').skipEmpty()) { ... }
+     */
+    class Tokenizer {
+    protected:
+        /**
+         * The characters being split.
+         */
+        StringView _source;
+
+        /**
+         * The delimiter for a STRING tokenizer.
+         */
+        StringView _delimiter;
+
+        /**
+         * The delimiter for a CHARACTER tokenizer.
+         */
+        char _character;
+
+        /**
+         * The delimiter characters for a CHARACTER_SET tokenizer.
+         */
+        CharSet _characters;
+
+        /**
+         * The kind of delimiter being split on, which selects the delimiter member that is used.
+         */
+        TokenizerDelimiter _type;
+
+        /**
+         * The index of the first character of the next token.
+         */
+        size_t _position;
+
+        /**
+         * The number of delimiters split on so far.
+         */
+        size_t _splits;
+
+        /**
+         * The number of delimiters to split on before the rest of the source is the final token. The maximum size_t
+         * when there is no limit.
+         */
+        size_t _maxSplits;
+
+        /**
+         * Whether empty tokens are skipped.
+         */
+        bool _skipEmpty;
+
+        /**
+         * Whether the final token has been returned.
+         */
+        bool _finished;
+
+        /**
+         * Finds the next delimiter at or after the position.
+         * @param length - Receives the length of the delimiter found.
+         * @return The index of the delimiter. StringView::NO_INDEX if there isn't one.
+         */
+        size_t findDelimiter(size_t& length) const;
+
+    public:
+        class Iterator;
+
+        /**
+         * Constructor that creates a Tokenizer splitting on a single character.
+         * @param source - The characters to split.
+         * @param delimiter - The character to split on.
+         */
+        Tokenizer(const StringView& source, char delimiter);
+
+        /**
+         * Constructor that creates a Tokenizer splitting on a sequence of characters. An empty delimiter splits the
+         * source into its characters, like String::split.
+         * @param source - The characters to split.
+         * @param delimiter - The characters to split on.
+         */
+        Tokenizer(const StringView& source, const StringView& delimiter);
+
+        /**
+         * Creates a Tokenizer splitting on any one of a set of characters.
+         * @param source - The characters to split.
+         * @param characters - The characters to split on.
+         * @return The Tokenizer.
+         */
+        static Tokenizer anyOf(const StringView& source, const StringView& characters);
+
+        /**
+         * Creates a Tokenizer splitting on any one of a set of characters.
+         * @param source - The characters to split.
+         * @param characters - The set of characters to split on.
+         * @return The Tokenizer.
+         */
+        static Tokenizer anyOf(const StringView& source, const CharSet& characters);
+
+        /**
+         * Sets whether empty tokens, from adjacent delimiters or delimiters at either end, are skipped.
+         * @param skip - Whether empty tokens are skipped.
+         * @return A reference to this Tokenizer.
+         */
+        Tokenizer& skipEmpty(bool skip = true) &;
+
+        /**
+         * Sets whether empty tokens are skipped on a temporary Tokenizer, such as one being iterated over directly.
+         * @param skip - Whether empty tokens are skipped.
+         * @return The Tokenizer, moved out of the temporary so it outlives the expression.
+         */
+        Tokenizer skipEmpty(bool skip = true) &&;
+
+        /**
+         * Limits the number of delimiters split on. Once the limit is reached the rest of the source, delimiters and
+         * all, is returned as the final token.
+         * @param count - The maximum number of splits.
+         * @return A reference to this Tokenizer.
+         */
+        Tokenizer& maxSplits(size_t count) &;
+
+        /**
+         * Limits the number of delimiters split on by a temporary Tokenizer, such as one being iterated over directly.
+         * @param count - The maximum number of splits.
+         * @return The Tokenizer, moved out of the temporary so it outlives the expression.
+         */
+        Tokenizer maxSplits(size_t count) &&;
+
+        /**
+         * Advances to the next token.
+         * @param token - Receives the token.
+         * @return true if there was a token; false if the source is exhausted.
+         */
+        bool next(StringView& token);
+
+        /**
+         * @return The part of the source that hasn't been tokenized yet.
+         */
+        StringView remainder() const;
+
+        /**
+         * @return true if every token has been returned; false otherwise.
+         */
+        bool isFinished() const;
+
+        /**
+         * @return The type of delimiter being split on.
+         */
+        TokenizerDelimiter delimiterType() const;
+
+        /**
+         * Iterating starts from the Tokenizer's current position and doesn't advance the Tokenizer itself.
+         * @return An iterator at the first remaining token.
+         */
+        Iterator begin() const;
+
+        /**
+         * @return An iterator past the last token.
+         */
+        Iterator end() const;
+    };
+
+    /**
+     * An input iterator over the tokens of a Tokenizer.
+     */
+    class Tokenizer::Iterator {
+    protected:
+        /**
+         * A copy of the Tokenizer being iterated over, which is advanced in its place.
+         */
+        Tokenizer _tokenizer;
+
+        /**
+         * The current token.
+         */
+        StringView _token;
+
+        /**
+         * Whether the iterator is past the last token.
+         */
+        bool _end;
+
+    public:
+        /**
+         * Tokens can only be read once, in order.
+         */
+        typedef std::input_iterator_tag iterator_category;
+
+        /**
+         * Each token is a StringView of the source.
+         */
+        typedef StringView value_type;
+
+        /**
+         * The type of the distance between two iterators.
+         */
+        typedef std::ptrdiff_t difference_type;
+
+        /**
+         * The type returned by operator->.
+         */
+        typedef const StringView* pointer;
+
+        /**
+         * The type returned by operator*.
+         */
+        typedef const StringView& reference;
+
+        /**
+         * Constructor that creates an iterator at the next token of a Tokenizer, or past the last token.
+         * @param tokenizer - The Tokenizer to iterate over. It is copied, so it isn't advanced.
+         * @param end - Whether to create the iterator past the last token.
+         */
+        Iterator(const Tokenizer& tokenizer, bool end);
+
+        /**
+         * @return The current token.
+         */
+        const StringView& operator*() const;
+
+        /**
+         * @return A pointer to the current token.
+         */
+        const StringView* operator->() const;
+
+        /**
+         * Advances to the next token.
+         * @return A reference to this iterator.
+         */
+        Iterator& operator++();
+
+        /**
+         * Advances to the next token.
+         * @return A copy of this iterator from before it was advanced.
+         */
+        Iterator operator++(int);
+
+        /**
+         * Iterators are equal when both are past the last token, or both are at the same token of the source.
+         * @param iterator - The iterator to compare to.
+         * @return true if the iterators are equal; false otherwise.
+         */
+        bool operator==(const Iterator& iterator) const;
+
+        /**
+         * @param iterator - The iterator to compare to.
+         * @return true if the iterators aren't equal; false otherwise.
+         */
+        bool operator!=(const Iterator& iterator) const;
+    };
+}
+
+#endif //ABRAHAM_TOKENIZER_HPP
@@ -70,6 +70,22 @@ namespace abraham {
         InvalidValueException(const std::string& message);
     };
 
+    /**
+     * The Exception class used for indicating a failed file or stream operation.
+     */
+    class IOException : public Exception {
+    public:
+        /**
+         * Default constructor for IOException.
+         */
+        IOException();
+
+        /**
+         * Constructor that allows a helpful message to be set.
+         */
+        IOException(const std::string& message);
+    };
+
     /**
      * The Exception class used during development for a function that hasn't been implemented yet.
      */
@@ -0,0 +1,297 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_CSVREADER_HPP
+#define ABRAHAM_CSVREADER_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Array.hpp"
+#include "NumberParser.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Why a CsvReader couldn't read a record cleanly.
+     */
+    enum class CsvError {
+        /**
+         * The record was read.
+         */
+        NONE,
+
+        /**
+         * A quoted field has no closing quote. The record ends at the end of the line the field started on.
+         */
+        UNTERMINATED_QUOTE,
+
+        /**
+         * A quoted field's closing quote is followed by something other than a delimiter or the end of the line. The
+         * rest of the line is skipped.
+         */
+        TEXT_AFTER_QUOTE
+    };
+
+    /**
+     * One record read by a CsvReader. Fields are views of the text being read, except for quoted fields containing
+     * doubled quotes, which are unescaped into the record's own buffer. Either way they're valid until the record is
+     * read into again.
+     */
+    class CsvRecord {
+    protected:
+        friend class CsvReader;
+
+        /**
+         * Views of the fields, in the text or in _unescaped.
+         */
+        std::vector<StringView> _fields;
+
+        /**
+         * The indexes of fields that still have their doubled quotes, until the record is finished.
+         */
+        std::vector<size_t> _escapedFields;
+
+        /**
+         * The unescaped text of fields that had doubled quotes.
+         */
+        std::string _unescaped;
+
+        /**
+         * Why the record couldn't be read cleanly, or NONE.
+         */
+        CsvError _error;
+
+        /**
+         * The 1-based number of the record among those read.
+         */
+        size_t _number;
+
+        /**
+         * The offset in the text of the record's first character.
+         */
+        size_t _offset;
+
+        /**
+         * Replaces each doubled quote in the escaped fields with a single one.
+         */
+        void unescape(char quote);
+
+        /**
+         * Points the unescaped fields, copied from another record, at the same characters in this record's buffer.
+         * @param source - The start of the buffer the fields point into.
+         */
+        void repoint(const char* source);
+
+    public:
+        /**
+         * Default constructor that creates an empty record.
+         */
+        CsvRecord();
+
+        /**
+         * Copy constructor. Fields that were unescaped point into the new record's own copy of the text.
+         * @param record - The record to copy.
+         */
+        CsvRecord(const CsvRecord& record);
+
+        /**
+         * Move constructor. Fields that were unescaped point into the new record's buffer, and the other record is
+         * left empty.
+         * @param record - The record to move from.
+         */
+        CsvRecord(CsvRecord&& record) noexcept;
+
+        /**
+         * Copy assignment. Fields that were unescaped point into this record's own copy of the text.
+         * @param record - The record to copy.
+         * @return A self reference.
+         */
+        CsvRecord& operator=(const CsvRecord& record);
+
+        /**
+         * Move assignment. Fields that were unescaped point into this record's buffer, and the other record is left
+         * empty.
+         * @param record - The record to move from.
+         * @return A self reference.
+         */
+        CsvRecord& operator=(CsvRecord&& record) noexcept;
+
+        /**
+         * @param index - The 0-based index of a field.
+         * @return A view of the field.
+         */
+        StringView operator[](size_t index) const;
+
+        /**
+         * @param index - The 0-based index of a field.
+         * @return A view of the field.
+         */
+        StringView field(size_t index) const;
+
+        /**
+         * Parses a field as a number or bool, as NumberParser::parseValue does.
+         * @param index - The 0-based index of the field.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed. A field that doesn't exist is INVALID.
+         */
+        template<typename T>
+        ParseError parseField(size_t index, T& value) const;
+
+        /**
+         * @return The number of fields.
+         */
+        size_t size() const;
+
+        /**
+         * @return Why the record couldn't be read cleanly, or NONE.
+         */
+        CsvError error() const;
+
+        /**
+         * @return true if the record was read without an error; false otherwise.
+         */
+        bool isValid() const;
+
+        /**
+         * @return The 1-based number of the record among those the CsvReader has read.
+         */
+        size_t number() const;
+
+        /**
+         * @return The offset in the text of the record's first character.
+         */
+        size_t offset() const;
+    };
+
+    /**
+     * Reads delimited records, such as CSV or TSV, one at a time from text that stays in place, like the contents of
+     * a MappedFile. Fields may be quoted to contain delimiters, line breaks or quotes, with a quote inside a quoted
+     * field written twice. Records end at "\n" or "\r\n", and blank lines are skipped. A quote in the middle of an
+     * unquoted field is part of the field.
+     *
+     * Delimiters and line breaks are found with SIMD bitmasks where SSE2 or AVX2 is available, and a mask is reused
+     * for every field in its block. A malformed record is returned with its error set rather than thrown, and reading
+     * carries on with the next line.
+     *
+     * The text isn't owned by the CsvReader and must outlive it and the records it produces.
+     *
+     * Example:
+     *     CsvReader reader = CsvReader(file.view());
+     *     CsvRecord record;
+     *     while (reader.next(record)) {
+     *         if (!record.isValid()) { ... }
+     *     }
+     */
+    class CsvReader {
+    protected:
+        /**
+         * The text being read.
+         */
+        StringView _text;
+
+        /**
+         * The index of the first character of the next record.
+         */
+        size_t _position;
+
+        /**
+         * The number of records read so far.
+         */
+        size_t _recordCount;
+
+        char _delimiter;
+
+        char _quote;
+
+    public:
+        /**
+         * Constructor that creates a CsvReader over some text.
+         * @param text - The delimited text.
+         * @param delimiter - The character between fields.
+         * @param quote - The character that quotes fields.
+         */
+        explicit CsvReader(const StringView& text, char delimiter = ',', char quote = '"');
+
+        /**
+         * @param text - Tab separated text.
+         * @return A CsvReader splitting fields on tabs.
+         */
+        static CsvReader tsv(const StringView& text);
+
+        /**
+         * Splits delimited text into about equal parts that each end at the end of a record, so each part can be
+         * given to its own CsvReader, such as on its own thread. Line breaks inside quoted fields aren't split on, as
+         * long as the text's quoting is well formed.
+         * @param text - The text to split.
+         * @param count - The number of parts wanted.
+         * @param quote - The character that quotes fields.
+         * @return The non-empty parts, in order. There are fewer than count if the text has too few records.
+         */
+        static std::vector<StringView> partition(const StringView& text, size_t count, char quote = '"');
+
+        /**
+         * Reads the next record.
+         * @param record - Receives the record, which may have an error.
+         * @return true if there was a record; false if the text is exhausted.
+         */
+        bool next(CsvRecord& record);
+
+        /**
+         * Reads a column of every remaining record into an Array. Records that have an error, don't have the column,
+         * or whose field can't be parsed are skipped.
+         * @param column - The 0-based index of the column.
+         * @param values - The parsed values are added to the end.
+         * @param bad_records - If not null, the number of each skipped record is added to the end.
+         * @return The number of records skipped.
+         */
+        template<typename T>
+        size_t readColumn(size_t column, Array<T>& values, Array<size_t>* bad_records = nullptr);
+
+        /**
+         * @return The number of records read so far.
+         */
+        size_t recordCount() const;
+
+        /**
+         * @return The part of the text that hasn't been read yet.
+         */
+        StringView remainder() const;
+
+        /**
+         * @return true if every record has been read; false otherwise.
+         */
+        bool isFinished() const;
+    };
+
+
+    // Template Implementation
+
+    template<typename T>
+    ParseError CsvRecord::parseField(size_t index, T& value) const {
+        if (index >= this->_fields.size()) return ParseError::INVALID;
+        return NumberParser::parseValue(this->_fields[index], value);
+    }
+
+    template<typename T>
+    size_t CsvReader::readColumn(size_t column, Array<T>& values, Array<size_t>* bad_records) {
+        CsvRecord record;
+        size_t skipped = 0;
+        while (this->next(record)) {
+            T value = T();
+            if (record.isValid() && record.parseField(column, value) == ParseError::NONE) {
+                values.add(value);
+            } else {
+                ++skipped;
+                if (bad_records != nullptr) bad_records->add(record.number());
+            }
+        }
+
+        return skipped;
+    }
+}
+
+#endif //ABRAHAM_CSVREADER_HPP
@@ -0,0 +1,143 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_LINEREADER_HPP
+#define ABRAHAM_LINEREADER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Splits text into lines without copying it. Lines are StringViews of the text, without their '\n', and a '\r'
+     * before the '\n' is dropped too unless keepCarriageReturns is set. The last line doesn't need a trailing '\n',
+     * and a trailing '\n' doesn't start another, empty, line.
+     *
+     * Newlines are found 16 or 32 bytes at a time where SSE2 or AVX2 is available. The text isn't owned by the
+     * LineReader and must outlive it and the lines it produces.
+     *
+     * Example:
+     *     MappedFile file = MappedFile("server.log");
+     *     for (StringView line : LineReader(file.view())) { ... }
+     */
+    class LineReader {
+    protected:
+        /**
+         * The text being split.
+         */
+        StringView _text;
+
+        /**
+         * The index of the first character of the next line.
+         */
+        size_t _position;
+
+        /**
+         * The number of lines returned so far.
+         */
+        size_t _lineCount;
+
+        bool _keepCarriageReturns;
+
+    public:
+        class Iterator;
+
+        /**
+         * Constructor that creates a LineReader over some text.
+         * @param text - The text to split into lines.
+         */
+        explicit LineReader(const StringView& text);
+
+        /**
+         * Finds the first '\n' in a range of characters.
+         * @param begin - The first character to search.
+         * @param end - The character after the last to search.
+         * @return A pointer to the '\n', or end if there isn't one.
+         */
+        static const char* findNewline(const char* begin, const char* end);
+
+        /**
+         * Splits text into about equal parts that each end just after a '\n', or at the end of the text, so each part
+         * can be given to its own LineReader, such as on its own thread, and together they read every line once.
+         * @param text - The text to split.
+         * @param count - The number of parts wanted.
+         * @return The non-empty parts, in order. There are fewer than count if the text has too few lines.
+         */
+        static std::vector<StringView> partition(const StringView& text, size_t count);
+
+        /**
+         * Sets whether a '\r' before a line's '\n' is kept as part of the line.
+         * @param keep - Whether carriage returns are kept.
+         * @return A reference to this LineReader.
+         */
+        LineReader& keepCarriageReturns(bool keep = true);
+
+        /**
+         * Advances to the next line.
+         * @param line - Receives the line.
+         * @return true if there was a line; false if the text is exhausted.
+         */
+        bool next(StringView& line);
+
+        /**
+         * @return The number of lines returned so far, which is the 1-based line number of the last line returned.
+         */
+        size_t lineCount() const;
+
+        /**
+         * @return The part of the text that hasn't been read yet.
+         */
+        StringView remainder() const;
+
+        /**
+         * @return true if every line has been returned; false otherwise.
+         */
+        bool isFinished() const;
+
+        /**
+         * Iterating starts from the LineReader's current position and doesn't advance the LineReader itself.
+         * @return An iterator at the first remaining line.
+         */
+        Iterator begin() const;
+
+        Iterator end() const;
+    };
+
+    /**
+     * An input iterator over the lines of a LineReader.
+     */
+    class LineReader::Iterator {
+    protected:
+        LineReader _reader;
+        StringView _line;
+        bool _end;
+
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef StringView value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const StringView* pointer;
+        typedef const StringView& reference;
+
+        Iterator(const LineReader& reader, bool end);
+
+        const StringView& operator*() const;
+
+        const StringView* operator->() const;
+
+        Iterator& operator++();
+
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& iterator) const;
+
+        bool operator!=(const Iterator& iterator) const;
+    };
+}
+
+#endif //ABRAHAM_LINEREADER_HPP
@@ -0,0 +1,144 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_MAPPEDFILE_HPP
+#define ABRAHAM_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * How a MappedFile's contents are expected to be read, passed to the operating system as a paging hint.
+     */
+    enum class FileAccess {
+        /**
+         * No particular order.
+         */
+        NORMAL,
+
+        /**
+         * Front to back, so pages are read ahead aggressively and can be dropped soon after they're read.
+         */
+        SEQUENTIAL,
+
+        /**
+         * Scattered reads, so read-ahead is turned off.
+         */
+        RANDOM,
+
+        /**
+         * All of it soon, so paging in starts immediately.
+         */
+        WILL_NEED
+    };
+
+    /**
+     * The contents of a file, read only. Regular files are memory mapped, so opening even a very large file is fast
+     * and its pages are only read as they're touched. Anything that can't be mapped, like a pipe, a terminal or a
+     * file in /proc, is read into memory with buffered reads instead, so every kind of file looks the same to the
+     * reader.
+     *
+     * Views of the contents are valid for as long as the MappedFile.
+     *
+     * Example:
+     *     MappedFile file = MappedFile("server.log");
+     *     for (StringView line : LineReader(file.view())) { ... }
+     */
+    class MappedFile {
+    protected:
+        const char* _data;
+        size_t _size;
+        bool _isMapped;
+
+        /**
+         * The contents of a file that was read rather than mapped.
+         */
+        std::string _buffer;
+
+        /**
+         * Maps or reads an open file, leaving the descriptor open.
+         */
+        void load(int descriptor, const std::string& name, FileAccess access);
+
+        /**
+         * Reads an open file to its end into the buffer.
+         */
+        void read(int descriptor, const std::string& name);
+
+        void release();
+
+    public:
+        /**
+         * Constructor that opens a file.
+         * @param path - The path of the file.
+         * @param access - How the contents will be read.
+         * @throws IOException if the file can't be opened or read.
+         */
+        explicit MappedFile(const std::string& path, FileAccess access = FileAccess::SEQUENTIAL);
+
+        /**
+         * Constructor that maps or reads a file that's already open, such as standard input. The descriptor is read
+         * from its current position for files that can't be mapped, and isn't closed.
+         * @param descriptor - The open file descriptor.
+         * @param access - How the contents will be read.
+         * @throws IOException if the file can't be read.
+         */
+        explicit MappedFile(int descriptor, FileAccess access = FileAccess::SEQUENTIAL);
+
+        MappedFile(MappedFile&& file) noexcept;
+
+        MappedFile(const MappedFile&) = delete;
+
+        ~MappedFile();
+
+        MappedFile& operator=(MappedFile&& file) noexcept;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * Changes the paging hint for the whole file. Does nothing if the file was read rather than mapped.
+         * @param access - How the contents will be read.
+         */
+        void advise(FileAccess access);
+
+        /**
+         * Changes the paging hint for part of the file, such as the part one thread of a parallel read covers.
+         * @param access - How that part will be read.
+         * @param offset - The offset of the first byte of the part.
+         * @param length - The length of the part.
+         */
+        void advise(FileAccess access, size_t offset, size_t length);
+
+        /**
+         * @return A pointer to the contents.
+         */
+        const char* data() const;
+
+        /**
+         * @return The number of bytes in the file.
+         */
+        size_t size() const;
+
+        /**
+         * @return true if the file has no contents; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @return true if the contents are memory mapped; false if they were read into memory.
+         */
+        bool isMapped() const;
+
+        /**
+         * @return A view of the whole contents.
+         */
+        StringView view() const;
+    };
+}
+
+#endif //ABRAHAM_MAPPEDFILE_HPP
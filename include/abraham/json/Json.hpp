@@ -0,0 +1,292 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_JSON_HPP
+#define ABRAHAM_JSON_HPP
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include "Array.hpp"
+#include "Dictionary.hpp"
+#include "Exception.hpp"
+#include "JsonCursor.hpp"
+#include "JsonDocument.hpp"
+#include "JsonValue.hpp"
+#include "JsonWriter.hpp"
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Converts a type from a parsed JSON value and writes it as JSON. Specializations are given for bool, the
+     * integers, float and double, String, JsonValue, and Array and Dictionary of convertible types, and can be added
+     * for other types. Each has a static fromJson(const JsonValue&), which throws InvalidValueException if the value
+     * has the wrong type or doesn't fit, and a static toJson(JsonWriter&, const T&).
+     */
+    template<typename T, typename Enable = void>
+    struct JsonConvert;
+
+    /**
+     * Reads and writes whole values of types that have a JsonConvert.
+     *
+     * Example:
+     *     Dictionary<String, Array<int>> scores = Json::parse<Dictionary<String, Array<int>>>(text);
+     *     String json = Json::serialize(scores);
+     */
+    class Json {
+    public:
+        /**
+         * @param text - A JSON text.
+         * @return The text's value as a T.
+         * @throws InvalidValueException if the text isn't valid JSON or its value can't be converted.
+         */
+        template<typename T>
+        static T parse(const StringView& text);
+
+        /**
+         * Parses only the value a cursor is at.
+         * @param value - A cursor at the value.
+         * @return The value as a T.
+         * @throws InvalidValueException if the value isn't valid JSON or can't be converted.
+         */
+        template<typename T>
+        static T parse(const JsonCursor& value);
+
+        /**
+         * @param value - The value to write.
+         * @return The value as compact JSON text.
+         */
+        template<typename T>
+        static String serialize(const T& value);
+    };
+
+
+    // Template Implementation
+
+    template<typename T>
+    T Json::parse(const StringView& text) {
+        const JsonDocument document = JsonDocument(text);
+        return JsonConvert<T>::fromJson(document.root());
+    }
+
+    template<typename T>
+    T Json::parse(const JsonCursor& value) {
+        const JsonDocument document = JsonDocument(value);
+        return JsonConvert<T>::fromJson(document.root());
+    }
+
+    template<typename T>
+    String Json::serialize(const T& value) {
+        JsonWriter writer = JsonWriter();
+        JsonConvert<T>::toJson(writer, value);
+        return writer.build();
+    }
+
+
+    // Conversions
+
+    /**
+     * Booleans are read from and written as true and false.
+     */
+    template<>
+    struct JsonConvert<bool> {
+        /**
+         * @param value - A parsed value.
+         * @return The value as a bool.
+         * @throws InvalidValueException if the value isn't a boolean.
+         */
+        static bool fromJson(const JsonValue& value) {
+            return value.asBool();
+        }
+
+        /**
+         * @param writer - Where to write the value.
+         * @param value - The bool to write.
+         */
+        static void toJson(JsonWriter& writer, bool value) {
+            writer.value(value);
+        }
+    };
+
+    /**
+     * Integers are range checked, so a value that doesn't fit the type is an error rather than truncated. Characters
+     * aren't treated as numbers.
+     */
+    template<typename T>
+    struct JsonConvert<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                                  !std::is_same<T, char>::value>::type> {
+        /**
+         * @param value - A parsed value.
+         * @return The value as a T.
+         * @throws InvalidValueException if the value isn't an integer or doesn't fit in a T.
+         */
+        static T fromJson(const JsonValue& value) {
+            // Unsigned types are read as uint64_t, so integers above INT64_MAX fit
+            if (std::is_signed<T>::value) {
+                const int64_t integer = value.asInteger();
+                if (integer < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+                    integer > static_cast<int64_t>(std::numeric_limits<T>::max())) {
+                    throw InvalidValueException("JSON integer is out of range");
+                }
+                return static_cast<T>(integer);
+            }
+
+            const uint64_t integer = value.asUnsigned();
+            if (integer > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+                throw InvalidValueException("JSON integer is out of range");
+            }
+            return static_cast<T>(integer);
+        }
+
+        /**
+         * @param writer - Where to write the value.
+         * @param value - The integer to write.
+         */
+        static void toJson(JsonWriter& writer, T value) {
+            writer.value(value);
+        }
+    };
+
+    /**
+     * Floating point values are read from any number, and written with the fewest digits that read back as the same
+     * value, which is always written as a double.
+     */
+    template<typename T>
+    struct JsonConvert<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+        /**
+         * @param value - A parsed value.
+         * @return The value as a T.
+         * @throws InvalidValueException if the value isn't a number.
+         */
+        static T fromJson(const JsonValue& value) {
+            return static_cast<T>(value.asDouble());
+        }
+
+        /**
+         * @param writer - Where to write the value.
+         * @param value - The number to write.
+         */
+        static void toJson(JsonWriter& writer, T value) {
+            writer.value(value);
+        }
+    };
+
+    /**
+     * Strings are copied out of the document, unescaped, and escaped again when they're written.
+     */
+    template<>
+    struct JsonConvert<String> {
+        /**
+         * @param value - A parsed value.
+         * @return The value as a String.
+         * @throws InvalidValueException if the value isn't a string.
+         */
+        static String fromJson(const JsonValue& value) {
+            const StringView string = value.asString();
+            return String(std::string(string.data(), string.length()));
+        }
+
+        /**
+         * @param writer - Where to write the value.
+         * @param value - The String to write.
+         */
+        static void toJson(JsonWriter& writer, const String& value) {
+            writer.value(StringView(value));
+        }
+    };
+
+    /**
+     * A parsed value can be written, with everything in it. There's no fromJson, since a JsonValue belongs to the
+     * JsonDocument it was parsed into.
+     */
+    template<>
+    struct JsonConvert<JsonValue> {
+        /**
+         * @param writer - Where to write the value.
+         * @param value - The parsed value to write.
+         */
+        static void toJson(JsonWriter& writer, const JsonValue& value) {
+            writer.value(value);
+        }
+    };
+
+    /**
+     * Arrays are read from and written as JSON arrays, converting each element with JsonConvert<T>.
+     */
+    template<typename T>
+    struct JsonConvert<Array<T>> {
+        /**
+         * @param value - A parsed value.
+         * @return The value as an Array of T.
+         * @throws InvalidValueException if the value isn't an array or an element can't be converted.
+         */
+        static Array<T> fromJson(const JsonValue& value) {
+            if (!value.isArray()) throw InvalidValueException("JSON value isn't an array");
+
+            Array<T> array = Array<T>();
+            for (size_t i = 0; i < value.size(); ++i) {
+                array.add(JsonConvert<T>::fromJson(value[i]));
+            }
+            return array;
+        }
+
+        /**
+         * @param writer - Where to write the value.
+         * @param value - The Array to write.
+         */
+        static void toJson(JsonWriter& writer, const Array<T>& value) {
+            writer.beginArray();
+            for (const T& element : value) {
+                JsonConvert<T>::toJson(writer, element);
+            }
+            writer.endArray();
+        }
+    };
+
+    /**
+     * Dictionaries with String keys are read from and written as JSON objects, converting each value with
+     * JsonConvert<V>. A key that's repeated in an object keeps its last value, as most JSON implementations do.
+     */
+    template<typename V>
+    struct JsonConvert<Dictionary<String, V>> {
+        /**
+         * @param value - A parsed value.
+         * @return The value as a Dictionary of V.
+         * @throws InvalidValueException if the value isn't an object or a member's value can't be converted.
+         */
+        static Dictionary<String, V> fromJson(const JsonValue& value) {
+            if (!value.isObject()) throw InvalidValueException("JSON value isn't an object");
+
+            Dictionary<String, V> dictionary = Dictionary<String, V>();
+            for (size_t i = 0; i < value.size(); ++i) {
+                const StringView key_view = value.key(i);
+                const String key = String(std::string(key_view.data(), key_view.length()));
+                if (dictionary.containsKey(key)) {
+                    dictionary.replace(key, JsonConvert<V>::fromJson(value.value(i)));
+                } else {
+                    dictionary.addObject(key, JsonConvert<V>::fromJson(value.value(i)));
+                }
+            }
+            return dictionary;
+        }
+
+        /**
+         * @param writer - Where to write the value.
+         * @param value - The Dictionary to write.
+         */
+        static void toJson(JsonWriter& writer, const Dictionary<String, V>& value) {
+            writer.beginObject();
+            for (const auto& member : value) {
+                writer.key(StringView(member.first));
+                JsonConvert<V>::toJson(writer, member.second);
+            }
+            writer.endObject();
+        }
+    };
+}
+
+#endif //ABRAHAM_JSON_HPP
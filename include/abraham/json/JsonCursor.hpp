@@ -0,0 +1,255 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_JSONCURSOR_HPP
+#define ABRAHAM_JSONCURSOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include "JsonIndex.hpp"
+#include "JsonValue.hpp"
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    class JsonDocument;
+
+    /**
+     * A position in an indexed JSON text, for reading a document on demand without building it.
+     *
+     * Moving to an element or member walks the structural characters of the JsonIndex, and the values passed over
+     * are skipped by counting brackets, without their strings or numbers being looked at. Only a value that's read
+     * is parsed, so reading a few fields of a large document costs about as much as indexing it. The parts of the
+     * document that are read are checked as strictly as a JsonDocument checks them, while the parts that are skipped
+     * are only checked to be balanced.
+     *
+     * A cursor refers to its index, which must outlive it. A value can be parsed into a JsonDocument with the
+     * JsonDocument(const JsonCursor&) constructor, which reuses the index.
+     *
+     * Example:
+     *     JsonIndex index = JsonIndex(text);
+     *     JsonCursor root = JsonCursor(index);
+     *     for (const JsonCursor& event : root["events"]) {
+     *         if (event["level"].asString() == "error") ++errors;
+     *     }
+     */
+    class JsonCursor {
+    protected:
+        const JsonIndex* _index;
+
+        /**
+         * The index of the value's first structural character.
+         */
+        size_t _position;
+
+        /**
+         * Marks that there is no next element or member.
+         */
+        static const size_t NO_POSITION = static_cast<size_t>(-1);
+
+        JsonCursor(const JsonIndex& index, size_t position);
+
+        /**
+         * @return The character at the index of a structural character.
+         * @throws InvalidValueException if the index is past the last structural character.
+         */
+        char character(size_t position) const;
+
+        /**
+         * @return The index of the structural character after the value starting at an index.
+         */
+        size_t skip(size_t position) const;
+
+        /**
+         * @return The index of the value of the member whose key is at an index.
+         */
+        size_t memberValue(size_t position) const;
+
+        /**
+         * @return The index of the first element or member value, or NO_POSITION if the container is empty.
+         */
+        size_t firstChild() const;
+
+        /**
+         * @return The index of the element or member value after one at an index, or NO_POSITION if it's the last.
+         */
+        size_t nextChild(size_t child, bool is_object) const;
+
+        /**
+         * @return The inside of the string whose opening quote is at an index, still escaped.
+         */
+        StringView rawString(size_t position) const;
+
+        friend class JsonDocument;
+
+    public:
+        class Iterator;
+
+        /**
+         * Default constructor that creates a cursor that isn't at a value, to be assigned one later.
+         */
+        JsonCursor();
+
+        /**
+         * Constructor that creates a cursor at the top level value of an indexed text.
+         * @param index - The index of the text.
+         * @throws InvalidValueException if the text has no value.
+         */
+        explicit JsonCursor(const JsonIndex& index);
+
+        /**
+         * The type of a number is found by parsing it; other types are known from their first character.
+         * @return The type of the value.
+         */
+        JsonType type() const;
+
+        /**
+         * @return true if the value is null; false otherwise.
+         */
+        bool isNull() const;
+
+        /**
+         * @return true if the value is true or false; false otherwise.
+         */
+        bool isBool() const;
+
+        /**
+         * @return true if the value is a number; false otherwise.
+         */
+        bool isNumber() const;
+
+        /**
+         * @return true if the value is a string; false otherwise.
+         */
+        bool isString() const;
+
+        /**
+         * @return true if the value is an array; false otherwise.
+         */
+        bool isArray() const;
+
+        /**
+         * @return true if the value is an object; false otherwise.
+         */
+        bool isObject() const;
+
+        /**
+         * Parses the value where it is, without building a JsonDocument.
+         * @return The value of a boolean.
+         * @throws InvalidValueException if the value isn't a boolean.
+         */
+        bool asBool() const;
+
+        /**
+         * Parses the value where it is, without building a JsonDocument.
+         * @return The value of an integer.
+         * @throws InvalidValueException if the value isn't an integer that fits in 64 bits.
+         */
+        int64_t asInteger() const;
+
+        /**
+         * Parses the value where it is, without building a JsonDocument.
+         * @return The value of a non-negative integer.
+         * @throws InvalidValueException if the value isn't an integer that fits in 64 bits unsigned.
+         */
+        uint64_t asUnsigned() const;
+
+        /**
+         * Parses the value where it is, without building a JsonDocument.
+         * @return The value of a number, converted to a double if it's an integer.
+         * @throws InvalidValueException if the value isn't a number.
+         */
+        double asDouble() const;
+
+        /**
+         * @return A copy of a string value, unescaped.
+         */
+        String asString() const;
+
+        /**
+         * @return The text of the value as it's written, from its first character to its last.
+         */
+        StringView raw() const;
+
+        /**
+         * Counting the elements or members skips over each of them.
+         * @return The number of elements of an array or members of an object.
+         */
+        size_t size() const;
+
+        /**
+         * @param index - The index of an element of an array.
+         * @return A cursor at the element.
+         * @throws OutOfBoundsException if the index is past the last element.
+         */
+        JsonCursor operator[](size_t index) const;
+
+        /**
+         * @param key - The key of a member of an object.
+         * @return A cursor at the value of the first member with the key.
+         * @throws InvalidValueException if the object has no member with the key.
+         */
+        JsonCursor operator[](const StringView& key) const;
+
+        /**
+         * @param key - The key of a member of an object.
+         * @param value - Set to a cursor at the value of the first member with the key.
+         * @return true if the object has a member with the key; false otherwise.
+         */
+        bool find(const StringView& key, JsonCursor& value) const;
+
+        /**
+         * @return The key of the member this cursor is at the value of, unescaped.
+         * @throws InvalidValueException if the value isn't a member of an object.
+         */
+        String key() const;
+
+        /**
+         * Iterates over the elements of an array, or the member values of an object.
+         * @return An iterator at the first element or member value.
+         */
+        Iterator begin() const;
+
+        /**
+         * @return An iterator past the last element or member value.
+         */
+        Iterator end() const;
+    };
+
+    /**
+     * An input iterator over the elements of an array, or the member values of an object, as cursors.
+     */
+    class JsonCursor::Iterator {
+    protected:
+        JsonCursor _child;
+        bool _isObject;
+        bool _end;
+
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef JsonCursor value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const JsonCursor* pointer;
+        typedef const JsonCursor& reference;
+
+        Iterator(const JsonCursor& parent, bool end);
+
+        const JsonCursor& operator*() const;
+
+        const JsonCursor* operator->() const;
+
+        Iterator& operator++();
+
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& iterator) const;
+
+        bool operator!=(const Iterator& iterator) const;
+    };
+}
+
+#endif //ABRAHAM_JSONCURSOR_HPP
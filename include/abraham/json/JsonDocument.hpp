@@ -0,0 +1,94 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_JSONDOCUMENT_HPP
+#define ABRAHAM_JSONDOCUMENT_HPP
+
+#include <memory>
+#include "Arena.hpp"
+#include "JsonCursor.hpp"
+#include "JsonValue.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * A parsed JSON document, built into an Arena.
+     *
+     * The text is indexed with a JsonIndex, then the values are built by walking the index, without recursion, so
+     * deep nesting can't overflow the stack. The children of an array or object are collected on a stack that's
+     * reused for the whole document and are copied into the Arena in one piece when the container is closed, so the
+     * document is a handful of large allocations, and freeing it is freeing them. The Arena isn't allocated at all for
+     * a document that is a single number or literal.
+     *
+     * The text is checked against RFC 8259, and an InvalidValueException with the index of the problem is thrown if
+     * it doesn't conform. The one stricter rule is that a "\u" escape of an unpaired UTF-16 surrogate, such as a lone
+     * "\uD800", is rejected, since strings are unescaped to UTF-8, which can't represent it. The document doesn't refer
+     * to the text once it's built.
+     *
+     * Example:
+     *     JsonDocument document = JsonDocument(R"({"name": "abraham", "tags": ["c++", "json"]})");
+     *     StringView name = document.root()["name"].asString();
+     */
+    class JsonDocument {
+    protected:
+        /**
+         * Where the strings, arrays and objects are kept.
+         */
+        std::unique_ptr<Arena> _arena;
+
+        /**
+         * The top level value. Its strings, arrays and objects are in the Arena.
+         */
+        JsonValue _root;
+
+        friend class details::JsonParser;
+
+    public:
+        /**
+         * Constructor that parses a JSON text.
+         * @param text - The text to parse.
+         * @throws InvalidValueException if the text isn't valid JSON.
+         */
+        explicit JsonDocument(const StringView& text);
+
+        /**
+         * Constructor that parses only the value a cursor is at, reusing the index it was found with.
+         * @param value - The value to parse.
+         * @throws InvalidValueException if the value isn't valid JSON.
+         */
+        explicit JsonDocument(const JsonCursor& value);
+
+        /**
+         * Move constructor that takes over another document's Arena. Values of the other document stay valid, and
+         * now belong to this one.
+         * @param document - The document to move from.
+         */
+        JsonDocument(JsonDocument&& document) noexcept = default;
+
+        /**
+         * Move assignment that takes over another document's Arena, freeing this document's values.
+         * @param document - The document to move from.
+         * @return A self reference.
+         */
+        JsonDocument& operator=(JsonDocument&& document) noexcept = default;
+
+        /**
+         * @return The document's top level value.
+         */
+        const JsonValue& root() const;
+
+        /**
+         * Parses the number, boolean or null a cursor is at without building a document, since none of them need
+         * storage.
+         * @param value - The value to parse.
+         * @return The parsed value.
+         * @throws InvalidValueException if the value is a string, array or object, or isn't valid JSON.
+         */
+        static JsonValue parseLiteral(const JsonCursor& value);
+    };
+}
+
+#endif //ABRAHAM_JSONDOCUMENT_HPP
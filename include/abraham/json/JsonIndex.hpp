@@ -0,0 +1,93 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_JSONINDEX_HPP
+#define ABRAHAM_JSONINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * The first stage of parsing JSON: the positions of the characters the structure of a document is made of, found
+     * without looking at the characters one at a time.
+     *
+     * The text is classified 64 bytes at a time, with AVX2 or SSE2 where they're available, into bit masks of its
+     * quotes, backslashes, operators ({}[]:,) and whitespace. Quotes escaped by an odd run of backslashes are removed
+     * with carries across the mask, and the insides of strings are found from the prefix XOR of the remaining quotes,
+     * with a carryless multiply where PCLMUL is available. What's left is an operator outside a string, the opening
+     * quote of each string, and the first character of each number and literal.
+     *
+     * The index checks only what it has to: that the text is UTF-8 and that its last string is closed. Everything
+     * else is checked by JsonDocument, or by a JsonCursor for the parts of a document it reads. The text isn't owned
+     * by the index and must outlive it.
+     */
+    class JsonIndex {
+    protected:
+        /**
+         * The indexed text.
+         */
+        StringView _text;
+
+        /**
+         * The offset of each structural character, in order.
+         */
+        std::vector<uint32_t> _positions;
+
+    public:
+        /**
+         * The longest text that can be indexed, since offsets are kept in 32 bits.
+         */
+        static const size_t MAX_LENGTH = UINT32_MAX;
+
+        /**
+         * Constructor that indexes some text.
+         * @param text - The JSON text.
+         * @throws InvalidValueException if the text is longer than MAX_LENGTH, isn't UTF-8, or has an unclosed string.
+         */
+        explicit JsonIndex(const StringView& text);
+
+        /**
+         * Finds the first character that can't appear in a JSON string without being escaped, or that starts an
+         * escape: a '"', a '\\', or a control character.
+         * @param begin - The first character to search.
+         * @param end - The character after the last to search.
+         * @return A pointer to the character, or end if there isn't one.
+         */
+        static const char* findEscapable(const char* begin, const char* end);
+
+        /**
+         * Replaces the escapes in the inside of a JSON string with the characters they stand for.
+         * @param begin - The first character after the opening quote.
+         * @param end - The closing quote.
+         * @param output - Where to write the characters. Must hold at least end - begin characters.
+         * @return The number of characters written.
+         * @throws InvalidValueException if an escape is invalid, a "\u" escape is an unpaired UTF-16 surrogate, which
+         * UTF-8 can't represent, or there is an unescaped control character.
+         */
+        static size_t unescape(const char* begin, const char* end, char* output);
+
+        /**
+         * @return The indexed text.
+         */
+        const StringView& text() const;
+
+        /**
+         * @param index - The index of a structural character.
+         * @return The character's offset in the text.
+         */
+        uint32_t operator[](size_t index) const;
+
+        /**
+         * @return The number of structural characters.
+         */
+        size_t size() const;
+    };
+}
+
+#endif //ABRAHAM_JSONINDEX_HPP
@@ -0,0 +1,209 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_JSONVALUE_HPP
+#define ABRAHAM_JSONVALUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    namespace details {
+        class JsonParser;
+    }
+
+    /**
+     * The kinds of value JSON has. Numbers are split into those written as integers that fit in 64 bits, signed or
+     * unsigned, and the rest.
+     */
+    enum class JsonType {
+        NULL_VALUE,
+        BOOLEAN,
+        INTEGER,
+        DOUBLE,
+        STRING,
+        ARRAY,
+        OBJECT
+    };
+
+    /**
+     * A value of a parsed JSON document. Values are owned by their JsonDocument, and are only valid as long as it is.
+     *
+     * Strings are unescaped when the document is parsed and are views of its memory. The members of an object are
+     * kept in the order they're written in, and a key is found by comparing it with each of them, which for the small
+     * objects JSON is usually made of is faster than hashing. Accessing a value as the wrong type throws
+     * InvalidValueException.
+     */
+    class JsonValue {
+    protected:
+        /**
+         * The kind of value.
+         */
+        JsonType _type;
+
+        /**
+         * Whether an integer is above INT64_MAX, and so is kept in unsignedInteger rather than integer.
+         */
+        bool _isUnsigned;
+
+        /**
+         * The number of characters of a string, elements of an array, or members of an object.
+         */
+        size_t _length;
+
+        union {
+            bool boolean;
+            int64_t integer;
+            uint64_t unsignedInteger;
+            double number;
+            const char* string;
+
+            /**
+             * The elements of an array, or the keys and values of an object one after the other.
+             */
+            const JsonValue* children;
+        } _value;
+
+        /**
+         * Throws an InvalidValueException, naming the expected type, if the value isn't of a type.
+         */
+        void checkType(JsonType type, const char* name) const;
+
+        friend class details::JsonParser;
+
+    public:
+        /**
+         * Default constructor that creates a null value.
+         */
+        JsonValue();
+
+        /**
+         * @return The kind of value.
+         */
+        JsonType type() const;
+
+        /**
+         * @return true if the value is null; false otherwise.
+         */
+        bool isNull() const;
+
+        /**
+         * @return true if the value is true or false; false otherwise.
+         */
+        bool isBool() const;
+
+        /**
+         * @return true if the value is an integer that fits in 64 bits, signed or unsigned; false otherwise.
+         */
+        bool isInteger() const;
+
+        /**
+         * @return true if the value is an integer above INT64_MAX, which can only be read with asUnsigned; false
+         * otherwise.
+         */
+        bool isUnsigned() const;
+
+        /**
+         * @return true if the value is a number that isn't an integer that fits in 64 bits; false otherwise.
+         */
+        bool isDouble() const;
+
+        /**
+         * @return true if the value is an integer or a double; false otherwise.
+         */
+        bool isNumber() const;
+
+        /**
+         * @return true if the value is a string; false otherwise.
+         */
+        bool isString() const;
+
+        /**
+         * @return true if the value is an array; false otherwise.
+         */
+        bool isArray() const;
+
+        /**
+         * @return true if the value is an object; false otherwise.
+         */
+        bool isObject() const;
+
+        /**
+         * @return The value of a boolean.
+         */
+        bool asBool() const;
+
+        /**
+         * @return The value of an integer.
+         * @throws InvalidValueException if the value isn't an integer, or is above INT64_MAX.
+         */
+        int64_t asInteger() const;
+
+        /**
+         * @return The value of an integer.
+         * @throws InvalidValueException if the value isn't an integer, or is negative.
+         */
+        uint64_t asUnsigned() const;
+
+        /**
+         * @return The value of a number, which may have been written as an integer.
+         */
+        double asDouble() const;
+
+        /**
+         * @return A view of the unescaped characters of a string.
+         */
+        StringView asString() const;
+
+        /**
+         * @return The number of elements of an array or members of an object.
+         */
+        size_t size() const;
+
+        /**
+         * @param index - The index of an element of an array.
+         * @return The element.
+         * @throws OutOfBoundsException if the index is past the last element.
+         */
+        const JsonValue& operator[](size_t index) const;
+
+        /**
+         * @param key - The key of a member of an object.
+         * @return The value of the first member with the key.
+         * @throws InvalidValueException if the object has no member with the key.
+         */
+        const JsonValue& operator[](const StringView& key) const;
+
+        /**
+         * @param key - The key of a member of an object.
+         * @return The value of the first member with the key, or nullptr if there isn't one.
+         */
+        const JsonValue* find(const StringView& key) const;
+
+        /**
+         * @param key - The key of a member of an object.
+         * @return true if the object has a member with the key; false otherwise.
+         */
+        bool containsKey(const StringView& key) const;
+
+        /**
+         * @param index - The index of a member of an object.
+         * @return The member's key.
+         * @throws OutOfBoundsException if the index is past the last member.
+         */
+        StringView key(size_t index) const;
+
+        /**
+         * @param index - The index of a member of an object.
+         * @return The member's value.
+         * @throws OutOfBoundsException if the index is past the last member.
+         */
+        const JsonValue& value(size_t index) const;
+    };
+}
+
+#endif //ABRAHAM_JSONVALUE_HPP
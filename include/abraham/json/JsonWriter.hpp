@@ -0,0 +1,252 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_JSONWRITER_HPP
+#define ABRAHAM_JSONWRITER_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "JsonValue.hpp"
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Writes compact JSON text into a growing buffer, a value at a time.
+     *
+     * Numbers are formatted by NumberFormatter straight into the end of the buffer, and strings are copied into it
+     * in runs between the characters that need escaping, which are found 16 or 32 at a time with SSE2 or AVX2, so
+     * nothing is built on the side and copied in. Commas and colons are added where they belong, and calls that would
+     * make invalid JSON, such as a value in an object without a key or an unbalanced end, throw
+     * InvalidArgumentException, as do the infinities and NaN, which JSON can't represent.
+     *
+     * Strings are expected to be UTF-8 and are written as they are, apart from the escapes.
+     *
+     * Example:
+     *     JsonWriter writer = JsonWriter();
+     *     writer.beginObject().key("name").value("abraham").key("version").value(1).endObject();
+     *     String json = writer.build();
+     */
+    class JsonWriter {
+    protected:
+        /**
+         * The text written so far.
+         */
+        std::string _output;
+
+        /**
+         * Whether each open container is an object.
+         */
+        std::vector<bool> _isObject;
+
+        /**
+         * Whether the open container, or the document, has a value yet.
+         */
+        bool _hasValue;
+
+        /**
+         * Whether a key has been written that's waiting for its value.
+         */
+        bool _hasKey;
+
+        /**
+         * Writes what separates a new value from the one before it, after checking a value can go here.
+         */
+        void beginValue();
+
+        /**
+         * Writes a string in quotes, escaped.
+         */
+        void appendString(const StringView& string);
+
+        /**
+         * Writes an integer, formatted straight into the end of the buffer.
+         */
+        template<typename T>
+        JsonWriter& appendNumber(T value);
+
+        /**
+         * Writes a float or double with the fewest digits that read back as the same value. One that's written
+         * without a fraction or exponent gets ".0", so it reads back as a double rather than an integer.
+         */
+        template<typename T>
+        JsonWriter& appendFloatingPoint(T value);
+
+    public:
+        /**
+         * Constructor that creates an empty JsonWriter.
+         * @param capacity - The number of characters to reserve room for.
+         */
+        explicit JsonWriter(size_t capacity = 0);
+
+        /**
+         * Opens an object, whose members are written with key and then a value.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& beginObject();
+
+        /**
+         * Closes the innermost open object.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if the innermost open container isn't an object, or its last key has no
+         * value.
+         */
+        JsonWriter& endObject();
+
+        /**
+         * Opens an array, whose elements are the values written until it's closed.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& beginArray();
+
+        /**
+         * Closes the innermost open array.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if the innermost open container isn't an array.
+         */
+        JsonWriter& endArray();
+
+        /**
+         * Writes the key of the next member of an object.
+         * @param name - The key.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if an object isn't open, or the last key has no value yet.
+         */
+        JsonWriter& key(const StringView& name);
+
+        /**
+         * Writes null.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& null();
+
+        /**
+         * Writes true or false.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(bool value);
+
+        /**
+         * Writes an integer.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(int value);
+
+        /**
+         * Writes an integer.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(long value);
+
+        /**
+         * Writes an integer.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(long long value);
+
+        /**
+         * Writes an integer.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(unsigned value);
+
+        /**
+         * Writes an integer.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(unsigned long value);
+
+        /**
+         * Writes an integer.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(unsigned long long value);
+
+        /**
+         * Writes a number with the fewest digits that read back as the same float, with ".0" added to an integral
+         * value so it reads back as a double.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if the value is infinite or NaN, or a value can't go here.
+         */
+        JsonWriter& value(float value);
+
+        /**
+         * Writes a number with the fewest digits that read back as the same double, with ".0" added to an integral
+         * value so it reads back as a double.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if the value is infinite or NaN, or a value can't go here.
+         */
+        JsonWriter& value(double value);
+
+        /**
+         * Writes a string in quotes, escaped.
+         * @param value - The null terminated UTF-8 characters to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(const char* value);
+
+        /**
+         * Writes a string in quotes, escaped.
+         * @param value - The UTF-8 characters to write.
+         * @return A reference to this JsonWriter.
+         * @throws InvalidArgumentException if a value can't go here.
+         */
+        JsonWriter& value(const StringView& value);
+
+        /**
+         * Writes a parsed value, with everything in it.
+         * @param value - The value to write.
+         * @return A reference to this JsonWriter.
+         */
+        JsonWriter& value(const JsonValue& value);
+
+        /**
+         * @return The text written so far.
+         */
+        StringView view() const;
+
+        /**
+         * @return true if a whole value has been written, with every container closed; false otherwise.
+         */
+        bool isComplete() const;
+
+        /**
+         * Moves the text into a String and leaves the JsonWriter empty, ready to write another document.
+         * @return The JSON text.
+         * @throws InvalidArgumentException if the document isn't complete.
+         */
+        String build();
+
+        /**
+         * Discards what has been written.
+         * @return A reference to this JsonWriter.
+         */
+        JsonWriter& clear();
+    };
+}
+
+#endif //ABRAHAM_JSONWRITER_HPP
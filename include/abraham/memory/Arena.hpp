@@ -0,0 +1,140 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_ARENA_HPP
+#define ABRAHAM_ARENA_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace abraham {
+
+    /**
+     * A bump allocator that hands out memory from large blocks and releases all of it at once. Allocating is a
+     * pointer increment, and nothing is freed individually; reset makes every block available again without
+     * returning them to the heap, so an Arena reused for each request or batch stops allocating once it's warm.
+     *
+     * Objects created in an Arena don't have their destructors run, so only trivially destructible types can be.
+     */
+    class Arena {
+    protected:
+        struct Block {
+            char* data;
+            size_t size;
+        };
+
+        /**
+         * Every block the Arena owns, in the order they're used.
+         */
+        std::vector<Block> _blocks;
+
+        /**
+         * The index of the block allocations are coming from.
+         */
+        size_t _current;
+
+        /**
+         * The number of bytes used in the current block.
+         */
+        size_t _used;
+
+        /**
+         * The number of bytes used in the blocks before the current one.
+         */
+        size_t _usedBefore;
+
+        /**
+         * The size of the next block that's created, which doubles each time up to MAX_BLOCK_SIZE.
+         */
+        size_t _nextBlockSize;
+
+        /**
+         * Moves to a block with room for an allocation, creating one if none of the remaining blocks are large
+         * enough.
+         */
+        void advance(size_t size, size_t alignment);
+
+    public:
+        /**
+         * The size of the first block, unless another is given.
+         */
+        static const size_t DEFAULT_BLOCK_SIZE = 4096;
+
+        /**
+         * Blocks stop growing at this size, although a single larger allocation still gets a block of its own.
+         */
+        static const size_t MAX_BLOCK_SIZE = 1 << 20;
+
+        /**
+         * Constructor that creates an empty Arena. No memory is allocated until it's first used.
+         * @param block_size - The size of the first block.
+         */
+        explicit Arena(size_t block_size = DEFAULT_BLOCK_SIZE);
+
+        Arena(const Arena& arena) = delete;
+
+        Arena& operator=(const Arena& arena) = delete;
+
+        /**
+         * Destructor that returns every block to the heap.
+         */
+        ~Arena();
+
+        /**
+         * @param size - The number of bytes needed.
+         * @param alignment - The alignment needed, which must be a power of two.
+         * @return Uninitialized memory that stays valid until the Arena is reset or destroyed.
+         */
+        void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * Resizes an allocation. It's extended in place if it's the most recent allocation and its block has room;
+         * otherwise it's copied to a new allocation, and the old one isn't reused until the Arena is reset.
+         * @param memory - The allocation to resize, or nullptr to allocate.
+         * @param old_size - The size the allocation was made with.
+         * @param new_size - The size needed.
+         * @param alignment - The alignment the allocation was made with.
+         * @return The resized allocation.
+         */
+        void* reallocate(void* memory, size_t old_size, size_t new_size, size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * Constructs an object in memory from the Arena.
+         * @param args - The arguments for the object's constructor.
+         * @return The object, which lives until the Arena is reset or destroyed.
+         */
+        template<typename T, typename... Args>
+        T* create(Args&&... args);
+
+        /**
+         * Makes all of the Arena's memory available again. Everything allocated from it is invalidated.
+         */
+        void reset();
+
+        /**
+         * @return The number of bytes handed out since the Arena was created or reset, including alignment padding.
+         */
+        size_t used() const;
+
+        /**
+         * @return The number of bytes in all of the Arena's blocks.
+         */
+        size_t capacity() const;
+    };
+
+
+    // Template Implementation
+
+    template<typename T, typename... Args>
+    T* Arena::create(Args&&... args) {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena objects are never destroyed");
+        return new (this->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+}
+
+#endif //ABRAHAM_ARENA_HPP
@@ -0,0 +1,102 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_ASCII_HPP
+#define ABRAHAM_ASCII_HPP
+
+#include <cstddef>
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Locale independent ASCII case mapping and case insensitive comparison. Only the letters A-Z and a-z are
+     * changed or folded; every other byte, including UTF-8 sequences, is left as it is.
+     *
+     * The range functions work on sixteen bytes at a time with SSE2, or thirty two with AVX2 when the library is
+     * compiled for it, and fall back to eight bytes at a time in a machine word otherwise. None of them allocate.
+     */
+    class Ascii {
+    public:
+        /**
+         * @param c - The character to convert.
+         * @return The lowercase character if c is an uppercase ASCII letter; c otherwise.
+         */
+        static char toLowerCase(char c);
+
+        /**
+         * @param c - The character to convert.
+         * @return The uppercase character if c is a lowercase ASCII letter; c otherwise.
+         */
+        static char toUpperCase(char c);
+
+        /**
+         * Converts a range of characters to lowercase in place.
+         * @param data - The first character.
+         * @param length - The number of characters.
+         */
+        static void toLowerCase(char* data, size_t length);
+
+        /**
+         * Converts a range of characters to uppercase in place.
+         * @param data - The first character.
+         * @param length - The number of characters.
+         */
+        static void toUpperCase(char* data, size_t length);
+
+        /**
+         * Swaps the case of every letter in a range of characters in place.
+         * @param data - The first character.
+         * @param length - The number of characters.
+         */
+        static void swapCase(char* data, size_t length);
+
+        /**
+         * @param left - The first range of characters.
+         * @param right - The second range of characters.
+         * @param length - The number of characters in each range.
+         * @return true if the ranges are equal ignoring case; false otherwise.
+         */
+        static bool isEqualIgnoringCase(const char* left, const char* right, size_t length);
+
+        /**
+         * Orders two ranges of characters as if both were lowercase, byte by byte.
+         * @return A negative value, zero or a positive value as left sorts before, with or after right.
+         */
+        static int compareIgnoringCase(const char* left, size_t left_length, const char* right, size_t right_length);
+
+        /**
+         * @param data - The first character.
+         * @param length - The number of characters.
+         * @return A hash of the characters that's the same for any two ranges equal ignoring case.
+         */
+        static size_t hashIgnoringCase(const char* data, size_t length);
+    };
+
+    /**
+     * Hash function object for case insensitive keys, for use with std::unordered_map and std::unordered_set.
+     * Example:
+     *     std::unordered_map<String, int, CaseInsensitiveHash, CaseInsensitiveEqual> headers;
+     */
+    struct CaseInsensitiveHash {
+        size_t operator()(const StringView& view) const;
+    };
+
+    /**
+     * Equality function object for case insensitive keys.
+     */
+    struct CaseInsensitiveEqual {
+        bool operator()(const StringView& left, const StringView& right) const;
+    };
+
+    /**
+     * Ordering function object for case insensitive keys, for use with std::map and std::set.
+     */
+    struct CaseInsensitiveLess {
+        bool operator()(const StringView& left, const StringView& right) const;
+    };
+}
+
+#endif //ABRAHAM_ASCII_HPP
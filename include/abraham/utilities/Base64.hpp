@@ -0,0 +1,107 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_BASE64_HPP
+#define ABRAHAM_BASE64_HPP
+
+#include <cstddef>
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * The two alphabets of RFC 4648, which differ only in the characters for 62 and 63.
+     */
+    enum class Base64Alphabet {
+        /**
+         * A-Z, a-z, 0-9, '+' and '/'.
+         */
+        STANDARD,
+
+        /**
+         * A-Z, a-z, 0-9, '-' and '_', safe in URLs and file names.
+         */
+        URL
+    };
+
+    /**
+     * Base64 encoding and decoding of bytes, as RFC 4648 defines them.
+     *
+     * When the library is compiled with SSSE3, twelve bytes are encoded into sixteen characters, and sixteen
+     * characters decoded into twelve bytes, at a time with the shuffle and multiply algorithms of Mula and Lemire;
+     * with AVX2 it's twice that. Elsewhere a group of three bytes is handled at a time.
+     *
+     * Decoding is strict, and throws InvalidValueException for a character outside the alphabet, including
+     * whitespace, for padding anywhere but the end, and for a final character whose unused bits aren't zero, so
+     * each byte sequence has exactly one accepted encoding. Padding may be left off, but if it's there it must be
+     * complete.
+     */
+    class Base64 {
+    public:
+        /**
+         * @param length - A number of bytes.
+         * @param padding - Whether the encoding is padded with '=' to a multiple of four characters.
+         * @return The number of characters encoding them takes.
+         */
+        static size_t encodedLength(size_t length, bool padding = true);
+
+        /**
+         * Encodes bytes as base64.
+         * @param data - The first byte.
+         * @param length - The number of bytes.
+         * @param output - Where to write the characters. Must hold at least encodedLength(length, padding).
+         * @param alphabet - The alphabet to encode with.
+         * @param padding - Whether to pad with '=' to a multiple of four characters.
+         * @return The number of characters written.
+         */
+        static size_t encode(const void* data, size_t length, char* output,
+                             Base64Alphabet alphabet = Base64Alphabet::STANDARD, bool padding = true);
+
+        /**
+         * @param bytes - The bytes to encode.
+         * @param alphabet - The alphabet to encode with.
+         * @param padding - Whether to pad with '=' to a multiple of four characters.
+         * @return A String of the encoding.
+         */
+        static String encode(const StringView& bytes, Base64Alphabet alphabet = Base64Alphabet::STANDARD,
+                             bool padding = true);
+
+        /**
+         * @param length - A number of base64 characters.
+         * @return The most bytes decoding them can produce, which is exact for unpadded input.
+         */
+        static size_t maxDecodedLength(size_t length);
+
+        /**
+         * Decodes base64 into a caller provided buffer.
+         * @param text - The first character.
+         * @param length - The number of characters.
+         * @param output - Where to write the bytes. Must hold at least maxDecodedLength(length) bytes.
+         * @param alphabet - The alphabet the text is encoded with.
+         * @return The number of bytes written.
+         * @throws InvalidValueException if the text isn't valid base64.
+         */
+        static size_t decode(const char* text, size_t length, void* output,
+                             Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+        /**
+         * @param text - The base64 text.
+         * @param alphabet - The alphabet the text is encoded with.
+         * @return A String of the decoded bytes.
+         * @throws InvalidValueException if the text isn't valid base64.
+         */
+        static String decode(const StringView& text, Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+        /**
+         * @param text - The characters to check.
+         * @param alphabet - The alphabet the text is encoded with.
+         * @return true if the characters can be decoded; false otherwise.
+         */
+        static bool isValid(const StringView& text, Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+    };
+}
+
+#endif //ABRAHAM_BASE64_HPP
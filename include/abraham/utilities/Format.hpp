@@ -0,0 +1,205 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_FORMAT_HPP
+#define ABRAHAM_FORMAT_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include "NumberFormatter.hpp"
+#include "StringView.hpp"
+
+
+/**
+ * Wraps a string literal so String::format can check it at compile time. A format string that has the wrong number
+ * of {} placeholders for its arguments, or a { or } that isn't part of a placeholder or doubled to escape it, is a
+ * compile error.
+ *
+ * Example:
+ *     String message = String::format(ABRAHAM_FORMAT("{} took {}ms"), name, elapsed);
+ */
+#define ABRAHAM_FORMAT(format)                                                             \
+    [] {                                                                                    \
+        struct AbrahamFormat : ::abraham::details::CompileTimeFormat {                       \
+            static constexpr const char* data() { return format; }                           \
+            static constexpr size_t length() { return sizeof(format) - 1; }                  \
+        };                                                                                  \
+        return AbrahamFormat();                                                             \
+    }()
+
+
+namespace abraham {
+
+    /**
+     * Writes a value into a format's output. Specialize it to format other types, with a length function giving an
+     * upper bound or estimate of the characters written, used to size the output once, and an append function that
+     * writes them.
+     * @tparam T - The type to format.
+     */
+    template<typename T, typename Enable = void>
+    struct Formatter;
+
+    namespace details {
+        /**
+         * The base of the types ABRAHAM_FORMAT creates.
+         */
+        struct CompileTimeFormat {};
+
+        const size_t MALFORMED_FORMAT = static_cast<size_t>(-1);
+
+        /**
+         * @return The number of {} placeholders in a format string, or MALFORMED_FORMAT if a brace is unmatched.
+         */
+        constexpr size_t countPlaceholders(const char* format, size_t length) {
+            size_t count = 0;
+            for (size_t i = 0; i < length; ++i) {
+                if (format[i] == '{') {
+                    if (i + 1 < length && format[i + 1] == '}') {
+                        ++count;
+                    } else if (i + 1 >= length || format[i + 1] != '{') {
+                        return MALFORMED_FORMAT;
+                    }
+                    ++i;
+                } else if (format[i] == '}') {
+                    if (i + 1 >= length || format[i + 1] != '}') return MALFORMED_FORMAT;
+                    ++i;
+                }
+            }
+
+            return count;
+        }
+
+        /**
+         * An argument with its type erased, so the format string is walked by one non-template function.
+         */
+        struct FormatArgument {
+            const void* value;
+            void (*append)(std::string& output, const void* value);
+        };
+
+        template<typename T>
+        void appendArgument(std::string& output, const void* value) {
+            Formatter<T>::append(output, *static_cast<const T*>(value));
+        }
+
+        /**
+         * Appends a format string to an output, replacing each placeholder with the next argument. The format must
+         * already have been checked.
+         */
+        void formatArguments(std::string& output, const char* format, size_t length, const FormatArgument* arguments);
+
+        /**
+         * Throws InvalidArgumentException if a format string is malformed or doesn't have a placeholder for each
+         * argument.
+         */
+        void checkFormat(const char* format, size_t length, size_t argument_count);
+
+        inline size_t sumLengths() {
+            return 0;
+        }
+
+        template<typename T, typename... Args>
+        size_t sumLengths(const T& value, const Args&... args) {
+            return Formatter<T>::length(value) + sumLengths(args...);
+        }
+
+        /**
+         * Sizes the output once for the whole result, then formats into it.
+         */
+        template<typename... Args>
+        void formatTo(std::string& output, const char* format, size_t length, const Args&... args) {
+            output.reserve(output.length() + length + sumLengths(args...));
+
+            // One extra element so the array isn't empty when there are no arguments
+            const FormatArgument arguments[] = {{&args, &appendArgument<Args>}..., {nullptr, nullptr}};
+            formatArguments(output, format, length, arguments);
+        }
+    }
+
+
+    // Formatters
+
+    template<>
+    struct Formatter<char> {
+        static size_t length(char) { return 1; }
+
+        static void append(std::string& output, char value) { output.push_back(value); }
+    };
+
+    template<>
+    struct Formatter<bool> {
+        static size_t length(bool) { return 5; }
+
+        static void append(std::string& output, bool value) { output.append(value ? "true" : "false"); }
+    };
+
+    /**
+     * Integers other than char and bool, written as NumberFormatter writes them.
+     */
+    template<typename T>
+    struct Formatter<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, char>::value &&
+                                                !std::is_same<T, bool>::value>::type> {
+        typedef typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type Wide;
+
+        static size_t length(T) { return NumberFormatter::MAX_LENGTH; }
+
+        static void append(std::string& output, T value) {
+            const size_t length = output.length();
+            output.resize(length + NumberFormatter::MAX_LENGTH);
+            output.resize(length + NumberFormatter::format(static_cast<Wide>(value), &output[length]));
+        }
+    };
+
+    /**
+     * Floating point values, written with the fewest digits that parse back to the same value.
+     */
+    template<typename T>
+    struct Formatter<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+        typedef typename std::conditional<std::is_same<T, float>::value, float, double>::type Narrow;
+
+        static size_t length(T) { return NumberFormatter::MAX_LENGTH; }
+
+        static void append(std::string& output, T value) {
+            const size_t length = output.length();
+            output.resize(length + NumberFormatter::MAX_LENGTH);
+            output.resize(length + NumberFormatter::format(static_cast<Narrow>(value), &output[length]));
+        }
+    };
+
+    template<>
+    struct Formatter<const char*> {
+        static size_t length(const char* value) { return std::strlen(value); }
+
+        static void append(std::string& output, const char* value) { output.append(value); }
+    };
+
+    template<>
+    struct Formatter<char*> : Formatter<const char*> {};
+
+    /**
+     * String literals and character arrays, which are deduced as arrays rather than pointers.
+     */
+    template<size_t N>
+    struct Formatter<char[N]> : Formatter<const char*> {};
+
+    template<>
+    struct Formatter<std::string> {
+        static size_t length(const std::string& value) { return value.length(); }
+
+        static void append(std::string& output, const std::string& value) { output.append(value); }
+    };
+
+    template<>
+    struct Formatter<StringView> {
+        static size_t length(const StringView& value) { return value.length(); }
+
+        static void append(std::string& output, const StringView& value) {
+            output.append(value.data(), value.length());
+        }
+    };
+}
+
+#endif //ABRAHAM_FORMAT_HPP
@@ -0,0 +1,64 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_HASH_HPP
+#define ABRAHAM_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+
+namespace abraham {
+
+    /**
+     * A fast non-cryptographic hash of bytes, based on wyhash. Short inputs are read in at most two overlapping loads
+     * without a loop, and long inputs are consumed 48 bytes at a time in three independent lanes so the multiplies
+     * overlap. Each step mixes with a 64x64 to 128 bit multiply.
+     *
+     * Hashes depend on the platform's byte order and may change between versions, so they shouldn't be stored or
+     * sent anywhere. They're not resistant to deliberate collisions, so keys chosen by an attacker should be hashed
+     * with a secret seed.
+     */
+    class Hasher {
+    public:
+        /**
+         * @param data - The first byte to hash.
+         * @param length - The number of bytes to hash.
+         * @param seed - A value that selects a different hash function.
+         * @return The hash of the bytes.
+         */
+        static uint64_t hash(const void* data, size_t length, uint64_t seed = 0);
+
+        /**
+         * @param value - The integer to hash.
+         * @return A hash of the integer whose bits all depend on every bit of it.
+         */
+        static uint64_t hashInteger(uint64_t value);
+
+        /**
+         * Folds another hash into a running hash, for hashing sequences and aggregates. The order matters, so
+         * combining a then b differs from combining b then a.
+         * @param seed - The running hash.
+         * @param hash - The hash to fold in.
+         * @return The new running hash.
+         */
+        static uint64_t combine(uint64_t seed, uint64_t hash);
+    };
+
+    /**
+     * The hash function object Abraham's containers use for their elements and keys. It defaults to std::hash, and is
+     * specialized for Abraham's strings and containers. Specialize it for a type to change how Abraham hashes it
+     * without touching std.
+     * @tparam T - The type to hash.
+     */
+    template<typename T>
+    struct Hash {
+        size_t operator()(const T& value) const {
+            return std::hash<T>()(value);
+        }
+    };
+}
+
+#endif //ABRAHAM_HASH_HPP
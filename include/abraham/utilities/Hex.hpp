@@ -0,0 +1,78 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_HEX_HPP
+#define ABRAHAM_HEX_HPP
+
+#include <cstddef>
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Hexadecimal encoding and decoding of bytes, two digits per byte with the high nibble first.
+     *
+     * Both directions work thirty-two bytes at a time with AVX2 or sixteen at a time with SSE2 when the library is
+     * compiled with them, and a byte at a time otherwise. Decoding is strict: the input must have an even length and
+     * contain only the digits 0-9, a-f and A-F, or InvalidValueException is thrown.
+     */
+    class Hex {
+    public:
+        /**
+         * @param length - A number of bytes.
+         * @return The number of digits encoding them takes.
+         */
+        static size_t encodedLength(size_t length);
+
+        /**
+         * Encodes bytes as hex digits.
+         * @param data - The first byte.
+         * @param length - The number of bytes.
+         * @param output - Where to write the digits. Must hold at least encodedLength(length) characters.
+         * @param uppercase - Whether to write A-F rather than a-f.
+         * @return The number of digits written.
+         */
+        static size_t encode(const void* data, size_t length, char* output, bool uppercase = false);
+
+        /**
+         * @param bytes - The bytes to encode.
+         * @param uppercase - Whether to write A-F rather than a-f.
+         * @return A String of the hex digits.
+         */
+        static String encode(const StringView& bytes, bool uppercase = false);
+
+        /**
+         * @param length - A number of hex digits.
+         * @return The number of bytes decoding them produces.
+         */
+        static size_t decodedLength(size_t length);
+
+        /**
+         * Decodes hex digits into a caller provided buffer.
+         * @param text - The first digit.
+         * @param length - The number of digits.
+         * @param output - Where to write the bytes. Must hold at least decodedLength(length) bytes.
+         * @return The number of bytes written.
+         * @throws InvalidValueException if the length is odd or a character isn't a hex digit.
+         */
+        static size_t decode(const char* text, size_t length, void* output);
+
+        /**
+         * @param text - The hex digits.
+         * @return A String of the decoded bytes.
+         * @throws InvalidValueException if the length is odd or a character isn't a hex digit.
+         */
+        static String decode(const StringView& text);
+
+        /**
+         * @param text - The characters to check.
+         * @return true if the characters can be decoded; false otherwise.
+         */
+        static bool isValid(const StringView& text);
+    };
+}
+
+#endif //ABRAHAM_HEX_HPP
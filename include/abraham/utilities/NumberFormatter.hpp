@@ -0,0 +1,99 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_NUMBERFORMATTER_HPP
+#define ABRAHAM_NUMBERFORMATTER_HPP
+
+#include <cstddef>
+
+
+namespace abraham {
+
+    /**
+     * Locale independent formatting of numbers into a caller's buffer, without allocating.
+     *
+     * Integers are written two digits at a time from a table of digit pairs. Floating point values are written with
+     * the fewest significant digits that parse back to the same value, found with the Schubfach algorithm. They're
+     * written in fixed notation when the decimal point is within 21 digits of the first digit and the value is at
+     * least 0.000001, such as 1234.5 or 0.001, and in scientific notation otherwise, such as 1e+21 or 1.5e-7.
+     * Infinities and NaN are written as inf, -inf and nan. The output parses back with NumberParser.
+     */
+    class NumberFormatter {
+    public:
+        /**
+         * The most characters any value is written as. Buffers given to format must hold at least this many.
+         */
+        static const size_t MAX_LENGTH = 32;
+
+        /**
+         * Writes a number as decimal characters. The buffer isn't null terminated.
+         * @param value - The number to write.
+         * @param buffer - Where to write it. Must hold at least MAX_LENGTH characters.
+         * @return The number of characters written.
+         */
+        static size_t format(int value, char* buffer);
+
+        /**
+         * Writes a number as decimal characters, with a leading '-' if it is negative. The buffer isn't null
+         * terminated.
+         * @param value - The number to write.
+         * @param buffer - Where to write it. Must hold at least MAX_LENGTH characters.
+         * @return The number of characters written.
+         */
+        static size_t format(long value, char* buffer);
+
+        /**
+         * Writes a number as decimal characters, with a leading '-' if it is negative. The buffer isn't null
+         * terminated.
+         * @param value - The number to write.
+         * @param buffer - Where to write it. Must hold at least MAX_LENGTH characters.
+         * @return The number of characters written.
+         */
+        static size_t format(long long value, char* buffer);
+
+        /**
+         * Writes a number as decimal characters. The buffer isn't null terminated.
+         * @param value - The number to write.
+         * @param buffer - Where to write it. Must hold at least MAX_LENGTH characters.
+         * @return The number of characters written.
+         */
+        static size_t format(unsigned value, char* buffer);
+
+        /**
+         * Writes a number as decimal characters. The buffer isn't null terminated.
+         * @param value - The number to write.
+         * @param buffer - Where to write it. Must hold at least MAX_LENGTH characters.
+         * @return The number of characters written.
+         */
+        static size_t format(unsigned long value, char* buffer);
+
+        /**
+         * Writes a number as decimal characters. The buffer isn't null terminated.
+         * @param value - The number to write.
+         * @param buffer - Where to write it. Must hold at least MAX_LENGTH characters.
+         * @return The number of characters written.
+         */
+        static size_t format(unsigned long long value, char* buffer);
+
+        /**
+         * Writes a number with the fewest significant digits that parse back to the same float, which may be fewer
+         * than the same value needs as a double. The buffer isn't null terminated.
+         * @param value - The number to write.
+         * @param buffer - Where to write it. Must hold at least MAX_LENGTH characters.
+         * @return The number of characters written.
+         */
+        static size_t format(float value, char* buffer);
+
+        /**
+         * Writes a number with the fewest significant digits that parse back to the same double. The buffer isn't
+         * null terminated.
+         * @param value - The number to write.
+         * @param buffer - Where to write it. Must hold at least MAX_LENGTH characters.
+         * @return The number of characters written.
+         */
+        static size_t format(double value, char* buffer);
+    };
+}
+
+#endif //ABRAHAM_NUMBERFORMATTER_HPP
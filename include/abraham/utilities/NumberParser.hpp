@@ -0,0 +1,270 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_NUMBERPARSER_HPP
+#define ABRAHAM_NUMBERPARSER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include "Array.hpp"
+#include "Exception.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * Why a NumberParser couldn't produce a value.
+     */
+    enum class ParseError {
+        /**
+         * The value was parsed.
+         */
+        NONE,
+
+        /**
+         * The characters aren't a number of the requested type.
+         */
+        INVALID,
+
+        /**
+         * The characters are a number, but it doesn't fit in the requested type.
+         */
+        OUT_OF_RANGE
+    };
+
+    /**
+     * The outcome of parsing a number from the start of a range of characters.
+     */
+    struct ParseResult {
+        /**
+         * The number of characters that make up the number. Zero when nothing was recognized.
+         */
+        size_t length;
+
+        /**
+         * Why the value couldn't be parsed, or NONE if it was.
+         */
+        ParseError error;
+
+        /**
+         * @return true if a value was parsed; false otherwise.
+         */
+        bool isValid() const {
+            return this->error == ParseError::NONE;
+        }
+    };
+
+    /**
+     * Locale independent parsing of decimal numbers that reports failure with an error code instead of throwing and
+     * never allocates, in the manner of std::from_chars.
+     *
+     * Integers are read eight digits at a time in a machine word. Floating point values are rounded correctly with
+     * the Eisel-Lemire algorithm, which needs a single 128 bit multiplication for any number with up to nineteen
+     * significant digits; longer numbers fall back to the C library.
+     *
+     * Accepted numbers are an optional sign, digits, and for floating point values an optional fraction, an optional
+     * exponent, or inf, infinity and nan in any case. Hexadecimal is not accepted.
+     */
+    class NumberParser {
+    public:
+        /**
+         * Parses the number at the start of a range of characters, in the manner of std::from_chars. Leading
+         * whitespace isn't skipped and parsing stops at the first character that can't be part of the number.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return The number of characters used and whether the value was parsed.
+         */
+        static ParseResult parse(const StringView& string, int& value);
+
+        /**
+         * Parses a long at the start of a range of characters, as parse does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return The number of characters used and whether the value was parsed.
+         */
+        static ParseResult parse(const StringView& string, long& value);
+
+        /**
+         * Parses a long long at the start of a range of characters, as parse does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return The number of characters used and whether the value was parsed.
+         */
+        static ParseResult parse(const StringView& string, long long& value);
+
+        /**
+         * Parses an unsigned at the start of a range of characters, as parse does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return The number of characters used and whether the value was parsed.
+         */
+        static ParseResult parse(const StringView& string, unsigned& value);
+
+        /**
+         * Parses an unsigned long at the start of a range of characters, as parse does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return The number of characters used and whether the value was parsed.
+         */
+        static ParseResult parse(const StringView& string, unsigned long& value);
+
+        /**
+         * Parses an unsigned long long at the start of a range of characters, as parse does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return The number of characters used and whether the value was parsed.
+         */
+        static ParseResult parse(const StringView& string, unsigned long long& value);
+
+        /**
+         * Parses a float at the start of a range of characters, as parse does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return The number of characters used and whether the value was parsed.
+         */
+        static ParseResult parse(const StringView& string, float& value);
+
+        /**
+         * Parses a double at the start of a range of characters, as parse does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return The number of characters used and whether the value was parsed.
+         */
+        static ParseResult parse(const StringView& string, double& value);
+
+        /**
+         * Parses a whole value. ASCII whitespace around the value is ignored, and any other character that isn't
+         * part of the number is an error.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, int& value);
+
+        /**
+         * Parses a whole long value, as parseValue does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, long& value);
+
+        /**
+         * Parses a whole long long value, as parseValue does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, long long& value);
+
+        /**
+         * Parses a whole unsigned value, as parseValue does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, unsigned& value);
+
+        /**
+         * Parses a whole unsigned long value, as parseValue does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, unsigned long& value);
+
+        /**
+         * Parses a whole unsigned long long value, as parseValue does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, unsigned long long& value);
+
+        /**
+         * Parses a whole float value, as parseValue does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, float& value);
+
+        /**
+         * Parses a whole double value, as parseValue does for an int.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, double& value);
+
+        /**
+         * Parses a whole bool value. Valid values are: true, false, yes, no, n, y, 0, 1. Values are not case
+         * sensitive and ASCII whitespace around the value is ignored.
+         * @param string - The characters to parse.
+         * @param value - Set to the parsed value. Left unchanged if there is an error.
+         * @return Whether the value was parsed.
+         */
+        static ParseError parseValue(const StringView& string, bool& value);
+
+        /**
+         * Parses a whole value, throwing an InvalidValueException naming the type if it isn't valid.
+         * @param string - The characters to parse.
+         * @param type_name - The name of the type, for the exception message.
+         * @return The parsed value.
+         */
+        template<typename T>
+        static T valueOf(const StringView& string, const char* type_name);
+
+        /**
+         * Parses every field of a delimited column, such as one line of a CSV file or a file of one number per line.
+         * Each field is parsed as a whole value, and a delimiter at the end of the column doesn't start another field.
+         * @param column - The delimited fields.
+         * @param delimiter - The character between fields.
+         * @param values - The parsed values are added to the end. On error it holds the fields before the bad one,
+         * so the number added is the index of the field that couldn't be parsed.
+         * @return Whether every field was parsed.
+         */
+        template<typename T>
+        static ParseError parseColumn(const StringView& column, char delimiter, Array<T>& values);
+    };
+
+
+    // Template Implementation
+
+    template<typename T>
+    T NumberParser::valueOf(const StringView& string, const char* type_name) {
+        T value = T();
+        if (parseValue(string, value) != ParseError::NONE) {
+            throw InvalidValueException(std::string("Value could not be converted to ") + type_name + ": " +
+                                        string.std_string());
+        }
+
+        return value;
+    }
+
+    template<typename T>
+    ParseError NumberParser::parseColumn(const StringView& column, char delimiter, Array<T>& values) {
+        const char* position = column.data();
+        const char* end = position + column.length();
+
+        while (position < end) {
+            const char* field_end = static_cast<const char*>(std::memchr(position, delimiter,
+                                                                         static_cast<size_t>(end - position)));
+            if (field_end == nullptr) field_end = end;
+
+            T value = T();
+            ParseError error = parseValue(StringView(position, static_cast<size_t>(field_end - position)), value);
+            if (error != ParseError::NONE) return error;
+
+            values.add(value);
+            position = field_end + 1;
+        }
+
+        return ParseError::NONE;
+    }
+}
+
+#endif //ABRAHAM_NUMBERPARSER_HPP
@@ -0,0 +1,135 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#ifndef ABRAHAM_UTF8_HPP
+#define ABRAHAM_UTF8_HPP
+
+#include <cstddef>
+#include <string>
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+namespace abraham {
+
+    /**
+     * UTF-8 validation, code point counting and indexing, and transcoding to and from UTF-16 and UTF-32.
+     *
+     * Valid UTF-8 is as RFC 3629 defines it: no overlong forms, no surrogates and nothing above U+10FFFF. Validation
+     * checks sixteen bytes at a time with the lookup table algorithm of Keiser and Lemire when the library is compiled
+     * with SSSE3, and otherwise skips runs of ASCII sixteen bytes at a time with SSE2 and decodes the rest one code
+     * point at a time. Counting, indexing and the ASCII runs of transcoding also work sixteen bytes at a time with
+     * SSE2, with scalar fallbacks elsewhere.
+     *
+     * The counting and indexing functions assume their input is valid, and only look at which bytes start a code
+     * point. The transcoding functions check their input and throw InvalidValueException if it isn't valid.
+     */
+    class Utf8 {
+    public:
+        /**
+         * @param data - The first byte.
+         * @param length - The number of bytes.
+         * @return true if the bytes are valid UTF-8; false otherwise.
+         */
+        static bool isValid(const char* data, size_t length);
+
+        /**
+         * @param data - The first byte.
+         * @param length - The number of bytes.
+         * @return The number of bytes in the longest prefix that is valid UTF-8, which is the index of the first
+         * invalid or incomplete sequence, or length if the bytes are all valid.
+         */
+        static size_t validLength(const char* data, size_t length);
+
+        /**
+         * @param data - The first byte of valid UTF-8.
+         * @param length - The number of bytes.
+         * @return The number of code points in the bytes.
+         */
+        static size_t countCodePoints(const char* data, size_t length);
+
+        /**
+         * @param data - The first byte of valid UTF-8.
+         * @param length - The number of bytes.
+         * @param index - The 0-based index of a code point.
+         * @return The byte offset the code point starts at, length if index is the number of code points, or NO_INDEX
+         * if it's greater.
+         */
+        static size_t offsetOfCodePoint(const char* data, size_t length, size_t index);
+
+        /**
+         * Reverses the order of the code points in valid UTF-8 in place, keeping each one's bytes in order.
+         * @param data - The first byte.
+         * @param length - The number of bytes.
+         */
+        static void reverseCodePoints(char* data, size_t length);
+
+        /**
+         * Transcodes UTF-8 to UTF-16.
+         * @param data - The first byte.
+         * @param length - The number of bytes.
+         * @param output - Where to write the UTF-16. Must hold at least length code units.
+         * @return The number of code units written.
+         */
+        static size_t toUtf16(const char* data, size_t length, char16_t* output);
+
+        /**
+         * Transcodes UTF-8 to UTF-32.
+         * @param data - The first byte.
+         * @param length - The number of bytes.
+         * @param output - Where to write the UTF-32. Must hold at least length code points.
+         * @return The number of code points written.
+         */
+        static size_t toUtf32(const char* data, size_t length, char32_t* output);
+
+        /**
+         * Transcodes UTF-16 to UTF-8.
+         * @param data - The first code unit.
+         * @param length - The number of code units.
+         * @param output - Where to write the UTF-8. Must hold at least 3 * length bytes.
+         * @return The number of bytes written.
+         */
+        static size_t fromUtf16(const char16_t* data, size_t length, char* output);
+
+        /**
+         * Transcodes UTF-32 to UTF-8.
+         * @param data - The first code point.
+         * @param length - The number of code points.
+         * @param output - Where to write the UTF-8. Must hold at least 4 * length bytes.
+         * @return The number of bytes written.
+         */
+        static size_t fromUtf32(const char32_t* data, size_t length, char* output);
+
+        /**
+         * @param string - The UTF-8 to transcode.
+         * @return The string as UTF-16.
+         */
+        static std::u16string toUtf16(const StringView& string);
+
+        /**
+         * @param string - The UTF-8 to transcode.
+         * @return The string as UTF-32.
+         */
+        static std::u32string toUtf32(const StringView& string);
+
+        /**
+         * @param string - The UTF-16 to transcode.
+         * @return The string as UTF-8.
+         */
+        static String fromUtf16(const std::u16string& string);
+
+        /**
+         * @param string - The UTF-32 to transcode.
+         * @return The string as UTF-8.
+         */
+        static String fromUtf32(const std::u32string& string);
+
+        /**
+         * Value representing a non-existent index.
+         */
+        static const size_t NO_INDEX;
+    };
+}
+
+#endif //ABRAHAM_UTF8_HPP
@@ -0,0 +1,229 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "CharSet.hpp"
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace abraham;
+
+
+namespace {
+    const size_t NO_INDEX = static_cast<size_t>(-1);
+
+#if defined(__SSE2__)
+    /**
+     * Sets with at most this many members, or at most this many non members, are matched by comparing sixteen
+     * characters against each member at once. Larger sets are looked up one character at a time.
+     */
+    const size_t MAX_VECTOR_MEMBERS = 8;
+
+    /**
+     * The number of characters checked one at a time before setting up a vector search, so short scans, like
+     * trimming a few spaces, don't pay for it.
+     */
+    const size_t SCALAR_PREFIX = 32;
+
+    /**
+     * Vector state for finding members of a small set.
+     */
+    struct VectorSet {
+        __m128i members[MAX_VECTOR_MEMBERS];
+        size_t count;
+
+        /**
+         * Whether members holds the characters not in the set, because there are fewer of them.
+         */
+        bool complemented;
+
+        /**
+         * @return A bit for each of the sixteen characters that is in the set.
+         */
+        unsigned match(const char* data) const {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            __m128i found = _mm_setzero_si128();
+            for (size_t i = 0; i < this->count; ++i) {
+                found = _mm_or_si128(found, _mm_cmpeq_epi8(block, this->members[i]));
+            }
+
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(found));
+            return this->complemented ? ~mask & 0xFFFFu : mask;
+        }
+    };
+
+    /**
+     * Prepares to match a set sixteen characters at a time.
+     * @return false if the set, and its complement, are too large to match that way.
+     */
+    bool makeVectorSet(const CharSet& set, VectorSet& vector_set) {
+        size_t size = set.size();
+        vector_set.count = 0;
+        vector_set.complemented = size > 256 - MAX_VECTOR_MEMBERS;
+        if (vector_set.complemented) size = 256 - size;
+        if (size > MAX_VECTOR_MEMBERS) return false;
+
+        for (unsigned c = 0; c < 256; ++c) {
+            if (set.contains(static_cast<char>(c)) != vector_set.complemented) {
+                vector_set.members[vector_set.count++] = _mm_set1_epi8(static_cast<char>(c));
+            }
+        }
+
+        return true;
+    }
+#endif
+
+    /**
+     * Searches a set, preparing its vector state the first time a search gets past the scalar prefix and reusing it
+     * for every later search, so an operation that searches many times only prepares once.
+     */
+    class Scanner {
+    protected:
+        const CharSet& _set;
+
+#if defined(__SSE2__)
+        VectorSet _vectorSet;
+
+        /**
+         * Whether the vector state has been prepared, and whether the set can be matched that way.
+         */
+        bool _prepared;
+        bool _vectorized;
+
+        bool vectorized() {
+            if (!this->_prepared) {
+                this->_vectorized = makeVectorSet(this->_set, this->_vectorSet);
+                this->_prepared = true;
+            }
+
+            return this->_vectorized;
+        }
+#endif
+
+    public:
+        explicit Scanner(const CharSet& set) : _set(set) {
+#if defined(__SSE2__)
+            this->_prepared = false;
+            this->_vectorized = false;
+#endif
+        }
+
+        /**
+         * Finds the first character whose membership in the set is MEMBER.
+         */
+        template<bool MEMBER>
+        size_t forward(const char* data, size_t length) {
+            size_t index = 0;
+
+#if defined(__SSE2__)
+            for (; index < length && index < SCALAR_PREFIX; ++index) {
+                if (this->_set.contains(data[index]) == MEMBER) return index;
+            }
+
+            if (length - index >= 16 && this->vectorized()) {
+                for (; index + 16 <= length; index += 16) {
+                    unsigned mask = this->_vectorSet.match(data + index);
+                    if (!MEMBER) mask = ~mask & 0xFFFFu;
+                    if (mask != 0) return index + static_cast<size_t>(__builtin_ctz(mask));
+                }
+            }
+#endif
+
+            for (; index < length; ++index) {
+                if (this->_set.contains(data[index]) == MEMBER) return index;
+            }
+
+            return NO_INDEX;
+        }
+
+        /**
+         * Finds the last character whose membership in the set is MEMBER.
+         */
+        template<bool MEMBER>
+        size_t reverse(const char* data, size_t length) {
+            size_t end = length;
+
+#if defined(__SSE2__)
+            for (; end > 0 && length - end < SCALAR_PREFIX; --end) {
+                if (this->_set.contains(data[end - 1]) == MEMBER) return end - 1;
+            }
+
+            if (end >= 16 && this->vectorized()) {
+                for (; end >= 16; end -= 16) {
+                    unsigned mask = this->_vectorSet.match(data + end - 16);
+                    if (!MEMBER) mask = ~mask & 0xFFFFu;
+                    if (mask != 0) return end - 16 + (31u - static_cast<unsigned>(__builtin_clz(mask)));
+                }
+            }
+#endif
+
+            while (end > 0) {
+                --end;
+                if (this->_set.contains(data[end]) == MEMBER) return end;
+            }
+
+            return NO_INDEX;
+        }
+    };
+}
+
+CharSet::CharSet(const StringView& characters) : _bits{0, 0, 0, 0} {
+    for (const char c : characters) {
+        this->add(c);
+    }
+}
+
+size_t CharSet::size() const {
+    size_t size = 0;
+    for (const uint64_t bits : this->_bits) {
+        size += static_cast<size_t>(__builtin_popcountll(bits));
+    }
+
+    return size;
+}
+
+bool CharSet::isEmpty() const {
+    return (this->_bits[0] | this->_bits[1] | this->_bits[2] | this->_bits[3]) == 0;
+}
+
+size_t CharSet::findFirst(const StringView& string) const {
+    return Scanner(*this).forward<true>(string.data(), string.length());
+}
+
+size_t CharSet::findFirstNot(const StringView& string) const {
+    return Scanner(*this).forward<false>(string.data(), string.length());
+}
+
+size_t CharSet::findLast(const StringView& string) const {
+    return Scanner(*this).reverse<true>(string.data(), string.length());
+}
+
+size_t CharSet::findLastNot(const StringView& string) const {
+    return Scanner(*this).reverse<false>(string.data(), string.length());
+}
+
+size_t CharSet::removeFrom(char* data, size_t length) const {
+    Scanner scanner = Scanner(*this);
+    size_t write_index = scanner.forward<true>(data, length);
+    if (write_index == NO_INDEX) return length;
+
+    // Move each run of kept characters towards the front in place
+    size_t read_index = write_index;
+    while (read_index < length) {
+        size_t kept_from = scanner.forward<false>(data + read_index, length - read_index);
+        if (kept_from == NO_INDEX) break;
+
+        kept_from += read_index;
+        size_t kept_to = scanner.forward<true>(data + kept_from, length - kept_from);
+        kept_to = kept_to == NO_INDEX ? length : kept_to + kept_from;
+
+        std::memmove(data + write_index, data + kept_from, kept_to - kept_from);
+        write_index += kept_to - kept_from;
+        read_index = kept_to;
+    }
+
+    return write_index;
+}
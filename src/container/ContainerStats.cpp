@@ -0,0 +1,113 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "ContainerStats.hpp"
+#include "String.hpp"
+#include <cstdio>
+
+using namespace abraham;
+
+
+namespace {
+    const size_t CONTAINER_TYPE_COUNT = 5;
+}
+
+#ifdef ABRAHAM_CONTAINER_STATS
+
+namespace {
+    details::AtomicContainerCounters COUNTERS[CONTAINER_TYPE_COUNT] = {};
+}
+
+details::AtomicContainerCounters& details::containerCounters(ContainerType type) {
+    return COUNTERS[static_cast<size_t>(type)];
+}
+
+#endif
+
+const ContainerCounters& ContainerStatsSnapshot::countersForType(ContainerType type) const {
+    return this->counters[static_cast<size_t>(type)];
+}
+
+String ContainerStatsSnapshot::toString() const {
+    String result = String();
+    char line[256];
+    for (size_t i = 0; i < CONTAINER_TYPE_COUNT; ++i) {
+        const ContainerCounters& c = this->counters[i];
+        snprintf(line, sizeof(line),
+                 "%-10s constructions=%llu destructions=%llu copies=%llu moves=%llu allocations=%llu "
+                 "regrowths=%llu reserved=%lld used=%lld nodes=%lld\n",
+                 ContainerStats::stringForContainerType(static_cast<ContainerType>(i)).c_string(),
+                 (unsigned long long) c.constructions, (unsigned long long) c.destructions,
+                 (unsigned long long) c.copies, (unsigned long long) c.moves,
+                 (unsigned long long) c.allocations, (unsigned long long) c.regrowths,
+                 (long long) c.bytesReserved, (long long) c.bytesUsed, (long long) c.nodes);
+        result.append(line);
+    }
+
+    return result;
+}
+
+bool ContainerStats::isEnabled() {
+#ifdef ABRAHAM_CONTAINER_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+ContainerStatsSnapshot ContainerStats::snapshot() {
+    ContainerStatsSnapshot snapshot = ContainerStatsSnapshot();
+
+#ifdef ABRAHAM_CONTAINER_STATS
+    for (size_t i = 0; i < CONTAINER_TYPE_COUNT; ++i) {
+        const details::AtomicContainerCounters& live = COUNTERS[i];
+        ContainerCounters& counters = snapshot.counters[i];
+        counters.constructions = live.constructions.load(std::memory_order_relaxed);
+        counters.destructions = live.destructions.load(std::memory_order_relaxed);
+        counters.copies = live.copies.load(std::memory_order_relaxed);
+        counters.moves = live.moves.load(std::memory_order_relaxed);
+        counters.allocations = live.allocations.load(std::memory_order_relaxed);
+        counters.regrowths = live.regrowths.load(std::memory_order_relaxed);
+        counters.bytesReserved = live.bytesReserved.load(std::memory_order_relaxed);
+        counters.bytesUsed = live.bytesUsed.load(std::memory_order_relaxed);
+        counters.nodes = live.nodes.load(std::memory_order_relaxed);
+    }
+#endif
+
+    return snapshot;
+}
+
+void ContainerStats::reset() {
+#ifdef ABRAHAM_CONTAINER_STATS
+    for (details::AtomicContainerCounters& live : COUNTERS) {
+        live.constructions.store(0, std::memory_order_relaxed);
+        live.destructions.store(0, std::memory_order_relaxed);
+        live.copies.store(0, std::memory_order_relaxed);
+        live.moves.store(0, std::memory_order_relaxed);
+        live.allocations.store(0, std::memory_order_relaxed);
+        live.regrowths.store(0, std::memory_order_relaxed);
+    }
+#endif
+}
+
+String ContainerStats::stringForContainerType(ContainerType type) {
+    switch (type) {
+        case ContainerType::ARRAY:
+            return "Array";
+
+        case ContainerType::DICTIONARY:
+            return "Dictionary";
+
+        case ContainerType::QUEUE:
+            return "Queue";
+
+        case ContainerType::STACK:
+            return "Stack";
+
+        case ContainerType::STRING:
+            return "String";
+    }
+
+    return "";
+}
@@ -0,0 +1,319 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "FuzzyMatcher.hpp"
+#include "ScopeGuard.hpp"
+#include <algorithm>
+#include <thread>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    const size_t WORD_BITS = 64;
+
+    /**
+     * Batches are only split between threads when each thread gets at least this many strings.
+     */
+    const size_t MIN_TEXTS_PER_THREAD = 64;
+
+    /**
+     * The part of a column of the edit distance table covering 64 rows of the query. Rather than the distances, it
+     * holds the difference between each row and the row above: the bits of positive are the rows one more, and the
+     * bits of negative the rows one less.
+     */
+    struct Block {
+        uint64_t positive;
+        uint64_t negative;
+
+        /**
+         * The distance at the block's last row.
+         */
+        size_t score;
+    };
+
+    /**
+     * Advances a block by one column.
+     * @param match - The bits of the rows whose query character matches the text character.
+     * @param carry - The difference between the new and previous column in the row above the block: -1, 0 or 1.
+     * @param last_row - The bit of the block's last row.
+     * @return The difference between the new and previous column in the block's last row.
+     */
+    int advance(Block& block, uint64_t match, int carry, uint64_t last_row) {
+        const uint64_t positive = block.positive;
+        const uint64_t negative = block.negative;
+        const uint64_t vertical = match | negative;
+        if (carry < 0) match |= 1;
+
+        const uint64_t horizontal = (((match & positive) + positive) ^ positive) | match;
+        uint64_t horizontal_positive = negative | ~(horizontal | positive);
+        uint64_t horizontal_negative = positive & horizontal;
+
+        const int carry_out = (horizontal_positive & last_row) ? 1 : (horizontal_negative & last_row) ? -1 : 0;
+        horizontal_positive <<= 1;
+        horizontal_negative <<= 1;
+        if (carry < 0) {
+            horizontal_negative |= 1;
+        } else if (carry > 0) {
+            horizontal_positive |= 1;
+        }
+
+        block.positive = horizontal_negative | ~(vertical | horizontal_positive);
+        block.negative = horizontal_positive & vertical;
+        if (carry_out > 0) {
+            ++block.score;
+        } else if (carry_out < 0) {
+            --block.score;
+        }
+
+        return carry_out;
+    }
+
+    /**
+     * Computes the distance for a query of 1 to 64 characters, which fits in a single block.
+     */
+    size_t singleWordDistance(const uint64_t* masks, size_t query_length, const StringView& text,
+                              size_t max_distance) {
+        const char* data = text.data();
+        const size_t length = text.length();
+        const uint64_t last_row = uint64_t(1) << (query_length - 1);
+        const size_t limit = std::min(max_distance, std::max(query_length, length));
+        Block block = Block{~uint64_t(0), 0, query_length};
+
+        for (size_t column = 0; column < length; ++column) {
+            advance(block, masks[static_cast<unsigned char>(data[column])], 1, last_row);
+
+            // The distance changes by at most one a column, so once it is too far above the limit it stays above it
+            if (block.score > limit && block.score - limit > length - column - 1) return max_distance + 1;
+        }
+
+        return block.score <= max_distance ? block.score : max_distance + 1;
+    }
+
+    /**
+     * Computes the distance for a query of more than 64 characters, across several blocks.
+     *
+     * A distance of at most the limit can only pass through cells whose row and column differ by at most the limit,
+     * so only the blocks overlapping that band are advanced. Cells outside the band are estimated from above, which
+     * leaves every cell within the limit exact. The band is also ended early at a block whose distances must all be
+     * over the limit, and if every block's are, the comparison stops.
+     */
+    size_t multiWordDistance(const uint64_t* masks, size_t word_count, size_t query_length, const StringView& text,
+                             size_t max_distance) {
+        thread_local std::vector<Block> blocks;
+        const char* data = text.data();
+        const size_t length = text.length();
+        const size_t limit = std::min(max_distance, std::max(query_length, length));
+
+        auto last_row_of = [query_length](size_t block) {
+            return std::min(WORD_BITS * (block + 1), query_length);
+        };
+        auto last_row_bit = [query_length, word_count](size_t block) {
+            return block + 1 == word_count ? uint64_t(1) << ((query_length - 1) % WORD_BITS) : uint64_t(1) << 63;
+        };
+
+        // The first column is the distance from each prefix of the query to the empty string
+        blocks.resize(word_count);
+        size_t first = 0;
+        size_t last = (std::max(std::min(query_length, limit), size_t(1)) - 1) / WORD_BITS;
+        for (size_t block = 0; block <= last; ++block) {
+            blocks[block] = Block{~uint64_t(0), 0, last_row_of(block)};
+        }
+
+        for (size_t column = 1; column <= length; ++column) {
+            const uint64_t* match = masks + static_cast<unsigned char>(data[column - 1]) * word_count;
+
+            // Blocks entering the band start as if each row were one more than the row above
+            const size_t band_last = (std::min(query_length, column + limit) - 1) / WORD_BITS;
+            while (last < band_last) {
+                ++last;
+                blocks[last] = Block{~uint64_t(0), 0, blocks[last - 1].score + last_row_of(last) -
+                                                      last_row_of(last - 1)};
+            }
+            while (first < last && column > limit && last_row_of(first) < column - limit) {
+                ++first;
+            }
+
+            // Above the band, as above the first row, the distance grows by one a column
+            int carry = 1;
+            for (size_t block = first; block <= last; ++block) {
+                carry = advance(blocks[block], match[block], carry, last_row_bit(block));
+            }
+            if (column == length) break;
+
+            // A block's distances differ by at most one a row, so its last row bounds all of them
+            while (blocks[last].score > limit + (last_row_of(last) - WORD_BITS * last - 1)) {
+                if (last == first) return max_distance + 1;
+                --last;
+            }
+        }
+
+        const size_t score = blocks[word_count - 1].score;
+        return score <= max_distance ? score : max_distance + 1;
+    }
+
+    size_t difference(size_t first, size_t second) {
+        return first > second ? first - second : second - first;
+    }
+
+    /**
+     * @return The number of threads to split a batch of strings between.
+     */
+    size_t partCount(size_t count, size_t thread_count) {
+        if (thread_count == 0) thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+        return std::max(std::min(thread_count, count / MIN_TEXTS_PER_THREAD), size_t(1));
+    }
+
+    /**
+     * Splits [0, count) into consecutive ranges and calls function(begin, end, part) for each, on its own thread.
+     */
+    template<typename Function>
+    void forEachPart(size_t count, size_t parts, Function function) {
+        const size_t part_size = (count + parts - 1) / parts;
+        std::vector<std::thread> threads;
+        scope_exit(for (std::thread& thread : threads) thread.join());
+
+        for (size_t part = 1; part < parts; ++part) {
+            const size_t begin = part * part_size;
+            threads.emplace_back(function, begin, std::min(begin + part_size, count), part);
+        }
+
+        function(0, std::min(part_size, count), 0);
+    }
+
+    template<typename Texts>
+    Array<size_t> distancesOf(const FuzzyMatcher& matcher, const Texts& texts, size_t count, size_t thread_count) {
+        std::vector<size_t> distances = std::vector<size_t>(count);
+        forEachPart(count, partCount(count, thread_count), [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                distances[i] = matcher.distance(texts(i));
+            }
+        });
+
+        return Array<size_t>(distances);
+    }
+
+    template<typename Texts>
+    Array<size_t> findWithinOf(const FuzzyMatcher& matcher, const Texts& texts, size_t count, size_t max_distance,
+                               size_t thread_count) {
+        const size_t parts = partCount(count, thread_count);
+        std::vector<std::vector<size_t>> found = std::vector<std::vector<size_t>>(parts);
+        forEachPart(count, parts, [&](size_t begin, size_t end, size_t part) {
+            for (size_t i = begin; i < end; ++i) {
+                if (matcher.withinDistance(texts(i), max_distance)) found[part].push_back(i);
+            }
+        });
+
+        std::vector<size_t> indexes;
+        for (const std::vector<size_t>& part : found) {
+            indexes.insert(indexes.end(), part.begin(), part.end());
+        }
+
+        return Array<size_t>(indexes);
+    }
+}
+
+const size_t FuzzyMatcher::NO_LIMIT = static_cast<size_t>(-1);
+
+FuzzyMatcher::FuzzyMatcher(const StringView& query) {
+    this->_query = query.std_string();
+    this->_wordCount = std::max((this->_query.length() + WORD_BITS - 1) / WORD_BITS, size_t(1));
+    this->_masks = std::vector<uint64_t>(256 * this->_wordCount, 0);
+
+    for (size_t i = 0; i < this->_query.length(); ++i) {
+        const size_t character = static_cast<unsigned char>(this->_query[i]);
+        this->_masks[character * this->_wordCount + i / WORD_BITS] |= uint64_t(1) << (i % WORD_BITS);
+    }
+}
+
+size_t FuzzyMatcher::distance(const StringView& text) const {
+    return this->distance(text, NO_LIMIT);
+}
+
+size_t FuzzyMatcher::distance(const StringView& text, size_t max_distance) const {
+    const size_t query_length = this->_query.length();
+    const size_t length = text.length();
+
+    // The lengths alone decide the distance when either string is empty, and bound it from below otherwise
+    if (difference(query_length, length) > max_distance) return max_distance + 1;
+    if (query_length == 0) return length;
+    if (length == 0) return query_length;
+
+    if (this->_wordCount == 1) {
+        return singleWordDistance(this->_masks.data(), query_length, text, max_distance);
+    }
+
+    return multiWordDistance(this->_masks.data(), this->_wordCount, query_length, text, max_distance);
+}
+
+bool FuzzyMatcher::withinDistance(const StringView& text, size_t max_distance) const {
+    return this->distance(text, max_distance) <= max_distance;
+}
+
+Array<size_t> FuzzyMatcher::distances(const Array<String>& texts, size_t thread_count) const {
+    const auto strings = texts.begin();
+    return distancesOf(*this, [strings](size_t i) { return strings[i].view(); }, texts.size(), thread_count);
+}
+
+Array<size_t> FuzzyMatcher::distances(const StringTable& texts, size_t thread_count) const {
+    return distancesOf(*this, [&texts](size_t i) { return texts[i]; }, texts.size(), thread_count);
+}
+
+Array<size_t> FuzzyMatcher::findWithin(const Array<String>& texts, size_t max_distance, size_t thread_count) const {
+    const auto strings = texts.begin();
+    return findWithinOf(*this, [strings](size_t i) { return strings[i].view(); }, texts.size(), max_distance,
+                        thread_count);
+}
+
+Array<size_t> FuzzyMatcher::findWithin(const StringTable& texts, size_t max_distance, size_t thread_count) const {
+    return findWithinOf(*this, [&texts](size_t i) { return texts[i]; }, texts.size(), max_distance, thread_count);
+}
+
+StringView FuzzyMatcher::query() const {
+    return StringView(this->_query);
+}
+
+size_t FuzzyMatcher::distanceBetween(const StringView& first, const StringView& second, size_t max_distance) {
+    const char* first_data = first.data();
+    const char* second_data = second.data();
+    size_t first_length = first.length();
+    size_t second_length = second.length();
+
+    // A shared prefix or suffix never needs an edit, so it is removed before the table is computed
+    size_t prefix = 0;
+    while (prefix < first_length && prefix < second_length && first_data[prefix] == second_data[prefix]) {
+        ++prefix;
+    }
+    first_data += prefix;
+    second_data += prefix;
+    first_length -= prefix;
+    second_length -= prefix;
+
+    while (first_length > 0 && second_length > 0 && first_data[first_length - 1] == second_data[second_length - 1]) {
+        --first_length;
+        --second_length;
+    }
+
+    if (first_length > second_length) {
+        std::swap(first_data, second_data);
+        std::swap(first_length, second_length);
+    }
+
+    if (second_length - first_length > max_distance) return max_distance + 1;
+    if (first_length == 0) return second_length;
+
+    // A query that fits in one word has its masks built on the stack, rather than by a FuzzyMatcher
+    if (first_length <= WORD_BITS) {
+        uint64_t masks[256] = {};
+        for (size_t i = 0; i < first_length; ++i) {
+            masks[static_cast<unsigned char>(first_data[i])] |= uint64_t(1) << i;
+        }
+
+        return singleWordDistance(masks, first_length, StringView(second_data, second_length), max_distance);
+    }
+
+    return FuzzyMatcher(StringView(first_data, first_length)).distance(StringView(second_data, second_length),
+                                                                       max_distance);
+}
@@ -0,0 +1,28 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "InlineString.hpp"
+#include <cerrno>
+#include <cstdlib>
+
+using namespace abraham;
+
+
+namespace {
+    [[noreturn]] void throwConversionError(const char* cstring, const char* type_name) {
+        throw InvalidValueException(std::string("Value could not be converted to ") + type_name + ": " + cstring);
+    }
+}
+
+long double details::inlineStringToLongDouble(const char* cstring) {
+    char* end = nullptr;
+    errno = 0;
+    long double value = std::strtold(cstring, &end);
+
+    if (end == cstring || errno == ERANGE) {
+        throwConversionError(cstring, "long double");
+    }
+
+    return value;
+}
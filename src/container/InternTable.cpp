@@ -0,0 +1,168 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "InternTable.hpp"
+#include "Hash.hpp"
+#include <cstring>
+
+using namespace abraham;
+
+
+namespace {
+    const size_t MIN_CAPACITY = 64;
+
+    /**
+     * @return The smallest power of two table size that holds a number of strings at most half full.
+     */
+    size_t capacityFor(size_t count) {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity / 2 < count) {
+            capacity *= 2;
+        }
+
+        return capacity;
+    }
+}
+
+
+// Atom
+
+Atom::Atom() {
+    this->_entry = nullptr;
+}
+
+Atom::Atom(const details::AtomEntry* entry) {
+    this->_entry = entry;
+}
+
+bool Atom::operator==(const Atom& atom) const {
+    return this->_entry == atom._entry;
+}
+
+bool Atom::operator!=(const Atom& atom) const {
+    return this->_entry != atom._entry;
+}
+
+bool Atom::operator<(const Atom& atom) const {
+    return std::less<const details::AtomEntry*>()(this->_entry, atom._entry);
+}
+
+size_t Atom::hash() const {
+    return static_cast<size_t>(this->_entry == nullptr ? Hasher::hash("", 0) : this->_entry->hash);
+}
+
+size_t Atom::length() const {
+    return this->_entry == nullptr ? 0 : this->_entry->length;
+}
+
+bool Atom::isEmpty() const {
+    return this->_entry == nullptr;
+}
+
+const char* Atom::c_string() const {
+    return this->_entry == nullptr ? "" : this->_entry->data;
+}
+
+StringView Atom::view() const {
+    return StringView(this->c_string(), this->length());
+}
+
+String Atom::toString() const {
+    return String(std::string(this->c_string(), this->length()));
+}
+
+
+// InternTable
+
+InternTable::Table::Table(size_t capacity) {
+    this->mask = capacity - 1;
+    this->slots.reset(new std::atomic<const details::AtomEntry*>[capacity]);
+    for (size_t i = 0; i < capacity; ++i) {
+        this->slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+InternTable::InternTable(size_t capacity) {
+    this->_tables.emplace_back(new Table(capacityFor(capacity)));
+    this->_table.store(this->_tables.back().get(), std::memory_order_release);
+    this->_size.store(0, std::memory_order_relaxed);
+}
+
+const details::AtomEntry* InternTable::find(const Table& table, const char* data, size_t length, uint64_t hash) {
+    for (size_t index = static_cast<size_t>(hash) & table.mask;; index = (index + 1) & table.mask) {
+        const details::AtomEntry* entry = table.slots[index].load(std::memory_order_acquire);
+        if (entry == nullptr) return nullptr;
+        if (entry->hash == hash && entry->length == length && std::memcmp(entry->data, data, length) == 0) {
+            return entry;
+        }
+    }
+}
+
+void InternTable::insert(Table& table, const details::AtomEntry* entry) {
+    size_t index = static_cast<size_t>(entry->hash) & table.mask;
+    while (table.slots[index].load(std::memory_order_relaxed) != nullptr) {
+        index = (index + 1) & table.mask;
+    }
+
+    table.slots[index].store(entry, std::memory_order_release);
+}
+
+void InternTable::grow() {
+    const Table& old_table = *this->_table.load(std::memory_order_relaxed);
+    std::unique_ptr<Table> table = std::unique_ptr<Table>(new Table((old_table.mask + 1) * 2));
+
+    for (size_t i = 0; i <= old_table.mask; ++i) {
+        const details::AtomEntry* entry = old_table.slots[i].load(std::memory_order_relaxed);
+        if (entry != nullptr) insert(*table, entry);
+    }
+
+    // The old table stays alive for readers that loaded it before the new one is published
+    this->_table.store(table.get(), std::memory_order_release);
+    this->_tables.push_back(std::move(table));
+}
+
+Atom InternTable::intern(const StringView& string) {
+    if (string.isEmpty()) return Atom();
+
+    const uint64_t hash = Hasher::hash(string.data(), string.length());
+    const details::AtomEntry* entry = find(*this->_table.load(std::memory_order_acquire), string.data(),
+                                           string.length(), hash);
+    if (entry != nullptr) return Atom(entry);
+
+    std::lock_guard<std::mutex> lock(this->_mutex);
+
+    // Another thread may have added it since the lookup above
+    entry = find(*this->_table.load(std::memory_order_relaxed), string.data(), string.length(), hash);
+    if (entry != nullptr) return Atom(entry);
+
+    const size_t size = this->_size.load(std::memory_order_relaxed) + 1;
+    if (size > (this->_table.load(std::memory_order_relaxed)->mask + 1) / 2) this->grow();
+
+    details::AtomEntry* created = this->_arena.create<details::AtomEntry>();
+    char* data = static_cast<char*>(this->_arena.allocate(string.length() + 1, 1));
+    std::memcpy(data, string.data(), string.length());
+    data[string.length()] = '\0';
+    created->hash = hash;
+    created->length = string.length();
+    created->data = data;
+
+    insert(*this->_table.load(std::memory_order_relaxed), created);
+    this->_size.store(size, std::memory_order_relaxed);
+    return Atom(created);
+}
+
+Atom InternTable::find(const StringView& string) const {
+    if (string.isEmpty()) return Atom();
+
+    const uint64_t hash = Hasher::hash(string.data(), string.length());
+    return Atom(find(*this->_table.load(std::memory_order_acquire), string.data(), string.length(), hash));
+}
+
+bool InternTable::contains(const StringView& string) const {
+    return string.isEmpty() || !this->find(string).isEmpty();
+}
+
+size_t InternTable::size() const {
+    return this->_size.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,204 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Replacer.hpp"
+#include "Exception.hpp"
+#include <algorithm>
+#include <cstring>
+
+using namespace abraham;
+
+
+namespace {
+    const uint32_t MISSING_STATE = UINT32_MAX;
+
+    /**
+     * The fewest indexes searched per backward pass. The pass also reads the longest pattern's length past the block,
+     * so blocks are kept several patterns long to bound the overlap.
+     */
+    const size_t MIN_BLOCK_LENGTH = 1024;
+}
+
+Replacer::Replacer(std::initializer_list<std::pair<String, String>> replacements) {
+    for (const std::pair<String, String>& replacement : replacements) {
+        this->_patterns.push_back(replacement.first.std_string());
+        this->_replacements.push_back(replacement.second.std_string());
+    }
+
+    this->compile();
+}
+
+Replacer::Replacer(const Dictionary<String, String>& replacements) {
+    for (const std::pair<const String, String>& replacement : replacements) {
+        this->_patterns.push_back(replacement.first.std_string());
+        this->_replacements.push_back(replacement.second.std_string());
+    }
+
+    this->compile();
+}
+
+void Replacer::compile() {
+    // Give every byte used by a pattern its own column, and every other byte column 0
+    std::memset(this->_byteClasses, 0, sizeof(this->_byteClasses));
+    this->_classCount = 1;
+    for (const std::string& pattern : this->_patterns) {
+        if (pattern.empty()) throw InvalidArgumentException("Replacer patterns can't be empty");
+        for (const char c : pattern) {
+            uint16_t& byte_class = this->_byteClasses[static_cast<unsigned char>(c)];
+            if (byte_class == 0) byte_class = static_cast<uint16_t>(this->_classCount++);
+        }
+    }
+
+    const size_t classes = this->_classCount;
+    this->_transitions.assign(classes, MISSING_STATE);
+    this->_matches.assign(1, -1);
+    this->_maxLength = 0;
+
+    // Build the trie of reversed patterns, dropping repeated patterns in favour of the last replacement given
+    std::vector<std::string> patterns;
+    std::vector<std::string> replacements;
+    for (size_t i = 0; i < this->_patterns.size(); ++i) {
+        const std::string& pattern = this->_patterns[i];
+        this->_maxLength = std::max(this->_maxLength, pattern.length());
+
+        uint32_t state = 0;
+        for (auto it = pattern.rbegin(); it != pattern.rend(); ++it) {
+            const size_t byte_class = this->_byteClasses[static_cast<unsigned char>(*it)];
+            uint32_t& next = this->_transitions[state * classes + byte_class];
+            if (next == MISSING_STATE) {
+                next = static_cast<uint32_t>(this->_matches.size());
+                this->_transitions.resize(this->_transitions.size() + classes, MISSING_STATE);
+                this->_matches.push_back(-1);
+            }
+            state = this->_transitions[state * classes + byte_class];
+        }
+
+        if (this->_matches[state] >= 0) {
+            replacements[this->_matches[state]] = this->_replacements[i];
+        } else {
+            this->_matches[state] = static_cast<int32_t>(patterns.size());
+            patterns.push_back(this->_patterns[i]);
+            replacements.push_back(this->_replacements[i]);
+        }
+    }
+
+    this->_patterns.swap(patterns);
+    this->_replacements.swap(replacements);
+
+    // Breadth first, point each missing transition where its failure link would lead, so matching needs no links
+    std::vector<uint32_t> failures = std::vector<uint32_t>(this->_matches.size(), 0);
+    std::vector<uint32_t> queue;
+    queue.reserve(this->_matches.size());
+
+    for (size_t c = 0; c < classes; ++c) {
+        uint32_t& next = this->_transitions[c];
+        if (next == MISSING_STATE) {
+            next = 0;
+        } else {
+            queue.push_back(next);
+        }
+    }
+
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const uint32_t state = queue[head];
+        const uint32_t failure = failures[state];
+
+        for (size_t c = 0; c < classes; ++c) {
+            uint32_t& next = this->_transitions[state * classes + c];
+            const uint32_t failure_next = this->_transitions[failure * classes + c];
+            if (next == MISSING_STATE) {
+                next = failure_next;
+            } else {
+                failures[next] = failure_next;
+                if (this->_matches[next] < 0) this->_matches[next] = this->_matches[failure_next];
+                queue.push_back(next);
+            }
+        }
+    }
+}
+
+template<typename F>
+void Replacer::forEachMatch(const StringView& source, F on_match) const {
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(source.data());
+    const size_t length = source.length();
+    const size_t classes = this->_classCount;
+    if (this->_patterns.empty()) return;
+
+    // The longest pattern starting at each index of the current block, or -1
+    thread_local std::vector<int32_t> longest;
+    const size_t block_length = std::max(MIN_BLOCK_LENGTH, 4 * this->_maxLength);
+    longest.resize(std::min(block_length, length));
+
+    size_t next = 0;
+    size_t block = 0;
+    while (block < length) {
+        const size_t block_end = std::min(length, block + block_length);
+
+        // Reading backwards, the automaton's state at an index is the longest reversed pattern prefix ending there,
+        // so it is exact once every pattern that could start at the index has been read
+        const size_t scan_end = std::min(length, block_end + this->_maxLength - 1);
+        uint32_t state = 0;
+        for (size_t index = scan_end; index > block;) {
+            --index;
+            state = this->_transitions[state * classes + this->_byteClasses[data[index]]];
+            if (index < block_end) longest[index - block] = this->_matches[state];
+        }
+
+        // Take the leftmost match, skip everything it overlaps, and repeat
+        for (size_t index = std::max(block, next); index < block_end; ++index) {
+            const int32_t pattern = longest[index - block];
+            if (pattern < 0) continue;
+
+            next = index + this->_patterns[pattern].length();
+            if (!on_match(index, next, pattern)) return;
+            index = next - 1;
+        }
+
+        block = std::max(block_end, next);
+    }
+}
+
+String Replacer::replace(const StringView& source) const {
+    std::string output;
+    this->replace(source, output);
+    return String(output);
+}
+
+void Replacer::replace(const StringView& source, std::string& output) const {
+    output.reserve(output.length() + source.length());
+    size_t copied = 0;
+
+    this->forEachMatch(source, [&](size_t from_index, size_t to_index, int32_t pattern) {
+        output.append(source.data() + copied, from_index - copied);
+        output.append(this->_replacements[pattern]);
+        copied = to_index;
+        return true;
+    });
+
+    output.append(source.data() + copied, source.length() - copied);
+}
+
+size_t Replacer::count(const StringView& source) const {
+    size_t matches = 0;
+    this->forEachMatch(source, [&](size_t, size_t, int32_t) {
+        ++matches;
+        return true;
+    });
+
+    return matches;
+}
+
+bool Replacer::containsMatch(const StringView& source) const {
+    bool found = false;
+    this->forEachMatch(source, [&](size_t, size_t, int32_t) {
+        found = true;
+        return false;
+    });
+
+    return found;
+}
+
+size_t Replacer::size() const {
+    return this->_patterns.size();
+}
@@ -0,0 +1,234 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "SharedString.hpp"
+#include "Exception.hpp"
+#include "Hash.hpp"
+#include <cstring>
+
+using namespace abraham;
+
+
+const size_t SharedString::INLINE_CAPACITY;
+
+bool SharedString::isInline() const {
+    return this->_length <= INLINE_CAPACITY;
+}
+
+void SharedString::assign(const char* data, size_t length) {
+    this->_length = length;
+    if (this->isInline()) {
+        std::memcpy(this->_inline, data, length);
+        this->_inline[length] = '\0';
+    } else {
+        Buffer* buffer = new Buffer();
+        buffer->references.store(1, std::memory_order_relaxed);
+        buffer->text.assign(data, length);
+        this->_shared.buffer = buffer;
+        this->_shared.data = buffer->text.data();
+    }
+}
+
+void SharedString::assign(std::string&& string) {
+    if (string.length() <= INLINE_CAPACITY) {
+        this->assign(string.data(), string.length());
+        return;
+    }
+
+    Buffer* buffer = new Buffer();
+    buffer->references.store(1, std::memory_order_relaxed);
+    buffer->text = std::move(string);
+    this->_length = buffer->text.length();
+    this->_shared.buffer = buffer;
+    this->_shared.data = buffer->text.data();
+}
+
+void SharedString::share(const SharedString& string) {
+    this->_length = string._length;
+    if (string.isInline()) {
+        std::memcpy(this->_inline, string._inline, sizeof(this->_inline));
+    } else {
+        string._shared.buffer->references.fetch_add(1, std::memory_order_relaxed);
+        this->_shared = string._shared;
+    }
+}
+
+void SharedString::release() {
+    if (this->isInline()) return;
+
+    // The last owner must see every other owner's use of the buffer before deleting it
+    if (this->_shared.buffer->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete this->_shared.buffer;
+    }
+}
+
+SharedString::SharedString() {
+    this->assign("", 0);
+}
+
+SharedString::SharedString(const char* cstring) {
+    this->assign(cstring, std::strlen(cstring));
+}
+
+SharedString::SharedString(const char* data, size_t length) {
+    this->assign(data, length);
+}
+
+SharedString::SharedString(const StringView& string) {
+    this->assign(string.data(), string.length());
+}
+
+SharedString::SharedString(const std::string& string) {
+    this->assign(string.data(), string.length());
+}
+
+SharedString::SharedString(std::string&& string) {
+    this->assign(std::move(string));
+}
+
+SharedString::SharedString(const String& string) {
+    this->assign(string._data.data(), string._data.length());
+}
+
+SharedString::SharedString(String&& string) {
+    this->assign(std::move(string._data));
+    string._data.clear();
+    string.updateStats();
+}
+
+SharedString::SharedString(const SharedString& string) {
+    this->share(string);
+}
+
+SharedString::SharedString(SharedString&& string) noexcept {
+    this->_length = string._length;
+    if (string.isInline()) {
+        std::memcpy(this->_inline, string._inline, sizeof(this->_inline));
+    } else {
+        this->_shared = string._shared;
+        string._length = 0;
+        string._inline[0] = '\0';
+    }
+}
+
+SharedString::~SharedString() {
+    this->release();
+}
+
+SharedString& SharedString::operator=(const SharedString& string) {
+    if (this == &string) return *this;
+    this->release();
+    this->share(string);
+    return *this;
+}
+
+SharedString& SharedString::operator=(SharedString&& string) noexcept {
+    if (this == &string) return *this;
+    this->release();
+    this->_length = string._length;
+    if (string.isInline()) {
+        std::memcpy(this->_inline, string._inline, sizeof(this->_inline));
+    } else {
+        this->_shared = string._shared;
+        string._length = 0;
+        string._inline[0] = '\0';
+    }
+
+    return *this;
+}
+
+bool SharedString::operator==(const SharedString& string) const {
+    return this->view() == string.view();
+}
+
+bool SharedString::operator!=(const SharedString& string) const {
+    return !(this->view() == string.view());
+}
+
+bool SharedString::operator<(const SharedString& string) const {
+    return this->view() < string.view();
+}
+
+char SharedString::operator[](size_t index) const {
+    if (index < this->_length) {
+        return this->data()[index];
+    } else {
+        throw OutOfBoundsException(index);
+    }
+}
+
+size_t SharedString::length() const {
+    return this->_length;
+}
+
+bool SharedString::isEmpty() const {
+    return this->_length == 0;
+}
+
+const char* SharedString::data() const {
+    return this->isInline() ? this->_inline : this->_shared.data;
+}
+
+StringView SharedString::view() const {
+    return StringView(this->data(), this->_length);
+}
+
+bool SharedString::isShared() const {
+    return !this->isInline();
+}
+
+SharedString SharedString::substring(size_t from_index, size_t to_index) const {
+    if (from_index > to_index) throw InvalidArgumentException("from_index must be less than to_index");
+    if (to_index > this->_length) throw OutOfBoundsException(to_index);
+
+    const size_t length = to_index - from_index;
+    if (length <= INLINE_CAPACITY) return SharedString(this->data() + from_index, length);
+
+    SharedString substring = SharedString();
+    substring.share(*this);
+    substring._length = length;
+    substring._shared.data += from_index;
+    return substring;
+}
+
+SharedString SharedString::substringFromIndex(size_t index) const {
+    return this->substring(index, this->_length);
+}
+
+SharedString SharedString::substringToIndex(size_t index) const {
+    return this->substring(0, index);
+}
+
+size_t SharedString::hash() const {
+    return static_cast<size_t>(Hasher::hash(this->data(), this->_length));
+}
+
+String SharedString::toString() const & {
+    return String(std::string(this->data(), this->_length));
+}
+
+String SharedString::toString() && {
+    if (this->isInline()) return String(std::string(this->_inline, this->_length));
+
+    // The only owner can take the buffer; otherwise the characters are copied and the reference dropped. Either
+    // way this SharedString is left empty
+    Buffer* buffer = this->_shared.buffer;
+    const bool is_whole = this->_shared.data == buffer->text.data() && this->_length == buffer->text.length();
+    String string;
+    if (is_whole && buffer->references.load(std::memory_order_acquire) == 1) {
+        string = String(std::move(buffer->text));
+        delete buffer;
+    } else {
+        string = String(std::string(this->_shared.data, this->_length));
+        this->release();
+    }
+
+    this->_length = 0;
+    this->_inline[0] = '\0';
+    return string;
+}
+
+std::string SharedString::std_string() const {
+    return std::string(this->data(), this->_length);
+}
@@ -0,0 +1,415 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "StaticDictionary.hpp"
+#include "Exception.hpp"
+#include <algorithm>
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace abraham;
+using namespace abraham::details;
+
+
+// Helpers
+namespace {
+    const char MAGIC[8] = {'A', 'B', 'R', 'S', 'D', 'I', 'C', 'T'};
+    const uint32_t VERSION = 1;
+
+    // Average number of keys per bucket. Larger buckets make the file smaller and the build slower.
+    const size_t KEYS_PER_BUCKET = 4;
+
+    const uint64_t P0 = 0xa0761d6478bd642fULL;
+    const uint64_t P1 = 0xe7037ed1a0b428dbULL;
+    const uint64_t P2 = 0x8ebc6af09c88c6e3ULL;
+    const uint64_t P3 = 0x589965cc75374cc3ULL;
+
+    void multiply(uint64_t a, uint64_t b, uint64_t& low, uint64_t& high) {
+#if defined(__SIZEOF_INT128__)
+        __uint128_t product = static_cast<__uint128_t>(a) * b;
+        low = static_cast<uint64_t>(product);
+        high = static_cast<uint64_t>(product >> 64);
+#else
+        uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+        uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+        uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+        uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+        high = hi_hi + (hi_lo >> 32) + (cross >> 32);
+        low = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+#endif
+    }
+
+    uint64_t mix(uint64_t a, uint64_t b) {
+        uint64_t low, high;
+        multiply(a, b, low, high);
+        return low ^ high;
+    }
+
+    uint64_t read64(const char* p) {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint64_t read32(const char* p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    // The key hash is part of the file format, so it is kept private to this file and never changes for a version
+    uint64_t hashKey(const char* key, size_t length, uint64_t seed) {
+        const char* p = key;
+        size_t remaining = length;
+        uint64_t h = seed ^ mix(length ^ P0, P1);
+
+        while (remaining > 16) {
+            h = mix(read64(p) ^ P1, read64(p + 8) ^ h);
+            p += 16;
+            remaining -= 16;
+        }
+
+        uint64_t a = 0, b = 0;
+        if (remaining >= 8) {
+            a = read64(p);
+            b = read64(p + remaining - 8);
+        } else if (remaining >= 4) {
+            a = read32(p);
+            b = read32(p + remaining - 4);
+        } else if (remaining > 0) {
+            const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+            a = (uint64_t(u[0]) << 16) | (uint64_t(u[remaining >> 1]) << 8) | u[remaining - 1];
+        }
+
+        return mix(P2 ^ length, mix(a ^ P2, b ^ h));
+    }
+
+    // Maps a 64 bit hash onto [0, n) without a division
+    uint64_t reduce(uint64_t hash, uint64_t n) {
+        uint64_t low, high;
+        multiply(hash, n, low, high);
+        return high;
+    }
+
+    uint64_t bucketFor(uint64_t hash, uint64_t bucket_count) {
+        return reduce(hash, bucket_count);
+    }
+
+    uint64_t slotFor(uint64_t hash, uint32_t displacement, uint64_t count) {
+        return reduce(mix(hash ^ P3, (uint64_t(displacement) << 1) | 1) ^ hash, count);
+    }
+
+    uint64_t alignUp(uint64_t offset, uint64_t alignment) {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+}
+
+
+// StaticDictionaryMapping
+StaticDictionaryMapping::StaticDictionaryMapping(const std::string& path) {
+    this->_data = nullptr;
+    this->_size = 0;
+    this->_isMapped = false;
+
+#if defined(_WIN32)
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) throw IOException("Could not open file: " + path);
+
+    this->_size = static_cast<size_t>(file.tellg());
+    char* buffer = new char[this->_size > 0 ? this->_size : 1];
+    file.seekg(0);
+    if (!file.read(buffer, this->_size)) {
+        delete[] buffer;
+        throw IOException("Could not read file: " + path);
+    }
+    this->_data = buffer;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw IOException("Could not open file: " + path);
+
+    struct stat info = {};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw IOException("Could not stat file: " + path);
+    }
+
+    this->_size = static_cast<size_t>(info.st_size);
+    if (this->_size > 0) {
+        void* address = ::mmap(nullptr, this->_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            throw IOException("Could not map file: " + path);
+        }
+
+        // Lookups land on unrelated pages, so read-ahead would only waste page cache
+        ::madvise(address, this->_size, MADV_RANDOM);
+        this->_data = static_cast<const char*>(address);
+        this->_isMapped = true;
+    }
+    ::close(fd);
+#endif
+}
+
+StaticDictionaryMapping::~StaticDictionaryMapping() {
+#if defined(_WIN32)
+    delete[] this->_data;
+#else
+    if (this->_isMapped) {
+        ::munmap(const_cast<char*>(this->_data), this->_size);
+    }
+#endif
+}
+
+const char* StaticDictionaryMapping::data() const {
+    return this->_data;
+}
+
+size_t StaticDictionaryMapping::size() const {
+    return this->_size;
+}
+
+
+// Build
+void details::buildStaticDictionaryHash(const std::vector<std::string>& keys, uint64_t& seed,
+                                        std::vector<uint32_t>& displacements, std::vector<uint64_t>& slots) {
+    const uint64_t count = keys.size();
+    const uint64_t bucket_count = std::max<uint64_t>(1, (count + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET);
+
+    std::vector<uint64_t> hashes = std::vector<uint64_t>(count);
+    std::vector<std::vector<uint64_t>> buckets;
+    std::vector<uint64_t> order;
+    std::vector<bool> taken;
+    std::vector<uint64_t> candidate;
+
+    for (seed = 0x9E3779B97F4A7C15ULL;; seed = mix(seed, P0)) {
+        buckets.assign(bucket_count, std::vector<uint64_t>());
+        for (uint64_t i = 0; i < count; ++i) {
+            hashes[i] = hashKey(keys[i].data(), keys[i].size(), seed);
+            buckets[bucketFor(hashes[i], bucket_count)].push_back(i);
+        }
+
+        // Place the largest buckets first, while the table still has plenty of free slots
+        order.resize(bucket_count);
+        for (uint64_t i = 0; i < bucket_count; ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&buckets](uint64_t a, uint64_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        displacements.assign(bucket_count, 0);
+        slots.assign(count, 0);
+        taken.assign(count, false);
+        bool placed_all = true;
+
+        for (uint64_t bucket : order) {
+            const std::vector<uint64_t>& members = buckets[bucket];
+            if (members.empty()) break;
+
+            bool placed = false;
+            for (uint64_t displacement = 0; displacement <= 0xFFFFFFFFULL && !placed; ++displacement) {
+                candidate.clear();
+                bool collides = false;
+
+                for (uint64_t key : members) {
+                    uint64_t slot = slotFor(hashes[key], uint32_t(displacement), count);
+                    if (taken[slot] || std::find(candidate.begin(), candidate.end(), slot) != candidate.end()) {
+                        collides = true;
+                        break;
+                    }
+                    candidate.push_back(slot);
+                }
+
+                if (collides) continue;
+
+                for (size_t i = 0; i < members.size(); ++i) {
+                    taken[candidate[i]] = true;
+                    slots[members[i]] = candidate[i];
+                }
+                displacements[bucket] = uint32_t(displacement);
+                placed = true;
+            }
+
+            if (!placed) {
+                placed_all = false;
+                break;
+            }
+        }
+
+        if (placed_all) return;
+    }
+}
+
+void details::writeStaticDictionary(const std::string& path, const std::vector<std::string>& keys,
+                                    uint32_t valueSize, size_t valueStride, const std::vector<char>& values,
+                                    const std::string& blob) {
+    uint64_t seed = 0;
+    std::vector<uint32_t> displacements;
+    std::vector<uint64_t> slots;
+    buildStaticDictionaryHash(keys, seed, displacements, slots);
+
+    const uint64_t count = keys.size();
+
+    // Blob section: the value blob first, so value references stay valid, then every key
+    std::string full_blob = blob;
+    std::vector<StaticDictionarySlot> slot_table = std::vector<StaticDictionarySlot>(count);
+    std::vector<char> value_table = std::vector<char>(valueStride * count);
+
+    for (uint64_t i = 0; i < count; ++i) {
+        const std::string& key = keys[i];
+        StaticDictionarySlot& slot = slot_table[slots[i]];
+        slot.keyOffset = full_blob.size();
+        slot.keyLength = static_cast<uint32_t>(key.size());
+        slot.fingerprint = static_cast<uint32_t>(hashKey(key.data(), key.size(), seed));
+        full_blob.append(key);
+
+        if (valueStride > 0) {
+            std::memcpy(value_table.data() + slots[i] * valueStride, values.data() + i * valueStride, valueStride);
+        }
+    }
+
+    StaticDictionaryHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.valueSize = valueSize;
+    header.count = count;
+    header.bucketCount = displacements.size();
+    header.seed = seed;
+    header.displacementOffset = alignUp(sizeof(StaticDictionaryHeader), 16);
+    header.slotOffset = alignUp(header.displacementOffset + displacements.size() * sizeof(uint32_t), 16);
+    header.valueOffset = alignUp(header.slotOffset + slot_table.size() * sizeof(StaticDictionarySlot), 16);
+    header.blobOffset = alignUp(header.valueOffset + value_table.size(), 16);
+    header.fileSize = header.blobOffset + full_blob.size();
+
+    std::vector<char> file = std::vector<char>(header.fileSize, 0);
+    std::memcpy(file.data(), &header, sizeof(header));
+    std::memcpy(file.data() + header.displacementOffset, displacements.data(),
+                displacements.size() * sizeof(uint32_t));
+    if (!slot_table.empty()) {
+        std::memcpy(file.data() + header.slotOffset, slot_table.data(),
+                    slot_table.size() * sizeof(StaticDictionarySlot));
+    }
+    if (!value_table.empty()) {
+        std::memcpy(file.data() + header.valueOffset, value_table.data(), value_table.size());
+    }
+    std::memcpy(file.data() + header.blobOffset, full_blob.data(), full_blob.size());
+
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    if (!output) throw IOException("Could not open file for writing: " + path);
+    output.write(file.data(), file.size());
+    if (!output) throw IOException("Could not write file: " + path);
+}
+
+
+// StaticDictionaryBase
+const size_t StaticDictionaryBase::NO_INDEX = -1;
+
+StaticDictionaryBase::StaticDictionaryBase() {
+    this->_mapping = nullptr;
+    this->_header = nullptr;
+    this->_displacements = nullptr;
+    this->_slots = nullptr;
+    this->_values = nullptr;
+    this->_blob = nullptr;
+    this->_blobSize = 0;
+    this->_valueStride = 0;
+}
+
+StaticDictionaryBase::StaticDictionaryBase(const String& path, uint32_t value_size, size_t value_stride) {
+    this->_mapping = std::make_shared<StaticDictionaryMapping>(path.std_string());
+    this->_valueStride = value_stride;
+
+    const char* data = this->_mapping->data();
+    const size_t size = this->_mapping->size();
+
+    if (size < sizeof(StaticDictionaryHeader) || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw InvalidValueException("Not a StaticDictionary file: " + path.std_string());
+    }
+
+    this->_header = reinterpret_cast<const StaticDictionaryHeader*>(data);
+    const StaticDictionaryHeader& header = *this->_header;
+
+    if (header.version != VERSION) {
+        throw InvalidValueException("Unsupported StaticDictionary version: " + std::to_string(header.version));
+    }
+    if (header.valueSize != value_size) {
+        throw InvalidValueException("StaticDictionary value size does not match: " + path.std_string());
+    }
+    // Each section must fit between the one before it and the one after it. The counts are checked against the
+    // file size first, so the section sizes can't overflow.
+    if (header.fileSize != size || header.bucketCount == 0 || header.bucketCount > size / sizeof(uint32_t) ||
+        header.count > size / sizeof(StaticDictionarySlot) ||
+        header.displacementOffset < sizeof(StaticDictionaryHeader) ||
+        header.displacementOffset % alignof(uint32_t) != 0 || header.slotOffset % alignof(StaticDictionarySlot) != 0 ||
+        header.displacementOffset > size || header.slotOffset > size || header.valueOffset > size ||
+        header.blobOffset > size ||
+        header.displacementOffset + header.bucketCount * sizeof(uint32_t) > header.slotOffset ||
+        header.slotOffset + header.count * sizeof(StaticDictionarySlot) > header.valueOffset ||
+        header.valueOffset + header.count * value_stride > header.blobOffset) {
+        throw InvalidValueException("Corrupt StaticDictionary file: " + path.std_string());
+    }
+
+    this->_displacements = reinterpret_cast<const uint32_t*>(data + header.displacementOffset);
+    this->_slots = reinterpret_cast<const StaticDictionarySlot*>(data + header.slotOffset);
+    this->_values = data + header.valueOffset;
+    this->_blob = data + header.blobOffset;
+
+    this->_blobSize = header.fileSize - header.blobOffset;
+}
+
+size_t StaticDictionaryBase::slotForKey(const char* key, size_t length) const {
+    if (this->_header == nullptr || this->_header->count == 0) return NO_INDEX;
+
+    const StaticDictionaryHeader& header = *this->_header;
+    uint64_t hash = hashKey(key, length, header.seed);
+    uint32_t displacement = this->_displacements[bucketFor(hash, header.bucketCount)];
+    uint64_t slot = slotFor(hash, displacement, header.count);
+
+    const StaticDictionarySlot& entry = this->_slots[slot];
+    if (entry.fingerprint != static_cast<uint32_t>(hash) || entry.keyLength != length) return NO_INDEX;
+    if (std::memcmp(this->keyAt(static_cast<size_t>(slot)), key, length) != 0) return NO_INDEX;
+
+    return static_cast<size_t>(slot);
+}
+
+const char* StaticDictionaryBase::keyAt(size_t slot) const {
+    const StaticDictionarySlot& entry = this->_slots[slot];
+    if (entry.keyOffset > this->_blobSize || entry.keyLength > this->_blobSize - entry.keyOffset) {
+        throw InvalidValueException("Corrupt StaticDictionary file: key out of bounds");
+    }
+
+    return this->_blob + entry.keyOffset;
+}
+
+void StaticDictionaryBase::validateKeys() const {
+    for (size_t i = 0; i < this->size(); ++i) {
+        this->keyAt(i);
+    }
+}
+
+size_t StaticDictionaryBase::size() const {
+    return this->_header == nullptr ? 0 : static_cast<size_t>(this->_header->count);
+}
+
+bool StaticDictionaryBase::isEmpty() const {
+    return this->size() == 0;
+}
+
+bool StaticDictionaryBase::containsKey(const String& key) const {
+    return this->slotForKey(key.c_string(), key.length()) != NO_INDEX;
+}
+
+Array<String> StaticDictionaryBase::getKeys() const {
+    Array<String> keys = Array<String>(this->size());
+    for (size_t i = 0; i < this->size(); ++i) {
+        const char* key = this->keyAt(i);
+        keys[i] = String(std::string(key, this->_slots[i].keyLength));
+    }
+
+    return keys;
+}
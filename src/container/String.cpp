@@ -3,33 +3,76 @@
 //
 
 #include "String.hpp"
+#include "Ascii.hpp"
+#include "CharSet.hpp"
 #include "Exception.hpp"
+#include "FuzzyMatcher.hpp"
+#include "Hash.hpp"
+#include "NumberFormatter.hpp"
+#include "NumberParser.hpp"
+#include "Replacer.hpp"
+#include "StringBuilder.hpp"
+#include "StringSearcher.hpp"
+#include "Tokenizer.hpp"
+#include "Utf8.hpp"
+#include <algorithm>
+#include <cstring>
 
 using namespace abraham;
 
 
 String::String() {
     this->_data = "";
+    this->updateStats();
 }
 
 String::String(char character) {
     this->_data = character;
+    this->updateStats();
 }
 
 String::String(const char* cstring) {
     this->_data = cstring;
+    this->updateStats();
 }
 
 String::String(const std::string& string) {
     this->_data = string;
+    this->updateStats();
 }
 
-String::String(const String& string) {
+String::String(std::string&& string) {
+    this->_data = std::move(string);
+    this->updateStats();
+}
+
+String::String(const String& string) : details::ContainerTracker<ContainerType::STRING>() {
     this->_data = string._data;
+    this->recordCopy();
+    this->updateStats();
 }
 
 String::String(String&& string) noexcept {
-    this->_data = string._data;
+    this->_data = std::move(string._data);
+    this->recordMove();
+    this->updateStats();
+    string.updateStats();
+}
+
+String String::fromInt(long long value) {
+    return String().append(value);
+}
+
+String String::fromUnsigned(unsigned long long value) {
+    return String().append(value);
+}
+
+String String::fromDouble(double value) {
+    return String().append(value);
+}
+
+String String::fromFloat(float value) {
+    return String().append(value);
 }
 
 char& String::operator[](size_t index) {
@@ -43,21 +86,30 @@ char& String::operator[](size_t index) {
 String& String::operator=(const String& string) {
     if (this == &string) return *this;
     this->_data = string._data;
+    this->recordCopy();
+    this->updateStats();
     return *this;
 }
 
 String& String::operator=(String&& string) noexcept {
     if (this == &string) return *this;
-    this->_data = string._data;
+    this->_data = std::move(string._data);
+    this->recordMove();
+    this->updateStats();
+    string.updateStats();
     return *this;
 }
 
 const String String::operator+(const String& string) const {
-    return String(this->_data + string._data);
+    std::string result;
+    result.reserve(this->_data.length() + string._data.length());
+    result.append(this->_data).append(string._data);
+    return String(std::move(result));
 }
 
 String& String::operator+=(const String& string) {
     this->_data += string._data;
+    this->updateStats();
     return *this;
 }
 
@@ -95,6 +147,10 @@ size_t String::length() const {
     return this->_data.length();
 }
 
+size_t String::hash() const {
+    return static_cast<size_t>(Hasher::hash(this->_data.data(), this->_data.length()));
+}
+
 char String::characterAtIndex(size_t index) const {
     if (index < this->_data.length()) {
         return this->_data[index];
@@ -115,49 +171,100 @@ String& String::setCharacterAtIndex(const char c, size_t index) {
 
 String& String::setValue(const String& string) {
     this->_data = string._data;
+    this->updateStats();
     return *this;
 }
 
 String& String::toLowerCase() {
-    for (char& c : this->_data) {
-        c = (char) tolower(c);
-    }
+    Ascii::toLowerCase(&this->_data[0], this->_data.length());
     return *this;
 }
 
 String& String::toUpperCase() {
-    for (char& c : this->_data) {
-        c = (char) toupper(c);
-    }
+    Ascii::toUpperCase(&this->_data[0], this->_data.length());
     return *this;
 }
 
 String& String::toCapitalCase() {
-    this->_data[0] = (char) toupper(this->_data[0]);
+    this->_data[0] = Ascii::toUpperCase(this->_data[0]);
     for (size_t i = 1; i < this->_data.length(); ++i) {
         if (this->_data[i - 1] == ' ') {
-            this->_data[i] = (char) toupper(this->_data[i]);
+            this->_data[i] = Ascii::toUpperCase(this->_data[i]);
         }
     }
     return *this;
 }
 
 String& String::swapCase() {
-    for (char& c : this->_data) {
-        if (islower(c)) {
-            c = (char) toupper(c);
-        } else if (isupper(c)) {
-            c = (char) tolower(c);
-        }
-    }
+    Ascii::swapCase(&this->_data[0], this->_data.length());
     return *this;
 }
 
 String& String::append(const String& string) {
     this->_data.append(string._data);
+    this->updateStats();
+    return *this;
+}
+
+String& String::append(char character) {
+    this->_data.push_back(character);
+    this->updateStats();
     return *this;
 }
 
+template<typename T>
+String& String::appendNumber(T value) {
+    const size_t length = this->_data.length();
+    this->_data.resize(length + NumberFormatter::MAX_LENGTH);
+    this->_data.resize(length + NumberFormatter::format(value, &this->_data[length]));
+    this->updateStats();
+    return *this;
+}
+
+String& String::append(int value) {
+    return this->appendNumber(value);
+}
+
+String& String::append(long value) {
+    return this->appendNumber(value);
+}
+
+String& String::append(long long value) {
+    return this->appendNumber(value);
+}
+
+String& String::append(unsigned value) {
+    return this->appendNumber(value);
+}
+
+String& String::append(unsigned long value) {
+    return this->appendNumber(value);
+}
+
+String& String::append(unsigned long long value) {
+    return this->appendNumber(value);
+}
+
+String& String::append(float value) {
+    return this->appendNumber(value);
+}
+
+String& String::append(double value) {
+    return this->appendNumber(value);
+}
+
+String String::codePointSubstring(size_t from_index, size_t to_index) const {
+    return this->view().codePointSubstring(from_index, to_index).string();
+}
+
+bool String::isValidUtf8() const {
+    return Utf8::isValid(this->_data.data(), this->_data.length());
+}
+
+size_t String::codePointLength() const {
+    return Utf8::countCodePoints(this->_data.data(), this->_data.length());
+}
+
 String String::substring(size_t from_index, size_t to_index) const {
     if (from_index > to_index) throw InvalidArgumentException("from_index must be less than to_index");
     if (to_index < this->_data.length()) {
@@ -185,33 +292,36 @@ String String::substringToIndex(size_t index) const {
 
 std::vector<String> String::split(const String& delimiter) const {
     std::vector<String> output;
-    size_t delim_length = delimiter._data.length();
+    Tokenizer tokenizer = Tokenizer(this->view(), delimiter.view());
+    StringView token;
 
-    if (delim_length == 0) {
-        for (const char c : this->_data) {
-            output.emplace_back(c);
-        }
-
-        return output;
+    while (tokenizer.next(token)) {
+        output.emplace_back(std::string(token.data(), token.length()));
     }
 
-    size_t element_begin = 0;
-    size_t element_end = 0;
+    return output;
+}
 
-    while ((element_end = this->_data.find(delimiter.std_string(), element_end)) != NO_INDEX) {
-        output.emplace_back(this->_data.substr(element_begin, element_end - element_begin));
-        element_end += delim_length;
-        element_begin = element_end;
-    }
+StringView String::view() const {
+    return StringView(this->_data);
+}
 
-    output.emplace_back(this->_data.substr(element_begin, this->_data.length() - element_begin));
+StringView String::substringView(size_t from_index, size_t to_index) const {
+    return this->view().substring(from_index, to_index);
+}
 
-    return output;
+std::vector<StringView> String::splitViews(const StringView& delimiter) const {
+    return this->view().split(delimiter);
+}
+
+StringView String::trimmedView(const StringView& characters) const {
+    return this->view().trim(characters);
 }
 
 String& String::insert(const String& string, size_t index) {
     if (index < this->_data.length()) {
         this->_data.insert(index, string.std_string());
+        this->updateStats();
         return *this;
     } else {
         throw OutOfBoundsException(index);
@@ -219,58 +329,67 @@ String& String::insert(const String& string, size_t index) {
 }
 
 String& String::trim(const String& characters) {
-    this->trimLeading(characters);
+    return this->trim(CharSet(characters.view()));
+}
+
+String& String::trim(const CharSet& characters) {
     this->trimTrailing(characters);
+    this->trimLeading(characters);
     return *this;
 }
 
 String& String::trimLeading(const String& characters) {
-    this->_data.erase(0, this->_data.find_first_not_of(characters.c_string()));
+    return this->trimLeading(CharSet(characters.view()));
+}
+
+String& String::trimLeading(const CharSet& characters) {
+    this->_data.erase(0, characters.findFirstNot(this->view()));
+    this->updateStats();
     return *this;
 }
 
 String& String::trimTrailing(const String& characters) {
-    size_t last_not_of = this->_data.find_last_not_of(characters.c_string()) + 1;
+    return this->trimTrailing(CharSet(characters.view()));
+}
+
+String& String::trimTrailing(const CharSet& characters) {
+    size_t last_not_of = characters.findLastNot(this->view()) + 1;
     this->_data.erase(last_not_of, this->_data.length() - last_not_of);
+    this->updateStats();
     return *this;
 }
 
 String& String::reverse() {
-    std::string buffer = "";
-
-    for (size_t i = this->_data.length(); i > 0; --i) {
-        buffer += this->_data[i - 1];
-    }
-    this->_data = buffer;
+    std::reverse(this->_data.begin(), this->_data.end());
+    return *this;
+}
 
+String& String::reverseCodePoints() {
+    Utf8::reverseCodePoints(&this->_data[0], this->_data.length());
     return *this;
 }
 
 String& String::pad(const String& string, size_t count) {
-    this->padLeft(string, count);
-    this->padRight(string, count);
-    return *this;
+    return this->padString(string, count, count);
 }
 
 String& String::padLeft(const String& string, size_t count) {
-    std::string pad_string = "";
-
-    for (size_t i = 0; i < count; ++i) {
-        pad_string += string._data;
-    }
-    this->_data.insert(0, pad_string);
-
-    return *this;
+    return this->padString(string, count, 0);
 }
 
 String& String::padRight(const String& string, size_t count) {
-    std::string pad_string = "";
+    return this->padString(string, 0, count);
+}
 
-    for (size_t i = 0; i < count; ++i) {
-        pad_string += string._data;
-    }
-    this->_data.insert(this->_data.length(), pad_string);
+String& String::padString(const String& string, size_t left_count, size_t right_count) {
+    // Build the padded result in one buffer, instead of growing a pad string and then inserting it
+    StringBuilder builder = StringBuilder(this->_data.length() + string._data.length() * (left_count + right_count));
+    builder.appendRepeated(string.view(), left_count);
+    builder.append(this->_data);
+    builder.appendRepeated(string.view(), right_count);
+    this->_data = std::move(builder.build()._data);
 
+    this->updateStats();
     return *this;
 }
 
@@ -282,6 +401,7 @@ String& String::replace(const String& old_string, const String& new_string) {
         this->_data.replace(target_index, target_length, new_string._data);
     }
 
+    this->updateStats();
     return *this;
 }
 
@@ -293,17 +413,42 @@ String& String::replaceLast(const String& old_string, const String& new_string)
         this->_data.replace(target_index, target_length, new_string._data);
     }
 
+    this->updateStats();
     return *this;
 }
 
 String& String::replaceAll(const String& old_string, const String& new_string) {
     size_t target_length = old_string._data.length();
-    size_t target_index = 0;
+    size_t target_index = target_length == 0 ? NO_INDEX : this->_data.find(old_string._data);
 
-    while ((target_index = this->_data.find(old_string._data, target_index)) != NO_INDEX) {
-        this->_data.replace(target_index, target_length, new_string._data);
+    if (target_index == NO_INDEX) {
+        return *this;
     }
 
+    // Copy the unmatched runs and replacements into a new buffer in one pass, rather than shifting the tail on
+    // every match
+    std::string buffer;
+    buffer.reserve(this->_data.length());
+    size_t copied_index = 0;
+
+    do {
+        buffer.append(this->_data, copied_index, target_index - copied_index);
+        buffer.append(new_string._data);
+        copied_index = target_index + target_length;
+    } while ((target_index = this->_data.find(old_string._data, copied_index)) != NO_INDEX);
+
+    buffer.append(this->_data, copied_index, NO_INDEX);
+    this->_data.swap(buffer);
+
+    this->updateStats();
+    return *this;
+}
+
+String& String::replaceAll(const Replacer& replacer) {
+    std::string buffer;
+    replacer.replace(this->view(), buffer);
+    this->_data.swap(buffer);
+    this->updateStats();
     return *this;
 }
 
@@ -315,6 +460,7 @@ String& String::remove(const String& string) {
         this->_data.erase(target_index, target_length);
     }
 
+    this->updateStats();
     return *this;
 }
 
@@ -326,17 +472,32 @@ String& String::removeLast(const String& string) {
         this->_data.erase(target_index, target_length);
     }
 
+    this->updateStats();
     return *this;
 }
 
 String& String::removeAll(const String& string) {
     size_t target_length = string._data.length();
-    size_t target_index = 0;
+    size_t target_index = target_length == 0 ? NO_INDEX : this->_data.find(string._data);
 
-    while ((target_index = this->_data.find(string._data, target_index)) != NO_INDEX) {
-        this->_data.erase(target_index, target_length);
+    if (target_index == NO_INDEX) {
+        return *this;
+    }
+
+    // Compact the unmatched runs towards the front in place
+    size_t write_index = target_index;
+    size_t read_index = target_index + target_length;
+
+    while ((target_index = this->_data.find(string._data, read_index)) != NO_INDEX) {
+        std::memmove(&this->_data[write_index], &this->_data[read_index], target_index - read_index);
+        write_index += target_index - read_index;
+        read_index = target_index + target_length;
     }
 
+    std::memmove(&this->_data[write_index], &this->_data[read_index], this->_data.length() - read_index);
+    this->_data.resize(write_index + this->_data.length() - read_index);
+
+    this->updateStats();
     return *this;
 }
 
@@ -344,6 +505,7 @@ String& String::removeRange(size_t from_index, size_t to_index) {
     if (from_index > to_index) throw InvalidArgumentException("from_index must be less than to_index");
     if (from_index < this->_data.length() && to_index < this->_data.length()) {
         this->_data.erase(from_index, to_index - from_index);
+        this->updateStats();
         return *this;
     } else {
         throw OutOfBoundsException(to_index);
@@ -351,20 +513,18 @@ String& String::removeRange(size_t from_index, size_t to_index) {
 }
 
 String& String::removeCharacters(const String& characters) {
-    std::string buffer = "";
+    return this->removeCharacters(CharSet(characters.view()));
+}
 
-    for (size_t i = 0; i < this->_data.length(); ++i) {
-        if (!characters.contains(this->_data[i])) {
-            buffer += this->_data[i];
-        }
-    }
-    this->_data = buffer;
+String& String::removeCharacters(const CharSet& characters) {
+    this->_data.resize(characters.removeFrom(&this->_data[0], this->_data.length()));
 
+    this->updateStats();
     return *this;
 }
 
 bool String::contains(const String& string) const {
-    size_t index = this->_data.find(string.std_string());
+    size_t index = this->_data.find(string._data);
     return index != NO_INDEX;
 }
 
@@ -384,6 +544,26 @@ size_t String::indexOfLast(const String& string, size_t max_index) const {
     return this->_data.rfind(string._data, max_index);
 }
 
+bool String::contains(const StringSearcher& searcher) const {
+    return searcher.occursIn(this->view());
+}
+
+size_t String::indexOf(const StringSearcher& searcher) const {
+    return searcher.find(this->view());
+}
+
+size_t String::indexOf(const StringSearcher& searcher, size_t min_index) const {
+    return searcher.find(this->view(), min_index);
+}
+
+size_t String::indexOfLast(const StringSearcher& searcher) const {
+    return searcher.findLast(this->view());
+}
+
+size_t String::indexOfLast(const StringSearcher& searcher, size_t max_index) const {
+    return searcher.findLast(this->view(), max_index);
+}
+
 bool String::isEqualTo(const String& string, bool case_sensitive) const {
     if (case_sensitive) {
         return this->_data == string._data;
@@ -395,94 +575,56 @@ bool String::isEqualTo(const String& string, bool case_sensitive) const {
         return false;
     }
 
-    for (size_t i = 0; i < length; ++i) {
-        if (tolower(this->_data[i]) != tolower(string._data[i])) {
-            return false;
-        }
-    }
-
-    return true;
+    return Ascii::isEqualIgnoringCase(this->_data.data(), string._data.data(), length);
 }
 
 int String::compare(const String& string, bool case_sensitive) const {
     if (case_sensitive) {
         return this->_data.compare(string._data);
     } else {
-        // This could be broken out and optimized a little
-        return this->copy().toLowerCase()._data.compare(string.copy().toLowerCase()._data);
+        return Ascii::compareIgnoringCase(this->_data.data(), this->_data.length(),
+                                          string._data.data(), string._data.length());
     }
 }
 
+size_t String::editDistance(const String& string) const {
+    return FuzzyMatcher::distanceBetween(this->view(), string.view());
+}
+
+bool String::withinDistance(const String& string, size_t max_distance) const {
+    return FuzzyMatcher::distanceBetween(this->view(), string.view(), max_distance) <= max_distance;
+}
+
 int String::intValue() const {
-    try {
-        return std::stoi(this->_data);
-    }
-    catch (std::exception& e) {
-        throw InvalidValueException("Value could not be converted to int: " + this->_data);
-    }
+    return NumberParser::valueOf<int>(this->view(), "int");
 }
 
 long String::longValue() const {
-    try {
-        return std::stol(this->_data);
-    }
-    catch (std::exception& e) {
-        throw InvalidValueException("Value could not be converted to long: " + this->_data);
-    }
+    return NumberParser::valueOf<long>(this->view(), "long");
 }
 
 long long String::longLongValue() const {
-    try {
-        return std::stoll(this->_data);
-    }
-    catch (std::exception& e) {
-        throw InvalidValueException("Value could not be converted to long long: " + this->_data);
-    }
+    return NumberParser::valueOf<long long>(this->view(), "long long");
 }
 
 unsigned String::unsignedValue() const {
-    try {
-        return std::stoul(this->_data);
-    }
-    catch (std::exception& e) {
-        throw InvalidValueException("Value could not be converted to unsigned: " + this->_data);
-    }
+    return NumberParser::valueOf<unsigned>(this->view(), "unsigned");
 }
 
 unsigned long String::unsignedLongValue() const {
-    try {
-        return std::stoul(this->_data);
-    }
-    catch (std::exception& e) {
-        throw InvalidValueException("Value could not be converted to unsigned long: " + this->_data);
-    }
+    return NumberParser::valueOf<unsigned long>(this->view(), "unsigned long");
 }
 
 unsigned long long String::unsignedLongLongValue() const {
-    try {
-        return std::stoull(this->_data);
-    }
-    catch (std::exception& e) {
-        throw InvalidValueException("Value could not be converted to unsigned long long: " + this->_data);
-    }
+    return NumberParser::valueOf<unsigned long long>(this->view(), "unsigned long long");
 }
 
 float String::floatValue() const {
-    try {
-        return std::stof(this->_data);
-    }
-    catch (std::exception& e) {
-        throw InvalidValueException("Value could not be converted to float: " + this->_data);
-    }
+    return NumberParser::valueOf<float>(this->view(), "float");
 }
 
 double String::doubleValue() const {
-    try {
-        return std::stod(this->_data);
-    }
-    catch (std::exception& e) {
-        throw InvalidValueException("Value could not be converted to double: " + this->_data);
-    }
+    return NumberParser::valueOf<double>(this->view(), "double");
 }
 
 long double String::longDoubleValue() const {
@@ -495,18 +637,43 @@ long double String::longDoubleValue() const {
 }
 
 bool String::boolValue() const {
-    String value = this->copy().toLowerCase();
+    return NumberParser::valueOf<bool>(this->view(), "bool");
+}
+
+bool String::tryIntValue(int& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
+}
+
+bool String::tryLongValue(long& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
+}
+
+bool String::tryLongLongValue(long long& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
+}
+
+bool String::tryUnsignedValue(unsigned& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
+}
+
+bool String::tryUnsignedLongValue(unsigned long& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
+}
+
+bool String::tryUnsignedLongLongValue(unsigned long long& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
+}
+
+bool String::tryFloatValue(float& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
+}
 
-    if (value == "false") return false;
-    if (value == "true") return true;
-    if (value == "no") return false;
-    if (value == "yes") return true;
-    if (value == "n") return false;
-    if (value == "y") return true;
-    if (value == "0") return false;
-    if (value == "1") return true;
+bool String::tryDoubleValue(double& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
+}
 
-    throw InvalidValueException("Value could not be converted to bool: " + this->_data);
+bool String::tryBoolValue(bool& value) const {
+    return NumberParser::parseValue(this->view(), value) == ParseError::NONE;
 }
 
 String String::copy() const {
@@ -556,3 +723,15 @@ const std::string String::ASCII_ALPHANUMERIC = ASCII_UPPERCASE + ASCII_LOWERCASE
 const std::string String::ASCII_HEX_DIGITS = "0123456789abcdefABCDEF";
 const std::string String::ASCII_OCT_DIGITS = "01234567";
 const std::string String::ASCII_PRINTABLE = ASCII_LETTERS + ASCII_DIGITS + ASCII_PUNCTUATION + ASCII_WHITESPACE;
+
+void String::updateStats() {
+#ifdef ABRAHAM_CONTAINER_STATS
+    // Short strings are stored inline by std::string and don't allocate
+    static const size_t inline_capacity = std::string().capacity();
+    if (this->_data.capacity() > inline_capacity) {
+        this->recordStorage(this->_data.capacity() + 1, this->_data.length() + 1);
+    } else {
+        this->recordStorage(0, 0);
+    }
+#endif
+}
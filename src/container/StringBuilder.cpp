@@ -0,0 +1,264 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "StringBuilder.hpp"
+#include "NumberFormatter.hpp"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+using namespace abraham;
+
+
+StringBuilder::StringBuilder(size_t capacity) {
+    this->_arena = nullptr;
+    this->_arenaData = nullptr;
+    this->_arenaLength = 0;
+    this->_arenaCapacity = 0;
+    this->_buffer.reserve(capacity);
+}
+
+StringBuilder::StringBuilder(Arena& arena, size_t capacity) {
+    this->_arena = &arena;
+    this->_arenaData = nullptr;
+    this->_arenaLength = 0;
+    this->_arenaCapacity = 0;
+    this->reserve(capacity);
+}
+
+StringBuilder::StringBuilder(const StringBuilder& builder) : _buffer(builder._buffer) {
+    this->_arena = builder._arena;
+    this->_arenaData = nullptr;
+    this->_arenaLength = 0;
+    this->_arenaCapacity = 0;
+    if (builder._arenaLength > 0) this->append(builder._arenaData, builder._arenaLength);
+}
+
+StringBuilder::StringBuilder(StringBuilder&& builder) noexcept : _buffer(std::move(builder._buffer)) {
+    this->_arena = builder._arena;
+    this->_arenaData = builder._arenaData;
+    this->_arenaLength = builder._arenaLength;
+    this->_arenaCapacity = builder._arenaCapacity;
+    builder._buffer.clear();
+    builder._arenaData = nullptr;
+    builder._arenaLength = 0;
+    builder._arenaCapacity = 0;
+}
+
+StringBuilder& StringBuilder::operator=(const StringBuilder& builder) {
+    if (this == &builder) return *this;
+
+    // The old Arena allocation is left to the Arena, which frees everything at once
+    this->_buffer = builder._buffer;
+    this->_arena = builder._arena;
+    this->_arenaData = nullptr;
+    this->_arenaLength = 0;
+    this->_arenaCapacity = 0;
+    if (builder._arenaLength > 0) this->append(builder._arenaData, builder._arenaLength);
+    return *this;
+}
+
+StringBuilder& StringBuilder::operator=(StringBuilder&& builder) noexcept {
+    if (this == &builder) return *this;
+
+    this->_buffer = std::move(builder._buffer);
+    this->_arena = builder._arena;
+    this->_arenaData = builder._arenaData;
+    this->_arenaLength = builder._arenaLength;
+    this->_arenaCapacity = builder._arenaCapacity;
+    builder._buffer.clear();
+    builder._arenaData = nullptr;
+    builder._arenaLength = 0;
+    builder._arenaCapacity = 0;
+    return *this;
+}
+
+void StringBuilder::grow(size_t capacity) {
+    const size_t current = this->capacity();
+    if (capacity <= current) return;
+
+    capacity = std::max(capacity, current * 2);
+    if (this->_arena == nullptr) {
+        this->_buffer.reserve(capacity);
+    } else {
+        this->_arenaData = static_cast<char*>(this->_arena->reallocate(this->_arenaData, this->_arenaCapacity,
+                                                                       capacity, 1));
+        this->_arenaCapacity = capacity;
+    }
+}
+
+char* StringBuilder::extend(size_t count) {
+    const size_t length = this->length();
+    this->grow(length + count);
+
+    if (this->_arena == nullptr) {
+        this->_buffer.resize(length + count);
+        return &this->_buffer[length];
+    }
+
+    this->_arenaLength = length + count;
+    return this->_arenaData + length;
+}
+
+void StringBuilder::truncate(size_t length) {
+    if (this->_arena == nullptr) {
+        this->_buffer.resize(length);
+    } else {
+        this->_arenaLength = length;
+    }
+}
+
+template<typename T>
+StringBuilder& StringBuilder::appendNumber(T value) {
+    const size_t length = this->length();
+    this->truncate(length + NumberFormatter::format(value, this->extend(NumberFormatter::MAX_LENGTH)));
+    return *this;
+}
+
+StringBuilder& StringBuilder::reserve(size_t capacity) {
+    if (capacity <= this->capacity()) return *this;
+
+    if (this->_arena == nullptr) {
+        this->_buffer.reserve(capacity);
+    } else {
+        this->_arenaData = static_cast<char*>(this->_arena->reallocate(this->_arenaData, this->_arenaCapacity,
+                                                                       capacity, 1));
+        this->_arenaCapacity = capacity;
+    }
+
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(const String& string) {
+    return this->append(string.c_string(), string.length());
+}
+
+StringBuilder& StringBuilder::append(const StringView& string) {
+    return this->append(string.data(), string.length());
+}
+
+StringBuilder& StringBuilder::append(const std::string& string) {
+    return this->append(string.data(), string.length());
+}
+
+StringBuilder& StringBuilder::append(const char* cstring) {
+    return this->append(cstring, std::strlen(cstring));
+}
+
+StringBuilder& StringBuilder::append(const char* data, size_t length) {
+    // std::string already grows geometrically, and copes with data from its own buffer
+    if (this->_arena == nullptr) {
+        this->_buffer.append(data, length);
+    } else if (length > 0) {
+        std::memcpy(this->extend(length), data, length);
+    }
+
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(char c) {
+    if (this->_arena == nullptr) {
+        this->_buffer.push_back(c);
+    } else {
+        *this->extend(1) = c;
+    }
+
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(int value) {
+    return this->appendNumber(value);
+}
+
+StringBuilder& StringBuilder::append(long value) {
+    return this->appendNumber(value);
+}
+
+StringBuilder& StringBuilder::append(long long value) {
+    return this->appendNumber(value);
+}
+
+StringBuilder& StringBuilder::append(unsigned value) {
+    return this->appendNumber(value);
+}
+
+StringBuilder& StringBuilder::append(unsigned long value) {
+    return this->appendNumber(value);
+}
+
+StringBuilder& StringBuilder::append(unsigned long long value) {
+    return this->appendNumber(value);
+}
+
+StringBuilder& StringBuilder::append(float value) {
+    return this->appendNumber(value);
+}
+
+StringBuilder& StringBuilder::append(double value) {
+    return this->appendNumber(value);
+}
+
+StringBuilder& StringBuilder::appendRepeated(const StringView& string, size_t count) {
+    if (string.isEmpty() || count == 0) return *this;
+
+    // The source may be in this buffer, so copy from the new copies rather than the original after growing
+    const size_t length = string.length();
+    const size_t offset = this->length();
+    const bool is_own = string.data() >= this->view().data() && string.data() < this->view().data() + offset;
+    const size_t source_offset = is_own ? static_cast<size_t>(string.data() - this->view().data()) : 0;
+
+    char* destination = this->extend(length * count);
+    const char* source = is_own ? destination - offset + source_offset : string.data();
+    std::memmove(destination, source, length);
+
+    // Double the repeated run each pass, so n copies take log n copies
+    size_t written = length;
+    const size_t total = length * count;
+    while (written < total) {
+        const size_t chunk = std::min(written, total - written);
+        std::memcpy(destination + written, destination, chunk);
+        written += chunk;
+    }
+
+    return *this;
+}
+
+StringBuilder& StringBuilder::appendRepeated(char c, size_t count) {
+    if (count > 0) std::memset(this->extend(count), c, count);
+    return *this;
+}
+
+size_t StringBuilder::length() const {
+    return this->_arena == nullptr ? this->_buffer.length() : this->_arenaLength;
+}
+
+size_t StringBuilder::capacity() const {
+    return this->_arena == nullptr ? this->_buffer.capacity() : this->_arenaCapacity;
+}
+
+bool StringBuilder::isEmpty() const {
+    return this->length() == 0;
+}
+
+StringBuilder& StringBuilder::clear() {
+    this->truncate(0);
+    return *this;
+}
+
+StringView StringBuilder::view() const {
+    if (this->_arena == nullptr) return StringView(this->_buffer);
+    return StringView(this->_arenaData == nullptr ? "" : this->_arenaData, this->_arenaLength);
+}
+
+String StringBuilder::build() {
+    if (this->_arena == nullptr) {
+        String result = String(std::move(this->_buffer));
+        this->_buffer.clear();
+        return result;
+    }
+
+    String result = String(std::string(this->_arenaData == nullptr ? "" : this->_arenaData, this->_arenaLength));
+    this->_arenaLength = 0;
+    return result;
+}
@@ -0,0 +1,255 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "StringSearcher.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace abraham;
+
+
+namespace {
+    const size_t NO_INDEX = static_cast<size_t>(-1);
+
+    /**
+     * Checks candidate positions from first to last, in ascending order. The needle's first and last characters are
+     * compared against sixteen positions at a time, and only positions where both match are compared in full.
+     */
+    size_t filterForward(const char* data, const std::string& needle, size_t first, size_t last) {
+        const size_t length = needle.length();
+        const char* middle = needle.data() + 1;
+        const size_t middle_length = length - 2;
+        size_t position = first;
+
+#if defined(__SSE2__)
+        const __m128i first_character = _mm_set1_epi8(needle[0]);
+        const __m128i last_character = _mm_set1_epi8(needle[length - 1]);
+        for (; position + 15 <= last; position += 16) {
+            __m128i starts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            __m128i ends = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + length - 1));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(starts, first_character), _mm_cmpeq_epi8(ends, last_character))));
+
+            while (mask != 0) {
+                size_t candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+                if (std::memcmp(data + candidate + 1, middle, middle_length) == 0) return candidate;
+                mask &= mask - 1;
+            }
+        }
+#endif
+
+        for (; position <= last; ++position) {
+            if (data[position] == needle[0] && data[position + length - 1] == needle[length - 1] &&
+                std::memcmp(data + position + 1, middle, middle_length) == 0) {
+                return position;
+            }
+        }
+
+        return NO_INDEX;
+    }
+
+    /**
+     * Checks candidate positions from last to first, in descending order, filtering as filterForward does.
+     */
+    size_t filterReverse(const char* data, const std::string& needle, size_t first, size_t last) {
+        const size_t length = needle.length();
+        const char* middle = needle.data() + 1;
+        const size_t middle_length = length - 2;
+        size_t end = last + 1;
+
+#if defined(__SSE2__)
+        const __m128i first_character = _mm_set1_epi8(needle[0]);
+        const __m128i last_character = _mm_set1_epi8(needle[length - 1]);
+        for (; end >= first + 16; end -= 16) {
+            const size_t position = end - 16;
+            __m128i starts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            __m128i ends = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + length - 1));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(starts, first_character), _mm_cmpeq_epi8(ends, last_character))));
+
+            while (mask != 0) {
+                unsigned bit = 31u - static_cast<unsigned>(__builtin_clz(mask));
+                size_t candidate = position + bit;
+                if (std::memcmp(data + candidate + 1, middle, middle_length) == 0) return candidate;
+                mask &= ~(1u << bit);
+            }
+        }
+#endif
+
+        while (end > first) {
+            --end;
+            if (data[end] == needle[0] && data[end + length - 1] == needle[length - 1] &&
+                std::memcmp(data + end + 1, middle, middle_length) == 0) {
+                return end;
+            }
+        }
+
+        return NO_INDEX;
+    }
+}
+
+const size_t StringSearcher::HORSPOOL_MIN_LENGTH = 32;
+
+StringSearcher::StringSearcher(const StringView& needle) {
+    this->_needle = needle.std_string();
+    const size_t length = this->_needle.length();
+
+    if (length == 0) {
+        this->_strategy = StringSearcherStrategy::EMPTY;
+    } else if (length == 1) {
+        this->_strategy = StringSearcherStrategy::CHARACTER;
+    } else if (length < HORSPOOL_MIN_LENGTH) {
+        this->_strategy = StringSearcherStrategy::FIRST_LAST_FILTER;
+    } else {
+        this->_strategy = StringSearcherStrategy::HORSPOOL;
+    }
+
+    std::fill(this->_skip, this->_skip + 256, length);
+    std::fill(this->_reverseSkip, this->_reverseSkip + 256, length);
+    for (size_t i = 0; i + 1 < length; ++i) {
+        this->_skip[static_cast<unsigned char>(this->_needle[i])] = length - 1 - i;
+    }
+    for (size_t i = length; i > 1; --i) {
+        this->_reverseSkip[static_cast<unsigned char>(this->_needle[i - 1])] = i - 1;
+    }
+}
+
+size_t StringSearcher::find(const StringView& haystack, size_t min_index) const {
+    const size_t length = this->_needle.length();
+    if (min_index > haystack.length() || length > haystack.length() - min_index) return NO_INDEX;
+
+    const char* data = haystack.data();
+    const size_t last = haystack.length() - length;
+
+    switch (this->_strategy) {
+        case StringSearcherStrategy::EMPTY:
+            return min_index;
+        case StringSearcherStrategy::CHARACTER: {
+            const void* found = std::memchr(data + min_index, this->_needle[0], haystack.length() - min_index);
+            return found == nullptr ? NO_INDEX : static_cast<size_t>(static_cast<const char*>(found) - data);
+        }
+        case StringSearcherStrategy::FIRST_LAST_FILTER:
+            return filterForward(data, this->_needle, min_index, last);
+        case StringSearcherStrategy::HORSPOOL: {
+            const char* needle = this->_needle.data();
+            const unsigned char last_character = static_cast<unsigned char>(needle[length - 1]);
+            size_t position = min_index;
+            while (position <= last) {
+                const unsigned char c = static_cast<unsigned char>(data[position + length - 1]);
+                if (c == last_character && std::memcmp(data + position, needle, length - 1) == 0) return position;
+                position += this->_skip[c];
+            }
+            return NO_INDEX;
+        }
+    }
+
+    return NO_INDEX;
+}
+
+size_t StringSearcher::findLast(const StringView& haystack, size_t max_index) const {
+    const size_t length = this->_needle.length();
+    if (length > haystack.length()) return NO_INDEX;
+
+    const char* data = haystack.data();
+    const size_t last = std::min(max_index, haystack.length() - length);
+
+    switch (this->_strategy) {
+        case StringSearcherStrategy::EMPTY:
+            return last;
+        case StringSearcherStrategy::CHARACTER: {
+            for (size_t position = last + 1; position > 0; --position) {
+                if (data[position - 1] == this->_needle[0]) return position - 1;
+            }
+            return NO_INDEX;
+        }
+        case StringSearcherStrategy::FIRST_LAST_FILTER:
+            return filterReverse(data, this->_needle, 0, last);
+        case StringSearcherStrategy::HORSPOOL: {
+            const char* needle = this->_needle.data();
+            const unsigned char first_character = static_cast<unsigned char>(needle[0]);
+            size_t position = last;
+            while (true) {
+                const unsigned char c = static_cast<unsigned char>(data[position]);
+                if (c == first_character && std::memcmp(data + position + 1, needle + 1, length - 1) == 0) {
+                    return position;
+                }
+                if (position < this->_reverseSkip[c]) return NO_INDEX;
+                position -= this->_reverseSkip[c];
+            }
+        }
+    }
+
+    return NO_INDEX;
+}
+
+StringSearcher::Matches StringSearcher::findAll(const StringView& haystack) const {
+    return Matches(this, haystack);
+}
+
+bool StringSearcher::occursIn(const StringView& haystack) const {
+    return this->find(haystack) != NO_INDEX;
+}
+
+size_t StringSearcher::count(const StringView& haystack) const {
+    Matches matches = this->findAll(haystack);
+    return static_cast<size_t>(std::distance(matches.begin(), matches.end()));
+}
+
+StringView StringSearcher::needle() const {
+    return StringView(this->_needle);
+}
+
+StringSearcherStrategy StringSearcher::strategy() const {
+    return this->_strategy;
+}
+
+// Matches
+
+StringSearcher::Matches::Matches(const StringSearcher* searcher, const StringView& haystack) {
+    this->_searcher = searcher;
+    this->_haystack = haystack;
+}
+
+StringSearcher::Matches::Iterator StringSearcher::Matches::begin() const {
+    return Iterator(this->_searcher, this->_haystack, this->_searcher->find(this->_haystack));
+}
+
+StringSearcher::Matches::Iterator StringSearcher::Matches::end() const {
+    return Iterator(this->_searcher, this->_haystack, NO_INDEX);
+}
+
+StringSearcher::Matches::Iterator::Iterator(const StringSearcher* searcher, const StringView& haystack, size_t index) {
+    this->_searcher = searcher;
+    this->_haystack = haystack;
+    this->_index = index;
+}
+
+const size_t& StringSearcher::Matches::Iterator::operator*() const {
+    return this->_index;
+}
+
+StringSearcher::Matches::Iterator& StringSearcher::Matches::Iterator::operator++() {
+    // Step past the match so occurrences don't overlap; an empty needle steps one character at a time
+    size_t step = std::max<size_t>(this->_searcher->_needle.length(), 1);
+    this->_index = this->_searcher->find(this->_haystack, this->_index + step);
+    return *this;
+}
+
+StringSearcher::Matches::Iterator StringSearcher::Matches::Iterator::operator++(int) {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+bool StringSearcher::Matches::Iterator::operator==(const Iterator& iterator) const {
+    return this->_index == iterator._index;
+}
+
+bool StringSearcher::Matches::Iterator::operator!=(const Iterator& iterator) const {
+    return !(*this == iterator);
+}
@@ -0,0 +1,218 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "StringTable.hpp"
+#include "Exception.hpp"
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+using namespace abraham;
+
+
+namespace {
+    const char MAGIC[] = {'A', 'B', 'S', 'T'};
+
+    const size_t HEADER_LENGTH = sizeof(MAGIC) + 2 * sizeof(uint64_t);
+
+    void writeUInt64(std::string& output, uint64_t value) {
+        char bytes[8];
+        for (size_t i = 0; i < 8; ++i) {
+            bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+        output.append(bytes, 8);
+    }
+
+    uint64_t readUInt64(const char* input) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(input[i])) << (8 * i);
+        }
+        return value;
+    }
+}
+
+const size_t StringTable::NO_INDEX = static_cast<size_t>(-1);
+
+StringView StringTable::at(size_t index) const {
+    const uint64_t offset = this->_offsets[index];
+    return StringView(this->_bytes.data() + offset, static_cast<size_t>(this->_offsets[index + 1] - offset));
+}
+
+StringTable::StringTable() {
+    this->_offsets.push_back(0);
+}
+
+StringView StringTable::operator[](size_t index) const {
+    return this->get(index);
+}
+
+size_t StringTable::add(const StringView& string) {
+    this->_bytes.append(string.data(), string.length());
+    this->_offsets.push_back(this->_bytes.length());
+    return this->_offsets.size() - 2;
+}
+
+StringView StringTable::get(size_t index) const {
+    if (index < this->size()) {
+        return this->at(index);
+    } else {
+        throw OutOfBoundsException(index);
+    }
+}
+
+size_t StringTable::size() const {
+    return this->_offsets.size() - 1;
+}
+
+bool StringTable::isEmpty() const {
+    return this->size() == 0;
+}
+
+size_t StringTable::byteSize() const {
+    return this->_bytes.length();
+}
+
+void StringTable::reserve(size_t count, size_t bytes) {
+    this->_offsets.reserve(count + 1);
+    this->_bytes.reserve(bytes);
+}
+
+void StringTable::clear() {
+    this->_bytes.clear();
+    this->_offsets.assign(1, 0);
+}
+
+std::vector<size_t> StringTable::sortedOrder() const {
+    std::vector<size_t> order(this->size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return this->at(a) < this->at(b);
+    });
+    return order;
+}
+
+void StringTable::permute(const std::vector<size_t>& order) {
+    size_t bytes = 0;
+    for (size_t index : order) {
+        if (index >= this->size()) throw OutOfBoundsException(index);
+        bytes += static_cast<size_t>(this->_offsets[index + 1] - this->_offsets[index]);
+    }
+
+    std::string permuted_bytes;
+    permuted_bytes.reserve(bytes);
+    std::vector<uint64_t> permuted_offsets;
+    permuted_offsets.reserve(order.size() + 1);
+    permuted_offsets.push_back(0);
+    for (size_t index : order) {
+        const StringView string = this->at(index);
+        permuted_bytes.append(string.data(), string.length());
+        permuted_offsets.push_back(permuted_bytes.length());
+    }
+
+    this->_bytes.swap(permuted_bytes);
+    this->_offsets.swap(permuted_offsets);
+}
+
+void StringTable::sort() {
+    this->permute(this->sortedOrder());
+}
+
+bool StringTable::isSorted() const {
+    for (size_t i = 1; i < this->size(); ++i) {
+        if (this->at(i) < this->at(i - 1)) return false;
+    }
+
+    return true;
+}
+
+size_t StringTable::binarySearch(const StringView& string) const {
+    size_t low = 0;
+    size_t high = this->size();
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (this->at(middle) < string) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low < this->size() && this->at(low) == string ? low : NO_INDEX;
+}
+
+size_t StringTable::dedupe() {
+    // Kept strings are compacted towards the front, which never overwrites a string that hasn't been read yet, so
+    // the set can hold views of them at their new positions
+    std::unordered_set<StringView> seen;
+    seen.reserve(this->size());
+
+    const size_t count = this->size();
+    size_t kept = 0;
+    uint64_t end = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const StringView string = this->at(i);
+        if (seen.find(string) != seen.end()) continue;
+
+        char* destination = &this->_bytes[0] + end;
+        if (destination != string.data()) std::memmove(destination, string.data(), string.length());
+        seen.insert(StringView(destination, string.length()));
+
+        this->_offsets[kept] = end;
+        end += string.length();
+        ++kept;
+    }
+
+    this->_offsets[kept] = end;
+    this->_offsets.resize(kept + 1);
+    this->_bytes.resize(static_cast<size_t>(end));
+    return count - kept;
+}
+
+std::string StringTable::serialize() const {
+    std::string output;
+    output.reserve(HEADER_LENGTH + this->_offsets.size() * sizeof(uint64_t) + this->_bytes.length());
+    output.append(MAGIC, sizeof(MAGIC));
+    writeUInt64(output, this->size());
+    writeUInt64(output, this->_bytes.length());
+    for (uint64_t offset : this->_offsets) {
+        writeUInt64(output, offset);
+    }
+
+    output.append(this->_bytes);
+    return output;
+}
+
+StringTable StringTable::deserialize(const StringView& data) {
+    if (data.length() < HEADER_LENGTH || std::memcmp(data.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        throw InvalidValueException("Data is not a serialized StringTable");
+    }
+
+    const char* input = data.data() + sizeof(MAGIC);
+    const uint64_t count = readUInt64(input);
+    const uint64_t bytes = readUInt64(input + sizeof(uint64_t));
+    const uint64_t remaining = data.length() - HEADER_LENGTH;
+    if (count >= remaining / sizeof(uint64_t) || bytes != remaining - (count + 1) * sizeof(uint64_t)) {
+        throw InvalidValueException("Serialized StringTable has the wrong length");
+    }
+
+    StringTable table;
+    table._offsets.resize(static_cast<size_t>(count + 1));
+    input += 2 * sizeof(uint64_t);
+    for (size_t i = 0; i <= count; ++i) {
+        const uint64_t offset = readUInt64(input + i * sizeof(uint64_t));
+        if ((i == 0 && offset != 0) || (i > 0 && offset < table._offsets[i - 1]) || offset > bytes) {
+            throw InvalidValueException("Serialized StringTable has invalid offsets");
+        }
+        table._offsets[i] = offset;
+    }
+
+    if (table._offsets[count] != bytes) throw InvalidValueException("Serialized StringTable has invalid offsets");
+
+    table._bytes.assign(input + (count + 1) * sizeof(uint64_t), static_cast<size_t>(bytes));
+    return table;
+}
@@ -0,0 +1,349 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "StringView.hpp"
+#include "Ascii.hpp"
+#include "CharSet.hpp"
+#include "Exception.hpp"
+#include "Hash.hpp"
+#include "InlineString.hpp"
+#include "NumberParser.hpp"
+#include "String.hpp"
+#include "Utf8.hpp"
+#include "Tokenizer.hpp"
+#include <algorithm>
+#include <cstring>
+
+using namespace abraham;
+
+
+namespace {
+    /**
+     * Long doubles are copied into a null terminated buffer before parsing. This covers any realistic number inline.
+     */
+    typedef InlineString<63> NumberBuffer;
+}
+
+StringView::StringView() {
+    this->_data = "";
+    this->_length = 0;
+}
+
+StringView::StringView(const char* cstring) {
+    this->_data = cstring;
+    this->_length = std::strlen(cstring);
+}
+
+StringView::StringView(const char* data, size_t length) {
+    this->_data = data;
+    this->_length = length;
+}
+
+StringView::StringView(const std::string& string) {
+    this->_data = string.data();
+    this->_length = string.length();
+}
+
+StringView::StringView(const String& string) {
+    this->_data = string.c_string();
+    this->_length = string.length();
+}
+
+size_t StringView::find(const char* bytes, size_t length, size_t min_index) const {
+    if (min_index > this->_length || length > this->_length - min_index) return NO_INDEX;
+    if (length == 0) return min_index;
+
+    const char* position = this->_data + min_index;
+    const char* last = this->_data + this->_length - length;
+    while (position <= last) {
+        position = static_cast<const char*>(std::memchr(position, bytes[0], static_cast<size_t>(last - position) + 1));
+        if (position == nullptr) return NO_INDEX;
+        if (std::memcmp(position + 1, bytes + 1, length - 1) == 0) {
+            return static_cast<size_t>(position - this->_data);
+        }
+        ++position;
+    }
+
+    return NO_INDEX;
+}
+
+char StringView::operator[](size_t index) const {
+    return this->characterAtIndex(index);
+}
+
+bool StringView::operator==(const StringView& view) const {
+    return this->_length == view._length && (this->_length == 0 ||
+                                             std::memcmp(this->_data, view._data, this->_length) == 0);
+}
+
+bool StringView::operator!=(const StringView& view) const {
+    return !(*this == view);
+}
+
+bool StringView::operator<(const StringView& view) const {
+    return this->compare(view) < 0;
+}
+
+bool StringView::operator>(const StringView& view) const {
+    return this->compare(view) > 0;
+}
+
+bool StringView::operator<=(const StringView& view) const {
+    return this->compare(view) <= 0;
+}
+
+bool StringView::operator>=(const StringView& view) const {
+    return this->compare(view) >= 0;
+}
+
+size_t StringView::length() const {
+    return this->_length;
+}
+
+size_t StringView::hash() const {
+    return static_cast<size_t>(Hasher::hash(this->_data, this->_length));
+}
+
+bool StringView::isEmpty() const {
+    return this->_length == 0;
+}
+
+const char* StringView::data() const {
+    return this->_data;
+}
+
+char StringView::characterAtIndex(size_t index) const {
+    if (index < this->_length) {
+        return this->_data[index];
+    } else {
+        throw OutOfBoundsException(index);
+    }
+}
+
+StringView StringView::substring(size_t from_index, size_t to_index) const {
+    if (from_index > to_index) throw InvalidArgumentException("from_index must be less than to_index");
+    if (to_index < this->_length) {
+        return StringView(this->_data + from_index, to_index - from_index);
+    } else {
+        throw OutOfBoundsException(to_index);
+    }
+}
+
+StringView StringView::substringFromIndex(size_t index) const {
+    if (index < this->_length) {
+        return StringView(this->_data + index, this->_length - index);
+    } else {
+        throw OutOfBoundsException(index);
+    }
+}
+
+StringView StringView::substringToIndex(size_t index) const {
+    if (index < this->_length) {
+        return StringView(this->_data, index);
+    } else {
+        throw OutOfBoundsException(index);
+    }
+}
+
+bool StringView::isValidUtf8() const {
+    return Utf8::isValid(this->_data, this->_length);
+}
+
+size_t StringView::codePointLength() const {
+    return Utf8::countCodePoints(this->_data, this->_length);
+}
+
+StringView StringView::codePointSubstring(size_t from_index, size_t to_index) const {
+    if (from_index > to_index) throw InvalidArgumentException("from_index must be less than to_index");
+
+    const size_t from = Utf8::offsetOfCodePoint(this->_data, this->_length, from_index);
+    if (from == Utf8::NO_INDEX) throw OutOfBoundsException(from_index);
+    const size_t length = Utf8::offsetOfCodePoint(this->_data + from, this->_length - from, to_index - from_index);
+    if (length == Utf8::NO_INDEX) throw OutOfBoundsException(to_index);
+
+    return StringView(this->_data + from, length);
+}
+
+std::vector<StringView> StringView::split(const StringView& delimiter) const {
+    std::vector<StringView> parts;
+    this->split(delimiter, parts);
+    return parts;
+}
+
+void StringView::split(const StringView& delimiter, std::vector<StringView>& parts) const {
+    parts.clear();
+
+    Tokenizer tokenizer = Tokenizer(*this, delimiter);
+    StringView token;
+    while (tokenizer.next(token)) {
+        parts.push_back(token);
+    }
+}
+
+StringView StringView::trim(const StringView& characters) const {
+    return this->trim(CharSet(characters));
+}
+
+StringView StringView::trim(const CharSet& characters) const {
+    return this->trimLeading(characters).trimTrailing(characters);
+}
+
+StringView StringView::trimLeading(const StringView& characters) const {
+    return this->trimLeading(CharSet(characters));
+}
+
+StringView StringView::trimLeading(const CharSet& characters) const {
+    size_t index = characters.findFirstNot(*this);
+    if (index == NO_INDEX) index = this->_length;
+
+    return StringView(this->_data + index, this->_length - index);
+}
+
+StringView StringView::trimTrailing(const StringView& characters) const {
+    return this->trimTrailing(CharSet(characters));
+}
+
+StringView StringView::trimTrailing(const CharSet& characters) const {
+    size_t index = characters.findLastNot(*this);
+    size_t length = index == NO_INDEX ? 0 : index + 1;
+
+    return StringView(this->_data, length);
+}
+
+bool StringView::contains(const StringView& view) const {
+    return this->find(view._data, view._length, 0) != NO_INDEX;
+}
+
+size_t StringView::indexOf(const StringView& view) const {
+    return this->find(view._data, view._length, 0);
+}
+
+size_t StringView::indexOf(const StringView& view, size_t min_index) const {
+    return this->find(view._data, view._length, min_index);
+}
+
+size_t StringView::indexOfLast(const StringView& view) const {
+    return this->indexOfLast(view, NO_INDEX);
+}
+
+size_t StringView::indexOfLast(const StringView& view, size_t max_index) const {
+    if (view._length > this->_length) return NO_INDEX;
+
+    size_t index = std::min(max_index, this->_length - view._length);
+    while (true) {
+        if (view._length == 0 || std::memcmp(this->_data + index, view._data, view._length) == 0) return index;
+        if (index == 0) return NO_INDEX;
+        --index;
+    }
+}
+
+bool StringView::isEqualTo(const StringView& view, bool case_sensitive) const {
+    if (case_sensitive) return *this == view;
+    return this->_length == view._length && Ascii::isEqualIgnoringCase(this->_data, view._data, this->_length);
+}
+
+int StringView::compare(const StringView& view, bool case_sensitive) const {
+    if (!case_sensitive) return Ascii::compareIgnoringCase(this->_data, this->_length, view._data, view._length);
+
+    const size_t length = std::min(this->_length, view._length);
+    int result = length == 0 ? 0 : std::memcmp(this->_data, view._data, length);
+    if (result != 0) return result < 0 ? -1 : 1;
+
+    if (this->_length == view._length) return 0;
+    return this->_length < view._length ? -1 : 1;
+}
+
+int StringView::intValue() const {
+    return NumberParser::valueOf<int>(*this, "int");
+}
+
+long StringView::longValue() const {
+    return NumberParser::valueOf<long>(*this, "long");
+}
+
+long long StringView::longLongValue() const {
+    return NumberParser::valueOf<long long>(*this, "long long");
+}
+
+unsigned StringView::unsignedValue() const {
+    return NumberParser::valueOf<unsigned>(*this, "unsigned");
+}
+
+unsigned long StringView::unsignedLongValue() const {
+    return NumberParser::valueOf<unsigned long>(*this, "unsigned long");
+}
+
+unsigned long long StringView::unsignedLongLongValue() const {
+    return NumberParser::valueOf<unsigned long long>(*this, "unsigned long long");
+}
+
+float StringView::floatValue() const {
+    return NumberParser::valueOf<float>(*this, "float");
+}
+
+double StringView::doubleValue() const {
+    return NumberParser::valueOf<double>(*this, "double");
+}
+
+long double StringView::longDoubleValue() const {
+    return NumberBuffer(this->_data, this->_length).longDoubleValue();
+}
+
+bool StringView::boolValue() const {
+    return NumberParser::valueOf<bool>(*this, "bool");
+}
+
+bool StringView::tryIntValue(int& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+bool StringView::tryLongValue(long& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+bool StringView::tryLongLongValue(long long& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+bool StringView::tryUnsignedValue(unsigned& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+bool StringView::tryUnsignedLongValue(unsigned long& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+bool StringView::tryUnsignedLongLongValue(unsigned long long& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+bool StringView::tryFloatValue(float& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+bool StringView::tryDoubleValue(double& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+bool StringView::tryBoolValue(bool& value) const {
+    return NumberParser::parseValue(*this, value) == ParseError::NONE;
+}
+
+String StringView::string() const {
+    return String(this->std_string());
+}
+
+std::string StringView::std_string() const {
+    return std::string(this->_data, this->_length);
+}
+
+const char* StringView::begin() const {
+    return this->_data;
+}
+
+const char* StringView::end() const {
+    return this->_data + this->_length;
+}
+
+const size_t StringView::NO_INDEX = static_cast<size_t>(-1);
@@ -0,0 +1,170 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Tokenizer.hpp"
+#include <cstring>
+#include <utility>
+
+using namespace abraham;
+
+
+Tokenizer::Tokenizer(const StringView& source, char delimiter) : Tokenizer(source, StringView()) {
+    this->_type = TokenizerDelimiter::CHARACTER;
+    this->_character = delimiter;
+}
+
+Tokenizer::Tokenizer(const StringView& source, const StringView& delimiter) {
+    this->_source = source;
+    this->_delimiter = delimiter;
+    this->_type = delimiter.length() == 1 ? TokenizerDelimiter::CHARACTER : TokenizerDelimiter::STRING;
+    this->_position = 0;
+    this->_splits = 0;
+    this->_maxSplits = static_cast<size_t>(-1);
+    this->_skipEmpty = false;
+    this->_finished = false;
+
+    this->_character = this->_type == TokenizerDelimiter::CHARACTER ? delimiter[0] : '\0';
+}
+
+Tokenizer Tokenizer::anyOf(const StringView& source, const StringView& characters) {
+    return anyOf(source, CharSet(characters));
+}
+
+Tokenizer Tokenizer::anyOf(const StringView& source, const CharSet& characters) {
+    Tokenizer tokenizer = Tokenizer(source, StringView());
+    tokenizer._type = TokenizerDelimiter::CHARACTER_SET;
+    tokenizer._characters = characters;
+    return tokenizer;
+}
+
+size_t Tokenizer::findDelimiter(size_t& length) const {
+    const char* begin = this->_source.data() + this->_position;
+    const char* end = this->_source.data() + this->_source.length();
+
+    switch (this->_type) {
+        case TokenizerDelimiter::CHARACTER: {
+            length = 1;
+            const char* found = static_cast<const char*>(std::memchr(begin, this->_character,
+                                                                     static_cast<size_t>(end - begin)));
+            return found == nullptr ? StringView::NO_INDEX : static_cast<size_t>(found - this->_source.data());
+        }
+        case TokenizerDelimiter::STRING: {
+            length = this->_delimiter.length();
+            if (length == 0) {
+                // An empty delimiter splits between every character
+                return this->_position + 1 < this->_source.length() ? this->_position + 1 : StringView::NO_INDEX;
+            }
+
+            return this->_source.indexOf(this->_delimiter, this->_position);
+        }
+        case TokenizerDelimiter::CHARACTER_SET: {
+            length = 1;
+            size_t index = this->_characters.findFirst(StringView(begin, static_cast<size_t>(end - begin)));
+            return index == StringView::NO_INDEX ? index : this->_position + index;
+        }
+    }
+
+    return StringView::NO_INDEX;
+}
+
+Tokenizer& Tokenizer::skipEmpty(bool skip) & {
+    this->_skipEmpty = skip;
+    return *this;
+}
+
+Tokenizer Tokenizer::skipEmpty(bool skip) && {
+    this->_skipEmpty = skip;
+    return std::move(*this);
+}
+
+Tokenizer& Tokenizer::maxSplits(size_t count) & {
+    this->_maxSplits = count;
+    return *this;
+}
+
+Tokenizer Tokenizer::maxSplits(size_t count) && {
+    this->_maxSplits = count;
+    return std::move(*this);
+}
+
+bool Tokenizer::next(StringView& token) {
+    // Splitting nothing into characters gives no tokens rather than one empty token
+    if (this->_type == TokenizerDelimiter::STRING && this->_delimiter.isEmpty() && this->_source.isEmpty()) {
+        this->_finished = true;
+    }
+
+    while (!this->_finished) {
+        size_t length = 0;
+        size_t index = this->_splits < this->_maxSplits ? this->findDelimiter(length) : StringView::NO_INDEX;
+
+        if (index == StringView::NO_INDEX) {
+            token = this->remainder();
+            this->_position = this->_source.length();
+            this->_finished = true;
+        } else {
+            token = StringView(this->_source.data() + this->_position, index - this->_position);
+            this->_position = index + length;
+        }
+
+        if (this->_skipEmpty && token.isEmpty()) continue;
+        if (!this->_finished) ++this->_splits;
+        return true;
+    }
+
+    return false;
+}
+
+StringView Tokenizer::remainder() const {
+    return StringView(this->_source.data() + this->_position, this->_source.length() - this->_position);
+}
+
+bool Tokenizer::isFinished() const {
+    return this->_finished;
+}
+
+TokenizerDelimiter Tokenizer::delimiterType() const {
+    return this->_type;
+}
+
+Tokenizer::Iterator Tokenizer::begin() const {
+    return Iterator(*this, false);
+}
+
+Tokenizer::Iterator Tokenizer::end() const {
+    return Iterator(*this, true);
+}
+
+// Iterator
+
+Tokenizer::Iterator::Iterator(const Tokenizer& tokenizer, bool end) : _tokenizer(tokenizer) {
+    this->_end = end || !this->_tokenizer.next(this->_token);
+}
+
+const StringView& Tokenizer::Iterator::operator*() const {
+    return this->_token;
+}
+
+const StringView* Tokenizer::Iterator::operator->() const {
+    return &this->_token;
+}
+
+Tokenizer::Iterator& Tokenizer::Iterator::operator++() {
+    this->_end = !this->_tokenizer.next(this->_token);
+    return *this;
+}
+
+Tokenizer::Iterator Tokenizer::Iterator::operator++(int) {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+bool Tokenizer::Iterator::operator==(const Iterator& iterator) const {
+    if (this->_end || iterator._end) return this->_end == iterator._end;
+    return this->_token.data() == iterator._token.data() && this->_token.length() == iterator._token.length();
+}
+
+bool Tokenizer::Iterator::operator!=(const Iterator& iterator) const {
+    return !(*this == iterator);
+}
@@ -3,9 +3,19 @@
 //
 
 #include "Exception.hpp"
+#include "NumberFormatter.hpp"
 
 using namespace abraham;
 
+
+namespace {
+    std::string outOfBoundsMessage(size_t attempted) {
+        char index[NumberFormatter::MAX_LENGTH];
+        return "Attempted access to index " + std::string(index, NumberFormatter::format(attempted, index)) +
+               " was out of bounds.";
+    }
+}
+
 // Exception
 Exception::Exception(char const* const message)
         : std::runtime_error(message) {}
@@ -16,8 +26,7 @@ char const* Exception::what() const noexcept {
 
 // OutOfBoundsException
 OutOfBoundsException::OutOfBoundsException(size_t attempted)
-        : Exception(
-        std::string("Attempted access to index " + std::to_string(attempted) + " was out of bounds.").c_str()) {}
+        : Exception(outOfBoundsMessage(attempted).c_str()) {}
 
 // InvalidArgumentException
 InvalidArgumentException::InvalidArgumentException()
@@ -33,6 +42,13 @@ InvalidValueException::InvalidValueException()
 InvalidValueException::InvalidValueException(const std::string& message)
         : Exception(message.c_str()) {}
 
+// IOException
+IOException::IOException()
+        : Exception("I/O error") {}
+
+IOException::IOException(const std::string& message)
+        : Exception(message.c_str()) {}
+
 // NotImplementedException
 NotImplementedException::NotImplementedException()
         : Exception("Function not implemented") {}
\ No newline at end of file
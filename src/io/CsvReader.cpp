@@ -0,0 +1,420 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "CsvReader.hpp"
+#include "Exception.hpp"
+#include "LineReader.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+#if defined(__AVX2__)
+    const ptrdiff_t BLOCK_SIZE = 32;
+
+    /**
+     * @return A bit for each of the 32 characters at a position that is either of two characters.
+     */
+    uint32_t matchMask(const char* block, char a, char b) {
+        __m256i characters = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+        __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(characters, _mm256_set1_epi8(a)),
+                                          _mm256_cmpeq_epi8(characters, _mm256_set1_epi8(b)));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+    }
+#elif defined(__SSE2__)
+    const ptrdiff_t BLOCK_SIZE = 16;
+
+    /**
+     * @return A bit for each of the 16 characters at a position that is either of two characters.
+     */
+    uint32_t matchMask(const char* block, char a, char b) {
+        __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8(a)),
+                                       _mm_cmpeq_epi8(characters, _mm_set1_epi8(b)));
+        return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+    }
+#else
+    const ptrdiff_t BLOCK_SIZE = 1;
+
+    uint32_t matchMask(const char* block, char a, char b) {
+        return *block == a || *block == b ? 1 : 0;
+    }
+#endif
+
+    /**
+     * @return The first position that is either of two characters, or end if there isn't one.
+     */
+    const char* findEither(const char* position, const char* end, char a, char b) {
+        while (end - position >= BLOCK_SIZE) {
+            uint32_t mask = matchMask(position, a, b);
+            if (mask != 0) return position + __builtin_ctz(mask);
+            position += BLOCK_SIZE;
+        }
+
+        while (position < end && *position != a && *position != b) {
+            ++position;
+        }
+
+        return position;
+    }
+
+    /**
+     * @return The number of times a character occurs.
+     */
+    size_t countCharacter(const char* position, const char* end, char c) {
+        size_t count = 0;
+        while (end - position >= BLOCK_SIZE) {
+            count += static_cast<size_t>(__builtin_popcount(matchMask(position, c, c)));
+            position += BLOCK_SIZE;
+        }
+
+        for (; position < end; ++position) {
+            if (*position == c) ++count;
+        }
+
+        return count;
+    }
+
+    /**
+     * Finds the delimiters and line breaks that end unquoted fields. The mask of the last block looked at is kept,
+     * so the short fields of a record are found from one load rather than one each.
+     */
+    class FieldScanner {
+    protected:
+        const char* _end;
+        const char* _block;
+        uint32_t _mask;
+        char _delimiter;
+
+    public:
+        FieldScanner(const char* end, char delimiter) {
+            this->_end = end;
+            this->_block = nullptr;
+            this->_mask = 0;
+            this->_delimiter = delimiter;
+        }
+
+        /**
+         * @return The first delimiter or '\n' at or after a position, or the end of the text if there isn't one.
+         */
+        const char* next(const char* position) {
+            while (true) {
+                if (this->_block != nullptr && position >= this->_block && position < this->_block + BLOCK_SIZE) {
+                    const uint32_t mask = this->_mask & (~0u << (position - this->_block));
+                    if (mask != 0) return this->_block + __builtin_ctz(mask);
+                    position = this->_block + BLOCK_SIZE;
+                }
+
+                if (this->_end - position < BLOCK_SIZE) return findEither(position, this->_end, this->_delimiter, '\n');
+
+                this->_block = position;
+                this->_mask = matchMask(position, this->_delimiter, '\n');
+            }
+        }
+    };
+
+    /**
+     * @return The first position that isn't part of a blank line.
+     */
+    const char* skipBlankLines(const char* position, const char* end) {
+        while (position < end) {
+            if (*position == '\n') {
+                ++position;
+            } else if (*position == '\r' && end - position > 1 && position[1] == '\n') {
+                position += 2;
+            } else {
+                break;
+            }
+        }
+
+        return position;
+    }
+
+    /**
+     * @return The position after the end of the line a position is on.
+     */
+    const char* skipLine(const char* position, const char* end) {
+        const char* newline = LineReader::findNewline(position, end);
+        return newline == end ? end : newline + 1;
+    }
+}
+
+
+// CsvRecord
+
+CsvRecord::CsvRecord() {
+    this->_error = CsvError::NONE;
+    this->_number = 0;
+    this->_offset = 0;
+}
+
+CsvRecord::CsvRecord(const CsvRecord& record)
+        : _fields(record._fields), _escapedFields(record._escapedFields), _unescaped(record._unescaped) {
+    this->_error = record._error;
+    this->_number = record._number;
+    this->_offset = record._offset;
+    this->repoint(record._unescaped.data());
+}
+
+CsvRecord::CsvRecord(CsvRecord&& record) noexcept
+        : _fields(std::move(record._fields)), _escapedFields(std::move(record._escapedFields)) {
+    // A short buffer is stored inside the string, so moving the string moves its characters
+    const char* source = record._unescaped.data();
+    this->_unescaped = std::move(record._unescaped);
+    this->_error = record._error;
+    this->_number = record._number;
+    this->_offset = record._offset;
+    this->repoint(source);
+    record._fields.clear();
+    record._escapedFields.clear();
+}
+
+CsvRecord& CsvRecord::operator=(const CsvRecord& record) {
+    if (this == &record) return *this;
+
+    this->_fields = record._fields;
+    this->_escapedFields = record._escapedFields;
+    this->_unescaped = record._unescaped;
+    this->_error = record._error;
+    this->_number = record._number;
+    this->_offset = record._offset;
+    this->repoint(record._unescaped.data());
+    return *this;
+}
+
+CsvRecord& CsvRecord::operator=(CsvRecord&& record) noexcept {
+    if (this == &record) return *this;
+
+    const char* source = record._unescaped.data();
+    this->_fields = std::move(record._fields);
+    this->_escapedFields = std::move(record._escapedFields);
+    this->_unescaped = std::move(record._unescaped);
+    this->_error = record._error;
+    this->_number = record._number;
+    this->_offset = record._offset;
+    this->repoint(source);
+    record._fields.clear();
+    record._escapedFields.clear();
+    return *this;
+}
+
+void CsvRecord::repoint(const char* source) {
+    for (size_t index : this->_escapedFields) {
+        const StringView field = this->_fields[index];
+        this->_fields[index] = StringView(this->_unescaped.data() + (field.data() - source), field.length());
+    }
+}
+
+void CsvRecord::unescape(char quote) {
+    if (this->_escapedFields.empty()) return;
+
+    // Unescaping only shortens fields, so reserving their escaped length means the buffer never moves
+    size_t length = 0;
+    for (size_t index : this->_escapedFields) {
+        length += this->_fields[index].length();
+    }
+    this->_unescaped.clear();
+    this->_unescaped.reserve(length);
+
+    for (size_t index : this->_escapedFields) {
+        const StringView field = this->_fields[index];
+        const size_t start = this->_unescaped.length();
+        for (size_t i = 0; i < field.length(); ++i) {
+            this->_unescaped.push_back(field.data()[i]);
+            if (field.data()[i] == quote) ++i;
+        }
+        this->_fields[index] = StringView(this->_unescaped.data() + start, this->_unescaped.length() - start);
+    }
+}
+
+StringView CsvRecord::operator[](size_t index) const {
+    return this->field(index);
+}
+
+StringView CsvRecord::field(size_t index) const {
+    if (index < this->_fields.size()) {
+        return this->_fields[index];
+    } else {
+        throw OutOfBoundsException(index);
+    }
+}
+
+size_t CsvRecord::size() const {
+    return this->_fields.size();
+}
+
+CsvError CsvRecord::error() const {
+    return this->_error;
+}
+
+bool CsvRecord::isValid() const {
+    return this->_error == CsvError::NONE;
+}
+
+size_t CsvRecord::number() const {
+    return this->_number;
+}
+
+size_t CsvRecord::offset() const {
+    return this->_offset;
+}
+
+
+// CsvReader
+
+CsvReader::CsvReader(const StringView& text, char delimiter, char quote) {
+    this->_text = text;
+    this->_position = 0;
+    this->_recordCount = 0;
+    this->_delimiter = delimiter;
+    this->_quote = quote;
+}
+
+CsvReader CsvReader::tsv(const StringView& text) {
+    return CsvReader(text, '\t');
+}
+
+std::vector<StringView> CsvReader::partition(const StringView& text, size_t count, char quote) {
+    std::vector<StringView> parts;
+    if (count == 0) count = 1;
+
+    const char* const begin = text.data();
+    const char* const end = begin + text.length();
+    const size_t target = text.length() / count;
+    const char* start = begin;
+
+    // Whether the position that quotes have been counted up to is inside a quoted field
+    const char* counted = begin;
+    bool is_quoted = false;
+
+    for (size_t i = 1; i < count && start < end; ++i) {
+        const char* position = std::max(start, begin + i * target);
+        if (position >= end) break;
+        is_quoted ^= (countCharacter(counted, position, quote) & 1) != 0;
+
+        // The part ends at the first line break from its target size that isn't inside a quoted field
+        const char* boundary = end;
+        while (position < end) {
+            position = findEither(position, end, quote, '\n');
+            if (position == end) break;
+            if (*position == quote) {
+                is_quoted = !is_quoted;
+            } else if (!is_quoted) {
+                boundary = position;
+                break;
+            }
+            ++position;
+        }
+
+        if (boundary == end) break;
+        parts.push_back(StringView(start, static_cast<size_t>(boundary + 1 - start)));
+        start = boundary + 1;
+        counted = start;
+    }
+
+    if (start < end) parts.push_back(StringView(start, static_cast<size_t>(end - start)));
+    return parts;
+}
+
+bool CsvReader::next(CsvRecord& record) {
+    const char* const begin = this->_text.data();
+    const char* const end = begin + this->_text.length();
+    const char* position = skipBlankLines(begin + this->_position, end);
+
+    if (position >= end) {
+        this->_position = this->_text.length();
+        return false;
+    }
+
+    record._fields.clear();
+    record._escapedFields.clear();
+    record._error = CsvError::NONE;
+    record._number = ++this->_recordCount;
+    record._offset = static_cast<size_t>(position - begin);
+
+    FieldScanner scanner = FieldScanner(end, this->_delimiter);
+    while (true) {
+        // A delimiter at the very end of the text is followed by an empty field
+        if (position == end) {
+            record._fields.push_back(StringView(end, 0));
+            break;
+        }
+
+        if (*position == this->_quote) {
+            const char* field_start = position + 1;
+            const char* closing = field_start;
+            bool is_escaped = false;
+            while (true) {
+                closing = findEither(closing, end, this->_quote, this->_quote);
+                if (closing == end || end - closing == 1 || closing[1] != this->_quote) break;
+                is_escaped = true;
+                closing += 2;
+            }
+
+            if (closing == end) {
+                const char* line_end = LineReader::findNewline(field_start, end);
+                record._fields.push_back(StringView(field_start, static_cast<size_t>(line_end - field_start)));
+                record._error = CsvError::UNTERMINATED_QUOTE;
+                position = line_end == end ? end : line_end + 1;
+                break;
+            }
+
+            if (is_escaped) record._escapedFields.push_back(record._fields.size());
+            record._fields.push_back(StringView(field_start, static_cast<size_t>(closing - field_start)));
+
+            position = closing + 1;
+            if (position == end) break;
+            if (*position == this->_delimiter) {
+                ++position;
+                continue;
+            }
+            if (*position == '\r' && (end - position == 1 || position[1] == '\n')) ++position;
+            if (position == end) break;
+            if (*position == '\n') {
+                ++position;
+                break;
+            }
+
+            record._error = CsvError::TEXT_AFTER_QUOTE;
+            position = skipLine(position, end);
+            break;
+        }
+
+        const char* field_end = scanner.next(position);
+        const bool is_line_end = field_end == end || *field_end == '\n';
+        const char* text_end = field_end;
+        if (field_end != end && *field_end == '\n' && text_end > position && text_end[-1] == '\r') --text_end;
+        record._fields.push_back(StringView(position, static_cast<size_t>(text_end - position)));
+
+        position = field_end == end ? end : field_end + 1;
+        if (is_line_end) break;
+    }
+
+    record.unescape(this->_quote);
+    this->_position = static_cast<size_t>(position - begin);
+    return true;
+}
+
+size_t CsvReader::recordCount() const {
+    return this->_recordCount;
+}
+
+StringView CsvReader::remainder() const {
+    return StringView(this->_text.data() + this->_position, this->_text.length() - this->_position);
+}
+
+bool CsvReader::isFinished() const {
+    const char* end = this->_text.data() + this->_text.length();
+    return skipBlankLines(this->_text.data() + this->_position, end) >= end;
+}
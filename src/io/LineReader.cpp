@@ -0,0 +1,144 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "LineReader.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace abraham;
+
+
+LineReader::LineReader(const StringView& text) {
+    this->_text = text;
+    this->_position = 0;
+    this->_lineCount = 0;
+    this->_keepCarriageReturns = false;
+}
+
+const char* LineReader::findNewline(const char* begin, const char* end) {
+#if defined(__AVX2__)
+    const __m256i newline = _mm256_set1_epi8('\n');
+    while (end - begin >= 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline)));
+        if (mask != 0) return begin + __builtin_ctz(mask);
+        begin += 32;
+    }
+#elif defined(__SSE2__)
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (end - begin >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, newline));
+        if (mask != 0) return begin + __builtin_ctz(static_cast<unsigned>(mask));
+        begin += 16;
+    }
+#endif
+
+    const void* found = begin < end ? std::memchr(begin, '\n', static_cast<size_t>(end - begin)) : nullptr;
+    return found != nullptr ? static_cast<const char*>(found) : end;
+}
+
+std::vector<StringView> LineReader::partition(const StringView& text, size_t count) {
+    std::vector<StringView> parts;
+    if (count == 0) count = 1;
+
+    const char* const begin = text.data();
+    const char* const end = begin + text.length();
+    const size_t target = text.length() / count;
+    const char* start = begin;
+    for (size_t i = 1; i < count && start < end; ++i) {
+        // Each part runs to the end of the line its target size lands in
+        const char* boundary = std::max(start, begin + i * target);
+        if (boundary == end) break;
+        boundary = findNewline(boundary, end);
+        if (boundary == end) break;
+
+        parts.push_back(StringView(start, static_cast<size_t>(boundary + 1 - start)));
+        start = boundary + 1;
+    }
+
+    if (start < end) parts.push_back(StringView(start, static_cast<size_t>(end - start)));
+    return parts;
+}
+
+LineReader& LineReader::keepCarriageReturns(bool keep) {
+    this->_keepCarriageReturns = keep;
+    return *this;
+}
+
+bool LineReader::next(StringView& line) {
+    if (this->_position >= this->_text.length()) return false;
+
+    const char* start = this->_text.data() + this->_position;
+    const char* end = this->_text.data() + this->_text.length();
+    const char* newline = findNewline(start, end);
+
+    size_t length = static_cast<size_t>(newline - start);
+    this->_position += length + (newline == end ? 0 : 1);
+    if (!this->_keepCarriageReturns && newline != end && length > 0 && start[length - 1] == '\r') --length;
+
+    line = StringView(start, length);
+    ++this->_lineCount;
+    return true;
+}
+
+size_t LineReader::lineCount() const {
+    return this->_lineCount;
+}
+
+StringView LineReader::remainder() const {
+    return StringView(this->_text.data() + this->_position, this->_text.length() - this->_position);
+}
+
+bool LineReader::isFinished() const {
+    return this->_position >= this->_text.length();
+}
+
+LineReader::Iterator LineReader::begin() const {
+    return Iterator(*this, false);
+}
+
+LineReader::Iterator LineReader::end() const {
+    return Iterator(*this, true);
+}
+
+// Iterator
+
+LineReader::Iterator::Iterator(const LineReader& reader, bool end) : _reader(reader) {
+    this->_end = end || !this->_reader.next(this->_line);
+}
+
+const StringView& LineReader::Iterator::operator*() const {
+    return this->_line;
+}
+
+const StringView* LineReader::Iterator::operator->() const {
+    return &this->_line;
+}
+
+LineReader::Iterator& LineReader::Iterator::operator++() {
+    this->_end = !this->_reader.next(this->_line);
+    return *this;
+}
+
+LineReader::Iterator LineReader::Iterator::operator++(int) {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+bool LineReader::Iterator::operator==(const Iterator& iterator) const {
+    if (this->_end || iterator._end) return this->_end == iterator._end;
+    return this->_line.data() == iterator._line.data() && this->_line.length() == iterator._line.length();
+}
+
+bool LineReader::Iterator::operator!=(const Iterator& iterator) const {
+    return !(*this == iterator);
+}
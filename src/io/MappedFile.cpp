@@ -0,0 +1,214 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "MappedFile.hpp"
+#include "Exception.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace abraham;
+
+
+namespace {
+    const size_t READ_CHUNK_SIZE = 64 * 1024;
+
+#if !defined(_WIN32)
+    int adviceForAccess(FileAccess access) {
+        switch (access) {
+            case FileAccess::SEQUENTIAL:
+                return MADV_SEQUENTIAL;
+            case FileAccess::RANDOM:
+                return MADV_RANDOM;
+            case FileAccess::WILL_NEED:
+                return MADV_WILLNEED;
+            default:
+                return MADV_NORMAL;
+        }
+    }
+#endif
+
+    int openFile(const std::string& path) {
+#if defined(_WIN32)
+        return ::_open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+        return ::open(path.c_str(), O_RDONLY);
+#endif
+    }
+
+    void closeFile(int descriptor) {
+#if defined(_WIN32)
+        ::_close(descriptor);
+#else
+        ::close(descriptor);
+#endif
+    }
+}
+
+void MappedFile::load(int descriptor, const std::string& name, FileAccess access) {
+    this->_data = nullptr;
+    this->_size = 0;
+    this->_isMapped = false;
+
+#if !defined(_WIN32)
+    struct stat info = {};
+    if (::fstat(descriptor, &info) != 0) throw IOException("Could not stat file: " + name);
+
+    // Only regular files with a known size can be mapped; pipes, terminals and files like those in /proc report no
+    // size and have to be read
+    if (S_ISREG(info.st_mode) && info.st_size > 0) {
+        const size_t size = static_cast<size_t>(info.st_size);
+        void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (address != MAP_FAILED) {
+            this->_data = static_cast<const char*>(address);
+            this->_size = size;
+            this->_isMapped = true;
+            this->advise(access);
+            return;
+        }
+    }
+#else
+    (void) access;
+#endif
+
+    this->read(descriptor, name);
+}
+
+void MappedFile::read(int descriptor, const std::string& name) {
+    this->_buffer.clear();
+    size_t length = 0;
+    while (true) {
+        if (this->_buffer.length() - length < READ_CHUNK_SIZE) {
+            this->_buffer.resize(std::max(this->_buffer.length() * 2, length + READ_CHUNK_SIZE));
+        }
+
+#if defined(_WIN32)
+        const int count = ::_read(descriptor, &this->_buffer[length], static_cast<unsigned>(READ_CHUNK_SIZE));
+#else
+        const ssize_t count = ::read(descriptor, &this->_buffer[length], this->_buffer.length() - length);
+#endif
+        if (count == 0) break;
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            throw IOException("Could not read file: " + name);
+        }
+        length += static_cast<size_t>(count);
+    }
+
+    this->_buffer.resize(length);
+    this->_buffer.shrink_to_fit();
+    this->_data = this->_buffer.data();
+    this->_size = length;
+}
+
+void MappedFile::release() {
+#if !defined(_WIN32)
+    if (this->_isMapped) {
+        ::munmap(const_cast<char*>(this->_data), this->_size);
+    }
+#endif
+
+    this->_data = nullptr;
+    this->_size = 0;
+    this->_isMapped = false;
+    this->_buffer.clear();
+}
+
+MappedFile::MappedFile(const std::string& path, FileAccess access) {
+    int descriptor = openFile(path);
+    if (descriptor < 0) throw IOException("Could not open file: " + path);
+
+    try {
+        this->load(descriptor, path, access);
+    } catch (...) {
+        closeFile(descriptor);
+        throw;
+    }
+
+    // A mapping stays valid after its descriptor is closed
+    closeFile(descriptor);
+}
+
+MappedFile::MappedFile(int descriptor, FileAccess access) {
+    this->load(descriptor, "descriptor " + std::to_string(descriptor), access);
+}
+
+MappedFile::MappedFile(MappedFile&& file) noexcept {
+    this->_isMapped = file._isMapped;
+    this->_size = file._size;
+    this->_buffer = std::move(file._buffer);
+
+    // A short buffer's characters may be stored in the std::string itself, so they move to a new address
+    this->_data = this->_isMapped ? file._data : this->_buffer.data();
+
+    file._data = nullptr;
+    file._size = 0;
+    file._isMapped = false;
+}
+
+MappedFile::~MappedFile() {
+    this->release();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& file) noexcept {
+    if (this == &file) return *this;
+    this->release();
+    this->_isMapped = file._isMapped;
+    this->_size = file._size;
+    this->_buffer = std::move(file._buffer);
+    this->_data = this->_isMapped ? file._data : this->_buffer.data();
+
+    file._data = nullptr;
+    file._size = 0;
+    file._isMapped = false;
+    return *this;
+}
+
+void MappedFile::advise(FileAccess access) {
+    this->advise(access, 0, this->_size);
+}
+
+void MappedFile::advise(FileAccess access, size_t offset, size_t length) {
+#if !defined(_WIN32)
+    if (!this->_isMapped || offset >= this->_size) return;
+
+    // madvise takes whole pages, so the range is widened to the page containing the offset
+    const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t start = offset / page_size * page_size;
+    const size_t end = std::min(this->_size, offset + std::min(length, this->_size - offset));
+    ::madvise(const_cast<char*>(this->_data) + start, end - start, adviceForAccess(access));
+#else
+    (void) access;
+    (void) offset;
+    (void) length;
+#endif
+}
+
+const char* MappedFile::data() const {
+    return this->_data;
+}
+
+size_t MappedFile::size() const {
+    return this->_size;
+}
+
+bool MappedFile::isEmpty() const {
+    return this->_size == 0;
+}
+
+bool MappedFile::isMapped() const {
+    return this->_isMapped;
+}
+
+StringView MappedFile::view() const {
+    return StringView(this->_data, this->_size);
+}
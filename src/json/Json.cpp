@@ -0,0 +1,7 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+/**
+ * The Json implementation is header only.
+ */
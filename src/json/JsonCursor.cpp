@@ -0,0 +1,317 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "JsonCursor.hpp"
+#include "Exception.hpp"
+#include "JsonDocument.hpp"
+#include "NumberFormatter.hpp"
+#include <cstring>
+#include <string>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    std::string invalidMessage(const char* what, size_t index) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        return std::string(what).append(digits, NumberFormatter::format(index, digits));
+    }
+
+    bool isWhitespace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    /**
+     * @return The end of the text before an offset, without the whitespace before it.
+     */
+    size_t trimWhitespace(const char* text, size_t offset) {
+        while (offset > 0 && isWhitespace(text[offset - 1])) {
+            --offset;
+        }
+
+        return offset;
+    }
+}
+
+const size_t JsonCursor::NO_POSITION;
+
+JsonCursor::JsonCursor() {
+    this->_index = nullptr;
+    this->_position = 0;
+}
+
+JsonCursor::JsonCursor(const JsonIndex& index) {
+    if (index.size() == 0) throw InvalidValueException("JSON text has no value");
+    this->_index = &index;
+    this->_position = 0;
+}
+
+JsonCursor::JsonCursor(const JsonIndex& index, size_t position) {
+    this->_index = &index;
+    this->_position = position;
+}
+
+char JsonCursor::character(size_t position) const {
+    if (position >= this->_index->size()) throw InvalidValueException("Unexpected end of JSON");
+    return this->_index->text().data()[(*this->_index)[position]];
+}
+
+size_t JsonCursor::skip(size_t position) const {
+    char c = this->character(position);
+    if (c != '{' && c != '[') return position + 1;
+
+    size_t depth = 1;
+    ++position;
+    while (depth != 0) {
+        c = this->character(position);
+        if (c == '{' || c == '[') {
+            ++depth;
+        } else if (c == '}' || c == ']') {
+            --depth;
+        }
+        ++position;
+    }
+
+    return position;
+}
+
+size_t JsonCursor::memberValue(size_t position) const {
+    if (this->character(position) != '"') {
+        throw InvalidValueException(invalidMessage("Expected a key in JSON at index ", (*this->_index)[position]));
+    }
+    if (this->character(position + 1) != ':') {
+        throw InvalidValueException(invalidMessage("Expected ':' in JSON at index ", (*this->_index)[position + 1]));
+    }
+
+    // Checks there is a value after the ':'
+    this->character(position + 2);
+    return position + 2;
+}
+
+size_t JsonCursor::firstChild() const {
+    const char c = this->character(this->_position);
+    if (c != '{' && c != '[') throw InvalidValueException("JSON value isn't an array or object");
+
+    const size_t next = this->_position + 1;
+    if (this->character(next) == (c == '{' ? '}' : ']')) return NO_POSITION;
+    return c == '{' ? this->memberValue(next) : next;
+}
+
+size_t JsonCursor::nextChild(size_t child, bool is_object) const {
+    const size_t next = this->skip(child);
+    const char c = this->character(next);
+
+    if (c == ',') {
+        this->character(next + 1);
+        return is_object ? this->memberValue(next + 1) : next + 1;
+    } else if (c == (is_object ? '}' : ']')) {
+        return NO_POSITION;
+    }
+
+    throw InvalidValueException(invalidMessage(is_object ? "Expected ',' or '}' in JSON at index "
+                                                         : "Expected ',' or ']' in JSON at index ",
+                                               (*this->_index)[next]));
+}
+
+StringView JsonCursor::rawString(size_t position) const {
+    const char* text = this->_index->text().data();
+    const size_t begin = (*this->_index)[position] + 1;
+
+    // The closing quote is the last character before the next structural character, other than whitespace
+    const size_t next = position + 1 < this->_index->size() ? (*this->_index)[position + 1]
+                                                            : this->_index->text().length();
+    const size_t end = trimWhitespace(text, next);
+    if (end <= begin || text[end - 1] != '"') {
+        throw InvalidValueException(invalidMessage("Invalid string in JSON at index ", begin - 1));
+    }
+
+    return StringView(text + begin, end - 1 - begin);
+}
+
+JsonType JsonCursor::type() const {
+    switch (this->character(this->_position)) {
+        case '{': return JsonType::OBJECT;
+        case '[': return JsonType::ARRAY;
+        case '"': return JsonType::STRING;
+        default: return JsonDocument::parseLiteral(*this).type();
+    }
+}
+
+bool JsonCursor::isNull() const {
+    return this->type() == JsonType::NULL_VALUE;
+}
+
+bool JsonCursor::isBool() const {
+    return this->type() == JsonType::BOOLEAN;
+}
+
+bool JsonCursor::isNumber() const {
+    const JsonType type = this->type();
+    return type == JsonType::INTEGER || type == JsonType::DOUBLE;
+}
+
+bool JsonCursor::isString() const {
+    return this->character(this->_position) == '"';
+}
+
+bool JsonCursor::isArray() const {
+    return this->character(this->_position) == '[';
+}
+
+bool JsonCursor::isObject() const {
+    return this->character(this->_position) == '{';
+}
+
+bool JsonCursor::asBool() const {
+    return JsonDocument::parseLiteral(*this).asBool();
+}
+
+int64_t JsonCursor::asInteger() const {
+    return JsonDocument::parseLiteral(*this).asInteger();
+}
+
+uint64_t JsonCursor::asUnsigned() const {
+    return JsonDocument::parseLiteral(*this).asUnsigned();
+}
+
+double JsonCursor::asDouble() const {
+    return JsonDocument::parseLiteral(*this).asDouble();
+}
+
+String JsonCursor::asString() const {
+    const JsonDocument document = JsonDocument(*this);
+    const StringView string = document.root().asString();
+    return String(std::string(string.data(), string.length()));
+}
+
+StringView JsonCursor::raw() const {
+    const char* text = this->_index->text().data();
+    const size_t begin = (*this->_index)[this->_position];
+    const size_t next = this->skip(this->_position);
+
+    size_t end;
+    if (next - this->_position > 1) {
+        end = (*this->_index)[next - 1] + 1;
+    } else {
+        end = trimWhitespace(text, next < this->_index->size() ? (*this->_index)[next] : this->_index->text().length());
+    }
+
+    return StringView(text + begin, end - begin);
+}
+
+size_t JsonCursor::size() const {
+    const bool is_object = this->isObject();
+    size_t count = 0;
+    for (size_t child = this->firstChild(); child != NO_POSITION; child = this->nextChild(child, is_object)) {
+        ++count;
+    }
+
+    return count;
+}
+
+JsonCursor JsonCursor::operator[](size_t index) const {
+    if (!this->isArray()) throw InvalidValueException("JSON value isn't an array");
+
+    size_t count = 0;
+    for (size_t child = this->firstChild(); child != NO_POSITION; child = this->nextChild(child, false)) {
+        if (count++ == index) return JsonCursor(*this->_index, child);
+    }
+
+    throw OutOfBoundsException(index);
+}
+
+JsonCursor JsonCursor::operator[](const StringView& key) const {
+    JsonCursor value;
+    if (!this->find(key, value)) {
+        throw InvalidValueException(std::string("JSON object has no member ").append(key.data(), key.length()));
+    }
+
+    return value;
+}
+
+bool JsonCursor::find(const StringView& key, JsonCursor& value) const {
+    if (!this->isObject()) throw InvalidValueException("JSON value isn't an object");
+
+    std::string unescaped;
+    for (size_t child = this->firstChild(); child != NO_POSITION; child = this->nextChild(child, true)) {
+        StringView member_key = this->rawString(child - 2);
+
+        // Most keys have no escapes and are compared where they are
+        if (std::memchr(member_key.data(), '\\', member_key.length()) != nullptr) {
+            unescaped.resize(member_key.length());
+            unescaped.resize(JsonIndex::unescape(member_key.data(), member_key.data() + member_key.length(),
+                                                 &unescaped[0]));
+            member_key = StringView(unescaped);
+        }
+
+        if (member_key == key) {
+            value = JsonCursor(*this->_index, child);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+String JsonCursor::key() const {
+    if (this->_position < 2 || this->character(this->_position - 1) != ':') {
+        throw InvalidValueException("JSON value isn't a member of an object");
+    }
+
+    const StringView raw_key = this->rawString(this->_position - 2);
+    std::string key = std::string(raw_key.length(), '\0');
+    key.resize(JsonIndex::unescape(raw_key.data(), raw_key.data() + raw_key.length(), &key[0]));
+    return String(std::move(key));
+}
+
+JsonCursor::Iterator JsonCursor::begin() const {
+    return Iterator(*this, false);
+}
+
+JsonCursor::Iterator JsonCursor::end() const {
+    return Iterator(*this, true);
+}
+
+
+// Iterator
+
+JsonCursor::Iterator::Iterator(const JsonCursor& parent, bool end) : _child(parent) {
+    this->_isObject = parent.isObject();
+    if (!this->_isObject && !parent.isArray()) throw InvalidValueException("JSON value isn't an array or object");
+
+    const size_t first = end ? NO_POSITION : parent.firstChild();
+    this->_end = first == NO_POSITION;
+    if (!this->_end) this->_child._position = first;
+}
+
+const JsonCursor& JsonCursor::Iterator::operator*() const {
+    return this->_child;
+}
+
+const JsonCursor* JsonCursor::Iterator::operator->() const {
+    return &this->_child;
+}
+
+JsonCursor::Iterator& JsonCursor::Iterator::operator++() {
+    const size_t next = this->_child.nextChild(this->_child._position, this->_isObject);
+    this->_end = next == NO_POSITION;
+    if (!this->_end) this->_child._position = next;
+    return *this;
+}
+
+JsonCursor::Iterator JsonCursor::Iterator::operator++(int) {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+bool JsonCursor::Iterator::operator==(const Iterator& iterator) const {
+    if (this->_end || iterator._end) return this->_end == iterator._end;
+    return this->_child._position == iterator._child._position;
+}
+
+bool JsonCursor::Iterator::operator!=(const Iterator& iterator) const {
+    return !(*this == iterator);
+}
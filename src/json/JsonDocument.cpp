@@ -0,0 +1,375 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "JsonDocument.hpp"
+#include "Exception.hpp"
+#include "NumberFormatter.hpp"
+#include "NumberParser.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    std::string invalidMessage(const char* what, size_t index) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        return std::string(what).append(digits, NumberFormatter::format(index, digits));
+    }
+
+    bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    /**
+     * An array or object that hasn't been closed yet.
+     */
+    struct Frame {
+        bool isObject;
+
+        /**
+         * Where the container's children start on the parser's stack of values.
+         */
+        size_t start;
+    };
+}
+
+
+// Parser
+
+namespace abraham {
+    namespace details {
+
+        /**
+         * Builds the values of a range of an index.
+         */
+        class JsonParser {
+        protected:
+            const JsonIndex& _index;
+            const char* _text;
+            size_t _length;
+            size_t _position;
+            size_t _end;
+            JsonDocument& _document;
+
+            /**
+             * The finished values whose container hasn't been closed yet.
+             */
+            std::vector<JsonValue> _values;
+
+            std::vector<Frame> _frames;
+
+        public:
+            JsonParser(const JsonIndex& index, size_t begin, size_t end, JsonDocument& document)
+                    : _index(index), _document(document) {
+                this->_text = index.text().data();
+                this->_length = index.text().length();
+                this->_position = begin;
+                this->_end = end;
+            }
+
+            JsonValue parse() {
+                while (true) {
+                    const size_t offset = this->offset();
+                    const char c = this->_text[offset];
+
+                    if (c == '{' || c == '[') {
+                        const bool is_object = c == '{';
+                        ++this->_position;
+                        this->_frames.push_back(Frame{is_object, this->_values.size()});
+
+                        if (this->peek() == (is_object ? '}' : ']')) {
+                            ++this->_position;
+                            this->close();
+                        } else {
+                            if (is_object) this->parseKey();
+                            continue;
+                        }
+                    } else {
+                        this->_values.push_back(this->parseScalar(offset));
+                        ++this->_position;
+                    }
+
+                    // The value is finished, so what follows it either continues or closes the containers it's in
+                    while (true) {
+                        if (this->_frames.empty()) {
+                            if (this->_position != this->_end) {
+                                throw InvalidValueException(invalidMessage("Unexpected character after JSON value at "
+                                                                           "index ", this->_index[this->_position]));
+                            }
+                            return this->_values.back();
+                        }
+
+                        const bool is_object = this->_frames.back().isObject;
+                        const size_t next_offset = this->offset();
+                        const char next = this->_text[next_offset];
+                        ++this->_position;
+
+                        if (next == ',') {
+                            if (is_object) this->parseKey();
+                            break;
+                        } else if (next == (is_object ? '}' : ']')) {
+                            this->close();
+                        } else {
+                            const char* what = is_object ? "Expected ',' or '}' in JSON at index "
+                                                         : "Expected ',' or ']' in JSON at index ";
+                            throw InvalidValueException(invalidMessage(what, next_offset));
+                        }
+                    }
+                }
+            }
+
+        protected:
+            /**
+             * @return The offset of the current structural character.
+             */
+            size_t offset() const {
+                if (this->_position >= this->_end) throw InvalidValueException("Unexpected end of JSON");
+                return this->_index[this->_position];
+            }
+
+            char peek() const {
+                return this->_text[this->offset()];
+            }
+
+            Arena& arena() {
+                if (!this->_document._arena) {
+                    const size_t block_size = std::min(std::max(this->_length, Arena::DEFAULT_BLOCK_SIZE),
+                                                       Arena::MAX_BLOCK_SIZE);
+                    this->_document._arena.reset(new Arena(block_size));
+                }
+
+                return *this->_document._arena;
+            }
+
+            /**
+             * @return true if a number or literal ends before an offset.
+             */
+            static bool endsScalar(const char* text, size_t length, size_t offset) {
+                if (offset == length) return true;
+
+                switch (text[offset]) {
+                    case ' ': case '\t': case '\n': case '\r':
+                    case '{': case '}': case '[': case ']': case ':': case ',': case '"':
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            void parseKey() {
+                const size_t offset = this->offset();
+                if (this->_text[offset] != '"') {
+                    throw InvalidValueException(invalidMessage("Expected a key in JSON at index ", offset));
+                }
+                this->_values.push_back(this->parseString(offset));
+                ++this->_position;
+
+                if (this->peek() != ':') {
+                    throw InvalidValueException(invalidMessage("Expected ':' in JSON at index ", this->offset()));
+                }
+                ++this->_position;
+            }
+
+            void close() {
+                const Frame frame = this->_frames.back();
+                this->_frames.pop_back();
+
+                const size_t count = this->_values.size() - frame.start;
+                JsonValue container = JsonValue();
+                container._type = frame.isObject ? JsonType::OBJECT : JsonType::ARRAY;
+                container._length = frame.isObject ? count / 2 : count;
+
+                if (count != 0) {
+                    JsonValue* children = static_cast<JsonValue*>(this->arena().allocate(count * sizeof(JsonValue),
+                                                                                         alignof(JsonValue)));
+                    std::memcpy(children, this->_values.data() + frame.start, count * sizeof(JsonValue));
+                    container._value.children = children;
+                }
+
+                this->_values.resize(frame.start);
+                this->_values.push_back(container);
+            }
+
+            JsonValue parseScalar(size_t offset) {
+                if (this->_text[offset] == '"') return this->parseString(offset);
+                return parseLiteral(this->_text, this->_length, offset);
+            }
+
+            static bool matches(const char* text, size_t length, size_t offset, const char* literal,
+                                size_t literal_length) {
+                return length - offset >= literal_length && std::memcmp(text + offset, literal, literal_length) == 0 &&
+                       endsScalar(text, length, offset + literal_length);
+            }
+
+            JsonValue parseString(size_t offset) {
+                const char* const begin = this->_text + offset + 1;
+                const char* const end = this->_text + this->_length;
+
+                // The closing quote is found first, so the string can be copied into exactly the room it needs
+                const char* closing = begin;
+                bool is_escaped = false;
+                while (true) {
+                    closing = JsonIndex::findEscapable(closing, end);
+                    if (closing == end) {
+                        throw InvalidValueException(invalidMessage("Unclosed string in JSON at index ", offset));
+                    } else if (*closing == '"') {
+                        break;
+                    } else if (*closing == '\\') {
+                        if (end - closing < 2) {
+                            throw InvalidValueException(invalidMessage("Unclosed string in JSON at index ", offset));
+                        }
+                        is_escaped = true;
+                        closing += 2;
+                    } else {
+                        throw InvalidValueException(invalidMessage("Unescaped control character in JSON at index ",
+                                                                   static_cast<size_t>(closing - this->_text)));
+                    }
+                }
+
+                JsonValue value = JsonValue();
+                value._type = JsonType::STRING;
+                value._value.string = "";
+
+                const size_t length = static_cast<size_t>(closing - begin);
+                if (length != 0) {
+                    char* data = static_cast<char*>(this->arena().allocate(length, 1));
+                    if (is_escaped) {
+                        value._length = JsonIndex::unescape(begin, closing, data);
+                    } else {
+                        std::memcpy(data, begin, length);
+                        value._length = length;
+                    }
+                    value._value.string = data;
+                }
+
+                return value;
+            }
+
+            static JsonValue parseNumber(const char* text, size_t length, size_t offset) {
+                size_t i = offset;
+                bool is_integer = true;
+
+                // NumberParser accepts more than JSON does, so the grammar is checked first
+                if (text[i] == '-') ++i;
+                if (i < length && text[i] == '0') {
+                    ++i;
+                } else if (i < length && isDigit(text[i])) {
+                    while (i < length && isDigit(text[i])) ++i;
+                } else {
+                    throw InvalidValueException(invalidMessage("Invalid number in JSON at index ", offset));
+                }
+
+                if (i < length && text[i] == '.') {
+                    is_integer = false;
+                    ++i;
+                    if (i == length || !isDigit(text[i])) {
+                        throw InvalidValueException(invalidMessage("Invalid number in JSON at index ", offset));
+                    }
+                    while (i < length && isDigit(text[i])) ++i;
+                }
+
+                if (i < length && (text[i] == 'e' || text[i] == 'E')) {
+                    is_integer = false;
+                    ++i;
+                    if (i < length && (text[i] == '+' || text[i] == '-')) ++i;
+                    if (i == length || !isDigit(text[i])) {
+                        throw InvalidValueException(invalidMessage("Invalid number in JSON at index ", offset));
+                    }
+                    while (i < length && isDigit(text[i])) ++i;
+                }
+
+                if (!endsScalar(text, length, i)) {
+                    throw InvalidValueException(invalidMessage("Invalid number in JSON at index ", offset));
+                }
+
+                const StringView number = StringView(text + offset, i - offset);
+                JsonValue value = JsonValue();
+
+                // An integer too large for 64 bits is kept as a double, as most JSON implementations do
+                long long integer;
+                if (is_integer && NumberParser::parseValue(number, integer) == ParseError::NONE) {
+                    value._type = JsonType::INTEGER;
+                    value._value.integer = integer;
+                    return value;
+                }
+
+                // Integers above INT64_MAX still fit in 64 bits unsigned
+                unsigned long long unsigned_integer;
+                if (is_integer && text[offset] != '-' &&
+                    NumberParser::parseValue(number, unsigned_integer) == ParseError::NONE) {
+                    value._type = JsonType::INTEGER;
+                    value._isUnsigned = true;
+                    value._value.unsignedInteger = unsigned_integer;
+                    return value;
+                }
+
+                double real;
+                if (NumberParser::parseValue(number, real) != ParseError::NONE) {
+                    throw InvalidValueException(invalidMessage("Number out of range in JSON at index ", offset));
+                }
+                value._type = JsonType::DOUBLE;
+                value._value.number = real;
+                return value;
+            }
+
+        public:
+            /**
+             * Parses a number, boolean or null, none of which need the document's storage.
+             * @param text - The JSON text.
+             * @param length - The length of the text.
+             * @param offset - The offset of the value's first character.
+             */
+            static JsonValue parseLiteral(const char* text, size_t length, size_t offset) {
+                const char c = text[offset];
+                if (c == '-' || isDigit(c)) return parseNumber(text, length, offset);
+
+                JsonValue value = JsonValue();
+                if (matches(text, length, offset, "true", 4)) {
+                    value._type = JsonType::BOOLEAN;
+                    value._value.boolean = true;
+                } else if (matches(text, length, offset, "false", 5)) {
+                    value._type = JsonType::BOOLEAN;
+                    value._value.boolean = false;
+                } else if (!matches(text, length, offset, "null", 4)) {
+                    throw InvalidValueException(invalidMessage("Unexpected character in JSON at index ", offset));
+                }
+
+                return value;
+            }
+        };
+    }
+}
+
+
+// JsonDocument
+
+JsonDocument::JsonDocument(const StringView& text) {
+    const JsonIndex index = JsonIndex(text);
+    if (index.size() == 0) throw InvalidValueException("JSON text has no value");
+    this->_root = details::JsonParser(index, 0, index.size(), *this).parse();
+}
+
+JsonDocument::JsonDocument(const JsonCursor& value) {
+    if (value._index == nullptr) throw InvalidValueException("JsonCursor isn't at a value");
+    const size_t end = value.skip(value._position);
+    this->_root = details::JsonParser(*value._index, value._position, end, *this).parse();
+}
+
+JsonValue JsonDocument::parseLiteral(const JsonCursor& value) {
+    if (value._index == nullptr) throw InvalidValueException("JsonCursor isn't at a value");
+
+    const char c = value.character(value._position);
+    if (c == '{' || c == '[' || c == '"') throw InvalidValueException("JSON value isn't a number, boolean or null");
+
+    const StringView text = value._index->text();
+    return details::JsonParser::parseLiteral(text.data(), text.length(), (*value._index)[value._position]);
+}
+
+const JsonValue& JsonDocument::root() const {
+    return this->_root;
+}
@@ -0,0 +1,383 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "JsonIndex.hpp"
+#include "Exception.hpp"
+#include "NumberFormatter.hpp"
+#include "Utf8.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#if defined(__AVX2__) || defined(__PCLMUL__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    const size_t BLOCK_SIZE = 64;
+
+    /**
+     * The characters of a block of text that the index is built from, a bit per character.
+     */
+    struct BlockMasks {
+        uint64_t quotes;
+        uint64_t backslashes;
+        uint64_t operators;
+        uint64_t whitespace;
+    };
+
+#if defined(__AVX2__)
+    void classify(const char* block, BlockMasks& masks) {
+        masks = BlockMasks{0, 0, 0, 0};
+        for (size_t half = 0; half < 2; ++half) {
+            const __m256i characters = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * half));
+
+            // Setting the 0x20 bit turns '[' and ']' into '{' and '}', so four brackets take two comparisons
+            const __m256i folded = _mm256_or_si256(characters, _mm256_set1_epi8(0x20));
+            const __m256i operators = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')),
+                                    _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+                    _mm256_or_si256(_mm256_cmpeq_epi8(characters, _mm256_set1_epi8(':')),
+                                    _mm256_cmpeq_epi8(characters, _mm256_set1_epi8(','))));
+            const __m256i whitespace = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_cmpeq_epi8(characters, _mm256_set1_epi8(' ')),
+                                    _mm256_cmpeq_epi8(characters, _mm256_set1_epi8('\t'))),
+                    _mm256_or_si256(_mm256_cmpeq_epi8(characters, _mm256_set1_epi8('\n')),
+                                    _mm256_cmpeq_epi8(characters, _mm256_set1_epi8('\r'))));
+
+            const size_t shift = 32 * half;
+            masks.quotes |= static_cast<uint64_t>(static_cast<uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(characters, _mm256_set1_epi8('"'))))) << shift;
+            masks.backslashes |= static_cast<uint64_t>(static_cast<uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(characters, _mm256_set1_epi8('\\'))))) << shift;
+            masks.operators |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(operators))) << shift;
+            masks.whitespace |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(whitespace))) << shift;
+        }
+    }
+#elif defined(__SSE2__)
+    void classify(const char* block, BlockMasks& masks) {
+        masks = BlockMasks{0, 0, 0, 0};
+        for (size_t quarter = 0; quarter < 4; ++quarter) {
+            const __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * quarter));
+
+            // Setting the 0x20 bit turns '[' and ']' into '{' and '}', so four brackets take two comparisons
+            const __m128i folded = _mm_or_si128(characters, _mm_set1_epi8(0x20));
+            const __m128i operators = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                                 _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+                    _mm_or_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8(':')),
+                                 _mm_cmpeq_epi8(characters, _mm_set1_epi8(','))));
+            const __m128i whitespace = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8(' ')),
+                                 _mm_cmpeq_epi8(characters, _mm_set1_epi8('\t'))),
+                    _mm_or_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8('\n')),
+                                 _mm_cmpeq_epi8(characters, _mm_set1_epi8('\r'))));
+
+            const size_t shift = 16 * quarter;
+            masks.quotes |= static_cast<uint64_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(characters, _mm_set1_epi8('"')))) << shift;
+            masks.backslashes |= static_cast<uint64_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(characters, _mm_set1_epi8('\\')))) << shift;
+            masks.operators |= static_cast<uint64_t>(_mm_movemask_epi8(operators)) << shift;
+            masks.whitespace |= static_cast<uint64_t>(_mm_movemask_epi8(whitespace)) << shift;
+        }
+    }
+#else
+    void classify(const char* block, BlockMasks& masks) {
+        masks = BlockMasks{0, 0, 0, 0};
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            const uint64_t bit = 1ULL << i;
+            switch (block[i]) {
+                case '"': masks.quotes |= bit; break;
+                case '\\': masks.backslashes |= bit; break;
+                case '{': case '}': case '[': case ']': case ':': case ',': masks.operators |= bit; break;
+                case ' ': case '\t': case '\n': case '\r': masks.whitespace |= bit; break;
+                default: break;
+            }
+        }
+    }
+#endif
+
+    /**
+     * Finds the characters escaped by a backslash: those after a run of backslashes of odd length. Runs starting on
+     * even and odd bits are added to separately, so each run's carry lands on the character after it, and that
+     * character's bit says whether the run's length was odd.
+     * @param backslashes - The backslashes of a block.
+     * @param carry - Whether the previous block ended in an unfinished escape. Updated for the next block.
+     * @return The escaped characters of the block.
+     */
+    uint64_t escapedCharacters(uint64_t backslashes, uint64_t& carry) {
+        if (backslashes == 0 && carry == 0) return 0;
+
+        const uint64_t EVEN_BITS = 0x5555555555555555ULL;
+        const uint64_t ODD_BITS = ~EVEN_BITS;
+
+        const uint64_t starts = backslashes & ~(backslashes << 1);
+        const uint64_t even_start_mask = EVEN_BITS ^ carry;
+        const uint64_t even_starts = starts & even_start_mask;
+        const uint64_t odd_starts = starts & ~even_start_mask;
+
+        const uint64_t even_carries = backslashes + even_starts;
+        unsigned long long odd_carries;
+        const bool ends_in_escape = __builtin_uaddll_overflow(backslashes, odd_starts, &odd_carries);
+        odd_carries |= carry;
+        carry = ends_in_escape ? 1 : 0;
+
+        const uint64_t even_carry_ends = even_carries & ~backslashes;
+        const uint64_t odd_carry_ends = odd_carries & ~backslashes;
+        return (even_carry_ends & ODD_BITS) | (odd_carry_ends & EVEN_BITS);
+    }
+
+    /**
+     * @return Each bit set to the XOR of itself and every bit below it, which for quotes is set from an opening
+     * quote up to, but not including, its closing quote.
+     */
+    uint64_t prefixXor(uint64_t bits) {
+#if defined(__PCLMUL__)
+        const __m128i product = _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<long long>(bits)),
+                                                     _mm_set1_epi8(-1), 0);
+        return static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+#else
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+        return bits;
+#endif
+    }
+
+    std::string invalidMessage(const char* what, size_t index) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        return std::string(what).append(digits, NumberFormatter::format(index, digits));
+    }
+
+    /**
+     * @return The value of a hex digit, or -1 if it isn't one.
+     */
+    int digitValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+
+        const char lowercase = static_cast<char>(c | 0x20);
+        if (lowercase >= 'a' && lowercase <= 'f') return lowercase - 'a' + 10;
+        return -1;
+    }
+
+    /**
+     * Reads the four hex digits of a \\u escape.
+     * @return The code unit, or -1 if there aren't four hex digits.
+     */
+    long readCodeUnit(const char* digits, const char* end) {
+        if (end - digits < 4) return -1;
+
+        long value = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            const int digit = digitValue(digits[i]);
+            if (digit < 0) return -1;
+            value = (value << 4) | digit;
+        }
+
+        return value;
+    }
+
+    /**
+     * Writes a code point as UTF-8.
+     * @return The number of characters written.
+     */
+    size_t writeUtf8(unsigned long code_point, char* output) {
+        if (code_point < 0x80) {
+            output[0] = static_cast<char>(code_point);
+            return 1;
+        } else if (code_point < 0x800) {
+            output[0] = static_cast<char>(0xC0 | (code_point >> 6));
+            output[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 2;
+        } else if (code_point < 0x10000) {
+            output[0] = static_cast<char>(0xE0 | (code_point >> 12));
+            output[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            output[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 3;
+        } else {
+            output[0] = static_cast<char>(0xF0 | (code_point >> 18));
+            output[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            output[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            output[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 4;
+        }
+    }
+}
+
+const size_t JsonIndex::MAX_LENGTH;
+
+JsonIndex::JsonIndex(const StringView& text) {
+    if (text.length() > MAX_LENGTH) throw InvalidValueException("JSON text is too long to index");
+
+    const size_t valid_length = Utf8::validLength(text.data(), text.length());
+    if (valid_length != text.length()) throw InvalidValueException(invalidMessage("Invalid UTF-8 in JSON at index ",
+                                                                                  valid_length));
+
+    this->_text = text;
+    const char* const data = text.data();
+    const size_t length = text.length();
+
+    uint64_t escape_carry = 0;
+    uint64_t string_carry = 0;
+    uint64_t scalar_carry = 0;
+    size_t last_string_start = 0;
+    size_t count = 0;
+
+    for (size_t offset = 0; offset < length; offset += BLOCK_SIZE) {
+        // The last partial block is padded with whitespace, which ends a number or literal and adds nothing
+        const char* block = data + offset;
+        char padded[BLOCK_SIZE];
+        if (length - offset < BLOCK_SIZE) {
+            std::memset(padded, ' ', BLOCK_SIZE);
+            std::memcpy(padded, block, length - offset);
+            block = padded;
+        }
+
+        BlockMasks masks;
+        classify(block, masks);
+
+        const uint64_t quotes = masks.quotes & ~escapedCharacters(masks.backslashes, escape_carry);
+        const uint64_t in_string = prefixXor(quotes) ^ string_carry;
+        string_carry = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+        // A closing quote isn't inside its string, but isn't outside of it either
+        const uint64_t outside = ~in_string & ~quotes;
+        const uint64_t string_starts = quotes & in_string;
+        const uint64_t scalars = outside & ~masks.operators & ~masks.whitespace;
+        const uint64_t scalar_starts = scalars & ~((scalars << 1) | scalar_carry);
+        scalar_carry = scalars >> 63;
+
+        uint64_t structurals = (masks.operators & outside) | string_starts | scalar_starts;
+        if (string_starts != 0) last_string_start = offset + 63 - static_cast<size_t>(__builtin_clzll(string_starts));
+
+        // Room for a whole block is made first, so the bits are written out without a check for each
+        if (this->_positions.size() < count + BLOCK_SIZE) {
+            this->_positions.resize(std::max(this->_positions.size() * 2, count + BLOCK_SIZE));
+        }
+
+        uint32_t* output = this->_positions.data() + count;
+        while (structurals != 0) {
+            *output++ = static_cast<uint32_t>(offset + static_cast<size_t>(__builtin_ctzll(structurals)));
+            structurals &= structurals - 1;
+        }
+        count = static_cast<size_t>(output - this->_positions.data());
+    }
+
+    if (string_carry != 0) throw InvalidValueException(invalidMessage("Unclosed string in JSON at index ",
+                                                                      last_string_start));
+    this->_positions.resize(count);
+}
+
+const char* JsonIndex::findEscapable(const char* begin, const char* end) {
+    const char* position = begin;
+
+#if defined(__AVX2__)
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i last_control = _mm256_set1_epi8(0x1F);
+    while (end - position >= 32) {
+        const __m256i characters = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(position));
+        const __m256i matches = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(characters, quote), _mm256_cmpeq_epi8(characters, backslash)),
+                _mm256_cmpeq_epi8(_mm256_min_epu8(characters, last_control), characters));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+        if (mask != 0) return position + __builtin_ctz(mask);
+        position += 32;
+    }
+#elif defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i last_control = _mm_set1_epi8(0x1F);
+    while (end - position >= 16) {
+        const __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+        const __m128i matches = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(characters, quote), _mm_cmpeq_epi8(characters, backslash)),
+                _mm_cmpeq_epi8(_mm_min_epu8(characters, last_control), characters));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+        if (mask != 0) return position + __builtin_ctz(mask);
+        position += 16;
+    }
+#endif
+
+    while (position < end) {
+        const unsigned char c = static_cast<unsigned char>(*position);
+        if (c == '"' || c == '\\' || c < 0x20) break;
+        ++position;
+    }
+
+    return position;
+}
+
+size_t JsonIndex::unescape(const char* begin, const char* end, char* output) {
+    char* written = output;
+    const char* position = begin;
+
+    while (true) {
+        const char* special = findEscapable(position, end);
+        std::memcpy(written, position, static_cast<size_t>(special - position));
+        written += special - position;
+        if (special == end) break;
+
+        if (*special != '\\') throw InvalidValueException("Unescaped control character or quote in JSON string");
+        if (end - special < 2) throw InvalidValueException("Incomplete escape in JSON string");
+
+        position = special + 2;
+        switch (special[1]) {
+            case '"': *written++ = '"'; break;
+            case '\\': *written++ = '\\'; break;
+            case '/': *written++ = '/'; break;
+            case 'b': *written++ = '\b'; break;
+            case 'f': *written++ = '\f'; break;
+            case 'n': *written++ = '\n'; break;
+            case 'r': *written++ = '\r'; break;
+            case 't': *written++ = '\t'; break;
+            case 'u': {
+                const long unit = readCodeUnit(position, end);
+                if (unit < 0) throw InvalidValueException("Invalid \\u escape in JSON string");
+                position += 4;
+
+                unsigned long code_point = static_cast<unsigned long>(unit);
+                if (unit >= 0xDC00 && unit <= 0xDFFF) {
+                    throw InvalidValueException("Unpaired surrogate in JSON string");
+                } else if (unit >= 0xD800 && unit <= 0xDBFF) {
+                    // Characters outside the basic multilingual plane are escaped as a UTF-16 surrogate pair
+                    const long low = end - position >= 2 && position[0] == '\\' && position[1] == 'u'
+                                     ? readCodeUnit(position + 2, end) : -1;
+                    if (low < 0xDC00 || low > 0xDFFF) throw InvalidValueException("Unpaired surrogate in JSON string");
+                    position += 6;
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + static_cast<unsigned long>(low - 0xDC00);
+                }
+
+                written += writeUtf8(code_point, written);
+                break;
+            }
+            default:
+                throw InvalidValueException("Invalid escape in JSON string");
+        }
+    }
+
+    return static_cast<size_t>(written - output);
+}
+
+const StringView& JsonIndex::text() const {
+    return this->_text;
+}
+
+uint32_t JsonIndex::operator[](size_t index) const {
+    return this->_positions[index];
+}
+
+size_t JsonIndex::size() const {
+    return this->_positions.size();
+}
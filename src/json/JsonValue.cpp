@@ -0,0 +1,159 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "JsonValue.hpp"
+#include "Exception.hpp"
+#include <string>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    const char* typeName(JsonType type) {
+        switch (type) {
+            case JsonType::NULL_VALUE: return "null";
+            case JsonType::BOOLEAN: return "a boolean";
+            case JsonType::INTEGER: return "an integer";
+            case JsonType::DOUBLE: return "a double";
+            case JsonType::STRING: return "a string";
+            case JsonType::ARRAY: return "an array";
+            case JsonType::OBJECT: return "an object";
+        }
+
+        return "unknown";
+    }
+}
+
+JsonValue::JsonValue() {
+    this->_type = JsonType::NULL_VALUE;
+    this->_isUnsigned = false;
+    this->_length = 0;
+    this->_value.children = nullptr;
+}
+
+void JsonValue::checkType(JsonType type, const char* name) const {
+    if (this->_type != type) {
+        throw InvalidValueException(std::string("JSON value is ") + typeName(this->_type) + ", not " + name);
+    }
+}
+
+JsonType JsonValue::type() const {
+    return this->_type;
+}
+
+bool JsonValue::isNull() const {
+    return this->_type == JsonType::NULL_VALUE;
+}
+
+bool JsonValue::isBool() const {
+    return this->_type == JsonType::BOOLEAN;
+}
+
+bool JsonValue::isInteger() const {
+    return this->_type == JsonType::INTEGER;
+}
+
+bool JsonValue::isUnsigned() const {
+    return this->_type == JsonType::INTEGER && this->_isUnsigned;
+}
+
+bool JsonValue::isDouble() const {
+    return this->_type == JsonType::DOUBLE;
+}
+
+bool JsonValue::isNumber() const {
+    return this->_type == JsonType::INTEGER || this->_type == JsonType::DOUBLE;
+}
+
+bool JsonValue::isString() const {
+    return this->_type == JsonType::STRING;
+}
+
+bool JsonValue::isArray() const {
+    return this->_type == JsonType::ARRAY;
+}
+
+bool JsonValue::isObject() const {
+    return this->_type == JsonType::OBJECT;
+}
+
+bool JsonValue::asBool() const {
+    this->checkType(JsonType::BOOLEAN, "a boolean");
+    return this->_value.boolean;
+}
+
+int64_t JsonValue::asInteger() const {
+    this->checkType(JsonType::INTEGER, "an integer");
+    if (this->_isUnsigned) throw InvalidValueException("JSON integer is too large for int64_t");
+    return this->_value.integer;
+}
+
+uint64_t JsonValue::asUnsigned() const {
+    this->checkType(JsonType::INTEGER, "an integer");
+    if (this->_isUnsigned) return this->_value.unsignedInteger;
+    if (this->_value.integer < 0) throw InvalidValueException("JSON integer is negative");
+    return static_cast<uint64_t>(this->_value.integer);
+}
+
+double JsonValue::asDouble() const {
+    if (this->_type == JsonType::INTEGER) {
+        return this->_isUnsigned ? static_cast<double>(this->_value.unsignedInteger)
+                                 : static_cast<double>(this->_value.integer);
+    }
+    this->checkType(JsonType::DOUBLE, "a number");
+    return this->_value.number;
+}
+
+StringView JsonValue::asString() const {
+    this->checkType(JsonType::STRING, "a string");
+    return StringView(this->_value.string, this->_length);
+}
+
+size_t JsonValue::size() const {
+    if (this->_type != JsonType::OBJECT) this->checkType(JsonType::ARRAY, "an array or object");
+    return this->_length;
+}
+
+const JsonValue& JsonValue::operator[](size_t index) const {
+    this->checkType(JsonType::ARRAY, "an array");
+    if (index >= this->_length) throw OutOfBoundsException(index);
+    return this->_value.children[index];
+}
+
+const JsonValue& JsonValue::operator[](const StringView& key) const {
+    const JsonValue* value = this->find(key);
+    if (value == nullptr) {
+        throw InvalidValueException(std::string("JSON object has no member ").append(key.data(), key.length()));
+    }
+
+    return *value;
+}
+
+const JsonValue* JsonValue::find(const StringView& key) const {
+    this->checkType(JsonType::OBJECT, "an object");
+
+    for (size_t i = 0; i < this->_length; ++i) {
+        const JsonValue& member_key = this->_value.children[2 * i];
+        if (member_key.asString() == key) return &this->_value.children[2 * i + 1];
+    }
+
+    return nullptr;
+}
+
+bool JsonValue::containsKey(const StringView& key) const {
+    return this->find(key) != nullptr;
+}
+
+StringView JsonValue::key(size_t index) const {
+    this->checkType(JsonType::OBJECT, "an object");
+    if (index >= this->_length) throw OutOfBoundsException(index);
+    return this->_value.children[2 * index].asString();
+}
+
+const JsonValue& JsonValue::value(size_t index) const {
+    this->checkType(JsonType::OBJECT, "an object");
+    if (index >= this->_length) throw OutOfBoundsException(index);
+    return this->_value.children[2 * index + 1];
+}
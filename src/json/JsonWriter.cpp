@@ -0,0 +1,249 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "JsonWriter.hpp"
+#include "Exception.hpp"
+#include "JsonIndex.hpp"
+#include "NumberFormatter.hpp"
+#include <cmath>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    const char HEX_DIGITS[] = "0123456789abcdef";
+}
+
+JsonWriter::JsonWriter(size_t capacity) {
+    this->_output.reserve(capacity);
+    this->_hasValue = false;
+    this->_hasKey = false;
+}
+
+void JsonWriter::beginValue() {
+    if (this->_isObject.empty()) {
+        if (this->_hasValue) throw InvalidArgumentException("JSON document already has a value");
+    } else if (this->_isObject.back()) {
+        if (!this->_hasKey) throw InvalidArgumentException("JSON object member has no key");
+        this->_hasKey = false;
+    } else if (this->_hasValue) {
+        this->_output.push_back(',');
+    }
+
+    this->_hasValue = true;
+}
+
+void JsonWriter::appendString(const StringView& string) {
+    const char* position = string.data();
+    const char* const end = position + string.length();
+
+    this->_output.push_back('"');
+    while (true) {
+        const char* special = JsonIndex::findEscapable(position, end);
+        this->_output.append(position, static_cast<size_t>(special - position));
+        if (special == end) break;
+
+        switch (*special) {
+            case '"': this->_output.append("\\\"", 2); break;
+            case '\\': this->_output.append("\\\\", 2); break;
+            case '\b': this->_output.append("\\b", 2); break;
+            case '\f': this->_output.append("\\f", 2); break;
+            case '\n': this->_output.append("\\n", 2); break;
+            case '\r': this->_output.append("\\r", 2); break;
+            case '\t': this->_output.append("\\t", 2); break;
+            default: {
+                const char escape[] = {'\\', 'u', '0', '0', HEX_DIGITS[(*special >> 4) & 0x0F],
+                                       HEX_DIGITS[*special & 0x0F]};
+                this->_output.append(escape, sizeof(escape));
+                break;
+            }
+        }
+        position = special + 1;
+    }
+    this->_output.push_back('"');
+}
+
+template<typename T>
+JsonWriter& JsonWriter::appendNumber(T value) {
+    this->beginValue();
+
+    const size_t length = this->_output.length();
+    this->_output.resize(length + NumberFormatter::MAX_LENGTH);
+    this->_output.resize(length + NumberFormatter::format(value, &this->_output[length]));
+    return *this;
+}
+
+template<typename T>
+JsonWriter& JsonWriter::appendFloatingPoint(T value) {
+    if (!std::isfinite(value)) throw InvalidArgumentException("JSON can't represent infinity or NaN");
+    this->beginValue();
+
+    const size_t length = this->_output.length();
+    this->_output.resize(length + NumberFormatter::MAX_LENGTH);
+    this->_output.resize(length + NumberFormatter::format(value, &this->_output[length]));
+
+    // Without a fraction or exponent the number would read back as an integer, and -0.0 as 0
+    if (this->_output.find_first_of(".e", length) == std::string::npos) this->_output.append(".0");
+    return *this;
+}
+
+JsonWriter& JsonWriter::beginObject() {
+    this->beginValue();
+    this->_output.push_back('{');
+    this->_isObject.push_back(true);
+    this->_hasValue = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::endObject() {
+    if (this->_isObject.empty() || !this->_isObject.back()) throw InvalidArgumentException("No JSON object to end");
+    if (this->_hasKey) throw InvalidArgumentException("JSON object member has no value");
+
+    this->_output.push_back('}');
+    this->_isObject.pop_back();
+    this->_hasValue = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::beginArray() {
+    this->beginValue();
+    this->_output.push_back('[');
+    this->_isObject.push_back(false);
+    this->_hasValue = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::endArray() {
+    if (this->_isObject.empty() || this->_isObject.back()) throw InvalidArgumentException("No JSON array to end");
+
+    this->_output.push_back(']');
+    this->_isObject.pop_back();
+    this->_hasValue = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(const StringView& name) {
+    if (this->_isObject.empty() || !this->_isObject.back()) throw InvalidArgumentException("No JSON object for key");
+    if (this->_hasKey) throw InvalidArgumentException("JSON object member has no value");
+
+    if (this->_hasValue) this->_output.push_back(',');
+    this->appendString(name);
+    this->_output.push_back(':');
+    this->_hasValue = true;
+    this->_hasKey = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::null() {
+    this->beginValue();
+    this->_output.append("null", 4);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool value) {
+    this->beginValue();
+    if (value) {
+        this->_output.append("true", 4);
+    } else {
+        this->_output.append("false", 5);
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(int value) {
+    return this->appendNumber(value);
+}
+
+JsonWriter& JsonWriter::value(long value) {
+    return this->appendNumber(value);
+}
+
+JsonWriter& JsonWriter::value(long long value) {
+    return this->appendNumber(value);
+}
+
+JsonWriter& JsonWriter::value(unsigned value) {
+    return this->appendNumber(value);
+}
+
+JsonWriter& JsonWriter::value(unsigned long value) {
+    return this->appendNumber(value);
+}
+
+JsonWriter& JsonWriter::value(unsigned long long value) {
+    return this->appendNumber(value);
+}
+
+JsonWriter& JsonWriter::value(float value) {
+    return this->appendFloatingPoint(value);
+}
+
+JsonWriter& JsonWriter::value(double value) {
+    return this->appendFloatingPoint(value);
+}
+
+JsonWriter& JsonWriter::value(const char* value) {
+    return this->value(StringView(value));
+}
+
+JsonWriter& JsonWriter::value(const StringView& value) {
+    this->beginValue();
+    this->appendString(value);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(const JsonValue& value) {
+    switch (value.type()) {
+        case JsonType::NULL_VALUE:
+            return this->null();
+        case JsonType::BOOLEAN:
+            return this->value(value.asBool());
+        case JsonType::INTEGER:
+            if (value.isUnsigned()) return this->value(static_cast<unsigned long long>(value.asUnsigned()));
+            return this->value(static_cast<long long>(value.asInteger()));
+        case JsonType::DOUBLE:
+            return this->value(value.asDouble());
+        case JsonType::STRING:
+            return this->value(value.asString());
+        case JsonType::ARRAY:
+            this->beginArray();
+            for (size_t i = 0; i < value.size(); ++i) {
+                this->value(value[i]);
+            }
+            return this->endArray();
+        case JsonType::OBJECT:
+            this->beginObject();
+            for (size_t i = 0; i < value.size(); ++i) {
+                this->key(value.key(i)).value(value.value(i));
+            }
+            return this->endObject();
+    }
+
+    return *this;
+}
+
+StringView JsonWriter::view() const {
+    return StringView(this->_output);
+}
+
+bool JsonWriter::isComplete() const {
+    return this->_isObject.empty() && this->_hasValue;
+}
+
+String JsonWriter::build() {
+    if (!this->isComplete()) throw InvalidArgumentException("JSON document isn't complete");
+
+    String result = String(std::move(this->_output));
+    this->clear();
+    return result;
+}
+
+JsonWriter& JsonWriter::clear() {
+    this->_output.clear();
+    this->_isObject.clear();
+    this->_hasValue = false;
+    this->_hasKey = false;
+    return *this;
+}
@@ -12,5 +12,6 @@ DevelopmentLogger::DevelopmentLogger(LogLevel level) {
 }
 
 String DevelopmentLogger::getLogMessage(const LogEntry& entry) const {
-    return String(entry.timeString + " " + entry.file + ":" + std::to_string(entry.line) + " " + entry.function + " [" + stringForLogLevel(entry.logLevel) + "] " + entry.message);
+    return String::format(ABRAHAM_FORMAT("{} {}:{} {} [{}] {}"), entry.timeString, entry.file, entry.line,
+                          entry.function, stringForLogLevel(entry.logLevel), entry.message);
 }
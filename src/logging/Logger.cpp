@@ -3,6 +3,8 @@
 //
 
 #include "Logger.hpp"
+#include "StaticMap.hpp"
+#include "StringBuilder.hpp"
 #include <TerminalUtil.hpp>
 #include <ctime>
 #include <thread>
@@ -10,6 +12,25 @@
 using namespace abraham;
 
 
+namespace {
+    /**
+     * The String representation of each log level, built at compile time.
+     */
+    constexpr auto LOG_LEVEL_NAMES = makeStaticMap<LogLevel, const char*>({
+        {LogLevel::ALL, "ALL"},
+        {LogLevel::TRACE, "TRACE"},
+        {LogLevel::DEBUG, "DEBUG"},
+        {LogLevel::INFO, "INFO"},
+        {LogLevel::NOTICE, "NOTICE"},
+        {LogLevel::WARNING, "WARNING"},
+        {LogLevel::ERROR, "ERROR"},
+        {LogLevel::CRITICAL, "CRITICAL"},
+        {LogLevel::ALERT, "ALERT"},
+        {LogLevel::FATAL, "FATAL"},
+        {LogLevel::OFF, "OFF"}
+    });
+}
+
 SharedPtr<Logger> Logger::_sharedInstance = nullptr;
 
 SharedPtr<Logger> Logger::sharedInstance() {
@@ -90,7 +111,10 @@ bool Logger::shouldWrite(LogLevel level) const {
 }
 
 String Logger::getLogMessage(const LogEntry& entry) const {
-    return String(entry.timeString + " [" + stringForLogLevel(entry.logLevel) + "] " + entry.message);
+    const String level = stringForLogLevel(entry.logLevel);
+    StringBuilder builder = StringBuilder(entry.timeString.length() + level.length() + entry.message.length() + 4);
+    builder.append(entry.timeString).append(" [").append(level).append("] ").append(entry.message);
+    return builder.build();
 }
 
 void Logger::write(const LogEntry& entry) const {
@@ -175,38 +199,5 @@ void Logger::setLogLevel(LogLevel level) {
 }
 
 String Logger::stringForLogLevel(LogLevel level) const {
-    switch (level) {
-        case LogLevel::ALL:
-            return "ALL";
-
-        case LogLevel::TRACE:
-            return "TRACE";
-
-        case LogLevel::DEBUG:
-            return "DEBUG";
-
-        case LogLevel::INFO:
-            return "INFO";
-
-        case LogLevel::NOTICE:
-            return "NOTICE";
-
-        case LogLevel::WARNING:
-            return "WARNING";
-
-        case LogLevel::ERROR:
-            return "ERROR";
-
-        case LogLevel::CRITICAL:
-            return "CRITICAL";
-
-        case LogLevel::ALERT:
-            return "ALERT";
-
-        case LogLevel::FATAL:
-            return "FATAL";
-
-        case LogLevel::OFF:
-            return "OFF";
-    }
+    return LOG_LEVEL_NAMES.objectForKey(level, "");
 }
@@ -3,6 +3,7 @@
 //
 
 #include "SimpleLogger.hpp"
+#include "StringBuilder.hpp"
 
 using namespace abraham;
 
@@ -12,5 +13,8 @@ SimpleLogger::SimpleLogger(LogLevel level) {
 }
 
 String SimpleLogger::getLogMessage(const LogEntry& entry) const {
-    return String(String("[") + stringForLogLevel(entry.logLevel) + "] " + entry.message);
+    const String level = stringForLogLevel(entry.logLevel);
+    StringBuilder builder = StringBuilder(level.length() + entry.message.length() + 3);
+    builder.append('[').append(level).append("] ").append(entry.message);
+    return builder.build();
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Arena.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+using namespace abraham;
+
+
+namespace {
+    /**
+     * @return The number of bytes to skip from an address to reach the alignment.
+     */
+    size_t padding(const char* address, size_t alignment) {
+        return (alignment - (reinterpret_cast<uintptr_t>(address) & (alignment - 1))) & (alignment - 1);
+    }
+}
+
+const size_t Arena::DEFAULT_BLOCK_SIZE;
+const size_t Arena::MAX_BLOCK_SIZE;
+
+Arena::Arena(size_t block_size) {
+    this->_current = 0;
+    this->_used = 0;
+    this->_usedBefore = 0;
+    this->_nextBlockSize = std::max<size_t>(block_size, 64);
+}
+
+Arena::~Arena() {
+    for (const Block& block : this->_blocks) {
+        ::operator delete(block.data);
+    }
+}
+
+void Arena::advance(size_t size, size_t alignment) {
+    // The worst case padding, since a block's address isn't known until it's chosen
+    const size_t needed = size + alignment - 1;
+    size_t next = this->_blocks.empty() ? 0 : this->_current + 1;
+
+    while (next < this->_blocks.size() && this->_blocks[next].size < needed) {
+        ++next;
+    }
+
+    if (next == this->_blocks.size()) {
+        const size_t block_size = std::max(this->_nextBlockSize, needed);
+        this->_blocks.push_back(Block{static_cast<char*>(::operator new(block_size)), block_size});
+        this->_nextBlockSize = std::min(this->_nextBlockSize * 2, MAX_BLOCK_SIZE);
+    } else if (next != this->_current + 1) {
+        // Keep the blocks in the order they're used, so a reset reuses them the same way
+        std::rotate(this->_blocks.begin() + this->_current + 1, this->_blocks.begin() + next,
+                    this->_blocks.begin() + next + 1);
+        next = this->_current + 1;
+    }
+
+    if (!this->_blocks.empty() && next != 0) this->_usedBefore += this->_used;
+    this->_current = next;
+    this->_used = 0;
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    if (!this->_blocks.empty()) {
+        const Block& block = this->_blocks[this->_current];
+        const size_t offset = this->_used + padding(block.data + this->_used, alignment);
+        if (offset <= block.size && size <= block.size - offset) {
+            this->_used = offset + size;
+            return block.data + offset;
+        }
+    }
+
+    this->advance(size, alignment);
+    const Block& block = this->_blocks[this->_current];
+    const size_t offset = padding(block.data, alignment);
+    this->_used = offset + size;
+    return block.data + offset;
+}
+
+void* Arena::reallocate(void* memory, size_t old_size, size_t new_size, size_t alignment) {
+    if (memory == nullptr) return this->allocate(new_size, alignment);
+
+    char* bytes = static_cast<char*>(memory);
+    const Block& block = this->_blocks[this->_current];
+    const bool is_last = bytes + old_size == block.data + this->_used;
+    if (is_last && static_cast<size_t>(bytes - block.data) + new_size <= block.size) {
+        this->_used = static_cast<size_t>(bytes - block.data) + new_size;
+        return memory;
+    }
+
+    void* resized = this->allocate(new_size, alignment);
+    std::memcpy(resized, memory, std::min(old_size, new_size));
+    return resized;
+}
+
+void Arena::reset() {
+    this->_current = 0;
+    this->_used = 0;
+    this->_usedBefore = 0;
+}
+
+size_t Arena::used() const {
+    return this->_usedBefore + this->_used;
+}
+
+size_t Arena::capacity() const {
+    size_t capacity = 0;
+    for (const Block& block : this->_blocks) {
+        capacity += block.size;
+    }
+
+    return capacity;
+}
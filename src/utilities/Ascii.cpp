@@ -0,0 +1,240 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Ascii.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ABRAHAM_ASCII_VECTOR
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define ABRAHAM_ASCII_VECTOR
+#endif
+
+using namespace abraham;
+
+
+namespace {
+    const uint64_t REPEATED_01 = 0x0101010101010101ULL;
+    const uint64_t REPEATED_7F = 0x7F7F7F7F7F7F7F7FULL;
+    const uint64_t REPEATED_80 = 0x8080808080808080ULL;
+
+    /**
+     * @return 0x20 in each byte of the word that is a letter from first to first + 25; 0 in the others.
+     */
+    inline uint64_t letterBits(uint64_t word, char first) {
+        const uint64_t low = word & REPEATED_7F;
+        const uint64_t at_least_first = low + REPEATED_01 * (0x80 - static_cast<uint64_t>(first));
+        const uint64_t after_last = low + REPEATED_01 * (0x7F - static_cast<uint64_t>(first + 25));
+        return ((at_least_first & ~after_last & ~word) & REPEATED_80) >> 2;
+    }
+
+    inline uint64_t loadWord(const char* data) {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        return word;
+    }
+
+    inline void storeWord(char* data, uint64_t word) {
+        std::memcpy(data, &word, sizeof(word));
+    }
+
+    inline uint64_t mixHash(uint64_t hash, uint64_t word) {
+        hash = (hash ^ word) * 0x9E3779B97F4A7C15ULL;
+        return hash ^ (hash >> 29);
+    }
+
+#if defined(__AVX2__)
+    typedef __m256i Block;
+    const size_t BLOCK_SIZE = 32;
+
+    inline Block loadBlock(const char* data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)); }
+    inline void storeBlock(char* data, Block block) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), block); }
+    inline Block repeated(char c) { return _mm256_set1_epi8(c); }
+
+    /**
+     * @return 0x20 in each byte of the block that is a letter from first to first + 25; 0 in the others.
+     */
+    inline Block letterBits(Block block, char first) {
+        // Shift the letters down to the bottom of the signed range so one comparison finds them
+        Block shifted = _mm256_add_epi8(block, repeated(static_cast<char>(0x80 - first)));
+        Block letters = _mm256_cmpgt_epi8(repeated(static_cast<char>(-128 + 26)), shifted);
+        return _mm256_and_si256(letters, repeated(0x20));
+    }
+
+    inline Block foldBlock(Block block) { return _mm256_or_si256(block, letterBits(block, 'A')); }
+
+    inline unsigned mismatches(Block left, Block right) {
+        return ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)));
+    }
+#elif defined(__SSE2__)
+    typedef __m128i Block;
+    const size_t BLOCK_SIZE = 16;
+
+    inline Block loadBlock(const char* data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); }
+    inline void storeBlock(char* data, Block block) { _mm_storeu_si128(reinterpret_cast<__m128i*>(data), block); }
+    inline Block repeated(char c) { return _mm_set1_epi8(c); }
+
+    /**
+     * @return 0x20 in each byte of the block that is a letter from first to first + 25; 0 in the others.
+     */
+    inline Block letterBits(Block block, char first) {
+        // Shift the letters down to the bottom of the signed range so one comparison finds them
+        Block shifted = _mm_add_epi8(block, repeated(static_cast<char>(0x80 - first)));
+        Block letters = _mm_cmplt_epi8(shifted, repeated(static_cast<char>(-128 + 26)));
+        return _mm_and_si128(letters, repeated(0x20));
+    }
+
+    inline Block foldBlock(Block block) { return _mm_or_si128(block, letterBits(block, 'A')); }
+
+    inline unsigned mismatches(Block left, Block right) {
+        return ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(left, right))) & 0xFFFFu;
+    }
+#endif
+
+    /**
+     * Applies a case mapping to a range, a block, then a word, then a byte at a time.
+     */
+    template<typename BlockMap, typename WordMap, typename CharMap>
+    void mapRange(char* data, size_t length, BlockMap block_map, WordMap word_map, CharMap char_map) {
+        size_t i = 0;
+#if defined(ABRAHAM_ASCII_VECTOR)
+        for (; i + BLOCK_SIZE <= length; i += BLOCK_SIZE) {
+            storeBlock(data + i, block_map(loadBlock(data + i)));
+        }
+#else
+        (void) block_map;
+#endif
+        for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+            storeWord(data + i, word_map(loadWord(data + i)));
+        }
+        for (; i < length; ++i) {
+            data[i] = char_map(data[i]);
+        }
+    }
+}
+
+char Ascii::toLowerCase(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+}
+
+char Ascii::toUpperCase(char c) {
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c & ~0x20) : c;
+}
+
+void Ascii::toLowerCase(char* data, size_t length) {
+    mapRange(data, length,
+#if defined(ABRAHAM_ASCII_VECTOR)
+             [](Block block) { return foldBlock(block); },
+#else
+             nullptr,
+#endif
+             [](uint64_t word) { return word | letterBits(word, 'A'); },
+             [](char c) { return Ascii::toLowerCase(c); });
+}
+
+void Ascii::toUpperCase(char* data, size_t length) {
+    mapRange(data, length,
+#if defined(__AVX2__)
+             [](Block block) { return _mm256_xor_si256(block, letterBits(block, 'a')); },
+#elif defined(__SSE2__)
+             [](Block block) { return _mm_xor_si128(block, letterBits(block, 'a')); },
+#else
+             nullptr,
+#endif
+             [](uint64_t word) { return word ^ letterBits(word, 'a'); },
+             [](char c) { return Ascii::toUpperCase(c); });
+}
+
+void Ascii::swapCase(char* data, size_t length) {
+    mapRange(data, length,
+#if defined(__AVX2__)
+             [](Block block) {
+                 return _mm256_xor_si256(block, _mm256_or_si256(letterBits(block, 'A'), letterBits(block, 'a')));
+             },
+#elif defined(__SSE2__)
+             [](Block block) {
+                 return _mm_xor_si128(block, _mm_or_si128(letterBits(block, 'A'), letterBits(block, 'a')));
+             },
+#else
+             nullptr,
+#endif
+             [](uint64_t word) { return word ^ letterBits(word, 'A') ^ letterBits(word, 'a'); },
+             [](char c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ? static_cast<char>(c ^ 0x20) : c; });
+}
+
+bool Ascii::isEqualIgnoringCase(const char* left, const char* right, size_t length) {
+    size_t i = 0;
+#if defined(ABRAHAM_ASCII_VECTOR)
+    for (; i + BLOCK_SIZE <= length; i += BLOCK_SIZE) {
+        if (mismatches(foldBlock(loadBlock(left + i)), foldBlock(loadBlock(right + i))) != 0) return false;
+    }
+#endif
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t l = loadWord(left + i);
+        uint64_t r = loadWord(right + i);
+        if ((l | letterBits(l, 'A')) != (r | letterBits(r, 'A'))) return false;
+    }
+    for (; i < length; ++i) {
+        if (toLowerCase(left[i]) != toLowerCase(right[i])) return false;
+    }
+
+    return true;
+}
+
+int Ascii::compareIgnoringCase(const char* left, size_t left_length, const char* right, size_t right_length) {
+    const size_t length = std::min(left_length, right_length);
+
+    size_t i = 0;
+#if defined(ABRAHAM_ASCII_VECTOR)
+    for (; i + BLOCK_SIZE <= length; i += BLOCK_SIZE) {
+        unsigned mismatch = mismatches(foldBlock(loadBlock(left + i)), foldBlock(loadBlock(right + i)));
+        if (mismatch != 0) {
+            i += static_cast<size_t>(__builtin_ctz(mismatch));
+            break;
+        }
+    }
+#endif
+    for (; i < length; ++i) {
+        unsigned char l = static_cast<unsigned char>(toLowerCase(left[i]));
+        unsigned char r = static_cast<unsigned char>(toLowerCase(right[i]));
+        if (l != r) return l < r ? -1 : 1;
+    }
+
+    if (left_length == right_length) return 0;
+    return left_length < right_length ? -1 : 1;
+}
+
+size_t Ascii::hashIgnoringCase(const char* data, size_t length) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t word = loadWord(data + i);
+        hash = mixHash(hash, word | letterBits(word, 'A'));
+    }
+
+    if (i < length) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, length - i);
+        hash = mixHash(hash, word | letterBits(word, 'A'));
+    }
+
+    return static_cast<size_t>(mixHash(hash, length));
+}
+
+size_t CaseInsensitiveHash::operator()(const StringView& view) const {
+    return Ascii::hashIgnoringCase(view.data(), view.length());
+}
+
+bool CaseInsensitiveEqual::operator()(const StringView& left, const StringView& right) const {
+    return left.length() == right.length() && Ascii::isEqualIgnoringCase(left.data(), right.data(), left.length());
+}
+
+bool CaseInsensitiveLess::operator()(const StringView& left, const StringView& right) const {
+    return Ascii::compareIgnoringCase(left.data(), left.length(), right.data(), right.length()) < 0;
+}
@@ -0,0 +1,372 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Base64.hpp"
+#include "Exception.hpp"
+#include "NumberFormatter.hpp"
+#include <cstdint>
+#include <string>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    const char STANDARD_CHARACTERS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    const char URL_CHARACTERS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+    const char* alphabetCharacters(Base64Alphabet alphabet) {
+        return alphabet == Base64Alphabet::URL ? URL_CHARACTERS : STANDARD_CHARACTERS;
+    }
+
+    /**
+     * A table from each character to its value in an alphabet, or -1 if it isn't in it.
+     */
+    struct DecodeTable {
+        signed char values[256];
+
+        explicit DecodeTable(const char* characters) {
+            for (signed char& value : this->values) {
+                value = -1;
+            }
+            for (int i = 0; i < 64; ++i) {
+                this->values[static_cast<unsigned char>(characters[i])] = static_cast<signed char>(i);
+            }
+        }
+    };
+
+    const DecodeTable& decodeTable(Base64Alphabet alphabet) {
+        static const DecodeTable STANDARD_TABLE = DecodeTable(STANDARD_CHARACTERS);
+        static const DecodeTable URL_TABLE = DecodeTable(URL_CHARACTERS);
+        return alphabet == Base64Alphabet::URL ? URL_TABLE : STANDARD_TABLE;
+    }
+
+    std::string invalidMessage(const char* what, size_t index) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        return std::string(what).append(digits, NumberFormatter::format(index, digits));
+    }
+
+    /**
+     * Where and why decoding failed. The message is null if it didn't.
+     */
+    struct DecodeFailure {
+        const char* message;
+        size_t index;
+    };
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+    // The SIMD kernels follow Mula and Lemire, "Faster Base64 Encoding and Decoding Using AVX2 Instructions". Each
+    // 32 bit lane holds three input bytes or four characters, so the 128 and 256 bit versions are the same steps.
+
+    /**
+     * The offsets from each sextet to its character, indexed by a reduced value: 13 for A-Z, 0 for a-z, 1 to 10 for
+     * 0-9, and 11 and 12 for the last two characters of the alphabet.
+     */
+    __m128i encodeOffsets(const char* characters) {
+        return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                             '0' - 52, '0' - 52, static_cast<char>(characters[62] - 62),
+                             static_cast<char>(characters[63] - 63), 'A', 0, 0);
+    }
+#endif
+
+#if defined(__AVX2__)
+    /**
+     * Encodes the three bytes at the start of each 32 bit lane's source, 24 bytes in all, into 32 characters.
+     */
+    __m256i encodeBlock(__m256i input, __m256i offsets) {
+        const __m256i spread = _mm256_shuffle_epi8(input, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9,
+                                                                            11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8,
+                                                                            7, 10, 9, 11, 10));
+        const __m256i first = _mm256_mulhi_epu16(_mm256_and_si256(spread, _mm256_set1_epi32(0x0FC0FC00)),
+                                                 _mm256_set1_epi32(0x04000040));
+        const __m256i second = _mm256_mullo_epi16(_mm256_and_si256(spread, _mm256_set1_epi32(0x003F03F0)),
+                                                  _mm256_set1_epi32(0x01000010));
+        const __m256i sextets = _mm256_or_si256(first, second);
+
+        __m256i reduced = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+        const __m256i is_upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets);
+        reduced = _mm256_or_si256(reduced, _mm256_and_si256(is_upper, _mm256_set1_epi8(13)));
+        return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, reduced), sextets);
+    }
+
+    /**
+     * Converts 32 characters to their sextets.
+     * @return false if any of the characters isn't in the alphabet.
+     */
+    bool decodeSextets(__m256i characters, __m256i last_two, __m256i last, __m256i& sextets) {
+        const __m256i upper = _mm256_sub_epi8(characters, _mm256_set1_epi8('A'));
+        const __m256i is_upper = _mm256_cmpeq_epi8(_mm256_min_epu8(upper, _mm256_set1_epi8(25)), upper);
+        const __m256i lower = _mm256_sub_epi8(characters, _mm256_set1_epi8('a'));
+        const __m256i is_lower = _mm256_cmpeq_epi8(_mm256_min_epu8(lower, _mm256_set1_epi8(25)), lower);
+        const __m256i digit = _mm256_sub_epi8(characters, _mm256_set1_epi8('0'));
+        const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+        const __m256i is_62 = _mm256_cmpeq_epi8(characters, last_two);
+        const __m256i is_63 = _mm256_cmpeq_epi8(characters, last);
+
+        sextets = _mm256_or_si256(
+                _mm256_or_si256(_mm256_and_si256(is_upper, upper),
+                                _mm256_and_si256(is_lower, _mm256_add_epi8(lower, _mm256_set1_epi8(26)))),
+                _mm256_or_si256(_mm256_and_si256(is_digit, _mm256_add_epi8(digit, _mm256_set1_epi8(52))),
+                                _mm256_or_si256(_mm256_and_si256(is_62, _mm256_set1_epi8(62)),
+                                                _mm256_and_si256(is_63, _mm256_set1_epi8(63)))));
+        const __m256i valid = _mm256_or_si256(_mm256_or_si256(is_upper, is_lower),
+                                              _mm256_or_si256(is_digit, _mm256_or_si256(is_62, is_63)));
+        return _mm256_movemask_epi8(valid) == -1;
+    }
+
+    /**
+     * Packs the four sextets of each 32 bit lane into three bytes, 24 in all at the start of the result.
+     */
+    __m256i packSextets(__m256i sextets) {
+        __m256i merged = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+        merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                              2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        return _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    }
+#elif defined(__SSSE3__)
+    /**
+     * Encodes the first twelve bytes of a block into sixteen characters.
+     */
+    __m128i encodeBlock(__m128i input, __m128i offsets) {
+        const __m128i spread = _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11,
+                                                                     10));
+        const __m128i first = _mm_mulhi_epu16(_mm_and_si128(spread, _mm_set1_epi32(0x0FC0FC00)),
+                                              _mm_set1_epi32(0x04000040));
+        const __m128i second = _mm_mullo_epi16(_mm_and_si128(spread, _mm_set1_epi32(0x003F03F0)),
+                                               _mm_set1_epi32(0x01000010));
+        const __m128i sextets = _mm_or_si128(first, second);
+
+        __m128i reduced = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+        const __m128i is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), sextets);
+        reduced = _mm_or_si128(reduced, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+        return _mm_add_epi8(_mm_shuffle_epi8(offsets, reduced), sextets);
+    }
+
+    /**
+     * Converts sixteen characters to their sextets.
+     * @return false if any of the characters isn't in the alphabet.
+     */
+    bool decodeSextets(__m128i characters, __m128i last_two, __m128i last, __m128i& sextets) {
+        const __m128i upper = _mm_sub_epi8(characters, _mm_set1_epi8('A'));
+        const __m128i is_upper = _mm_cmpeq_epi8(_mm_min_epu8(upper, _mm_set1_epi8(25)), upper);
+        const __m128i lower = _mm_sub_epi8(characters, _mm_set1_epi8('a'));
+        const __m128i is_lower = _mm_cmpeq_epi8(_mm_min_epu8(lower, _mm_set1_epi8(25)), lower);
+        const __m128i digit = _mm_sub_epi8(characters, _mm_set1_epi8('0'));
+        const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+        const __m128i is_62 = _mm_cmpeq_epi8(characters, last_two);
+        const __m128i is_63 = _mm_cmpeq_epi8(characters, last);
+
+        sextets = _mm_or_si128(_mm_or_si128(_mm_and_si128(is_upper, upper),
+                                            _mm_and_si128(is_lower, _mm_add_epi8(lower, _mm_set1_epi8(26)))),
+                               _mm_or_si128(_mm_and_si128(is_digit, _mm_add_epi8(digit, _mm_set1_epi8(52))),
+                                            _mm_or_si128(_mm_and_si128(is_62, _mm_set1_epi8(62)),
+                                                         _mm_and_si128(is_63, _mm_set1_epi8(63)))));
+        const __m128i valid = _mm_or_si128(_mm_or_si128(is_upper, is_lower),
+                                           _mm_or_si128(is_digit, _mm_or_si128(is_62, is_63)));
+        return _mm_movemask_epi8(valid) == 0xFFFF;
+    }
+
+    /**
+     * Packs the four sextets of each 32 bit lane into three bytes, twelve in all at the start of the result.
+     */
+    __m128i packSextets(__m128i sextets) {
+        __m128i merged = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+        merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        return _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+#endif
+
+    /**
+     * Decodes base64, or only checks it if output is null.
+     * @return The number of bytes decoded. The failure's message is set if the text isn't valid.
+     */
+    size_t decodeText(const char* text, size_t length, unsigned char* output, Base64Alphabet alphabet,
+                      DecodeFailure& failure) {
+        failure.message = nullptr;
+
+        // Padding, if there is any, must make the length a multiple of four
+        size_t data_length = length;
+        if (data_length > 0 && text[data_length - 1] == '=') --data_length;
+        if (data_length > 0 && data_length < length && text[data_length - 1] == '=') --data_length;
+        if (data_length < length && length % 4 != 0) {
+            failure.message = "Incomplete base64 padding at index ";
+            failure.index = data_length;
+            return 0;
+        }
+        if (data_length % 4 == 1) {
+            failure.message = "Incomplete base64 group at index ";
+            failure.index = data_length - 1;
+            return 0;
+        }
+
+        size_t i = 0;
+        size_t written = 0;
+
+        // Each block stores a few bytes past the ones it decodes, so blocks stop far enough from the end for the
+        // output to have room for them
+#if defined(__AVX2__)
+        if (output != nullptr) {
+            const char* characters = alphabetCharacters(alphabet);
+            const __m256i last_two = _mm256_set1_epi8(characters[62]);
+            const __m256i last = _mm256_set1_epi8(characters[63]);
+            for (; i + 32 + 12 <= data_length; i += 32, written += 24) {
+                __m256i sextets;
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+                if (!decodeSextets(block, last_two, last, sextets)) break;
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + written), packSextets(sextets));
+            }
+        }
+#elif defined(__SSSE3__)
+        if (output != nullptr) {
+            const char* characters = alphabetCharacters(alphabet);
+            const __m128i last_two = _mm_set1_epi8(characters[62]);
+            const __m128i last = _mm_set1_epi8(characters[63]);
+            for (; i + 16 + 8 <= data_length; i += 16, written += 12) {
+                __m128i sextets;
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+                if (!decodeSextets(block, last_two, last, sextets)) break;
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written), packSextets(sextets));
+            }
+        }
+#endif
+
+        // A block with a bad character is left to the scalar loop, which finds which one it is
+        const signed char* values = decodeTable(alphabet).values;
+        uint32_t group = 0;
+        size_t group_length = 0;
+        for (; i < data_length; ++i) {
+            const signed char value = values[static_cast<unsigned char>(text[i])];
+            if (value < 0) {
+                failure.message = "Invalid base64 character at index ";
+                failure.index = i;
+                return 0;
+            }
+
+            group = (group << 6) | static_cast<uint32_t>(value);
+            if (++group_length == 4) {
+                if (output != nullptr) {
+                    output[written] = static_cast<unsigned char>(group >> 16);
+                    output[written + 1] = static_cast<unsigned char>(group >> 8);
+                    output[written + 2] = static_cast<unsigned char>(group);
+                }
+                written += 3;
+                group = 0;
+                group_length = 0;
+            }
+        }
+
+        // The unused low bits of the last character must be zero, so that every byte sequence has one encoding
+        if (group_length == 2) {
+            if ((group & 0x0F) != 0) {
+                failure.message = "Nonzero unused bits in base64 character at index ";
+                failure.index = data_length - 1;
+                return 0;
+            }
+            if (output != nullptr) output[written] = static_cast<unsigned char>(group >> 4);
+            written += 1;
+        } else if (group_length == 3) {
+            if ((group & 0x03) != 0) {
+                failure.message = "Nonzero unused bits in base64 character at index ";
+                failure.index = data_length - 1;
+                return 0;
+            }
+            if (output != nullptr) {
+                output[written] = static_cast<unsigned char>(group >> 10);
+                output[written + 1] = static_cast<unsigned char>(group >> 2);
+            }
+            written += 2;
+        }
+
+        return written;
+    }
+}
+
+size_t Base64::encodedLength(size_t length, bool padding) {
+    if (padding) return (length + 2) / 3 * 4;
+    return length / 3 * 4 + (length % 3 == 0 ? 0 : length % 3 + 1);
+}
+
+size_t Base64::encode(const void* data, size_t length, char* output, Base64Alphabet alphabet, bool padding) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    const char* characters = alphabetCharacters(alphabet);
+    size_t i = 0;
+    size_t written = 0;
+
+    // Blocks load sixteen bytes for every twelve they encode, so they stop before reading past the end
+#if defined(__AVX2__)
+    const __m256i offsets = _mm256_broadcastsi128_si256(encodeOffsets(characters));
+    for (; i + 28 <= length; i += 24, written += 32) {
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 12));
+        const __m256i block = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + written), encodeBlock(block, offsets));
+    }
+#elif defined(__SSSE3__)
+    const __m128i offsets = encodeOffsets(characters);
+    for (; i + 16 <= length; i += 12, written += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written), encodeBlock(block, offsets));
+    }
+#endif
+
+    for (; i + 3 <= length; i += 3, written += 4) {
+        const uint32_t group = (static_cast<uint32_t>(bytes[i]) << 16) | (static_cast<uint32_t>(bytes[i + 1]) << 8) |
+                               bytes[i + 2];
+        output[written] = characters[group >> 18];
+        output[written + 1] = characters[(group >> 12) & 0x3F];
+        output[written + 2] = characters[(group >> 6) & 0x3F];
+        output[written + 3] = characters[group & 0x3F];
+    }
+
+    const size_t remaining = length - i;
+    if (remaining > 0) {
+        const uint32_t group = (static_cast<uint32_t>(bytes[i]) << 16) |
+                               (remaining == 2 ? static_cast<uint32_t>(bytes[i + 1]) << 8 : 0);
+        output[written++] = characters[group >> 18];
+        output[written++] = characters[(group >> 12) & 0x3F];
+        if (remaining == 2) output[written++] = characters[(group >> 6) & 0x3F];
+        if (padding) {
+            output[written++] = '=';
+            if (remaining == 1) output[written++] = '=';
+        }
+    }
+
+    return written;
+}
+
+String Base64::encode(const StringView& bytes, Base64Alphabet alphabet, bool padding) {
+    std::string output(encodedLength(bytes.length(), padding), '\0');
+    encode(bytes.data(), bytes.length(), &output[0], alphabet, padding);
+    return String(std::move(output));
+}
+
+size_t Base64::maxDecodedLength(size_t length) {
+    return length / 4 * 3 + length % 4 * 3 / 4;
+}
+
+size_t Base64::decode(const char* text, size_t length, void* output, Base64Alphabet alphabet) {
+    DecodeFailure failure = {};
+    const size_t written = decodeText(text, length, static_cast<unsigned char*>(output), alphabet, failure);
+    if (failure.message != nullptr) throw InvalidValueException(invalidMessage(failure.message, failure.index));
+    return written;
+}
+
+String Base64::decode(const StringView& text, Base64Alphabet alphabet) {
+    std::string output(maxDecodedLength(text.length()), '\0');
+    output.resize(decode(text.data(), text.length(), &output[0], alphabet));
+    return String(std::move(output));
+}
+
+bool Base64::isValid(const StringView& text, Base64Alphabet alphabet) {
+    DecodeFailure failure = {};
+    decodeText(text.data(), text.length(), nullptr, alphabet, failure);
+    return failure.message == nullptr;
+}
@@ -0,0 +1,41 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Format.hpp"
+#include "Exception.hpp"
+
+using namespace abraham;
+
+
+void details::formatArguments(std::string& output, const char* format, size_t length,
+                              const FormatArgument* arguments) {
+    size_t literal_start = 0;
+    for (size_t i = 0; i < length; ++i) {
+        const char c = format[i];
+        if (c != '{' && c != '}') continue;
+
+        // Copy the literal up to the brace, keeping one brace of an escaped pair
+        output.append(format + literal_start, i - literal_start + (format[i + 1] == c ? 1 : 0));
+        if (c == '{' && format[i + 1] == '}') {
+            arguments->append(output, arguments->value);
+            ++arguments;
+        }
+
+        ++i;
+        literal_start = i + 1;
+    }
+
+    output.append(format + literal_start, length - literal_start);
+}
+
+void details::checkFormat(const char* format, size_t length, size_t argument_count) {
+    const size_t count = countPlaceholders(format, length);
+    if (count == MALFORMED_FORMAT) {
+        throw InvalidArgumentException("Format string has an unmatched brace: " + std::string(format, length));
+    }
+    if (count != argument_count) {
+        throw InvalidArgumentException("Format string doesn't have one placeholder per argument: " +
+                                       std::string(format, length));
+    }
+}
@@ -0,0 +1,121 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Hash.hpp"
+#include <cstring>
+
+using namespace abraham;
+
+
+namespace {
+    const uint64_t SECRET[4] = {0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL, 0x4B33A62ED433D4A3ULL,
+                                0x4D5A2DA51DE1AA47ULL};
+
+    /**
+     * Computes the full 128 bit product of two 64 bit values.
+     */
+    inline void multiply(uint64_t a, uint64_t b, uint64_t& low, uint64_t& high) {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        low = static_cast<uint64_t>(product);
+        high = static_cast<uint64_t>(product >> 64);
+#else
+        const uint64_t a_low = a & 0xFFFFFFFFULL, a_high = a >> 32;
+        const uint64_t b_low = b & 0xFFFFFFFFULL, b_high = b >> 32;
+        const uint64_t low_low = a_low * b_low, low_high = a_low * b_high;
+        const uint64_t high_low = a_high * b_low, high_high = a_high * b_high;
+        const uint64_t middle = (low_low >> 32) + (low_high & 0xFFFFFFFFULL) + (high_low & 0xFFFFFFFFULL);
+        low = (middle << 32) | (low_low & 0xFFFFFFFFULL);
+        high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+    }
+
+    /**
+     * @return The low and high halves of the 128 bit product, folded together with xor.
+     */
+    inline uint64_t mix(uint64_t a, uint64_t b) {
+        uint64_t low;
+        uint64_t high;
+        multiply(a, b, low, high);
+        return low ^ high;
+    }
+
+    inline uint64_t read64(const unsigned char* data) {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t read32(const unsigned char* data) {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    /**
+     * Reads one to three bytes as the first, middle and last, so every byte is included without a branch per length.
+     */
+    inline uint64_t read3(const unsigned char* data, size_t length) {
+        return (static_cast<uint64_t>(data[0]) << 16) | (static_cast<uint64_t>(data[length >> 1]) << 8) |
+               data[length - 1];
+    }
+}
+
+
+uint64_t Hasher::hash(const void* data, size_t length, uint64_t seed) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    seed ^= mix(seed ^ SECRET[0], SECRET[1]);
+
+    uint64_t a;
+    uint64_t b;
+    if (length <= 16) {
+        if (length >= 4) {
+            // Two pairs of overlapping 4 byte loads cover every length from 4 to 16
+            const size_t middle = (length >> 3) << 2;
+            a = (read32(bytes) << 32) | read32(bytes + middle);
+            b = (read32(bytes + length - 4) << 32) | read32(bytes + length - 4 - middle);
+        } else if (length > 0) {
+            a = read3(bytes, length);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t remaining = length;
+        if (remaining > 48) {
+            uint64_t lane1 = seed;
+            uint64_t lane2 = seed;
+            do {
+                seed = mix(read64(bytes) ^ SECRET[1], read64(bytes + 8) ^ seed);
+                lane1 = mix(read64(bytes + 16) ^ SECRET[2], read64(bytes + 24) ^ lane1);
+                lane2 = mix(read64(bytes + 32) ^ SECRET[3], read64(bytes + 40) ^ lane2);
+                bytes += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane1 ^ lane2;
+        }
+
+        while (remaining > 16) {
+            seed = mix(read64(bytes) ^ SECRET[1], read64(bytes + 8) ^ seed);
+            bytes += 16;
+            remaining -= 16;
+        }
+
+        // The last 16 bytes, which may overlap ones already mixed
+        a = read64(bytes + remaining - 16);
+        b = read64(bytes + remaining - 8);
+    }
+
+    multiply(a ^ SECRET[1], b ^ seed, a, b);
+    return mix(a ^ SECRET[0] ^ length, b ^ SECRET[1]);
+}
+
+uint64_t Hasher::hashInteger(uint64_t value) {
+    return mix(value ^ SECRET[0], value ^ SECRET[1]);
+}
+
+uint64_t Hasher::combine(uint64_t seed, uint64_t hash) {
+    return mix(seed ^ SECRET[2], hash ^ SECRET[3]);
+}
@@ -0,0 +1,230 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Hex.hpp"
+#include "Exception.hpp"
+#include "NumberFormatter.hpp"
+#include <string>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    const char LOWERCASE_DIGITS[] = "0123456789abcdef";
+    const char UPPERCASE_DIGITS[] = "0123456789ABCDEF";
+
+    /**
+     * The distance from '0' + 10 to 'a' or 'A', added to nibbles above nine.
+     */
+    const char LOWERCASE_OFFSET = 'a' - '0' - 10;
+    const char UPPERCASE_OFFSET = 'A' - '0' - 10;
+
+    /**
+     * @return The value of a hex digit, or -1 if it isn't one.
+     */
+    int digitValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+
+        const char lowercase = static_cast<char>(c | 0x20);
+        if (lowercase >= 'a' && lowercase <= 'f') return lowercase - 'a' + 10;
+        return -1;
+    }
+
+    std::string invalidMessage(const char* what, size_t index) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        return std::string(what).append(digits, NumberFormatter::format(index, digits));
+    }
+
+#if defined(__AVX2__)
+    __m256i nibblesToDigits(__m256i nibbles, __m256i letter_offset) {
+        const __m256i is_letter = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+        return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')),
+                               _mm256_and_si256(is_letter, letter_offset));
+    }
+
+    /**
+     * Converts thirty-two hex digits to their values.
+     * @return false if any of the characters isn't a hex digit.
+     */
+    bool digitValues(__m256i characters, __m256i& values) {
+        const __m256i digit = _mm256_sub_epi8(characters, _mm256_set1_epi8('0'));
+        const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+        const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(characters, _mm256_set1_epi8(0x20)),
+                                               _mm256_set1_epi8('a'));
+        const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+        values = _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+                                 _mm256_and_si256(is_letter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+        return _mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) == -1;
+    }
+
+    /**
+     * Joins each pair of digit values, high nibble first, into a byte in the low half of its 16 bit lane.
+     */
+    __m256i joinNibbles(__m256i values) {
+        return _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(values, _mm256_set1_epi16(0x00FF)), 4),
+                               _mm256_srli_epi16(values, 8));
+    }
+#elif defined(__SSE2__)
+    __m128i nibblesToDigits(__m128i nibbles, __m128i letter_offset) {
+        const __m128i is_letter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+        return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), _mm_and_si128(is_letter, letter_offset));
+    }
+
+    /**
+     * Converts sixteen hex digits to their values.
+     * @return false if any of the characters isn't a hex digit.
+     */
+    bool digitValues(__m128i characters, __m128i& values) {
+        const __m128i digit = _mm_sub_epi8(characters, _mm_set1_epi8('0'));
+        const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+        const __m128i letter = _mm_sub_epi8(_mm_or_si128(characters, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+        const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+        values = _mm_or_si128(_mm_and_si128(is_digit, digit),
+                              _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+        return _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) == 0xFFFF;
+    }
+
+    /**
+     * Joins each pair of digit values, high nibble first, into a byte in the low half of its 16 bit lane.
+     */
+    __m128i joinNibbles(__m128i values) {
+        return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 4),
+                            _mm_srli_epi16(values, 8));
+    }
+#endif
+}
+
+size_t Hex::encodedLength(size_t length) {
+    return length * 2;
+}
+
+size_t Hex::encode(const void* data, size_t length, char* output, bool uppercase) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256i letter_offset = _mm256_set1_epi8(uppercase ? UPPERCASE_OFFSET : LOWERCASE_OFFSET);
+    const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+    for (; i + 32 <= length; i += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+        const __m256i high = nibblesToDigits(_mm256_and_si256(_mm256_srli_epi16(block, 4), low_nibble), letter_offset);
+        const __m256i low = nibblesToDigits(_mm256_and_si256(block, low_nibble), letter_offset);
+
+        // Interleaving works within each 128 bit lane, so the halves are put back in order afterwards
+        const __m256i first = _mm256_unpacklo_epi8(high, low);
+        const __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 2 * i + 32),
+                            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+#elif defined(__SSE2__)
+    const __m128i letter_offset = _mm_set1_epi8(uppercase ? UPPERCASE_OFFSET : LOWERCASE_OFFSET);
+    const __m128i low_nibble = _mm_set1_epi8(0x0F);
+    for (; i + 16 <= length; i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        const __m128i high = nibblesToDigits(_mm_and_si128(_mm_srli_epi16(block, 4), low_nibble), letter_offset);
+        const __m128i low = nibblesToDigits(_mm_and_si128(block, low_nibble), letter_offset);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2 * i), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2 * i + 16), _mm_unpackhi_epi8(high, low));
+    }
+#endif
+
+    const char* digits = uppercase ? UPPERCASE_DIGITS : LOWERCASE_DIGITS;
+    for (; i < length; ++i) {
+        output[2 * i] = digits[bytes[i] >> 4];
+        output[2 * i + 1] = digits[bytes[i] & 0x0F];
+    }
+
+    return length * 2;
+}
+
+String Hex::encode(const StringView& bytes, bool uppercase) {
+    std::string output(encodedLength(bytes.length()), '\0');
+    encode(bytes.data(), bytes.length(), &output[0], uppercase);
+    return String(std::move(output));
+}
+
+size_t Hex::decodedLength(size_t length) {
+    return length / 2;
+}
+
+size_t Hex::decode(const char* text, size_t length, void* output) {
+    if (length % 2 != 0) throw InvalidValueException("Hex has an odd number of digits");
+
+    unsigned char* bytes = static_cast<unsigned char*>(output);
+    size_t i = 0;
+
+    // A block with a bad digit is left to the scalar loop, which finds which one it is
+#if defined(__AVX2__)
+    for (; i + 64 <= length; i += 64) {
+        __m256i first, second;
+        if (!digitValues(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i)), first) ||
+            !digitValues(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i + 32)), second)) {
+            break;
+        }
+
+        // Packing works within each 128 bit lane, so the 64 bit quarters are put back in order afterwards
+        const __m256i packed = _mm256_packus_epi16(joinNibbles(first), joinNibbles(second));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(bytes + i / 2), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+#elif defined(__SSE2__)
+    for (; i + 32 <= length; i += 32) {
+        __m128i first, second;
+        if (!digitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i)), first) ||
+            !digitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + 16)), second)) {
+            break;
+        }
+
+        const __m128i packed = _mm_packus_epi16(joinNibbles(first), joinNibbles(second));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + i / 2), packed);
+    }
+#endif
+
+    for (; i < length; i += 2) {
+        const int high = digitValue(text[i]);
+        if (high < 0) throw InvalidValueException(invalidMessage("Invalid hex digit at index ", i));
+        const int low = digitValue(text[i + 1]);
+        if (low < 0) throw InvalidValueException(invalidMessage("Invalid hex digit at index ", i + 1));
+        bytes[i / 2] = static_cast<unsigned char>((high << 4) | low);
+    }
+
+    return length / 2;
+}
+
+String Hex::decode(const StringView& text) {
+    std::string output(decodedLength(text.length()), '\0');
+    decode(text.data(), text.length(), &output[0]);
+    return String(std::move(output));
+}
+
+bool Hex::isValid(const StringView& text) {
+    if (text.length() % 2 != 0) return false;
+
+    const char* data = text.data();
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= text.length(); i += 32) {
+        __m256i values;
+        if (!digitValues(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), values)) return false;
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= text.length(); i += 16) {
+        __m128i values;
+        if (!digitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), values)) return false;
+    }
+#endif
+
+    for (; i < text.length(); ++i) {
+        if (digitValue(data[i]) < 0) return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,482 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "Utf8.hpp"
+#include "Exception.hpp"
+#include "NumberFormatter.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace abraham;
+
+
+namespace {
+    const uint64_t REPEATED_80 = 0x8080808080808080ULL;
+
+    inline bool isContinuation(unsigned char c) {
+        return (c & 0xC0) == 0x80;
+    }
+
+    /**
+     * Decodes the sequence at the start of some bytes.
+     * @return The number of bytes in the sequence, or 0 if it's invalid or incomplete.
+     */
+    size_t decode(const unsigned char* data, size_t remaining, uint32_t& code_point) {
+        const unsigned char lead = data[0];
+        if (lead < 0x80) {
+            code_point = lead;
+            return 1;
+        }
+
+        // The lead byte limits the second byte more tightly than other continuations, ruling out overlong forms,
+        // surrogates and values above U+10FFFF
+        size_t length;
+        unsigned char low = 0x80;
+        unsigned char high = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+            code_point = lead & 0x1F;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            code_point = lead & 0x0F;
+            if (lead == 0xE0) low = 0xA0;
+            if (lead == 0xED) high = 0x9F;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            code_point = lead & 0x07;
+            if (lead == 0xF0) low = 0x90;
+            if (lead == 0xF4) high = 0x8F;
+        } else {
+            return 0;
+        }
+
+        if (remaining < length || data[1] < low || data[1] > high) return 0;
+        code_point = (code_point << 6) | (data[1] & 0x3F);
+        for (size_t i = 2; i < length; ++i) {
+            if (!isContinuation(data[i])) return 0;
+            code_point = (code_point << 6) | (data[i] & 0x3F);
+        }
+
+        return length;
+    }
+
+    /**
+     * Writes a code point as UTF-8.
+     * @return The number of bytes written.
+     */
+    inline size_t encode(uint32_t code_point, char* output) {
+        if (code_point < 0x80) {
+            output[0] = static_cast<char>(code_point);
+            return 1;
+        } else if (code_point < 0x800) {
+            output[0] = static_cast<char>(0xC0 | (code_point >> 6));
+            output[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 2;
+        } else if (code_point < 0x10000) {
+            output[0] = static_cast<char>(0xE0 | (code_point >> 12));
+            output[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            output[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 3;
+        } else {
+            output[0] = static_cast<char>(0xF0 | (code_point >> 18));
+            output[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            output[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            output[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 4;
+        }
+    }
+
+    /**
+     * @return The number of ASCII bytes at the start of a range, checked a block or a word at a time.
+     */
+    size_t asciiLength(const char* data, size_t length) {
+        size_t i = 0;
+#if defined(__SSE2__)
+        for (; i + 16 <= length; i += 16) {
+            const int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+            if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+        }
+#endif
+        for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            if ((word & REPEATED_80) != 0) break;
+        }
+        while (i < length && static_cast<unsigned char>(data[i]) < 0x80) {
+            ++i;
+        }
+
+        return i;
+    }
+
+    std::string invalidMessage(const char* what, size_t index) {
+        char digits[NumberFormatter::MAX_LENGTH];
+        return std::string(what).append(digits, NumberFormatter::format(index, digits));
+    }
+
+#if defined(__SSSE3__)
+    // Error bits for pairs of adjacent bytes, from Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction
+    // Per Byte". Each pair is classified by three table lookups, on the high and low nibbles of the first byte and the
+    // high nibble of the second, and is invalid when a bit is set in all three.
+    const uint8_t TOO_SHORT = 1 << 0;       // A lead byte or ASCII follows a lead byte
+    const uint8_t TOO_LONG = 1 << 1;        // A continuation follows ASCII
+    const uint8_t OVERLONG_3 = 1 << 2;      // E0 followed by 80-9F
+    const uint8_t TOO_LARGE = 1 << 3;       // F4 followed by 90-BF, or F5-FF
+    const uint8_t SURROGATE = 1 << 4;       // ED followed by A0-BF
+    const uint8_t OVERLONG_2 = 1 << 5;      // C0 or C1
+    const uint8_t TOO_LARGE_1000 = 1 << 6;  // F5-FF followed by 80-8F
+    const uint8_t OVERLONG_4 = 1 << 6;      // F0 followed by 80-8F
+    const uint8_t TWO_CONTINUATIONS = 1 << 7;
+    const uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTINUATIONS;
+
+    inline __m128i table(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4, uint8_t b5, uint8_t b6,
+                         uint8_t b7, uint8_t b8, uint8_t b9, uint8_t b10, uint8_t b11, uint8_t b12, uint8_t b13,
+                         uint8_t b14, uint8_t b15) {
+        return _mm_setr_epi8(static_cast<char>(b0), static_cast<char>(b1), static_cast<char>(b2),
+                             static_cast<char>(b3), static_cast<char>(b4), static_cast<char>(b5),
+                             static_cast<char>(b6), static_cast<char>(b7), static_cast<char>(b8),
+                             static_cast<char>(b9), static_cast<char>(b10), static_cast<char>(b11),
+                             static_cast<char>(b12), static_cast<char>(b13), static_cast<char>(b14),
+                             static_cast<char>(b15));
+    }
+
+    inline __m128i highNibbles(__m128i block) {
+        return _mm_and_si128(_mm_srli_epi16(block, 4), _mm_set1_epi8(0x0F));
+    }
+
+    /**
+     * Validates blocks of sixteen bytes, carrying the sequences that cross from one block into the next.
+     */
+    class BlockValidator {
+    protected:
+        __m128i _firstHigh;
+        __m128i _firstLow;
+        __m128i _secondHigh;
+        __m128i _previous;
+        __m128i _previousIncomplete;
+        __m128i _error;
+
+    public:
+        BlockValidator() {
+            this->_firstHigh = table(TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                                     TWO_CONTINUATIONS, TWO_CONTINUATIONS, TWO_CONTINUATIONS, TWO_CONTINUATIONS,
+                                     TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+                                     TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+            const uint8_t large = CARRY | TOO_LARGE | TOO_LARGE_1000;
+            this->_firstLow = table(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY, CARRY,
+                                    CARRY | TOO_LARGE, large, large, large, large, large, large, large, large,
+                                    large | SURROGATE, large, large);
+            const uint8_t continuation = TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS;
+            this->_secondHigh = table(TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                                      TOO_SHORT, continuation | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+                                      continuation | OVERLONG_3 | TOO_LARGE, continuation | SURROGATE | TOO_LARGE,
+                                      continuation | SURROGATE | TOO_LARGE, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                                      TOO_SHORT);
+            this->_previous = _mm_setzero_si128();
+            this->_previousIncomplete = _mm_setzero_si128();
+            this->_error = _mm_setzero_si128();
+        }
+
+        void check(__m128i block) {
+            if (_mm_movemask_epi8(block) == 0) {
+                // An ASCII block is only an error if the previous one ended partway through a sequence
+                this->_error = _mm_or_si128(this->_error, this->_previousIncomplete);
+            } else {
+                const __m128i previous1 = _mm_alignr_epi8(block, this->_previous, 15);
+                const __m128i special = _mm_and_si128(
+                        _mm_and_si128(_mm_shuffle_epi8(this->_firstHigh, highNibbles(previous1)),
+                                      _mm_shuffle_epi8(this->_firstLow, _mm_and_si128(previous1,
+                                                                                       _mm_set1_epi8(0x0F)))),
+                        _mm_shuffle_epi8(this->_secondHigh, highNibbles(block)));
+
+                // Third and fourth bytes of a sequence must be continuations, which the pair tables can't see
+                const __m128i previous2 = _mm_alignr_epi8(block, this->_previous, 14);
+                const __m128i previous3 = _mm_alignr_epi8(block, this->_previous, 13);
+                const __m128i third = _mm_subs_epu8(previous2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+                const __m128i fourth = _mm_subs_epu8(previous3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+                const __m128i must_continue = _mm_and_si128(_mm_or_si128(third, fourth),
+                                                            _mm_set1_epi8(static_cast<char>(0x80)));
+                this->_error = _mm_or_si128(this->_error, _mm_xor_si128(must_continue, special));
+
+                // A block is incomplete if a sequence starting in its last three bytes runs past its end
+                const __m128i limits = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                     static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1),
+                                                     static_cast<char>(0xC0 - 1));
+                this->_previousIncomplete = _mm_subs_epu8(block, limits);
+            }
+
+            this->_previous = block;
+        }
+
+        bool isValid() const {
+            const __m128i error = _mm_or_si128(this->_error, this->_previousIncomplete);
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+        }
+    };
+#endif
+}
+
+const size_t Utf8::NO_INDEX = static_cast<size_t>(-1);
+
+bool Utf8::isValid(const char* data, size_t length) {
+#if defined(__SSSE3__)
+    BlockValidator validator = BlockValidator();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        validator.check(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+    }
+
+    // The tail is padded with zeros, which are ASCII and so don't hide an incomplete sequence
+    if (i < length) {
+        char tail[16] = {};
+        std::memcpy(tail, data + i, length - i);
+        validator.check(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tail)));
+    }
+
+    return validator.isValid();
+#else
+    return validLength(data, length) == length;
+#endif
+}
+
+size_t Utf8::validLength(const char* data, size_t length) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    size_t i = 0;
+    while (i < length) {
+        if (bytes[i] < 0x80) {
+            i += asciiLength(data + i, length - i);
+            continue;
+        }
+
+        uint32_t code_point;
+        const size_t sequence = decode(bytes + i, length - i, code_point);
+        if (sequence == 0) return i;
+        i += sequence;
+    }
+
+    return length;
+}
+
+size_t Utf8::countCodePoints(const char* data, size_t length) {
+    size_t count = 0;
+    size_t i = 0;
+#if defined(__SSE2__)
+    // Continuation bytes are 0x80 to 0xBF, the only ones below -64 as signed bytes
+    const __m128i continuation_limit = _mm_set1_epi8(-65);
+    while (i + 16 <= length) {
+        // Byte counters hold at most 255 before they're summed
+        const size_t blocks = std::min<size_t>((length - i) / 16, 255);
+        __m128i counters = _mm_setzero_si128();
+        for (size_t block = 0; block < blocks; ++block, i += 16) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(bytes, continuation_limit));
+        }
+
+        uint64_t sums[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(sums), _mm_sad_epu8(counters, _mm_setzero_si128()));
+        count += static_cast<size_t>(sums[0] + sums[1]);
+    }
+#endif
+    for (; i < length; ++i) {
+        if (!isContinuation(static_cast<unsigned char>(data[i]))) ++count;
+    }
+
+    return count;
+}
+
+size_t Utf8::offsetOfCodePoint(const char* data, size_t length, size_t index) {
+    size_t count = 0;
+    size_t i = 0;
+#if defined(__SSE2__)
+    // Skip whole blocks until the one holding the code point
+    const __m128i continuation_limit = _mm_set1_epi8(-65);
+    for (; i + 16 <= length; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const size_t starts = static_cast<size_t>(
+                __builtin_popcount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, continuation_limit)))));
+        if (count + starts > index) break;
+        count += starts;
+    }
+#endif
+    for (; i < length; ++i) {
+        if (isContinuation(static_cast<unsigned char>(data[i]))) continue;
+        if (count == index) return i;
+        ++count;
+    }
+
+    return count == index ? length : NO_INDEX;
+}
+
+void Utf8::reverseCodePoints(char* data, size_t length) {
+    std::reverse(data, data + length);
+
+    // Each multi-byte sequence is now its continuations followed by its lead byte, so put them back in order
+    size_t start = 0;
+    for (size_t i = 0; i < length; ++i) {
+        if (!isContinuation(static_cast<unsigned char>(data[i]))) {
+            if (i > start) std::reverse(data + start, data + i + 1);
+            start = i + 1;
+        }
+    }
+}
+
+size_t Utf8::toUtf16(const char* data, size_t length, char16_t* output) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    size_t written = 0;
+    size_t i = 0;
+    while (i < length) {
+#if defined(__SSE2__)
+        // Widen runs of ASCII sixteen bytes at a time
+        if (i + 16 <= length) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            if (_mm_movemask_epi8(block) == 0) {
+                const __m128i zero = _mm_setzero_si128();
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written), _mm_unpacklo_epi8(block, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written + 8), _mm_unpackhi_epi8(block, zero));
+                i += 16;
+                written += 16;
+                continue;
+            }
+        }
+#endif
+        if (bytes[i] < 0x80) {
+            output[written++] = bytes[i++];
+            continue;
+        }
+
+        uint32_t code_point;
+        const size_t sequence = decode(bytes + i, length - i, code_point);
+        if (sequence == 0) throw InvalidValueException(invalidMessage("Invalid UTF-8 at byte ", i));
+        i += sequence;
+
+        if (code_point < 0x10000) {
+            output[written++] = static_cast<char16_t>(code_point);
+        } else {
+            code_point -= 0x10000;
+            output[written++] = static_cast<char16_t>(0xD800 | (code_point >> 10));
+            output[written++] = static_cast<char16_t>(0xDC00 | (code_point & 0x3FF));
+        }
+    }
+
+    return written;
+}
+
+size_t Utf8::toUtf32(const char* data, size_t length, char32_t* output) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    size_t written = 0;
+    size_t i = 0;
+    while (i < length) {
+#if defined(__SSE2__)
+        if (i + 16 <= length) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            if (_mm_movemask_epi8(block) == 0) {
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i low = _mm_unpacklo_epi8(block, zero);
+                const __m128i high = _mm_unpackhi_epi8(block, zero);
+                __m128i* destination = reinterpret_cast<__m128i*>(output + written);
+                _mm_storeu_si128(destination, _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(destination + 1, _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(destination + 2, _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(destination + 3, _mm_unpackhi_epi16(high, zero));
+                i += 16;
+                written += 16;
+                continue;
+            }
+        }
+#endif
+        if (bytes[i] < 0x80) {
+            output[written++] = bytes[i++];
+            continue;
+        }
+
+        uint32_t code_point;
+        const size_t sequence = decode(bytes + i, length - i, code_point);
+        if (sequence == 0) throw InvalidValueException(invalidMessage("Invalid UTF-8 at byte ", i));
+        i += sequence;
+        output[written++] = code_point;
+    }
+
+    return written;
+}
+
+size_t Utf8::fromUtf16(const char16_t* data, size_t length, char* output) {
+    size_t written = 0;
+    size_t i = 0;
+    while (i < length) {
+#if defined(__SSE2__)
+        // Narrow runs of ASCII sixteen code units at a time
+        if (i + 16 <= length) {
+            const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 8));
+            const __m128i non_ascii = _mm_and_si128(_mm_or_si128(first, second),
+                                                    _mm_set1_epi16(static_cast<short>(0xFF80)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, _mm_setzero_si128())) == 0xFFFF) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written), _mm_packus_epi16(first, second));
+                i += 16;
+                written += 16;
+                continue;
+            }
+        }
+#endif
+        uint32_t code_point = data[i];
+        if (code_point >= 0xD800 && code_point <= 0xDFFF) {
+            if (code_point > 0xDBFF || i + 1 >= length || data[i + 1] < 0xDC00 || data[i + 1] > 0xDFFF) {
+                throw InvalidValueException(invalidMessage("Unpaired UTF-16 surrogate at index ", i));
+            }
+
+            code_point = 0x10000 + ((code_point - 0xD800) << 10) + (data[i + 1] - 0xDC00);
+            ++i;
+        }
+
+        written += encode(code_point, output + written);
+        ++i;
+    }
+
+    return written;
+}
+
+size_t Utf8::fromUtf32(const char32_t* data, size_t length, char* output) {
+    size_t written = 0;
+    for (size_t i = 0; i < length; ++i) {
+        const uint32_t code_point = data[i];
+        if (code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF)) {
+            throw InvalidValueException(invalidMessage("Invalid code point at index ", i));
+        }
+
+        written += encode(code_point, output + written);
+    }
+
+    return written;
+}
+
+std::u16string Utf8::toUtf16(const StringView& string) {
+    std::u16string result = std::u16string(string.length(), u'\0');
+    result.resize(toUtf16(string.data(), string.length(), &result[0]));
+    return result;
+}
+
+std::u32string Utf8::toUtf32(const StringView& string) {
+    std::u32string result = std::u32string(string.length(), U'\0');
+    result.resize(toUtf32(string.data(), string.length(), &result[0]));
+    return result;
+}
+
+String Utf8::fromUtf16(const std::u16string& string) {
+    std::string result = std::string(string.length() * 3, '\0');
+    result.resize(fromUtf16(string.data(), string.length(), &result[0]));
+    return String(std::move(result));
+}
+
+String Utf8::fromUtf32(const std::u32string& string) {
+    std::string result = std::string(string.length() * 4, '\0');
+    result.resize(fromUtf32(string.data(), string.length(), &result[0]));
+    return String(std::move(result));
+}
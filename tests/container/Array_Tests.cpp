@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include "Array.hpp"
 #include "Exception.hpp"
+#include <utility>
 
 using namespace abraham;
 
@@ -59,6 +60,29 @@ TEST(Array, vector_constructor) {
     EXPECT_EQ(expect, array.std_vector());
 }
 
+TEST(Array, move_constructor) {
+    // Setup
+    Array<int> source = {1, 2, 3};
+    const int* elements = &*source.begin();
+    Array<int> array = std::move(source);
+
+    // Assertion
+    EXPECT_EQ(elements, &*array.begin());
+    EXPECT_EQ(Array<int>({1, 2, 3}), array);
+}
+
+TEST(Array, move_assignment) {
+    // Setup
+    Array<int> source = {1, 2, 3};
+    const int* elements = &*source.begin();
+    Array<int> array = {4};
+    array = std::move(source);
+
+    // Assertion
+    EXPECT_EQ(elements, &*array.begin());
+    EXPECT_EQ(Array<int>({1, 2, 3}), array);
+}
+
 TEST(Array, array_constructor) {
     // Setup
     Array<int> expect = {1, 2, 3};
@@ -0,0 +1,154 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "CharSet.hpp"
+#include "InlineString.hpp"
+#include "String.hpp"
+#include "Tokenizer.hpp"
+
+using namespace abraham;
+
+
+// Constructor
+
+TEST(CharSet, compile_time_constructors) {
+    // Setup
+    constexpr CharSet separators = CharSet(",;|");
+    constexpr CharSet letters = CharSet::range('a', 'z');
+    static_assert(separators.contains(';'), "CharSet should be usable at compile time");
+    static_assert(!ASCII_DIGITS_SET.contains('a'), "CharSet should be usable at compile time");
+
+    // Assertion
+    EXPECT_EQ(3, separators.size());
+    EXPECT_EQ(26, letters.size());
+    EXPECT_TRUE(CharSet().isEmpty());
+    EXPECT_EQ(CharSet(" \t\r\n\v\f"), ASCII_WHITESPACE_SET);
+    EXPECT_EQ(CharSet(String::ASCII_PUNCTUATION.c_str()), ASCII_PUNCTUATION_SET);
+    EXPECT_EQ(CharSet(String::ASCII_HEX_DIGITS.c_str()), ASCII_HEX_DIGITS_SET);
+    EXPECT_EQ(CharSet(String::ASCII_PRINTABLE.c_str()), ASCII_PRINTABLE_SET);
+    EXPECT_EQ(256, CharSet::range('\0', '\xFF').size());
+}
+
+TEST(CharSet, operations) {
+    // Setup
+    CharSet set = CharSet("abc");
+    set.add('\0').add('\xFF').remove('b');
+
+    // Assertion
+    EXPECT_TRUE(set.contains('\0'));
+    EXPECT_TRUE(set.contains('\xFF'));
+    EXPECT_FALSE(set.contains('b'));
+    EXPECT_EQ(4, set.size());
+    EXPECT_EQ(252, (~set).size());
+    EXPECT_EQ(CharSet("ac"), set & CharSet("abcd"));
+    EXPECT_EQ(6, (set | CharSet("xy")).size());
+    EXPECT_EQ(2, CharSet(StringView("a\0a", 3)).size());
+}
+
+// Searching
+
+TEST(CharSet, find) {
+    // Setup
+    std::string text = std::string(40, ' ') + "value" + std::string(40, '\t');
+    CharSet digits = ASCII_DIGITS_SET;
+
+    // Assertion
+    EXPECT_EQ(40, ASCII_WHITESPACE_SET.findFirstNot(text));
+    EXPECT_EQ(44, ASCII_WHITESPACE_SET.findLastNot(text));
+    EXPECT_EQ(0, ASCII_WHITESPACE_SET.findFirst(text));
+    EXPECT_EQ(84, ASCII_WHITESPACE_SET.findLast(text));
+    EXPECT_EQ(StringView::NO_INDEX, digits.findFirst(text));
+    EXPECT_EQ(StringView::NO_INDEX, digits.findLast(text));
+    EXPECT_EQ(StringView::NO_INDEX, ASCII_WHITESPACE_SET.findFirstNot("  \t "));
+    EXPECT_EQ(StringView::NO_INDEX, ASCII_WHITESPACE_SET.findLastNot(""));
+}
+
+TEST(CharSet, find_matches_scalar) {
+    // Setup
+    std::vector<CharSet> sets = {CharSet("x"), ASCII_WHITESPACE_SET, ASCII_DIGITS_SET, ~CharSet("xy"), CharSet()};
+    std::string text;
+    for (int i = 0; i < 200; ++i) {
+        text += "ab x9 y\t"[(i * 7 + i / 13) % 8];
+    }
+
+    // Assertion
+    for (const CharSet& set : sets) {
+        for (size_t length = 0; length <= text.length(); length += 11) {
+            StringView view = StringView(text.data(), length);
+            size_t first = StringView::NO_INDEX, first_not = StringView::NO_INDEX;
+            size_t last = StringView::NO_INDEX, last_not = StringView::NO_INDEX;
+            for (size_t i = 0; i < length; ++i) {
+                if (set.contains(text[i])) {
+                    if (first == StringView::NO_INDEX) first = i;
+                    last = i;
+                } else {
+                    if (first_not == StringView::NO_INDEX) first_not = i;
+                    last_not = i;
+                }
+            }
+
+            ASSERT_EQ(first, set.findFirst(view));
+            ASSERT_EQ(first_not, set.findFirstNot(view));
+            ASSERT_EQ(last, set.findLast(view));
+            ASSERT_EQ(last_not, set.findLastNot(view));
+        }
+    }
+}
+
+// Strings
+
+TEST(CharSet, trim_and_remove) {
+    // Setup
+    String string = String("--==value==--");
+    InlineString<15> field = "0012300";
+    String digits = String("a1b2c3d4e5f6g7h8i9j0 and then some more letters 1234567890 k");
+
+    // Assertion
+    EXPECT_STREQ("value", string.copy().trim(CharSet("-=")).c_string());
+    EXPECT_STREQ("value==--", string.copy().trimLeading(CharSet("-=")).c_string());
+    EXPECT_STREQ("--==value", string.copy().trimTrailing(CharSet("-=")).c_string());
+    EXPECT_STREQ("", String("----").trim(CharSet("-")).c_string());
+    EXPECT_STREQ("123", field.trim(CharSet("0")).c_string());
+    EXPECT_EQ("value", StringView(" value\n").trim(ASCII_WHITESPACE_SET).std_string());
+    EXPECT_STREQ("abcdefghij and then some more letters  k", digits.removeCharacters(ASCII_DIGITS_SET).c_string());
+    EXPECT_STREQ("", String("123").removeCharacters(ASCII_DIGITS_SET).c_string());
+    EXPECT_STREQ("ac", InlineString<7>("a.b.c").removeCharacters(CharSet("b.")).c_string());
+}
+
+TEST(CharSet, remove_matches_scalar) {
+    // Setup
+    std::vector<CharSet> sets = {CharSet("x"), ASCII_WHITESPACE_SET, ASCII_DIGITS_SET, ~CharSet("xy"), CharSet()};
+    std::string text;
+    for (int i = 0; i < 500; ++i) {
+        text += "ab x9 y\t"[(i * 7 + i / 13) % 8];
+    }
+
+    // Assertion
+    for (const CharSet& set : sets) {
+        for (size_t length = 0; length <= text.length(); length += 37) {
+            std::string expected;
+            for (size_t i = 0; i < length; ++i) {
+                if (!set.contains(text[i])) expected += text[i];
+            }
+
+            std::string removed = text.substr(0, length);
+            removed.resize(set.removeFrom(&removed[0], removed.length()));
+            ASSERT_EQ(expected, removed);
+            ASSERT_EQ(expected, String(text.substr(0, length)).removeCharacters(set).std_string());
+        }
+    }
+}
+
+TEST(CharSet, split_on_any) {
+    // Setup
+    std::vector<std::string> tokens;
+    Tokenizer tokenizer = Tokenizer::anyOf("a1b22c333d", ASCII_DIGITS_SET);
+    for (const StringView& token : tokenizer.skipEmpty()) {
+        tokens.push_back(token.std_string());
+    }
+
+    // Assertion
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "c", "d"}), tokens);
+}
@@ -0,0 +1,169 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "ContainerStats.hpp"
+#include "Array.hpp"
+#include "Dictionary.hpp"
+#include "Queue.hpp"
+#include "Stack.hpp"
+#include "String.hpp"
+
+using namespace abraham;
+
+
+TEST(ContainerStats, container_type_names) {
+    // Assertion
+    EXPECT_STREQ("Array", ContainerStats::stringForContainerType(ContainerType::ARRAY).c_string());
+    EXPECT_STREQ("Dictionary", ContainerStats::stringForContainerType(ContainerType::DICTIONARY).c_string());
+    EXPECT_STREQ("Queue", ContainerStats::stringForContainerType(ContainerType::QUEUE).c_string());
+    EXPECT_STREQ("Stack", ContainerStats::stringForContainerType(ContainerType::STACK).c_string());
+    EXPECT_STREQ("String", ContainerStats::stringForContainerType(ContainerType::STRING).c_string());
+}
+
+TEST(ContainerStats, snapshot_to_string) {
+    // Setup
+    String report = ContainerStats::snapshot().toString();
+
+    // Assertion
+    EXPECT_TRUE(report.contains("Array"));
+    EXPECT_TRUE(report.contains("regrowths="));
+    EXPECT_EQ(6, report.split("\n").size());
+}
+
+#ifndef ABRAHAM_CONTAINER_STATS
+
+TEST(ContainerStats, disabled) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    Array<int> copy = array;
+    ContainerStatsSnapshot snapshot = ContainerStats::snapshot();
+
+    // Assertion
+    EXPECT_FALSE(ContainerStats::isEnabled());
+    EXPECT_EQ(0, snapshot.countersForType(ContainerType::ARRAY).constructions);
+    EXPECT_EQ(0, snapshot.countersForType(ContainerType::ARRAY).copies);
+    EXPECT_EQ(sizeof(std::vector<int>), sizeof(Array<int>));
+    EXPECT_EQ(sizeof(std::string), sizeof(String));
+}
+
+#else
+
+TEST(ContainerStats, array_counters) {
+    // Setup
+    ContainerStats::reset();
+    ContainerCounters before = ContainerStats::snapshot().countersForType(ContainerType::ARRAY);
+    {
+        Array<int> array = Array<int>();
+        for (int i = 0; i < 100; ++i) {
+            array.add(i);
+        }
+        Array<int> copy = array;
+        ContainerCounters during = ContainerStats::snapshot().countersForType(ContainerType::ARRAY);
+
+        // Assertion
+        EXPECT_EQ(2, during.constructions);
+        EXPECT_EQ(1, during.copies);
+        EXPECT_LE(1, during.regrowths);
+        EXPECT_LE(during.regrowths, during.allocations);
+        EXPECT_EQ(before.bytesUsed + 200 * static_cast<int64_t>(sizeof(int)), during.bytesUsed);
+        EXPECT_LE(during.bytesUsed, during.bytesReserved);
+    }
+    ContainerCounters after = ContainerStats::snapshot().countersForType(ContainerType::ARRAY);
+
+    // Assertion
+    EXPECT_TRUE(ContainerStats::isEnabled());
+    EXPECT_EQ(2, after.destructions);
+    EXPECT_EQ(before.bytesUsed, after.bytesUsed);
+    EXPECT_EQ(before.bytesReserved, after.bytesReserved);
+}
+
+TEST(ContainerStats, dictionary_nodes) {
+    // Setup
+    ContainerStats::reset();
+    int64_t nodes = ContainerStats::snapshot().countersForType(ContainerType::DICTIONARY).nodes;
+    {
+        Dictionary<int, int> dictionary = Dictionary<int, int>();
+        for (int i = 0; i < 10; ++i) {
+            dictionary.addObject(i, i);
+        }
+        dictionary.remove(3);
+        ContainerCounters during = ContainerStats::snapshot().countersForType(ContainerType::DICTIONARY);
+
+        // Assertion
+        EXPECT_EQ(nodes + 9, during.nodes);
+        EXPECT_EQ(10, during.allocations);
+    }
+
+    // Assertion
+    EXPECT_EQ(nodes, ContainerStats::snapshot().countersForType(ContainerType::DICTIONARY).nodes);
+}
+
+TEST(ContainerStats, queue_and_stack) {
+    // Setup
+    ContainerStats::reset();
+    Queue<int> queue = Queue<int>();
+    Stack<int> stack = Stack<int>();
+    queue.push(1).push(2);
+    stack.push(1);
+    Queue<int> queue_copy = queue.copy();
+    ContainerStatsSnapshot snapshot = ContainerStats::snapshot();
+
+    // Assertion
+    EXPECT_EQ(2, snapshot.countersForType(ContainerType::QUEUE).constructions);
+    EXPECT_EQ(1, snapshot.countersForType(ContainerType::STACK).constructions);
+    EXPECT_LE(static_cast<int64_t>(4 * sizeof(int)), snapshot.countersForType(ContainerType::QUEUE).bytesUsed);
+}
+
+TEST(ContainerStats, string_moves) {
+    // Setup
+    String source = String("a string long enough to be allocated on the heap");
+    ContainerStats::reset();
+    String copy = source;
+    String moved = std::move(copy);
+    ContainerCounters counters = ContainerStats::snapshot().countersForType(ContainerType::STRING);
+
+    // Assertion
+    EXPECT_EQ(1, counters.copies);
+    EXPECT_EQ(1, counters.moves);
+    EXPECT_LE(1, counters.allocations);
+}
+
+TEST(ContainerStats, array_moves) {
+    // Setup
+    Array<int> source = {1, 2, 3};
+    ContainerStats::reset();
+    Array<int> copy = source;
+    Array<int> moved = std::move(copy);
+    Array<int> assigned = Array<int>();
+    assigned = std::move(moved);
+    ContainerCounters counters = ContainerStats::snapshot().countersForType(ContainerType::ARRAY);
+
+    // Assertion
+    EXPECT_EQ(1, counters.copies);
+    EXPECT_EQ(2, counters.moves);
+    EXPECT_EQ(3, assigned.size());
+}
+
+TEST(ContainerStats, move_bytes) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    Dictionary<int, int> dictionary = {{1, 1}, {2, 2}};
+    ContainerCounters array_before = ContainerStats::snapshot().countersForType(ContainerType::ARRAY);
+    ContainerCounters dictionary_before = ContainerStats::snapshot().countersForType(ContainerType::DICTIONARY);
+    Array<int> moved_array = std::move(array);
+    Array<int> assigned_array = Array<int>();
+    assigned_array = std::move(moved_array);
+    Dictionary<int, int> moved_dictionary = std::move(dictionary);
+    ContainerCounters array_after = ContainerStats::snapshot().countersForType(ContainerType::ARRAY);
+    ContainerCounters dictionary_after = ContainerStats::snapshot().countersForType(ContainerType::DICTIONARY);
+
+    // Assertion
+    EXPECT_EQ(array_before.bytesUsed, array_after.bytesUsed);
+    EXPECT_EQ(array_before.bytesReserved, array_after.bytesReserved);
+    EXPECT_EQ(dictionary_before.bytesUsed, dictionary_after.bytesUsed);
+    EXPECT_EQ(dictionary_before.nodes, dictionary_after.nodes);
+}
+
+#endif
@@ -0,0 +1,191 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "FuzzyMatcher.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    /**
+     * The edit distance computed with the full table, as a reference.
+     */
+    size_t referenceDistance(const std::string& first, const std::string& second) {
+        std::vector<size_t> row = std::vector<size_t>(second.length() + 1);
+        for (size_t j = 0; j <= second.length(); ++j) row[j] = j;
+
+        for (size_t i = 1; i <= first.length(); ++i) {
+            size_t diagonal = row[0];
+            row[0] = i;
+            for (size_t j = 1; j <= second.length(); ++j) {
+                const size_t above = row[j];
+                row[j] = std::min({above + 1, row[j - 1] + 1, diagonal + (first[i - 1] == second[j - 1] ? 0 : 1)});
+                diagonal = above;
+            }
+        }
+
+        return row[second.length()];
+    }
+
+    std::string randomString(std::mt19937& random, size_t length, char alphabet) {
+        std::string string;
+        for (size_t i = 0; i < length; ++i) {
+            string += static_cast<char>('a' + random() % alphabet);
+        }
+
+        return string;
+    }
+
+    /**
+     * Applies a number of random insertions, deletions and substitutions.
+     */
+    std::string mutate(std::mt19937& random, std::string string, size_t edits) {
+        for (size_t edit = 0; edit < edits; ++edit) {
+            const size_t position = string.empty() ? 0 : random() % string.length();
+            switch (random() % 3) {
+                case 0: string.insert(position, 1, 'x'); break;
+                case 1: if (!string.empty()) string.erase(position, 1); break;
+                default: if (!string.empty()) string[position] = 'y'; break;
+            }
+        }
+
+        return string;
+    }
+}
+
+
+// Distance
+
+TEST(FuzzyMatcher, distance) {
+    // Setup
+    FuzzyMatcher matcher = FuzzyMatcher("kitten");
+
+    // Assertion
+    EXPECT_EQ(3, matcher.distance("sitting"));
+    EXPECT_EQ(0, matcher.distance("kitten"));
+    EXPECT_EQ(6, matcher.distance(""));
+    EXPECT_EQ(1, matcher.distance("kittens"));
+    EXPECT_EQ(3, FuzzyMatcher("").distance("abc"));
+    EXPECT_EQ(0, FuzzyMatcher("").distance(""));
+}
+
+TEST(FuzzyMatcher, bounded_distance) {
+    // Setup
+    FuzzyMatcher matcher = FuzzyMatcher("kitten");
+
+    // Assertion
+    EXPECT_EQ(3, matcher.distance("sitting", 3));
+    EXPECT_EQ(3, matcher.distance("sitting", 2));
+    EXPECT_EQ(1, matcher.distance("sitting", 0));
+    EXPECT_TRUE(matcher.withinDistance("sitting", 3));
+    EXPECT_FALSE(matcher.withinDistance("sitting", 2));
+    EXPECT_FALSE(matcher.withinDistance("a much longer string", 5));
+}
+
+TEST(FuzzyMatcher, owns_query) {
+    // Setup
+    String query = String("abc");
+    FuzzyMatcher matcher = FuzzyMatcher(query);
+    query.setValue("xyz");
+
+    // Assertion
+    EXPECT_EQ("abc", matcher.query().std_string());
+    EXPECT_EQ(0, matcher.distance("abc"));
+}
+
+TEST(FuzzyMatcher, long_query) {
+    // Setup
+    std::string query = std::string(100, 'a') + std::string(100, 'b');
+    std::string text = std::string(99, 'a') + "c" + std::string(101, 'b');
+    FuzzyMatcher matcher = FuzzyMatcher(query);
+
+    // Assertion
+    EXPECT_EQ(2, matcher.distance(text));
+    EXPECT_TRUE(matcher.withinDistance(text, 2));
+    EXPECT_FALSE(matcher.withinDistance(text, 1));
+    EXPECT_EQ(200, matcher.distance(std::string(200, 'z')));
+    EXPECT_EQ(11, matcher.distance(std::string(200, 'z'), 10));
+}
+
+TEST(FuzzyMatcher, matches_reference) {
+    // Setup
+    std::mt19937 random = std::mt19937(17);
+    std::vector<size_t> query_lengths = {1, 2, 5, 63, 64, 65, 100, 127, 128, 129, 200, 300};
+
+    // Assertion
+    for (size_t query_length : query_lengths) {
+        for (int round = 0; round < 30; ++round) {
+            const std::string query = randomString(random, query_length, static_cast<char>(2 + round % 3));
+            const std::string text = round % 2 == 0 ? mutate(random, query, random() % 40)
+                                                    : randomString(random, random() % 320, 3);
+            const size_t expected = referenceDistance(query, text);
+            FuzzyMatcher matcher = FuzzyMatcher(query);
+
+            ASSERT_EQ(expected, matcher.distance(text)) << query << " " << text;
+            ASSERT_EQ(expected, FuzzyMatcher::distanceBetween(query, text)) << query << " " << text;
+            ASSERT_EQ(expected, FuzzyMatcher::distanceBetween(text, query)) << query << " " << text;
+
+            for (size_t max_distance : {size_t(0), size_t(1), expected - 1, expected, expected + 1, size_t(25)}) {
+                if (max_distance == FuzzyMatcher::NO_LIMIT) continue;
+                const size_t bounded = std::min(expected, max_distance + 1);
+                ASSERT_EQ(bounded, matcher.distance(text, max_distance)) << query << " " << text << " " << max_distance;
+                ASSERT_EQ(bounded, FuzzyMatcher::distanceBetween(text, query, max_distance)) << query << " " << text;
+                ASSERT_EQ(expected <= max_distance, matcher.withinDistance(text, max_distance));
+            }
+        }
+    }
+}
+
+// Batches
+
+TEST(FuzzyMatcher, distances) {
+    // Setup
+    std::mt19937 random = std::mt19937(5);
+    const std::string query = randomString(random, 80, 4);
+    FuzzyMatcher matcher = FuzzyMatcher(query);
+    Array<String> strings = Array<String>();
+    StringTable table = StringTable();
+    std::vector<size_t> expected;
+
+    for (size_t i = 0; i < 500; ++i) {
+        const std::string text = mutate(random, query, random() % 10);
+        strings.add(String(text));
+        table.add(text);
+        expected.push_back(referenceDistance(query, text));
+    }
+
+    // Assertion
+    EXPECT_EQ(Array<size_t>(expected), matcher.distances(strings));
+    EXPECT_EQ(Array<size_t>(expected), matcher.distances(strings, 1));
+    EXPECT_EQ(Array<size_t>(expected), matcher.distances(table, 3));
+    EXPECT_EQ(Array<size_t>(), matcher.distances(Array<String>()));
+}
+
+TEST(FuzzyMatcher, find_within) {
+    // Setup
+    std::mt19937 random = std::mt19937(8);
+    const std::string query = randomString(random, 30, 4);
+    FuzzyMatcher matcher = FuzzyMatcher(query);
+    Array<String> strings = Array<String>();
+    StringTable table = StringTable();
+    std::vector<size_t> expected;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        const std::string text = mutate(random, query, random() % 8);
+        strings.add(String(text));
+        table.add(text);
+        if (referenceDistance(query, text) <= 3) expected.push_back(i);
+    }
+
+    // Assertion
+    EXPECT_EQ(Array<size_t>(expected), matcher.findWithin(strings, 3));
+    EXPECT_EQ(Array<size_t>(expected), matcher.findWithin(table, 3, 4));
+    EXPECT_EQ(Array<size_t>(expected), matcher.findWithin(table, 3, 1));
+}
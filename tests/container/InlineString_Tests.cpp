@@ -0,0 +1,240 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "InlineString.hpp"
+
+using namespace abraham;
+
+
+typedef InlineString<31> Field;
+typedef InlineString<8, InlineStringOverflow::TRUNCATE> ShortField;
+
+
+// Constructor
+
+TEST(InlineString, default_constructor) {
+    // Setup
+    Field field = Field();
+
+    // Assertion
+    EXPECT_EQ(0, field.length());
+    EXPECT_STREQ("", field.c_string());
+    EXPECT_TRUE(field.isInline());
+    EXPECT_EQ(31, field.capacity());
+}
+
+TEST(InlineString, string_conversions) {
+    // Setup
+    String source = String("request_latency_ms");
+    Field field = source;
+    String result = field.string();
+
+    // Assertion
+    EXPECT_TRUE(field.isInline());
+    EXPECT_STREQ("request_latency_ms", field.c_string());
+    EXPECT_EQ(source, result);
+    EXPECT_EQ("request_latency_ms", field.std_string());
+}
+
+TEST(InlineString, copy_and_move) {
+    // Setup
+    Field inline_field = "short";
+    Field heap_field = "a value that is much longer than thirty one bytes";
+    Field inline_copy = inline_field;
+    Field heap_copy = heap_field;
+    Field heap_moved = std::move(heap_copy);
+
+    // Assertion
+    EXPECT_EQ(inline_field, inline_copy);
+    EXPECT_FALSE(heap_field.isInline());
+    EXPECT_EQ(heap_field, heap_moved);
+    EXPECT_EQ(0, heap_copy.length());
+    EXPECT_TRUE(heap_copy.isInline());
+}
+
+// Overflow
+
+TEST(InlineString, spill) {
+    // Setup
+    Field field = "0123456789012345678901234567890";
+    EXPECT_TRUE(field.isInline());
+    field.append("ab");
+
+    // Assertion
+    EXPECT_FALSE(field.isInline());
+    EXPECT_EQ(33, field.length());
+    EXPECT_STREQ("0123456789012345678901234567890ab", field.c_string());
+}
+
+TEST(InlineString, truncate) {
+    // Setup
+    ShortField field = "abcdef";
+    field.append("ghijk");
+
+    // Assertion
+    EXPECT_TRUE(field.isInline());
+    EXPECT_STREQ("abcdefgh", field.c_string());
+    EXPECT_STREQ("12345678", ShortField("123456789").c_string());
+    EXPECT_STREQ("xxabcdef", field.padLeft("x", 2).c_string());
+}
+
+TEST(InlineString, truncate_insert_keeps_prefix) {
+    // Setup
+    ShortField field = "abcdefgh";
+    field.insert("XYZ", 2);
+
+    // Assertion
+    EXPECT_STREQ("abXYZcde", field.c_string());
+}
+
+// Editing
+
+TEST(InlineString, append_self) {
+    // Setup
+    Field field = "abc";
+    field.append(field).append(field);
+
+    // Assertion
+    EXPECT_STREQ("abcabcabcabc", field.c_string());
+}
+
+TEST(InlineString, substring) {
+    // Setup
+    Field field = "Hello World";
+
+    // Assertion
+    EXPECT_STREQ("lo W", field.substring(3, 7).c_string());
+    EXPECT_STREQ("World", field.substringFromIndex(6).c_string());
+    EXPECT_STREQ("Hello", field.substringToIndex(5).c_string());
+    EXPECT_THROW(field.substring(5, 3), InvalidArgumentException);
+    EXPECT_THROW(field.substring(3, 20), OutOfBoundsException);
+}
+
+TEST(InlineString, split) {
+    // Setup
+    Field field = "a,bb,,ccc";
+    std::vector<Field> parts = field.split(",");
+    std::vector<Field> characters = Field("xyz").split("");
+
+    // Assertion
+    ASSERT_EQ(4, parts.size());
+    EXPECT_STREQ("a", parts[0].c_string());
+    EXPECT_STREQ("bb", parts[1].c_string());
+    EXPECT_STREQ("", parts[2].c_string());
+    EXPECT_STREQ("ccc", parts[3].c_string());
+    ASSERT_EQ(3, characters.size());
+    EXPECT_STREQ("z", characters[2].c_string());
+}
+
+TEST(InlineString, trim) {
+    // Assertion
+    EXPECT_STREQ("value", Field("  value \t\n").trim().c_string());
+    EXPECT_STREQ("value \n", Field("  value \n").trimLeading().c_string());
+    EXPECT_STREQ("  value", Field("  value \n").trimTrailing().c_string());
+    EXPECT_STREQ("value", Field("xxvaluexx").trim("x").c_string());
+    EXPECT_STREQ("", Field("   ").trim().c_string());
+}
+
+TEST(InlineString, case_conversions) {
+    // Assertion
+    EXPECT_STREQ("hello world", Field("Hello World").toLowerCase().c_string());
+    EXPECT_STREQ("HELLO WORLD", Field("Hello World").toUpperCase().c_string());
+    EXPECT_STREQ("Hello World", Field("hello world").toCapitalCase().c_string());
+    EXPECT_STREQ("hELLO wORLD", Field("Hello World").swapCase().c_string());
+    EXPECT_STREQ("", Field().toCapitalCase().c_string());
+}
+
+TEST(InlineString, replace_and_remove) {
+    // Assertion
+    EXPECT_STREQ("a-b.c.d", Field("a.b.c.d").replace(".", "-").c_string());
+    EXPECT_STREQ("a.b.c-d", Field("a.b.c.d").replaceLast(".", "-").c_string());
+    EXPECT_STREQ("a::b::c::d", Field("a.b.c.d").replaceAll(".", "::").c_string());
+    EXPECT_STREQ("aa", Field("a").replaceAll("a", "aa").c_string());
+    EXPECT_STREQ("abcd", Field("a.b.c.d").removeAll(".").c_string());
+    EXPECT_STREQ("ab.c.d", Field("a.b.c.d").remove(".").c_string());
+    EXPECT_STREQ("a.b.cd", Field("a.b.c.d").removeLast(".").c_string());
+    EXPECT_STREQ("ad", Field("abcd").removeRange(1, 3).c_string());
+    EXPECT_STREQ("hll wrld", Field("hello world").removeCharacters("aeiou").c_string());
+}
+
+TEST(InlineString, pad_insert_reverse) {
+    // Assertion
+    EXPECT_STREQ("--x--", Field("x").pad("-", 2).c_string());
+    EXPECT_STREQ("aXYZbc", Field("abc").insert("XYZ", 1).c_string());
+    EXPECT_STREQ("cba", Field("abc").reverse().c_string());
+    EXPECT_THROW(Field("abc").insert("x", 3), OutOfBoundsException);
+}
+
+TEST(InlineString, pad_many) {
+    // Setup
+    Field field = Field("abc");
+    field.padLeft("<>", 1000).padRight("|", 500);
+    Field self = Field("ab");
+    self.padLeft(self, 3);
+
+    // Assertion
+    EXPECT_EQ(2503, field.length());
+    EXPECT_EQ(0, std::string(field.c_string(), 6).compare("<><><>"));
+    EXPECT_EQ(0, std::string(field.c_string() + 1998, 8).compare("<>abc|||"));
+    EXPECT_STREQ("abababab", self.c_string());
+    EXPECT_STREQ("<><><><>", ShortField("abc|").padLeft("<>", 100).c_string());
+    EXPECT_STREQ("<>abc|", ShortField("abc|").padLeft("<>", 1).c_string());
+    EXPECT_STREQ("abc|||||", ShortField("abc").padRight("|", 100).c_string());
+}
+
+// Searching
+
+TEST(InlineString, index_of) {
+    // Setup
+    Field field = "abcabc";
+
+    // Assertion
+    EXPECT_EQ(1, field.indexOf("bc"));
+    EXPECT_EQ(4, field.indexOf("bc", 2));
+    EXPECT_EQ(4, field.indexOfLast("bc"));
+    EXPECT_EQ(1, field.indexOfLast("bc", 3));
+    EXPECT_EQ(Field::NO_INDEX, field.indexOf("x"));
+    EXPECT_EQ(Field::NO_INDEX, field.indexOf("abc", 10));
+    EXPECT_TRUE(field.contains("cab"));
+    EXPECT_FALSE(field.contains("cc"));
+}
+
+// Comparison
+
+TEST(InlineString, comparison) {
+    // Assertion
+    EXPECT_TRUE(Field("abc") == Field("abc"));
+    EXPECT_TRUE(Field("abc") != Field("abd"));
+    EXPECT_TRUE(Field("ab") < Field("abc"));
+    EXPECT_TRUE(Field("b") > Field("abc"));
+    EXPECT_TRUE(Field("ABC").isEqualTo("abc", false));
+    EXPECT_FALSE(Field("ABC").isEqualTo("abc"));
+    EXPECT_EQ(0, Field("ABC").compare("abc", false));
+}
+
+// Numeric Conversions
+
+TEST(InlineString, numeric_conversions) {
+    // Assertion
+    EXPECT_EQ(-10, Field("-10").intValue());
+    EXPECT_EQ(10L, Field("10").longValue());
+    EXPECT_EQ(9000000000LL, Field("9000000000").longLongValue());
+    EXPECT_EQ(10U, Field("10").unsignedValue());
+    EXPECT_EQ(10UL, Field("10").unsignedLongValue());
+    EXPECT_EQ(10ULL, Field("10").unsignedLongLongValue());
+    EXPECT_FLOAT_EQ(1.234f, Field("1.234").floatValue());
+    EXPECT_DOUBLE_EQ(1.234, Field("1.234").doubleValue());
+    EXPECT_DOUBLE_EQ(1.234, (double) Field("1.234").longDoubleValue());
+    EXPECT_TRUE(Field("Yes").boolValue());
+    EXPECT_FALSE(Field("0").boolValue());
+}
+
+TEST(InlineString, numeric_conversions_invalid) {
+    // Assertion
+    EXPECT_THROW(Field("test").intValue(), InvalidValueException);
+    EXPECT_THROW(Field("9000000000").intValue(), InvalidValueException);
+    EXPECT_THROW(Field("").doubleValue(), InvalidValueException);
+    EXPECT_THROW(Field("maybe").boolValue(), InvalidValueException);
+}
@@ -0,0 +1,132 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "InternTable.hpp"
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+using namespace abraham;
+
+
+// Atom
+
+TEST(InternTable, empty_atom) {
+    // Setup
+    InternTable table;
+    Atom atom = Atom();
+
+    // Assertion
+    EXPECT_TRUE(atom.isEmpty());
+    EXPECT_EQ(0, atom.length());
+    EXPECT_STREQ("", atom.c_string());
+    EXPECT_EQ(atom, table.intern(""));
+    EXPECT_TRUE(table.contains(""));
+    EXPECT_EQ(0, table.size());
+}
+
+TEST(InternTable, atom_text) {
+    // Setup
+    InternTable table;
+    Atom atom = table.intern("main.cpp");
+
+    // Assertion
+    EXPECT_FALSE(atom.isEmpty());
+    EXPECT_EQ(8, atom.length());
+    EXPECT_STREQ("main.cpp", atom.c_string());
+    EXPECT_EQ(StringView("main.cpp"), atom.view());
+    EXPECT_STREQ("main.cpp", atom.toString().c_string());
+}
+
+
+// Intern
+
+TEST(InternTable, intern_same_text) {
+    // Setup
+    InternTable table;
+    String name = String("requests.count");
+    Atom first = table.intern(name);
+    Atom second = table.intern(std::string("requests.count"));
+    Atom other = table.intern("requests.bytes");
+
+    // Assertion
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first.c_string(), second.c_string());
+    EXPECT_EQ(first.hash(), second.hash());
+    EXPECT_NE(first, other);
+    EXPECT_TRUE(first < other || other < first);
+    EXPECT_EQ(2, table.size());
+}
+
+TEST(InternTable, intern_many) {
+    // Setup
+    InternTable table;
+    std::vector<Atom> atoms;
+    for (int i = 0; i < 5000; ++i) {
+        atoms.push_back(table.intern(std::string("name") + std::to_string(i)));
+    }
+
+    // Assertion
+    EXPECT_EQ(5000, table.size());
+    for (int i = 0; i < 5000; ++i) {
+        std::string text = std::string("name") + std::to_string(i);
+        EXPECT_EQ(atoms[i], table.intern(text));
+        EXPECT_EQ(atoms[i], table.find(text));
+        EXPECT_STREQ(text.c_str(), atoms[i].c_string());
+    }
+}
+
+TEST(InternTable, find) {
+    // Setup
+    InternTable table;
+    Atom atom = table.intern("present");
+
+    // Assertion
+    EXPECT_EQ(atom, table.find("present"));
+    EXPECT_TRUE(table.find("absent").isEmpty());
+    EXPECT_TRUE(table.contains("present"));
+    EXPECT_FALSE(table.contains("absent"));
+    EXPECT_EQ(1, table.size());
+}
+
+TEST(InternTable, std_hash) {
+    // Setup
+    InternTable table;
+    std::unordered_set<Atom> set;
+    set.insert(table.intern("a"));
+    set.insert(table.intern("b"));
+    set.insert(table.intern("a"));
+
+    // Assertion
+    EXPECT_EQ(2, set.size());
+    EXPECT_EQ(1, set.count(table.intern("b")));
+}
+
+TEST(InternTable, threads) {
+    // Setup
+    InternTable table;
+    const int thread_count = 4;
+    std::vector<std::vector<Atom>> results = std::vector<std::vector<Atom>>(thread_count);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&table, &results, t]() {
+            for (int i = 0; i < 2000; ++i) {
+                results[t].push_back(table.intern(std::string("key") + std::to_string((i * (t + 1)) % 2000)));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Assertion
+    EXPECT_EQ(2000, table.size());
+    for (int t = 0; t < thread_count; ++t) {
+        for (int i = 0; i < 2000; ++i) {
+            std::string text = std::string("key") + std::to_string((i * (t + 1)) % 2000);
+            EXPECT_EQ(table.find(text), results[t][i]);
+        }
+    }
+}
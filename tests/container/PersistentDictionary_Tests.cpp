@@ -0,0 +1,323 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "PersistentDictionary.hpp"
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace abraham;
+
+
+// Helper key whose hashes always collide, to exercise collision nodes
+struct CollidingKey {
+    int value;
+
+    bool operator==(const CollidingKey& key) const { return value == key.value; }
+    bool operator<(const CollidingKey& key) const { return value < key.value; }
+};
+
+namespace std {
+    template<>
+    struct hash<CollidingKey> {
+        size_t operator()(const CollidingKey&) const { return 42; }
+    };
+}
+
+
+// Constructor
+
+TEST(PersistentDictionary, default_constructor) {
+    // Setup
+    PersistentDictionary<char, int> dictionary = PersistentDictionary<char, int>();
+
+    // Assertion
+    EXPECT_EQ(0, dictionary.size());
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_TRUE(dictionary.begin() == dictionary.end());
+}
+
+TEST(PersistentDictionary, initializer_list_constructor) {
+    // Setup
+    PersistentDictionary<char, int> dictionary = {{'a', 1}, {'b', 2}};
+    std::map<char, int> expect = {{'a', 1}, {'b', 2}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary.std_map());
+    EXPECT_EQ(2, dictionary.size());
+}
+
+TEST(PersistentDictionary, dictionary_constructor) {
+    // Setup
+    Dictionary<char, int> source = {{'a', 1}, {'b', 2}};
+    PersistentDictionary<char, int> dictionary = PersistentDictionary<char, int>(source);
+
+    // Assertion
+    EXPECT_EQ(source.std_map(), dictionary.std_map());
+    EXPECT_TRUE(source == dictionary.dictionary());
+}
+
+TEST(PersistentDictionary, copy_shares_structure) {
+    // Setup
+    PersistentDictionary<char, int> dictionary = {{'a', 1}, {'b', 2}};
+    PersistentDictionary<char, int> copy = dictionary.copy();
+
+    // Assertion
+    EXPECT_TRUE(copy.sharesStructureWith(dictionary));
+    EXPECT_TRUE(copy == dictionary);
+}
+
+// AddObject
+
+TEST(PersistentDictionary, add_object_valid) {
+    // Setup
+    PersistentDictionary<char, int> original = {{'a', 1}};
+    PersistentDictionary<char, int> updated = original.addObject('b', 2);
+
+    // Assertion
+    EXPECT_EQ(1, original.size());
+    EXPECT_FALSE(original.containsKey('b'));
+    EXPECT_EQ(2, updated.size());
+    EXPECT_EQ(2, updated.objectForKey('b'));
+    EXPECT_EQ(1, updated.objectForKey('a'));
+}
+
+TEST(PersistentDictionary, add_object_invalid) {
+    // Setup
+    PersistentDictionary<char, int> dictionary = {{'a', 1}};
+
+    // Assertion
+    EXPECT_THROW(dictionary.addObject('a', 2), InvalidArgumentException);
+}
+
+TEST(PersistentDictionary, set_object) {
+    // Setup
+    PersistentDictionary<char, int> original = {{'a', 1}};
+    PersistentDictionary<char, int> updated = original.setObject('a', 5).setObject('b', 2);
+
+    // Assertion
+    EXPECT_EQ(1, original.objectForKey('a'));
+    EXPECT_EQ(5, updated.objectForKey('a'));
+    EXPECT_EQ(2, updated.objectForKey('b'));
+    EXPECT_EQ(2, updated.size());
+}
+
+// Replace
+
+TEST(PersistentDictionary, replace_valid) {
+    // Setup
+    PersistentDictionary<char, int> original = {{'a', 1}, {'b', 2}};
+    PersistentDictionary<char, int> updated = original.replace('b', 3);
+    std::map<char, int> expect = {{'a', 1}, {'b', 3}};
+
+    // Assertion
+    EXPECT_EQ(expect, updated.std_map());
+    EXPECT_EQ(2, original.objectForKey('b'));
+}
+
+TEST(PersistentDictionary, replace_invalid) {
+    // Setup
+    PersistentDictionary<char, int> dictionary = {{'a', 1}};
+
+    // Assertion
+    EXPECT_THROW(dictionary.replace('b', 2), InvalidArgumentException);
+}
+
+// Remove
+
+TEST(PersistentDictionary, remove_valid) {
+    // Setup
+    PersistentDictionary<char, int> original = {{'a', 1}, {'b', 2}, {'c', 3}};
+    PersistentDictionary<char, int> updated = original.remove('b');
+    std::map<char, int> expect = {{'a', 1}, {'c', 3}};
+
+    // Assertion
+    EXPECT_EQ(expect, updated.std_map());
+    EXPECT_EQ(3, original.size());
+    EXPECT_EQ(2, updated.size());
+}
+
+TEST(PersistentDictionary, remove_invalid) {
+    // Setup
+    PersistentDictionary<char, int> original = {{'a', 1}};
+    PersistentDictionary<char, int> updated = original.remove('z');
+
+    // Assertion
+    EXPECT_TRUE(updated.sharesStructureWith(original));
+}
+
+TEST(PersistentDictionary, remove_objects) {
+    // Setup
+    PersistentDictionary<char, int> original = {{'a', 1}, {'b', 2}, {'c', 3}};
+    PersistentDictionary<char, int> updated = original.removeObjects({'a', 'c', 'z'});
+    std::map<char, int> expect = {{'b', 2}};
+
+    // Assertion
+    EXPECT_EQ(expect, updated.std_map());
+    EXPECT_EQ(3, original.size());
+}
+
+// ObjectForKey
+
+TEST(PersistentDictionary, object_for_key_invalid) {
+    // Setup
+    PersistentDictionary<char, int> dictionary = {{'a', 1}};
+
+    // Assertion
+    EXPECT_THROW(dictionary.objectForKey('b'), InvalidArgumentException);
+}
+
+// Keys and Values
+
+TEST(PersistentDictionary, get_keys_and_values) {
+    // Setup
+    PersistentDictionary<char, int> dictionary = {{'a', 1}, {'b', 2}, {'c', 3}};
+    Array<char> keys = dictionary.getKeys().sort();
+    Array<int> values = dictionary.getValues().sort();
+
+    // Assertion
+    EXPECT_EQ(Array<char>({'a', 'b', 'c'}), keys);
+    EXPECT_EQ(Array<int>({1, 2, 3}), values);
+}
+
+// Equality
+
+TEST(PersistentDictionary, equality) {
+    // Setup
+    PersistentDictionary<char, int> first = {{'a', 1}, {'b', 2}};
+    PersistentDictionary<char, int> second = PersistentDictionary<char, int>().addObject('b', 2).addObject('a', 1);
+    PersistentDictionary<char, int> third = second.replace('a', 5);
+
+    // Assertion
+    EXPECT_TRUE(first == second);
+    EXPECT_TRUE(first.isEqualTo(second));
+    EXPECT_TRUE(first != third);
+}
+
+// Large Contents
+
+TEST(PersistentDictionary, many_versions) {
+    // Setup
+    PersistentDictionary<int, int> dictionary = PersistentDictionary<int, int>();
+    std::vector<PersistentDictionary<int, int>> versions;
+    for (int i = 0; i < 5000; ++i) {
+        versions.push_back(dictionary);
+        dictionary = dictionary.addObject(i, i * 2);
+    }
+
+    // Assertion
+    EXPECT_EQ(5000, dictionary.size());
+    for (int i = 0; i < 5000; ++i) {
+        EXPECT_EQ(i * 2, dictionary.objectForKey(i));
+        EXPECT_EQ(static_cast<size_t>(i), versions[i].size());
+        EXPECT_FALSE(versions[i].containsKey(i));
+    }
+
+    size_t count = 0;
+    for (const std::pair<int, int>& entry : dictionary) {
+        EXPECT_EQ(entry.first * 2, entry.second);
+        ++count;
+    }
+    EXPECT_EQ(5000, count);
+
+    for (int i = 0; i < 5000; i += 2) {
+        dictionary = dictionary.remove(i);
+    }
+    EXPECT_EQ(2500, dictionary.size());
+    EXPECT_FALSE(dictionary.containsKey(0));
+    EXPECT_TRUE(dictionary.containsKey(1));
+    EXPECT_EQ(5000, versions.back().size() + 1);
+}
+
+TEST(PersistentDictionary, hash_collisions) {
+    // Setup
+    PersistentDictionary<CollidingKey, int> dictionary = PersistentDictionary<CollidingKey, int>();
+    for (int i = 0; i < 10; ++i) {
+        dictionary = dictionary.addObject({i}, i);
+    }
+    PersistentDictionary<CollidingKey, int> removed = dictionary.remove({3}).remove({7});
+
+    // Assertion
+    EXPECT_EQ(10, dictionary.size());
+    EXPECT_EQ(8, removed.size());
+    EXPECT_EQ(5, removed.objectForKey({5}));
+    EXPECT_FALSE(removed.containsKey({3}));
+    EXPECT_TRUE(dictionary.containsKey({3}));
+
+    for (int i = 0; i < 10; ++i) {
+        removed = removed.remove({i});
+    }
+    EXPECT_TRUE(removed.isEmpty());
+}
+
+// Transient
+
+TEST(PersistentDictionary, transient_batch) {
+    // Setup
+    PersistentDictionary<std::string, int> original = {{"zero", 0}};
+    TransientDictionary<std::string, int> transient = original.transient();
+    for (int i = 1; i <= 1000; ++i) {
+        transient.setObject(std::to_string(i), i);
+    }
+    transient.remove("zero").replace("1", 100);
+    PersistentDictionary<std::string, int> result = transient.persistent();
+
+    // Assertion
+    EXPECT_EQ(1, original.size());
+    EXPECT_EQ(0, original.objectForKey("zero"));
+    EXPECT_EQ(1000, result.size());
+    EXPECT_EQ(100, result.objectForKey("1"));
+    EXPECT_EQ(500, result.objectForKey("500"));
+    EXPECT_FALSE(result.containsKey("zero"));
+}
+
+TEST(PersistentDictionary, transient_does_not_mutate_persistent_versions) {
+    // Setup
+    TransientDictionary<int, int> transient = TransientDictionary<int, int>();
+    for (int i = 0; i < 100; ++i) {
+        transient.setObject(i, i);
+    }
+    PersistentDictionary<int, int> first = transient.persistent();
+    TransientDictionary<int, int> second_transient = first.transient();
+    for (int i = 0; i < 100; ++i) {
+        second_transient.setObject(i, -i);
+    }
+    PersistentDictionary<int, int> second = second_transient.persistent();
+
+    // Assertion
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(i, first.objectForKey(i));
+        EXPECT_EQ(-i, second.objectForKey(i));
+    }
+}
+
+TEST(PersistentDictionary, transient_used_after_persistent) {
+    // Setup
+    TransientDictionary<int, int> transient = TransientDictionary<int, int>();
+    transient.setObject(1, 1);
+    transient.persistent();
+
+    // Assertion
+    EXPECT_THROW(transient.setObject(2, 2), InvalidValueException);
+}
+
+TEST(PersistentDictionary, transient_move_only) {
+    // Setup
+    TransientDictionary<int, int> transient = TransientDictionary<int, int>();
+    transient.setObject(1, 1);
+    TransientDictionary<int, int> moved = std::move(transient);
+    moved.setObject(2, 2);
+    TransientDictionary<int, int> assigned = TransientDictionary<int, int>();
+    assigned = std::move(moved);
+    PersistentDictionary<int, int> result = assigned.persistent();
+
+    // Assertion
+    EXPECT_FALSE((std::is_copy_constructible<TransientDictionary<int, int>>::value));
+    EXPECT_FALSE((std::is_copy_assignable<TransientDictionary<int, int>>::value));
+    EXPECT_THROW(transient.setObject(3, 3), InvalidValueException);
+    EXPECT_THROW(moved.setObject(3, 3), InvalidValueException);
+    EXPECT_EQ(2, result.size());
+    EXPECT_EQ(2, result.objectForKey(2));
+}
@@ -0,0 +1,182 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Replacer.hpp"
+#include "Exception.hpp"
+#include <chrono>
+#include <random>
+
+using namespace abraham;
+
+
+namespace {
+    /**
+     * Replaces leftmost, then longest, matches by trying every pattern at every index.
+     */
+    std::string referenceReplace(const std::string& source,
+                                 const std::vector<std::pair<std::string, std::string>>& pairs) {
+        std::string output;
+        size_t index = 0;
+        while (index < source.length()) {
+            const std::pair<std::string, std::string>* best = nullptr;
+            for (const std::pair<std::string, std::string>& pair : pairs) {
+                if (source.compare(index, pair.first.length(), pair.first) == 0 &&
+                    (best == nullptr || pair.first.length() > best->first.length())) {
+                    best = &pair;
+                }
+            }
+
+            if (best == nullptr) {
+                output += source[index++];
+            } else {
+                output += best->second;
+                index += best->first.length();
+            }
+        }
+
+        return output;
+    }
+}
+
+
+// Constructor
+
+TEST(Replacer, constructors) {
+    // Setup
+    Replacer replacer = Replacer({{"cat", "dog"}, {"red", "blue"}});
+    Replacer dictionary = Replacer(Dictionary<String, String>({{"a", "1"}, {"b", "2"}}));
+
+    // Assertion
+    EXPECT_EQ(2, replacer.size());
+    EXPECT_EQ(String("the blue dog"), replacer.replace("the red cat"));
+    EXPECT_EQ(String("1-2-c"), dictionary.replace("a-b-c"));
+}
+
+TEST(Replacer, repeated_and_empty_patterns) {
+    // Setup
+    Replacer replacer = Replacer({{"x", "1"}, {"x", "2"}});
+
+    // Assertion
+    EXPECT_EQ(1, replacer.size());
+    EXPECT_EQ(String("2y2"), replacer.replace("xyx"));
+    EXPECT_THROW(Replacer({{"", "empty"}}), InvalidArgumentException);
+    EXPECT_EQ(String("unchanged"), Replacer({}).replace("unchanged"));
+}
+
+// Matching
+
+TEST(Replacer, leftmost_longest) {
+    // Setup
+    Replacer replacer = Replacer({{"pass", "[P]"}, {"password", "[REDACTED]"}, {"word", "[W]"}, {"bc", "X"},
+                                  {"abcd", "Y"}});
+
+    // Assertion
+    EXPECT_EQ(String("[REDACTED]=1 [P]=2 [W]"), replacer.replace("password=1 pass=2 word"));
+    EXPECT_EQ(String("Y"), replacer.replace("abcd"));
+    EXPECT_EQ(String("aXe"), replacer.replace("abce"));
+    EXPECT_EQ(String("[P]wor[P]"), replacer.replace("passworpass"));
+}
+
+TEST(Replacer, replacement_containing_pattern) {
+    // Setup
+    Replacer replacer = Replacer({{"a", "aa"}, {"b", "ab"}});
+
+    // Assertion
+    EXPECT_EQ(String("aaabaa"), replacer.replace("aba"));
+}
+
+TEST(Replacer, matches_reference) {
+    // Setup
+    std::mt19937 random = std::mt19937(7);
+    std::vector<std::pair<std::string, std::string>> pairs = {
+            {"ab", "1"}, {"abc", "2"}, {"bca", "3"}, {"c", "4"}, {"aab", "5"}, {"bbbb", "6"}, {"cab", ""}};
+    Replacer replacer = Replacer({{"ab", "1"}, {"abc", "2"}, {"bca", "3"}, {"c", "4"}, {"aab", "5"}, {"bbbb", "6"},
+                                  {"cab", ""}});
+
+    // Assertion
+    for (int i = 0; i < 500; ++i) {
+        std::string source;
+        size_t length = random() % 41;
+        for (size_t j = 0; j < length; ++j) {
+            source += static_cast<char>('a' + random() % 4);
+        }
+
+        ASSERT_EQ(referenceReplace(source, pairs), replacer.replace(source).std_string()) << source;
+    }
+}
+
+TEST(Replacer, matches_reference_long_patterns) {
+    // Setup
+    std::mt19937 random = std::mt19937(13);
+    std::vector<std::pair<std::string, std::string>> pairs = {
+            {std::string(600, 'a'), "1"}, {std::string(599, 'a') + "b", "2"}, {"ab", "3"}, {"ba", "4"}};
+    Replacer replacer = Replacer({{std::string(600, 'a'), "1"}, {std::string(599, 'a') + "b", "2"}, {"ab", "3"},
+                                  {"ba", "4"}});
+
+    // Assertion
+    for (int i = 0; i < 20; ++i) {
+        std::string source;
+        size_t length = random() % 6000;
+        for (size_t j = 0; j < length; ++j) {
+            source += random() % 50 == 0 ? 'b' : 'a';
+        }
+
+        ASSERT_EQ(referenceReplace(source, pairs), replacer.replace(source).std_string()) << length;
+    }
+}
+
+TEST(Replacer, linear_time) {
+    // Setup
+    const std::string source = std::string(200000, 'a');
+    Replacer short_patterns = Replacer({{"a", "x"}, {std::string(10, 'a') + "b", "y"}});
+    Replacer long_patterns = Replacer({{"a", "x"}, {std::string(10000, 'a') + "b", "y"}});
+
+    // Each match ends a long pattern in progress, which a rescanning search would read again after every match
+    const auto short_start = std::chrono::steady_clock::now();
+    const size_t short_count = short_patterns.count(source);
+    const auto short_time = std::chrono::steady_clock::now() - short_start;
+
+    const auto long_start = std::chrono::steady_clock::now();
+    const size_t long_count = long_patterns.count(source);
+    const auto long_time = std::chrono::steady_clock::now() - long_start;
+
+    // Assertion
+    EXPECT_EQ(200000, short_count);
+    EXPECT_EQ(200000, long_count);
+    EXPECT_LT(long_time, short_time * 10 + std::chrono::milliseconds(50));
+}
+
+TEST(Replacer, count_and_contains) {
+    // Setup
+    Replacer replacer = Replacer({{"secret", "***"}, {"token", "***"}});
+
+    // Assertion
+    EXPECT_EQ(4, replacer.count("secret token secrettoken"));
+    EXPECT_EQ(0, replacer.count("nothing here"));
+    EXPECT_TRUE(replacer.containsMatch("my token"));
+    EXPECT_FALSE(replacer.containsMatch("my toke"));
+}
+
+TEST(Replacer, replace_into_buffer) {
+    // Setup
+    Replacer replacer = Replacer({{"\xFF", "?"}, {"\t", " "}});
+    std::string buffer = "> ";
+    replacer.replace(StringView("a\tb\xFF", 4), buffer);
+
+    // Assertion
+    EXPECT_EQ("> a b?", buffer);
+}
+
+// String
+
+TEST(Replacer, string_replace_all) {
+    // Setup
+    String line = String("user=alice password=hunter2 api_key=abc");
+    Replacer scrubber = Replacer({{"hunter2", "*******"}, {"abc", "***"}});
+    line.replaceAll(scrubber);
+
+    // Assertion
+    EXPECT_STREQ("user=alice password=******* api_key=***", line.c_string());
+}
@@ -0,0 +1,196 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "SharedString.hpp"
+#include "Exception.hpp"
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace abraham;
+
+
+const char* LONG_TEXT = "a string long enough to be kept in a shared heap buffer";
+
+
+// Constructor
+
+TEST(SharedString, default_constructor) {
+    // Setup
+    SharedString string = SharedString();
+
+    // Assertion
+    EXPECT_TRUE(string.isEmpty());
+    EXPECT_EQ(0, string.length());
+    EXPECT_FALSE(string.isShared());
+    EXPECT_EQ(StringView(""), string.view());
+}
+
+TEST(SharedString, inline_constructor) {
+    // Setup
+    SharedString string = SharedString("short");
+    SharedString longest = SharedString(std::string(SharedString::INLINE_CAPACITY, 'x'));
+    SharedString shortest_shared = SharedString(std::string(SharedString::INLINE_CAPACITY + 1, 'x'));
+
+    // Assertion
+    EXPECT_EQ(StringView("short"), string.view());
+    EXPECT_FALSE(string.isShared());
+    EXPECT_FALSE(longest.isShared());
+    EXPECT_TRUE(shortest_shared.isShared());
+}
+
+TEST(SharedString, string_constructors) {
+    // Setup
+    String string = String(LONG_TEXT);
+    SharedString from_string = SharedString(string);
+    SharedString from_view = SharedString(StringView(LONG_TEXT));
+    SharedString from_std_string = SharedString(std::string(LONG_TEXT));
+    SharedString from_data = SharedString(LONG_TEXT, 8);
+
+    // Assertion
+    EXPECT_EQ(StringView(LONG_TEXT), from_string.view());
+    EXPECT_EQ(StringView(LONG_TEXT), from_view.view());
+    EXPECT_EQ(StringView(LONG_TEXT), from_std_string.view());
+    EXPECT_EQ(StringView("a string"), from_data.view());
+    EXPECT_STREQ(LONG_TEXT, string.c_string());
+}
+
+TEST(SharedString, move_string_constructor) {
+    // Setup
+    String string = String(LONG_TEXT);
+    const char* data = string.c_string();
+    SharedString shared = SharedString(std::move(string));
+
+    // Assertion
+    EXPECT_EQ(data, shared.data());
+    EXPECT_EQ(StringView(LONG_TEXT), shared.view());
+}
+
+
+// Copy
+
+TEST(SharedString, copy_shares_buffer) {
+    // Setup
+    SharedString original = SharedString(LONG_TEXT);
+    SharedString copy = original;
+    SharedString assigned;
+    assigned = copy;
+
+    // Assertion
+    EXPECT_EQ(original.data(), copy.data());
+    EXPECT_EQ(original.data(), assigned.data());
+    EXPECT_EQ(original, assigned);
+}
+
+TEST(SharedString, copy_outlives_original) {
+    // Setup
+    SharedString* original = new SharedString(LONG_TEXT);
+    SharedString copy = *original;
+    delete original;
+
+    // Assertion
+    EXPECT_EQ(StringView(LONG_TEXT), copy.view());
+}
+
+TEST(SharedString, move) {
+    // Setup
+    SharedString original = SharedString(LONG_TEXT);
+    const char* data = original.data();
+    SharedString moved = std::move(original);
+    SharedString assigned = SharedString("short");
+    assigned = std::move(moved);
+
+    // Assertion
+    EXPECT_EQ(data, assigned.data());
+    EXPECT_TRUE(original.isEmpty());
+    EXPECT_TRUE(moved.isEmpty());
+}
+
+TEST(SharedString, copy_across_threads) {
+    // Setup
+    SharedString original = SharedString(LONG_TEXT);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([original]() {
+            for (int i = 0; i < 10000; ++i) {
+                SharedString copy = original;
+                SharedString tail = copy.substringFromIndex(1);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Assertion
+    EXPECT_EQ(StringView(LONG_TEXT), original.view());
+}
+
+
+// Substring
+
+TEST(SharedString, substring_shares_buffer) {
+    // Setup
+    SharedString string = SharedString(LONG_TEXT);
+    SharedString tail = string.substringFromIndex(2);
+    SharedString head = string.substringToIndex(8);
+    SharedString middle = string.substring(2, 8);
+
+    // Assertion
+    EXPECT_EQ(string.data() + 2, tail.data());
+    EXPECT_EQ(StringView(LONG_TEXT + 2), tail.view());
+    EXPECT_FALSE(head.isShared());
+    EXPECT_EQ(StringView("a string"), head.view());
+    EXPECT_EQ(StringView("string"), middle.view());
+    EXPECT_EQ(StringView(""), string.substringFromIndex(string.length()).view());
+}
+
+TEST(SharedString, substring_invalid) {
+    // Setup
+    SharedString string = SharedString("text");
+
+    // Assertion
+    EXPECT_THROW(string.substring(3, 2), InvalidArgumentException);
+    EXPECT_THROW(string.substring(0, 5), OutOfBoundsException);
+    EXPECT_THROW(string[4], OutOfBoundsException);
+    EXPECT_EQ('x', string[2]);
+}
+
+
+// Conversion
+
+TEST(SharedString, to_string) {
+    // Setup
+    SharedString shared = SharedString(LONG_TEXT);
+    SharedString copy = shared;
+    String copied = shared.toString();
+    const char* data = shared.data();
+    String still_shared = std::move(copy).toString();
+    String taken = std::move(shared).toString();
+
+    // Assertion
+    EXPECT_STREQ(LONG_TEXT, copied.c_string());
+    EXPECT_STREQ(LONG_TEXT, still_shared.c_string());
+    EXPECT_NE(data, still_shared.c_string());
+    EXPECT_EQ(data, taken.c_string());
+    EXPECT_EQ(LONG_TEXT, SharedString(LONG_TEXT).std_string());
+}
+
+
+// Comparison
+
+TEST(SharedString, comparison_and_hash) {
+    // Setup
+    SharedString a = SharedString(LONG_TEXT);
+    SharedString b = SharedString(std::string(LONG_TEXT));
+    std::unordered_set<SharedString> set = {a, b, SharedString("other")};
+
+    // Assertion
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, SharedString("other"));
+    EXPECT_TRUE(SharedString("abc") < SharedString("abd"));
+    EXPECT_EQ(String(LONG_TEXT).hash(), a.hash());
+    EXPECT_EQ(2, set.size());
+}
@@ -0,0 +1,269 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "StaticDictionary.hpp"
+#include "Exception.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace abraham;
+
+
+// Helper for a unique path in the temporary directory
+static String temporaryPath(const std::string& name) {
+    const char* directory = std::getenv("TMPDIR");
+    if (directory == nullptr || *directory == '\0') directory = std::getenv("TEMP");
+    if (directory == nullptr || *directory == '\0') directory = "/tmp";
+    return String(std::string(directory) + "/abraham_static_dictionary_" + name + ".tmp");
+}
+
+// Helper that reads a whole file, so tests can corrupt it
+static std::string readFile(const String& path) {
+    std::ifstream file(path.c_string(), std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Helper that replaces a whole file
+static void writeFile(const String& path, const std::string& contents) {
+    std::ofstream(path.c_string(), std::ios::binary | std::ios::trunc).write(contents.data(), contents.size());
+}
+
+// Helper value type for checking trivially copyable values
+struct Point {
+    int x;
+    double y;
+};
+
+
+TEST(StaticDictionary, default_constructor) {
+    // Setup
+    StaticDictionary<int> dictionary = StaticDictionary<int>();
+
+    // Assertion
+    EXPECT_EQ(0, dictionary.size());
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_FALSE(dictionary.containsKey("a"));
+}
+
+TEST(StaticDictionary, build_and_load_int) {
+    // Setup
+    String path = temporaryPath("int");
+    Dictionary<String, int> source = {{"one", 1}, {"two", 2}, {"three", 3}};
+    StaticDictionaryBuilder<int>(source).write(path);
+    StaticDictionary<int> dictionary = StaticDictionary<int>(path);
+
+    // Assertion
+    EXPECT_EQ(3, dictionary.size());
+    EXPECT_EQ(1, dictionary.objectForKey("one"));
+    EXPECT_EQ(2, dictionary.objectForKey("two"));
+    EXPECT_EQ(3, dictionary.objectForKey("three"));
+    EXPECT_FALSE(dictionary.containsKey("four"));
+    EXPECT_THROW(dictionary.objectForKey("four"), InvalidArgumentException);
+    EXPECT_TRUE(source == dictionary.dictionary());
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, build_and_load_struct) {
+    // Setup
+    String path = temporaryPath("struct");
+    StaticDictionaryBuilder<Point> builder = StaticDictionaryBuilder<Point>();
+    builder.addObject("origin", {0, 0.0}).addObject("unit", {1, 1.5});
+    builder.write(path);
+    StaticDictionary<Point> dictionary = StaticDictionary<Point>(path);
+    Point point = {};
+
+    // Assertion
+    EXPECT_TRUE(dictionary.tryObjectForKey("unit", point));
+    EXPECT_EQ(1, point.x);
+    EXPECT_DOUBLE_EQ(1.5, point.y);
+    EXPECT_FALSE(dictionary.tryObjectForKey("missing", point));
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, build_and_load_string) {
+    // Setup
+    String path = temporaryPath("string");
+    Dictionary<String, String> source = {{"hello", "world"}, {"empty", ""}, {"", "empty key"}};
+    StaticDictionaryBuilder<String>(source).write(path);
+    StaticDictionary<String> dictionary = StaticDictionary<String>(path);
+
+    // Assertion
+    EXPECT_EQ(3, dictionary.size());
+    EXPECT_STREQ("world", dictionary.objectForKey("hello").c_string());
+    EXPECT_STREQ("", dictionary.objectForKey("empty").c_string());
+    EXPECT_STREQ("empty key", dictionary.objectForKey("").c_string());
+    EXPECT_TRUE(source == dictionary.dictionary());
+    EXPECT_NO_THROW(dictionary.validate());
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, build_and_load_many) {
+    // Setup
+    String path = temporaryPath("many");
+    StaticDictionaryBuilder<long> builder = StaticDictionaryBuilder<long>();
+    for (long i = 0; i < 20000; ++i) {
+        builder.addObject(String("key_" + std::to_string(i)), i * 7);
+    }
+    builder.write(path);
+    StaticDictionary<long> dictionary = StaticDictionary<long>(path);
+
+    // Assertion
+    EXPECT_EQ(20000, dictionary.size());
+    for (long i = 0; i < 20000; ++i) {
+        EXPECT_EQ(i * 7, dictionary.objectForKey(String("key_" + std::to_string(i))));
+    }
+    for (long i = 20000; i < 21000; ++i) {
+        EXPECT_FALSE(dictionary.containsKey(String("key_" + std::to_string(i))));
+    }
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, build_empty) {
+    // Setup
+    String path = temporaryPath("empty");
+    StaticDictionaryBuilder<int>().write(path);
+    StaticDictionary<int> dictionary = StaticDictionary<int>(path);
+
+    // Assertion
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_FALSE(dictionary.containsKey("a"));
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, builder_duplicate_key) {
+    // Setup
+    StaticDictionaryBuilder<int> builder = StaticDictionaryBuilder<int>();
+    builder.addObject("a", 1);
+
+    // Assertion
+    EXPECT_THROW(builder.addObject("a", 2), InvalidArgumentException);
+}
+
+TEST(StaticDictionary, load_missing_file) {
+    // Assertion
+    EXPECT_THROW(StaticDictionary<int>(temporaryPath("does_not_exist")), IOException);
+}
+
+TEST(StaticDictionary, load_invalid_file) {
+    // Setup
+    String path = temporaryPath("invalid");
+    std::ofstream(path.c_string()) << "this is not a static dictionary file, but it is long enough to have a header";
+
+    // Assertion
+    EXPECT_THROW(StaticDictionary<int> dictionary = StaticDictionary<int>(path), InvalidValueException);
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, load_mismatched_value_type) {
+    // Setup
+    String path = temporaryPath("mismatch");
+    Dictionary<String, int> source = {{"one", 1}};
+    StaticDictionaryBuilder<int>(source).write(path);
+
+    // Assertion
+    EXPECT_THROW(StaticDictionary<double> dictionary = StaticDictionary<double>(path), InvalidValueException);
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, load_corrupt_key_offset) {
+    // Setup
+    String path = temporaryPath("corrupt_key");
+    Dictionary<String, int> source = {{"one", 1}, {"two", 2}};
+    StaticDictionaryBuilder<int>(source).write(path);
+
+    std::string contents = readFile(path);
+    details::StaticDictionaryHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    details::StaticDictionarySlot slot;
+    std::memcpy(&slot, contents.data() + header.slotOffset, sizeof(slot));
+    slot.keyOffset = header.fileSize;
+    std::memcpy(&contents[header.slotOffset], &slot, sizeof(slot));
+    writeFile(path, contents);
+
+    StaticDictionary<int> dictionary = StaticDictionary<int>(path);
+    int failures = 0;
+    for (const char* key : {"one", "two"}) {
+        try {
+            dictionary.objectForKey(key);
+        } catch (const InvalidValueException&) {
+            ++failures;
+        }
+    }
+
+    // Assertion
+    EXPECT_EQ(1, failures);
+    EXPECT_THROW(dictionary.getKeys(), InvalidValueException);
+    EXPECT_THROW(dictionary.validate(), InvalidValueException);
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, load_corrupt_string_value) {
+    // Setup
+    String path = temporaryPath("corrupt_value");
+    Dictionary<String, String> source = {{"one", "first"}};
+    StaticDictionaryBuilder<String>(source).write(path);
+
+    std::string contents = readFile(path);
+    details::StaticDictionaryHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    details::StaticDictionaryStringRef ref;
+    std::memcpy(&ref, contents.data() + header.valueOffset, sizeof(ref));
+    ref.length = UINT64_MAX;
+    std::memcpy(&contents[header.valueOffset], &ref, sizeof(ref));
+    writeFile(path, contents);
+
+    StaticDictionary<String> dictionary = StaticDictionary<String>(path);
+    String value;
+
+    // Assertion
+    EXPECT_TRUE(dictionary.containsKey("one"));
+    EXPECT_THROW(dictionary.objectForKey("one"), InvalidValueException);
+    EXPECT_THROW(dictionary.tryObjectForKey("one", value), InvalidValueException);
+    EXPECT_THROW(dictionary.getValues(), InvalidValueException);
+    EXPECT_THROW(dictionary.validate(), InvalidValueException);
+
+    // Clean up
+    std::remove(path.c_string());
+}
+
+TEST(StaticDictionary, load_corrupt_count) {
+    // Setup
+    String path = temporaryPath("corrupt_count");
+    Dictionary<String, int> source = {{"one", 1}};
+    StaticDictionaryBuilder<int>(source).write(path);
+
+    std::string contents = readFile(path);
+    details::StaticDictionaryHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    header.count = UINT64_MAX / 2;
+    std::memcpy(&contents[0], &header, sizeof(header));
+    writeFile(path, contents);
+
+    // Assertion
+    EXPECT_THROW(StaticDictionary<int> dictionary = StaticDictionary<int>(path), InvalidValueException);
+
+    // Clean up
+    std::remove(path.c_string());
+}
@@ -0,0 +1,82 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "StaticMap.hpp"
+#include "String.hpp"
+
+using namespace abraham;
+
+
+enum class Color {
+    RED,
+    GREEN,
+    BLUE,
+    BLACK
+};
+
+constexpr auto NUMBERS = makeStaticMap<int, int>({{30, 3}, {10, 1}, {20, 2}, {50, 5}, {40, 4}});
+constexpr auto COLORS = makeStaticMap<Color, const char*>({{Color::BLUE, "blue"}, {Color::RED, "red"}, {Color::GREEN, "green"}});
+constexpr auto NAMES = makeStaticMap<const char*, int>({{"zeta", 26}, {"alpha", 1}, {"mu", 12}, {"al", 100}});
+
+// Lookups are evaluated entirely at compile time
+static_assert(NUMBERS.size() == 5, "size is constexpr");
+static_assert(NUMBERS.objectForKey(40) == 4, "lookup is constexpr");
+static_assert(!NUMBERS.containsKey(35), "containsKey is constexpr");
+static_assert(NAMES.objectForKey("mu") == 12, "C string keys compare by contents");
+static_assert(NAMES.objectForKey("alp", -1) == -1, "missing keys return the default value");
+
+
+TEST(StaticMap, object_for_key) {
+    // Assertion
+    EXPECT_EQ(1, NUMBERS.objectForKey(10));
+    EXPECT_EQ(5, NUMBERS.objectForKey(50));
+    EXPECT_STREQ("green", COLORS.objectForKey(Color::GREEN));
+    EXPECT_EQ(100, NAMES.objectForKey(String("al").c_string()));
+    EXPECT_EQ(1, NAMES.objectForKey(String("alpha").c_string()));
+}
+
+TEST(StaticMap, object_for_key_invalid) {
+    // Assertion
+    EXPECT_THROW(NUMBERS.objectForKey(25), InvalidArgumentException);
+    EXPECT_THROW(COLORS.objectForKey(Color::BLACK), InvalidArgumentException);
+    EXPECT_THROW(NAMES.objectForKey("beta"), InvalidArgumentException);
+}
+
+TEST(StaticMap, object_for_key_default) {
+    // Assertion
+    EXPECT_EQ(3, NUMBERS.objectForKey(30, 0));
+    EXPECT_EQ(0, NUMBERS.objectForKey(0, 0));
+    EXPECT_STREQ("none", COLORS.objectForKey(Color::BLACK, "none"));
+}
+
+TEST(StaticMap, contains_key) {
+    // Assertion
+    EXPECT_TRUE(COLORS.containsKey(Color::RED));
+    EXPECT_FALSE(COLORS.containsKey(Color::BLACK));
+    EXPECT_TRUE(NAMES.containsKey("zeta"));
+    EXPECT_FALSE(NAMES.containsKey("zet"));
+    EXPECT_FALSE(NAMES.containsKey(""));
+}
+
+TEST(StaticMap, iteration_is_sorted) {
+    // Setup
+    int expect = 1;
+
+    // Assertion
+    for (const StaticMapEntry<int, int>& entry : NUMBERS) {
+        EXPECT_EQ(expect * 10, entry.key);
+        EXPECT_EQ(expect, entry.value);
+        ++expect;
+    }
+    EXPECT_EQ(6, expect);
+}
+
+TEST(StaticMap, duplicate_key) {
+    // Setup
+    StaticMapEntry<int, int> entries[] = {{1, 1}, {2, 2}, {1, 3}};
+
+    // Assertion
+    EXPECT_THROW((StaticMap<int, int, 3>(entries)), InvalidArgumentException);
+}
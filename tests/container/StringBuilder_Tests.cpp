@@ -0,0 +1,241 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "StringBuilder.hpp"
+#include <utility>
+
+using namespace abraham;
+
+
+// Constructor
+
+TEST(StringBuilder, default_constructor) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+
+    // Assertion
+    EXPECT_TRUE(builder.isEmpty());
+    EXPECT_EQ(0, builder.length());
+    EXPECT_STREQ("", builder.build().c_string());
+}
+
+TEST(StringBuilder, capacity_constructor) {
+    // Setup
+    StringBuilder builder = StringBuilder(100);
+
+    // Assertion
+    EXPECT_TRUE(builder.isEmpty());
+    EXPECT_LE(100, builder.capacity());
+}
+
+TEST(StringBuilder, arena_constructor) {
+    // Setup
+    Arena arena;
+    StringBuilder builder = StringBuilder(arena, 100);
+
+    // Assertion
+    EXPECT_TRUE(builder.isEmpty());
+    EXPECT_LE(100, builder.capacity());
+    EXPECT_LE(100, arena.used());
+}
+
+TEST(StringBuilder, copy_constructor) {
+    // Setup
+    Arena arena;
+    StringBuilder heap = StringBuilder();
+    StringBuilder arena_builder = StringBuilder(arena);
+    heap.append("heap");
+    arena_builder.append("arena");
+    StringBuilder heap_copy = StringBuilder(heap);
+    StringBuilder arena_copy = StringBuilder(arena_builder);
+    heap_copy.clear().append("HEAP");
+    arena_copy.clear().append("ARENA");
+
+    // Assertion
+    EXPECT_EQ(StringView("heap"), heap.view());
+    EXPECT_EQ(StringView("HEAP"), heap_copy.view());
+    EXPECT_EQ(StringView("arena"), arena_builder.view());
+    EXPECT_EQ(StringView("ARENA"), arena_copy.view());
+    EXPECT_NE(arena_builder.view().data(), arena_copy.view().data());
+}
+
+TEST(StringBuilder, copy_assignment) {
+    // Setup
+    Arena arena;
+    StringBuilder builder = StringBuilder(arena);
+    StringBuilder copy = StringBuilder();
+    builder.append("original");
+    copy.append("replaced");
+    copy = builder;
+    copy.append(" copy");
+
+    // Assertion
+    EXPECT_EQ(StringView("original"), builder.view());
+    EXPECT_EQ(StringView("original copy"), copy.view());
+}
+
+TEST(StringBuilder, move) {
+    // Setup
+    Arena arena;
+    StringBuilder builder = StringBuilder(arena);
+    builder.append("moved");
+    const char* data = builder.view().data();
+    StringBuilder moved = StringBuilder(std::move(builder));
+    StringBuilder assigned = StringBuilder();
+    assigned = std::move(moved);
+
+    // Assertion
+    EXPECT_EQ(StringView("moved"), assigned.view());
+    EXPECT_EQ(data, assigned.view().data());
+    EXPECT_TRUE(builder.isEmpty());
+    EXPECT_TRUE(moved.isEmpty());
+    EXPECT_STREQ("again", builder.append("again").build().c_string());
+}
+
+
+// Append
+
+TEST(StringBuilder, append_strings) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    builder.append(String("one")).append(StringView(" two")).append(std::string(" three")).append(" four")
+            .append(" fivesix", 5).append('!');
+
+    // Assertion
+    EXPECT_EQ(24, builder.length());
+    EXPECT_EQ(StringView("one two three four five!"), builder.view());
+    EXPECT_STREQ("one two three four five!", builder.build().c_string());
+}
+
+TEST(StringBuilder, append_numbers) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    builder.append(-12).append(' ').append(34L).append(' ').append(-56LL).append(' ').append(7U).append(' ')
+            .append(89UL).append(' ').append(18446744073709551615ULL).append(' ').append(1.5f).append(' ')
+            .append(0.1);
+
+    // Assertion
+    EXPECT_STREQ("-12 34 -56 7 89 18446744073709551615 1.5 0.1", builder.build().c_string());
+}
+
+TEST(StringBuilder, append_grows) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    std::string expected;
+    for (int i = 0; i < 1000; ++i) {
+        builder.append(i).append(',');
+        expected += std::to_string(i) + ",";
+    }
+
+    // Assertion
+    EXPECT_EQ(expected.length(), builder.length());
+    EXPECT_STREQ(expected.c_str(), builder.build().c_string());
+}
+
+TEST(StringBuilder, append_own_view) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    builder.append("abc");
+    builder.append(builder.view());
+    builder.append(builder.view());
+
+    // Assertion
+    EXPECT_STREQ("abcabcabcabc", builder.build().c_string());
+}
+
+
+// Repeat
+
+TEST(StringBuilder, append_repeated) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    builder.append('[').appendRepeated(StringView("ab"), 5).appendRepeated('-', 3).appendRepeated("x", 0)
+            .append(']');
+
+    // Assertion
+    EXPECT_STREQ("[ababababab---]", builder.build().c_string());
+}
+
+TEST(StringBuilder, append_repeated_own_view) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    builder.append("xyz");
+    builder.appendRepeated(builder.view().substringFromIndex(1), 3);
+
+    // Assertion
+    EXPECT_STREQ("xyzyzyzyz", builder.build().c_string());
+}
+
+
+// Build
+
+TEST(StringBuilder, build_empties) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    builder.append("first");
+    String first = builder.build();
+    builder.append("second");
+    String second = builder.build();
+
+    // Assertion
+    EXPECT_STREQ("first", first.c_string());
+    EXPECT_STREQ("second", second.c_string());
+    EXPECT_TRUE(builder.isEmpty());
+}
+
+TEST(StringBuilder, build_keeps_buffer) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    builder.appendRepeated('a', 100);
+    const char* data = builder.view().data();
+    String string = builder.build();
+
+    // Assertion
+    EXPECT_EQ(data, string.c_string());
+}
+
+TEST(StringBuilder, clear) {
+    // Setup
+    StringBuilder builder = StringBuilder();
+    builder.append("some text");
+    size_t capacity = builder.capacity();
+    builder.clear();
+
+    // Assertion
+    EXPECT_TRUE(builder.isEmpty());
+    EXPECT_EQ(capacity, builder.capacity());
+}
+
+
+// Arena
+
+TEST(StringBuilder, arena_append) {
+    // Setup
+    Arena arena(64);
+    StringBuilder builder = StringBuilder(arena);
+    std::string expected;
+    for (int i = 0; i < 200; ++i) {
+        builder.append("n=").append(i).append(';');
+        expected += "n=" + std::to_string(i) + ";";
+    }
+
+    // Assertion
+    EXPECT_EQ(StringView(expected), builder.view());
+    EXPECT_STREQ(expected.c_str(), builder.build().c_string());
+    EXPECT_TRUE(builder.isEmpty());
+}
+
+TEST(StringBuilder, arena_append_repeated) {
+    // Setup
+    Arena arena(64);
+    StringBuilder builder = StringBuilder(arena);
+    builder.append("ab");
+    builder.appendRepeated(builder.view(), 40).appendRepeated('.', 3);
+
+    // Assertion
+    EXPECT_EQ(85, builder.length());
+    EXPECT_EQ(StringView("abab"), builder.view().substring(0, 4));
+    EXPECT_EQ(StringView("ab..."), builder.view().substringFromIndex(80));
+}
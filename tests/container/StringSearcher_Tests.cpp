@@ -0,0 +1,123 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "StringSearcher.hpp"
+#include "String.hpp"
+#include <random>
+
+using namespace abraham;
+
+
+// Constructor
+
+TEST(StringSearcher, strategy) {
+    // Assertion
+    EXPECT_EQ(StringSearcherStrategy::EMPTY, StringSearcher("").strategy());
+    EXPECT_EQ(StringSearcherStrategy::CHARACTER, StringSearcher("x").strategy());
+    EXPECT_EQ(StringSearcherStrategy::FIRST_LAST_FILTER, StringSearcher("needle").strategy());
+    EXPECT_EQ(StringSearcherStrategy::HORSPOOL,
+              StringSearcher(std::string(StringSearcher::HORSPOOL_MIN_LENGTH, 'n')).strategy());
+}
+
+TEST(StringSearcher, owns_needle) {
+    // Setup
+    String needle = String("abc");
+    StringSearcher searcher = StringSearcher(needle);
+    needle.setValue("xyz");
+
+    // Assertion
+    EXPECT_EQ("abc", searcher.needle().std_string());
+    EXPECT_EQ(3, searcher.find("---abc"));
+}
+
+// Searching
+
+TEST(StringSearcher, find) {
+    // Setup
+    StringSearcher searcher = StringSearcher("needle");
+    std::string haystack = std::string(100, 'n') + "needle" + std::string(50, 'e') + "needle";
+
+    // Assertion
+    EXPECT_EQ(100, searcher.find(haystack));
+    EXPECT_EQ(156, searcher.find(haystack, 101));
+    EXPECT_EQ(StringView::NO_INDEX, searcher.find(haystack, 157));
+    EXPECT_EQ(StringView::NO_INDEX, searcher.find(haystack, 1000));
+    EXPECT_EQ(StringView::NO_INDEX, searcher.find("needl"));
+    EXPECT_EQ(0, searcher.find("needle"));
+}
+
+TEST(StringSearcher, find_last) {
+    // Setup
+    StringSearcher searcher = StringSearcher("needle");
+    std::string haystack = "needle" + std::string(50, 'e') + "needle" + std::string(100, 'n');
+
+    // Assertion
+    EXPECT_EQ(56, searcher.findLast(haystack));
+    EXPECT_EQ(0, searcher.findLast(haystack, 55));
+    EXPECT_EQ(56, searcher.findLast(haystack, 56));
+    EXPECT_EQ(StringView::NO_INDEX, searcher.findLast("needl"));
+    EXPECT_EQ(3, StringSearcher("").findLast("abc"));
+}
+
+TEST(StringSearcher, find_all) {
+    // Setup
+    StringSearcher searcher = StringSearcher("aa");
+    std::vector<size_t> indexes;
+    for (size_t index : searcher.findAll("aaaaa-aa")) {
+        indexes.push_back(index);
+    }
+
+    // Assertion
+    EXPECT_EQ(std::vector<size_t>({0, 2, 6}), indexes);
+    EXPECT_EQ(3, searcher.count("aaaaa-aa"));
+    EXPECT_EQ(0, searcher.count("a-a-a"));
+    EXPECT_EQ(4, StringSearcher("").count("abc"));
+    EXPECT_TRUE(searcher.occursIn("baab"));
+    EXPECT_FALSE(searcher.occursIn("abab"));
+}
+
+TEST(StringSearcher, matches_std_string) {
+    // Setup
+    std::mt19937 random = std::mt19937(11);
+    std::vector<size_t> needle_lengths = {1, 2, 3, 7, 16, 17, 31, 32, 33, 64};
+
+    // Assertion
+    for (size_t needle_length : needle_lengths) {
+        for (int round = 0; round < 40; ++round) {
+            std::string haystack;
+            size_t haystack_length = random() % 300;
+            for (size_t i = 0; i < haystack_length; ++i) {
+                haystack += static_cast<char>('a' + random() % 2);
+            }
+
+            size_t start = haystack.empty() ? 0 : random() % haystack.length();
+            std::string needle = haystack.substr(start, needle_length);
+            if (needle.length() < needle_length) needle = std::string(needle_length, 'b');
+
+            StringSearcher searcher = StringSearcher(needle);
+            size_t bound = random() % 320;
+            ASSERT_EQ(haystack.find(needle), searcher.find(haystack)) << needle;
+            ASSERT_EQ(haystack.find(needle, bound), searcher.find(haystack, bound)) << needle;
+            ASSERT_EQ(haystack.rfind(needle), searcher.findLast(haystack)) << needle;
+            ASSERT_EQ(haystack.rfind(needle, bound), searcher.findLast(haystack, bound)) << needle;
+        }
+    }
+}
+
+// String
+
+TEST(StringSearcher, string_methods) {
+    // Setup
+    StringSearcher searcher = StringSearcher("ERROR");
+    String line = String("12:00 ERROR disk full; ERROR retrying");
+
+    // Assertion
+    EXPECT_TRUE(line.contains(searcher));
+    EXPECT_FALSE(String("12:00 INFO ok").contains(searcher));
+    EXPECT_EQ(6, line.indexOf(searcher));
+    EXPECT_EQ(23, line.indexOf(searcher, 7));
+    EXPECT_EQ(23, line.indexOfLast(searcher));
+    EXPECT_EQ(6, line.indexOfLast(searcher, 22));
+}
@@ -0,0 +1,230 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "StringTable.hpp"
+#include "Exception.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace abraham;
+
+
+// Adding and Reading
+
+TEST(StringTable, add_get) {
+    // Setup
+    StringTable table;
+    size_t first = table.add("alpha");
+    size_t second = table.add("");
+    size_t third = table.add(std::string("gamma"));
+
+    // Assertion
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(second, 1);
+    EXPECT_EQ(third, 2);
+    EXPECT_EQ(table.size(), 3);
+    EXPECT_EQ(table.byteSize(), 10);
+    EXPECT_EQ(table.get(0), "alpha");
+    EXPECT_EQ(table.get(1), "");
+    EXPECT_EQ(table[2], "gamma");
+}
+
+TEST(StringTable, out_of_bounds) {
+    // Setup
+    StringTable table;
+    table.add("a");
+
+    // Assertion
+    EXPECT_THROW(table.get(1), OutOfBoundsException);
+    EXPECT_THROW(table[5], OutOfBoundsException);
+}
+
+TEST(StringTable, empty_clear) {
+    // Setup
+    StringTable table;
+
+    // Assertion
+    EXPECT_TRUE(table.isEmpty());
+    table.reserve(10, 100);
+    table.add("x");
+    EXPECT_FALSE(table.isEmpty());
+    table.clear();
+    EXPECT_TRUE(table.isEmpty());
+    EXPECT_EQ(table.byteSize(), 0);
+    EXPECT_EQ(table.add("y"), 0);
+}
+
+
+// Sorting and Searching
+
+TEST(StringTable, sorted_order) {
+    // Setup
+    StringTable table;
+    table.add("pear");
+    table.add("apple");
+    table.add("fig");
+    table.add("apple");
+
+    // Assertion
+    EXPECT_EQ(table.sortedOrder(), std::vector<size_t>({1, 3, 2, 0}));
+    EXPECT_EQ(table[0], "pear");
+    EXPECT_FALSE(table.isSorted());
+}
+
+TEST(StringTable, sort) {
+    // Setup
+    StringTable table;
+    table.add("pear");
+    table.add("apple");
+    table.add("");
+    table.add("app");
+    table.sort();
+
+    // Assertion
+    EXPECT_TRUE(table.isSorted());
+    EXPECT_EQ(table.size(), 4);
+    EXPECT_EQ(table[0], "");
+    EXPECT_EQ(table[1], "app");
+    EXPECT_EQ(table[2], "apple");
+    EXPECT_EQ(table[3], "pear");
+}
+
+TEST(StringTable, permute) {
+    // Setup
+    StringTable table;
+    table.add("a");
+    table.add("bb");
+    table.add("ccc");
+    table.permute({2, 0, 1});
+
+    // Assertion
+    EXPECT_EQ(table[0], "ccc");
+    EXPECT_EQ(table[1], "a");
+    EXPECT_EQ(table[2], "bb");
+    EXPECT_THROW(table.permute({0, 3}), OutOfBoundsException);
+    EXPECT_EQ(table.size(), 3);
+}
+
+TEST(StringTable, binary_search) {
+    // Setup
+    StringTable table;
+    table.add("b");
+    table.add("d");
+    table.add("d");
+    table.add("f");
+
+    // Assertion
+    EXPECT_EQ(table.binarySearch("b"), 0);
+    EXPECT_EQ(table.binarySearch("d"), 1);
+    EXPECT_EQ(table.binarySearch("f"), 3);
+    EXPECT_EQ(table.binarySearch("a"), StringTable::NO_INDEX);
+    EXPECT_EQ(table.binarySearch("c"), StringTable::NO_INDEX);
+    EXPECT_EQ(table.binarySearch("g"), StringTable::NO_INDEX);
+    EXPECT_EQ(StringTable().binarySearch("a"), StringTable::NO_INDEX);
+}
+
+TEST(StringTable, sort_random) {
+    // Setup
+    std::mt19937 generator(45);
+    StringTable table;
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < 2000; ++i) {
+        std::string string(generator() % 12, 'a');
+        for (char& c : string) {
+            c = static_cast<char>('a' + generator() % 4);
+        }
+        strings.push_back(string);
+        table.add(string);
+    }
+    table.sort();
+    std::sort(strings.begin(), strings.end());
+
+    // Assertion
+    ASSERT_EQ(table.size(), strings.size());
+    for (size_t i = 0; i < strings.size(); ++i) {
+        EXPECT_EQ(table[i], strings[i]);
+        EXPECT_EQ(table[table.binarySearch(strings[i])], strings[i]);
+    }
+}
+
+
+// Deduplication
+
+TEST(StringTable, dedupe) {
+    // Setup
+    StringTable table;
+    table.add("one");
+    table.add("two");
+    table.add("one");
+    table.add("");
+    table.add("three");
+    table.add("two");
+    table.add("");
+    size_t removed = table.dedupe();
+
+    // Assertion
+    EXPECT_EQ(removed, 3);
+    EXPECT_EQ(table.size(), 4);
+    EXPECT_EQ(table.byteSize(), 11);
+    EXPECT_EQ(table[0], "one");
+    EXPECT_EQ(table[1], "two");
+    EXPECT_EQ(table[2], "");
+    EXPECT_EQ(table[3], "three");
+    EXPECT_EQ(table.dedupe(), 0);
+}
+
+TEST(StringTable, dedupe_sorted) {
+    // Setup
+    StringTable table;
+    for (int i = 0; i < 100; ++i) {
+        table.add(std::string(1, static_cast<char>('a' + i % 5)) + "xyz");
+    }
+    table.sort();
+    table.dedupe();
+
+    // Assertion
+    EXPECT_EQ(table.size(), 5);
+    EXPECT_TRUE(table.isSorted());
+    EXPECT_EQ(table[4], "exyz");
+}
+
+
+// Serialization
+
+TEST(StringTable, serialize) {
+    // Setup
+    StringTable table;
+    table.add("hello");
+    table.add("");
+    table.add(std::string("a\0b", 3));
+    std::string data = table.serialize();
+    StringTable copy = StringTable::deserialize(data);
+
+    // Assertion
+    ASSERT_EQ(copy.size(), 3);
+    EXPECT_EQ(copy[0], "hello");
+    EXPECT_EQ(copy[1], "");
+    EXPECT_EQ(copy[2], StringView("a\0b", 3));
+    EXPECT_EQ(StringTable::deserialize(StringTable().serialize()).size(), 0);
+}
+
+TEST(StringTable, deserialize_invalid) {
+    // Setup
+    StringTable table;
+    table.add("abc");
+    table.add("de");
+    std::string data = table.serialize();
+    std::string bad_offset = data;
+    bad_offset[4 + 16 + 8] = 9;
+
+    // Assertion
+    EXPECT_THROW(StringTable::deserialize(""), InvalidValueException);
+    EXPECT_THROW(StringTable::deserialize("XXXX" + data.substr(4)), InvalidValueException);
+    EXPECT_THROW(StringTable::deserialize(data.substr(0, data.length() - 1)), InvalidValueException);
+    EXPECT_THROW(StringTable::deserialize(data + "x"), InvalidValueException);
+    EXPECT_THROW(StringTable::deserialize(bad_offset), InvalidValueException);
+}
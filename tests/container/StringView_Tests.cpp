@@ -0,0 +1,165 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "StringView.hpp"
+#include "Exception.hpp"
+#include "String.hpp"
+
+using namespace abraham;
+
+
+// Constructor
+
+TEST(StringView, default_constructor) {
+    // Setup
+    StringView view = StringView();
+
+    // Assertion
+    EXPECT_EQ(0, view.length());
+    EXPECT_TRUE(view.isEmpty());
+    EXPECT_EQ("", view.std_string());
+}
+
+TEST(StringView, string_constructor) {
+    // Setup
+    String string = String("Hello World");
+    StringView view = string;
+
+    // Assertion
+    EXPECT_EQ(11, view.length());
+    EXPECT_EQ(string.c_string(), view.data());
+    EXPECT_EQ(string, view.string());
+}
+
+// Slicing
+
+TEST(StringView, substring) {
+    // Setup
+    StringView view = "Hello World";
+
+    // Assertion
+    EXPECT_EQ("lo W", view.substring(3, 7).std_string());
+    EXPECT_EQ("World", view.substringFromIndex(6).std_string());
+    EXPECT_EQ("Hello", view.substringToIndex(5).std_string());
+    EXPECT_EQ(view.data() + 3, view.substring(3, 7).data());
+    EXPECT_THROW(view.substring(5, 3), InvalidArgumentException);
+    EXPECT_THROW(view.substring(3, 20), OutOfBoundsException);
+    EXPECT_THROW(view.characterAtIndex(11), OutOfBoundsException);
+}
+
+TEST(StringView, split) {
+    // Setup
+    StringView view = "2017-09-18 12:00:01 [INFO] started";
+    std::vector<StringView> parts = view.split(" ");
+    std::vector<StringView> characters = StringView("abc").split("");
+
+    // Assertion
+    ASSERT_EQ(4, parts.size());
+    EXPECT_EQ("2017-09-18", parts[0].std_string());
+    EXPECT_EQ("[INFO]", parts[2].std_string());
+    EXPECT_EQ("started", parts[3].std_string());
+    ASSERT_EQ(3, characters.size());
+    EXPECT_EQ("b", characters[1].std_string());
+}
+
+TEST(StringView, split_reuses_vector) {
+    // Setup
+    std::vector<StringView> parts;
+    StringView("a,b,c,d").split(",", parts);
+    size_t capacity = parts.capacity();
+    StringView("x,,y").split(",", parts);
+
+    // Assertion
+    ASSERT_EQ(3, parts.size());
+    EXPECT_EQ("x", parts[0].std_string());
+    EXPECT_TRUE(parts[1].isEmpty());
+    EXPECT_EQ("y", parts[2].std_string());
+    EXPECT_EQ(capacity, parts.capacity());
+}
+
+TEST(StringView, trim) {
+    // Setup
+    StringView view = "  \tvalue \n";
+
+    // Assertion
+    EXPECT_EQ("value", view.trim().std_string());
+    EXPECT_EQ("value \n", view.trimLeading().std_string());
+    EXPECT_EQ("  \tvalue", view.trimTrailing().std_string());
+    EXPECT_EQ("value", StringView("--value--").trim("-").std_string());
+    EXPECT_TRUE(StringView("   ").trim().isEmpty());
+}
+
+// Searching
+
+TEST(StringView, index_of) {
+    // Setup
+    StringView view = "abcabc";
+
+    // Assertion
+    EXPECT_EQ(1, view.indexOf("bc"));
+    EXPECT_EQ(4, view.indexOf("bc", 2));
+    EXPECT_EQ(4, view.indexOfLast("bc"));
+    EXPECT_EQ(1, view.indexOfLast("bc", 3));
+    EXPECT_EQ(StringView::NO_INDEX, view.indexOf("x"));
+    EXPECT_EQ(StringView::NO_INDEX, view.indexOf("abcabcd"));
+    EXPECT_TRUE(view.contains("cab"));
+    EXPECT_FALSE(view.contains("cc"));
+    EXPECT_EQ(StringView::NO_INDEX, view.substringToIndex(3).indexOf("ca"));
+}
+
+// Comparison
+
+TEST(StringView, comparison) {
+    // Setup
+    String string = "abc";
+
+    // Assertion
+    EXPECT_TRUE(StringView("abc") == string);
+    EXPECT_TRUE(StringView("abc") != StringView("abd"));
+    EXPECT_TRUE(StringView("ab") < StringView("abc"));
+    EXPECT_TRUE(StringView("b") > StringView("abc"));
+    EXPECT_TRUE(StringView("ABC").isEqualTo("abc", false));
+    EXPECT_FALSE(StringView("ABC").isEqualTo("abc"));
+    EXPECT_EQ(0, StringView("ABC").compare("abc", false));
+}
+
+// Numeric Conversions
+
+TEST(StringView, numeric_conversions) {
+    // Setup
+    StringView view = "10,-20,1.5,true";
+    std::vector<StringView> fields = view.split(",");
+
+    // Assertion
+    EXPECT_EQ(10, fields[0].intValue());
+    EXPECT_EQ(-20L, fields[1].longValue());
+    EXPECT_EQ(-20LL, fields[1].longLongValue());
+    EXPECT_EQ(10U, fields[0].unsignedValue());
+    EXPECT_EQ(10UL, fields[0].unsignedLongValue());
+    EXPECT_EQ(10ULL, fields[0].unsignedLongLongValue());
+    EXPECT_FLOAT_EQ(1.5f, fields[2].floatValue());
+    EXPECT_DOUBLE_EQ(1.5, fields[2].doubleValue());
+    EXPECT_DOUBLE_EQ(1.5, (double) fields[2].longDoubleValue());
+    EXPECT_TRUE(fields[3].boolValue());
+    EXPECT_THROW(fields[3].intValue(), InvalidValueException);
+}
+
+// String
+
+TEST(StringView, string_views) {
+    // Setup
+    String line = String("  key = value  ");
+    StringView trimmed = line.trimmedView();
+    std::vector<StringView> parts = trimmed.split("=");
+
+    // Assertion
+    EXPECT_EQ("key = value", trimmed.std_string());
+    EXPECT_EQ("key", parts[0].trim().std_string());
+    EXPECT_EQ("value", parts[1].trim().std_string());
+    EXPECT_EQ("key", line.substringView(2, 5).std_string());
+    EXPECT_EQ(2, line.splitViews("=").size());
+    EXPECT_EQ(line.c_string(), line.view().data());
+    EXPECT_STREQ("  key = value  ", line.c_string());
+}
@@ -44,6 +44,17 @@ TEST(String, std_str_constructor) {
     EXPECT_STREQ("test", string.c_string());
 }
 
+TEST(String, std_str_move_constructor) {
+    // Setup
+    std::string std_str = "a string long enough to be allocated on the heap";
+    const char* data = std_str.data();
+    String string = String(std::move(std_str));
+
+    // Assertion
+    EXPECT_STREQ("a string long enough to be allocated on the heap", string.c_string());
+    EXPECT_EQ(data, string.c_string());
+}
+
 TEST(String, literal_constructor) {
     // Setup
     String string = String("test");
@@ -666,6 +677,15 @@ TEST(String, pad_zero) {
     EXPECT_STREQ(" ", pad.c_string());
 }
 
+TEST(String, pad_self) {
+    // Setup
+    String string = String("ab");
+    string.pad(string, 2);
+
+    // Assertion
+    EXPECT_STREQ("ababababab", string.c_string());
+}
+
 // PadLeft
 
 TEST(String, pad_left) {
@@ -798,6 +818,16 @@ TEST(String, replace_all_invalid) {
     EXPECT_STREQ("merica", replacement.c_string());
 }
 
+TEST(String, replace_all_containing_target) {
+    // Setup
+    String string = String("a.b.c");
+    string.replaceAll(".", "..");
+
+    // Assertion
+    EXPECT_STREQ("a..b..c", string.c_string());
+    EXPECT_STREQ("a..b..c", String("a.b.c").replaceAll("", "x").replaceAll(".", "..").c_string());
+}
+
 // Remove
 
 TEST(String, remove_valid) {
@@ -905,6 +935,16 @@ TEST(String, remove_all_invalid) {
     EXPECT_STREQ("merica", remove_str.c_string());
 }
 
+TEST(String, remove_all_adjacent) {
+    // Setup
+    String string = String("xxaxxxbxx");
+    string.removeAll("xx");
+
+    // Assertion
+    EXPECT_STREQ("axb", string.c_string());
+    EXPECT_STREQ("abc", String("abc").removeAll("").c_string());
+}
+
 // Contains
 
 TEST(String, contains_valid) {
@@ -1105,6 +1145,44 @@ TEST(String, compare_case) {
     EXPECT_TRUE(string1.compare(string2) > 0);
 }
 
+// EditDistance
+
+TEST(String, edit_distance) {
+    // Setup
+    String string1 = String("kitten");
+    String string2 = String("sitting");
+
+    // Assertion
+    EXPECT_EQ(string1.editDistance(string2), 3);
+    EXPECT_EQ(string2.editDistance(string1), 3);
+    EXPECT_EQ(string1.editDistance(string1), 0);
+    EXPECT_EQ(string1.editDistance(""), 6);
+}
+
+TEST(String, edit_distance_long) {
+    // Setup
+    String string1 = String(std::string(150, 'a') + "middle" + std::string(150, 'b'));
+    String string2 = String(std::string(150, 'a') + "muddles" + std::string(150, 'b'));
+    String string3 = String(std::string(70, 'x') + std::string(70, 'y'));
+    String string4 = String(std::string(70, 'y') + std::string(70, 'x'));
+
+    // Assertion
+    EXPECT_EQ(string1.editDistance(string2), 2);
+    EXPECT_EQ(string3.editDistance(string4), 140);
+}
+
+TEST(String, within_distance) {
+    // Setup
+    String string1 = String("kitten");
+    String string2 = String("sitting");
+
+    // Assertion
+    EXPECT_TRUE(string1.withinDistance(string2, 3));
+    EXPECT_FALSE(string1.withinDistance(string2, 2));
+    EXPECT_FALSE(string1.withinDistance("kitten and more", 8));
+    EXPECT_TRUE(string1.withinDistance("kitten", 0));
+}
+
 // CompareIgnoreCase
 
 TEST(String, compare_ignore_case_less) {
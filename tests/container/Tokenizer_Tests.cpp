@@ -0,0 +1,158 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Tokenizer.hpp"
+#include "String.hpp"
+
+using namespace abraham;
+
+
+namespace {
+    std::vector<std::string> tokens(Tokenizer tokenizer) {
+        std::vector<std::string> output;
+        for (const StringView& token : tokenizer) {
+            output.push_back(token.std_string());
+        }
+
+        return output;
+    }
+}
+
+
+// Delimiters
+
+TEST(Tokenizer, character_delimiter) {
+    // Setup
+    Tokenizer tokenizer = Tokenizer("a,bb,,ccc", ',');
+    std::vector<std::string> expected = {"a", "bb", "", "ccc"};
+
+    // Assertion
+    EXPECT_EQ(TokenizerDelimiter::CHARACTER, tokenizer.delimiterType());
+    EXPECT_EQ(expected, tokens(tokenizer));
+}
+
+TEST(Tokenizer, character_delimiter_long_source) {
+    // Setup
+    String source = String("0123456789abcdefghijklmnopqrstuvwxyz|0123456789abcdefghijklmnopqrstuvwxyz|tail");
+    std::vector<std::string> expected = {"0123456789abcdefghijklmnopqrstuvwxyz", "0123456789abcdefghijklmnopqrstuvwxyz",
+                                         "tail"};
+
+    // Assertion
+    EXPECT_EQ(expected, tokens(Tokenizer(source, '|')));
+}
+
+TEST(Tokenizer, string_delimiter) {
+    // Setup
+    Tokenizer tokenizer = Tokenizer("a::b::::c", "::");
+    std::vector<std::string> expected = {"a", "b", "", "c"};
+
+    // Assertion
+    EXPECT_EQ(TokenizerDelimiter::STRING, tokenizer.delimiterType());
+    EXPECT_EQ(expected, tokens(tokenizer));
+}
+
+TEST(Tokenizer, empty_delimiter) {
+    // Setup
+    std::vector<std::string> expected = {"a", "b", "c"};
+
+    // Assertion
+    EXPECT_EQ(expected, tokens(Tokenizer("abc", "")));
+    EXPECT_TRUE(tokens(Tokenizer("", "")).empty());
+}
+
+TEST(Tokenizer, character_set_delimiter) {
+    // Setup
+    Tokenizer tokenizer = Tokenizer::anyOf("key=value; other:thing", "=;: ");
+    std::vector<std::string> expected = {"key", "value", "", "other", "thing"};
+
+    // Assertion
+    EXPECT_EQ(TokenizerDelimiter::CHARACTER_SET, tokenizer.delimiterType());
+    EXPECT_EQ(expected, tokens(tokenizer));
+}
+
+// Options
+
+TEST(Tokenizer, skip_empty) {
+    // Setup
+    std::vector<std::string> expected = {"a", "b", "c"};
+
+    // Assertion
+    EXPECT_EQ(expected, tokens(Tokenizer(",,a,,b,c,", ',').skipEmpty()));
+    EXPECT_EQ(expected, tokens(Tokenizer::anyOf("  a \t b\nc ", " \t\n").skipEmpty()));
+    EXPECT_TRUE(tokens(Tokenizer(",,,", ',').skipEmpty()).empty());
+}
+
+TEST(Tokenizer, options_on_temporary) {
+    // Setup
+    std::vector<std::string> skipped;
+    for (const StringView& token : Tokenizer(",,a,,b,c,", ',').skipEmpty()) {
+        skipped.push_back(token.std_string());
+    }
+
+    std::vector<std::string> limited;
+    for (const StringView& token : Tokenizer("a,b,c", ',').skipEmpty().maxSplits(1)) {
+        limited.push_back(token.std_string());
+    }
+
+    // Assertion
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}), skipped);
+    EXPECT_EQ(std::vector<std::string>({"a", "b,c"}), limited);
+}
+
+TEST(Tokenizer, max_splits) {
+    // Setup
+    std::vector<std::string> expected = {"GET", "/index.html HTTP/1.1"};
+    std::vector<std::string> skipped = {"a", "b", "c,d"};
+
+    // Assertion
+    EXPECT_EQ(expected, tokens(Tokenizer("GET /index.html HTTP/1.1", ' ').maxSplits(1)));
+    EXPECT_EQ(skipped, tokens(Tokenizer("a,,b,c,d", ',').skipEmpty().maxSplits(2)));
+    EXPECT_EQ(std::vector<std::string>{"a,b"}, tokens(Tokenizer("a,b", ',').maxSplits(0)));
+}
+
+// Advancing
+
+TEST(Tokenizer, next) {
+    // Setup
+    String line = String("id|name|rest|of|line");
+    Tokenizer tokenizer = Tokenizer(line, '|');
+    StringView id, name;
+    tokenizer.next(id);
+    tokenizer.next(name);
+
+    // Assertion
+    EXPECT_EQ("id", id.std_string());
+    EXPECT_EQ("name", name.std_string());
+    EXPECT_EQ(line.c_string() + 3, name.data());
+    EXPECT_EQ("rest|of|line", tokenizer.remainder().std_string());
+    EXPECT_FALSE(tokenizer.isFinished());
+}
+
+TEST(Tokenizer, exhausted) {
+    // Setup
+    Tokenizer tokenizer = Tokenizer("a", ',');
+    StringView token;
+
+    // Assertion
+    EXPECT_TRUE(tokenizer.next(token));
+    EXPECT_EQ("a", token.std_string());
+    EXPECT_TRUE(tokenizer.isFinished());
+    EXPECT_FALSE(tokenizer.next(token));
+    EXPECT_TRUE(tokenizer.remainder().isEmpty());
+}
+
+TEST(Tokenizer, iterator) {
+    // Setup
+    Tokenizer tokenizer = Tokenizer("x y z", ' ');
+    Tokenizer::Iterator iterator = tokenizer.begin();
+
+    // Assertion
+    EXPECT_EQ("x", iterator->std_string());
+    EXPECT_EQ("y", (*++iterator).std_string());
+    EXPECT_EQ("y", (*iterator++).std_string());
+    EXPECT_EQ("z", (*iterator).std_string());
+    EXPECT_TRUE(++iterator == tokenizer.end());
+    EXPECT_EQ(3, std::distance(tokenizer.begin(), tokenizer.end()));
+}
@@ -0,0 +1,300 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "CsvReader.hpp"
+#include "Exception.hpp"
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    std::vector<std::vector<std::string>> readAll(CsvReader reader) {
+        std::vector<std::vector<std::string>> records;
+        CsvRecord record;
+        while (reader.next(record)) {
+            std::vector<std::string> fields;
+            for (size_t i = 0; i < record.size(); ++i) {
+                fields.push_back(record[i].std_string());
+            }
+            records.push_back(fields);
+        }
+        return records;
+    }
+
+    typedef std::vector<std::vector<std::string>> Records;
+}
+
+
+// Reading Records
+
+TEST(CsvReader, records) {
+    // Setup
+    CsvReader reader = CsvReader("name,age\nalice,30\nbob,41");
+    CsvRecord record;
+
+    // Assertion
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.size(), 2);
+    EXPECT_EQ(record[0], "name");
+    EXPECT_EQ(record[1], "age");
+    EXPECT_EQ(record.number(), 1);
+    EXPECT_EQ(record.offset(), 0);
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.field(0), "alice");
+    EXPECT_EQ(record.offset(), 9);
+    EXPECT_EQ(reader.remainder(), "bob,41");
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record[1], "41");
+    EXPECT_TRUE(record.isValid());
+    EXPECT_THROW(record[2], OutOfBoundsException);
+    EXPECT_TRUE(reader.isFinished());
+    EXPECT_FALSE(reader.next(record));
+    EXPECT_EQ(reader.recordCount(), 3);
+}
+
+TEST(CsvReader, empty_fields) {
+    // Assertion
+    EXPECT_EQ(readAll(CsvReader(",a,,\n,")), Records({{"", "a", "", ""}, {"", ""}}));
+    EXPECT_EQ(readAll(CsvReader("a,\"\",b")), Records({{"a", "", "b"}}));
+    EXPECT_EQ(readAll(CsvReader("a,\"\"")), Records({{"a", ""}}));
+    EXPECT_EQ(readAll(CsvReader("\"x\",")), Records({{"x", ""}}));
+}
+
+TEST(CsvReader, blank_lines) {
+    // Setup
+    CsvReader reader = CsvReader("\n\na,b\r\n\r\n\nc\n\n");
+
+    // Assertion
+    EXPECT_EQ(readAll(reader), Records({{"a", "b"}, {"c"}}));
+    EXPECT_TRUE(readAll(CsvReader("")).empty());
+    EXPECT_TRUE(CsvReader("\n\r\n").isFinished());
+}
+
+TEST(CsvReader, line_endings) {
+    // Assertion
+    EXPECT_EQ(readAll(CsvReader("a,b\r\nc,d\r\n")), Records({{"a", "b"}, {"c", "d"}}));
+    EXPECT_EQ(readAll(CsvReader("\"a\"\r\n\"b\"\r")), Records({{"a"}, {"b"}}));
+}
+
+TEST(CsvReader, quoted_fields) {
+    // Setup
+    CsvReader reader = CsvReader("\"a,b\",\"line\nbreak\",\"say \"\"hi\"\"\",plain\n\"\"\"\"\n");
+
+    // Assertion
+    EXPECT_EQ(readAll(reader), Records({{"a,b", "line\nbreak", "say \"hi\"", "plain"}, {"\""}}));
+}
+
+TEST(CsvReader, copy_record) {
+    // Setup
+    CsvReader reader = CsvReader("\"a\"\"b\",x\n\"long enough to need a buffer of its own \"\"quoted\"\"\",y");
+    CsvRecord record;
+    CsvRecord assigned;
+    ASSERT_TRUE(reader.next(record));
+    CsvRecord copy = CsvRecord(record);
+    assigned = copy;
+    ASSERT_TRUE(reader.next(record));
+    CsvRecord long_copy = CsvRecord(record);
+    record = CsvRecord();
+
+    // Assertion
+    EXPECT_EQ(copy[0], "a\"b");
+    EXPECT_EQ(copy[1], "x");
+    EXPECT_EQ(assigned[0], "a\"b");
+    EXPECT_EQ(assigned.number(), 1);
+    EXPECT_EQ(long_copy[0], "long enough to need a buffer of its own \"quoted\"");
+    EXPECT_EQ(long_copy[1], "y");
+}
+
+TEST(CsvReader, move_record) {
+    // Setup
+    CsvReader reader = CsvReader("\"a\"\"b\",x\n\"long enough to need a buffer of its own \"\"quoted\"\"\",y");
+    CsvRecord record;
+    CsvRecord assigned;
+    ASSERT_TRUE(reader.next(record));
+    CsvRecord moved = CsvRecord(std::move(record));
+    assigned = std::move(moved);
+    ASSERT_TRUE(reader.next(record));
+    CsvRecord long_moved = CsvRecord(std::move(record));
+
+    // Assertion
+    EXPECT_EQ(assigned[0], "a\"b");
+    EXPECT_EQ(assigned[1], "x");
+    EXPECT_EQ(assigned.number(), 1);
+    EXPECT_EQ(moved.size(), 0);
+    EXPECT_EQ(long_moved[0], "long enough to need a buffer of its own \"quoted\"");
+    EXPECT_EQ(long_moved[1], "y");
+    EXPECT_EQ(record.size(), 0);
+}
+
+TEST(CsvReader, quote_in_unquoted_field) {
+    // Assertion
+    EXPECT_EQ(readAll(CsvReader("5\" pipe,x")), Records({{"5\" pipe", "x"}}));
+}
+
+TEST(CsvReader, tsv) {
+    // Setup
+    CsvReader reader = CsvReader::tsv("a\tb,c\t\"d\te\"\n1\t2\t3");
+
+    // Assertion
+    EXPECT_EQ(readAll(reader), Records({{"a", "b,c", "d\te"}, {"1", "2", "3"}}));
+}
+
+TEST(CsvReader, custom_quote) {
+    // Assertion
+    EXPECT_EQ(readAll(CsvReader("'a;b';'it''s'", ';', '\'')), Records({{"a;b", "it's"}}));
+}
+
+TEST(CsvReader, long_records) {
+    // Setup
+    std::mt19937 generator(47);
+    Records expected;
+    std::string text;
+    for (int r = 0; r < 300; ++r) {
+        std::vector<std::string> fields;
+        size_t count = 1 + generator() % 12;
+        for (size_t f = 0; f < count; ++f) {
+            std::string field;
+            size_t length = generator() % 50;
+            for (size_t i = 0; i < length; ++i) {
+                const char characters[] = "abc,\"\n\r x";
+                field.push_back(characters[generator() % 9]);
+            }
+            bool needs_quotes = field.find_first_of(",\"\n\r") != std::string::npos || field.empty();
+            if (needs_quotes) {
+                text.push_back('"');
+                for (char c : field) {
+                    if (c == '"') text.push_back('"');
+                    text.push_back(c);
+                }
+                text.push_back('"');
+            } else {
+                text.append(field);
+            }
+            text.push_back(f + 1 < count ? ',' : '\n');
+            fields.push_back(field);
+        }
+        expected.push_back(fields);
+    }
+
+    // Assertion
+    EXPECT_EQ(readAll(CsvReader(text)), expected);
+}
+
+
+// Malformed Records
+
+TEST(CsvReader, unterminated_quote) {
+    // Setup
+    CsvReader reader = CsvReader("a,\"open\nb,c");
+    CsvRecord record;
+
+    // Assertion
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_FALSE(record.isValid());
+    EXPECT_EQ(record.error(), CsvError::UNTERMINATED_QUOTE);
+    EXPECT_EQ(record[1], "open");
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_TRUE(record.isValid());
+    EXPECT_EQ(record[0], "b");
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST(CsvReader, text_after_quote) {
+    // Setup
+    CsvReader reader = CsvReader("\"a\"b,c\nd\n");
+    CsvRecord record;
+
+    // Assertion
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.error(), CsvError::TEXT_AFTER_QUOTE);
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_TRUE(record.isValid());
+    EXPECT_EQ(record[0], "d");
+    EXPECT_EQ(record.number(), 2);
+}
+
+
+// Typed Columns
+
+TEST(CsvReader, parse_field) {
+    // Setup
+    CsvReader reader = CsvReader("12, 3.5 ,x,true");
+    CsvRecord record;
+    reader.next(record);
+    int integer = 0;
+    double real = 0;
+    bool boolean = false;
+
+    // Assertion
+    EXPECT_EQ(record.parseField(0, integer), ParseError::NONE);
+    EXPECT_EQ(integer, 12);
+    EXPECT_EQ(record.parseField(1, real), ParseError::NONE);
+    EXPECT_EQ(real, 3.5);
+    EXPECT_EQ(record.parseField(2, integer), ParseError::INVALID);
+    EXPECT_EQ(integer, 12);
+    EXPECT_EQ(record.parseField(3, boolean), ParseError::NONE);
+    EXPECT_TRUE(boolean);
+    EXPECT_EQ(record.parseField(9, integer), ParseError::INVALID);
+}
+
+TEST(CsvReader, read_column) {
+    // Setup
+    CsvReader reader = CsvReader("id,score\n1,10.5\n2,oops\n3\n4,\"7\"\n5,\"bad\n6,2");
+    CsvRecord header;
+    reader.next(header);
+    Array<double> scores;
+    Array<size_t> bad_records;
+    size_t skipped = reader.readColumn(1, scores, &bad_records);
+
+    // Assertion
+    EXPECT_EQ(skipped, 3);
+    EXPECT_EQ(scores, Array<double>({10.5, 7, 2}));
+    EXPECT_EQ(bad_records, Array<size_t>({3, 4, 6}));
+    EXPECT_TRUE(reader.isFinished());
+}
+
+
+// Partitioning
+
+TEST(CsvReader, partition) {
+    // Setup
+    std::string text = "a,b\n\"c\nd\",e\nf,g\n";
+    std::vector<StringView> parts = CsvReader::partition(text, 3);
+
+    // Assertion
+    // The first target lands inside the quoted field, so the part runs to the end of its record
+    ASSERT_EQ(parts.size(), 2);
+    EXPECT_EQ(parts[0], "a,b\n\"c\nd\",e\n");
+    EXPECT_EQ(parts[1], "f,g\n");
+    EXPECT_TRUE(CsvReader::partition("", 2).empty());
+    EXPECT_EQ(CsvReader::partition("\"a\nb\nc\"", 3).size(), 1);
+}
+
+TEST(CsvReader, partition_records) {
+    // Setup
+    std::mt19937 generator(147);
+    std::string text;
+    for (int r = 0; r < 500; ++r) {
+        text.append("\"" + std::string(generator() % 20, 'q') + "\n" + std::string(generator() % 5, '"') +
+                    std::string(generator() % 5, '"') + "\"," + std::to_string(r) + "\n");
+    }
+    Records expected = readAll(CsvReader(text));
+
+    // Assertion
+    for (size_t count = 1; count < 30; ++count) {
+        Records records;
+        for (StringView part : CsvReader::partition(text, count)) {
+            for (const std::vector<std::string>& record : readAll(CsvReader(part))) {
+                records.push_back(record);
+            }
+        }
+        EXPECT_EQ(records, expected);
+    }
+}
@@ -0,0 +1,182 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "LineReader.hpp"
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace abraham;
+
+
+// Helper that splits text the slow way
+namespace {
+    std::vector<std::string> expectedLines(const std::string& text) {
+        std::vector<std::string> lines;
+        size_t start = 0;
+        while (start < text.length()) {
+            size_t newline = text.find('\n', start);
+            if (newline == std::string::npos) newline = text.length();
+            std::string line = text.substr(start, newline - start);
+            if (newline < text.length() && !line.empty() && line.back() == '\r') line.pop_back();
+            lines.push_back(line);
+            start = newline + 1;
+        }
+        return lines;
+    }
+
+    std::vector<std::string> readLines(LineReader reader) {
+        std::vector<std::string> lines;
+        for (StringView line : reader) {
+            lines.push_back(line.std_string());
+        }
+        return lines;
+    }
+}
+
+
+// Reading Lines
+
+TEST(LineReader, lines) {
+    // Setup
+    LineReader reader = LineReader("one\ntwo\n\nfour");
+    StringView line;
+
+    // Assertion
+    EXPECT_TRUE(reader.next(line));
+    EXPECT_EQ(line, "one");
+    EXPECT_TRUE(reader.next(line));
+    EXPECT_EQ(line, "two");
+    EXPECT_EQ(reader.remainder(), "\nfour");
+    EXPECT_TRUE(reader.next(line));
+    EXPECT_EQ(line, "");
+    EXPECT_FALSE(reader.isFinished());
+    EXPECT_TRUE(reader.next(line));
+    EXPECT_EQ(line, "four");
+    EXPECT_EQ(reader.lineCount(), 4);
+    EXPECT_TRUE(reader.isFinished());
+    EXPECT_FALSE(reader.next(line));
+}
+
+TEST(LineReader, trailing_newline) {
+    // Assertion
+    EXPECT_EQ(readLines(LineReader("a\nb\n")), std::vector<std::string>({"a", "b"}));
+    EXPECT_EQ(readLines(LineReader("\n")), std::vector<std::string>({""}));
+    EXPECT_EQ(readLines(LineReader("\n\n")), std::vector<std::string>({"", ""}));
+    EXPECT_TRUE(readLines(LineReader("")).empty());
+}
+
+TEST(LineReader, carriage_returns) {
+    // Setup
+    StringView text = "one\r\ntwo\r\n\r\nthree\r";
+
+    // Assertion
+    EXPECT_EQ(readLines(LineReader(text)), std::vector<std::string>({"one", "two", "", "three\r"}));
+    EXPECT_EQ(readLines(LineReader(text).keepCarriageReturns()),
+              std::vector<std::string>({"one\r", "two\r", "\r", "three\r"}));
+}
+
+TEST(LineReader, long_lines) {
+    // Setup
+    std::mt19937 generator(46);
+    std::string text;
+    for (int i = 0; i < 500; ++i) {
+        text.append(generator() % 100, static_cast<char>('a' + i % 26));
+        text.push_back(generator() % 4 == 0 ? '\r' : 'z');
+        text.push_back('\n');
+    }
+    text.append(70, 'q');
+
+    // Assertion
+    EXPECT_EQ(readLines(LineReader(text)), expectedLines(text));
+}
+
+TEST(LineReader, find_newline) {
+    // Setup
+    std::string text = std::string(100, 'x');
+
+    // Assertion
+    EXPECT_EQ(LineReader::findNewline(text.data(), text.data() + text.length()), text.data() + text.length());
+    for (size_t i = 0; i < text.length(); ++i) {
+        text[i] = '\n';
+        EXPECT_EQ(LineReader::findNewline(text.data(), text.data() + text.length()), text.data() + i);
+        EXPECT_EQ(LineReader::findNewline(text.data(), text.data() + i), text.data() + i);
+        text[i] = 'x';
+    }
+}
+
+
+// Partitioning
+
+TEST(LineReader, partition) {
+    // Setup
+    std::string text = "aaaa\nbbbb\ncccc\ndddd\neeee";
+    std::vector<StringView> parts = LineReader::partition(text, 3);
+
+    // Assertion
+    ASSERT_EQ(parts.size(), 3);
+    EXPECT_EQ(parts[0], "aaaa\nbbbb\n");
+    EXPECT_EQ(parts[1], "cccc\ndddd\n");
+    EXPECT_EQ(parts[2], "eeee");
+    EXPECT_EQ(LineReader::partition(text, 1).size(), 1);
+    EXPECT_EQ(LineReader::partition("no newline", 4).size(), 1);
+    EXPECT_TRUE(LineReader::partition("", 4).empty());
+}
+
+TEST(LineReader, partition_covers_text) {
+    // Setup
+    std::mt19937 generator(146);
+    std::string text;
+    for (int i = 0; i < 300; ++i) {
+        text.append(generator() % 40, 'x');
+        text.push_back('\n');
+    }
+
+    // Assertion
+    for (size_t count = 1; count < 40; ++count) {
+        std::vector<StringView> parts = LineReader::partition(text, count);
+        EXPECT_LE(parts.size(), count);
+        std::vector<std::string> lines;
+        std::string joined;
+        for (StringView part : parts) {
+            EXPECT_FALSE(part.isEmpty());
+            joined.append(part.data(), part.length());
+            for (const std::string& line : readLines(LineReader(part))) {
+                lines.push_back(line);
+            }
+        }
+        EXPECT_EQ(joined, text);
+        EXPECT_EQ(lines, expectedLines(text));
+    }
+}
+
+TEST(LineReader, parallel) {
+    // Setup
+    std::string text;
+    for (int i = 0; i < 10000; ++i) {
+        text.append(std::to_string(i));
+        text.push_back('\n');
+    }
+    std::vector<StringView> parts = LineReader::partition(text, 4);
+    std::atomic<size_t> lines(0);
+    std::vector<std::thread> threads;
+    for (StringView part : parts) {
+        threads.push_back(std::thread([part, &lines]() {
+            LineReader reader = LineReader(part);
+            StringView line;
+            while (reader.next(line)) {}
+            lines.fetch_add(reader.lineCount());
+        }));
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Assertion
+    EXPECT_EQ(parts.size(), 4);
+    EXPECT_EQ(lines.load(), 10000);
+}
@@ -0,0 +1,126 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "MappedFile.hpp"
+#include "Exception.hpp"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+using namespace abraham;
+
+
+// Helpers for files in the working directory
+namespace {
+    std::string temporaryPath(const std::string& name) {
+        return "abraham_mapped_file_" + name + ".tmp";
+    }
+
+    void writeFile(const std::string& path, const std::string& contents) {
+        std::ofstream output(path, std::ios::binary);
+        output.write(contents.data(), static_cast<std::streamsize>(contents.length()));
+    }
+}
+
+
+// Mapping
+
+TEST(MappedFile, map) {
+    // Setup
+    std::string path = temporaryPath("map");
+    std::string contents = "first line\nsecond line\n" + std::string(10000, 'x');
+    writeFile(path, contents);
+    MappedFile file = MappedFile(path);
+
+    // Assertion
+    EXPECT_TRUE(file.isMapped());
+    EXPECT_FALSE(file.isEmpty());
+    EXPECT_EQ(file.size(), contents.length());
+    EXPECT_EQ(file.view(), contents);
+    file.advise(FileAccess::WILL_NEED);
+    file.advise(FileAccess::RANDOM, 5000, 100000);
+    file.advise(FileAccess::NORMAL, 20000, 1);
+    EXPECT_EQ(file.view(), contents);
+    std::remove(path.c_str());
+}
+
+TEST(MappedFile, empty) {
+    // Setup
+    std::string path = temporaryPath("empty");
+    writeFile(path, "");
+    MappedFile file = MappedFile(path);
+
+    // Assertion
+    EXPECT_TRUE(file.isEmpty());
+    EXPECT_EQ(file.size(), 0);
+    EXPECT_EQ(file.view().length(), 0);
+    std::remove(path.c_str());
+}
+
+TEST(MappedFile, missing) {
+    // Assertion
+    EXPECT_THROW(MappedFile(temporaryPath("missing")), IOException);
+}
+
+TEST(MappedFile, move) {
+    // Setup
+    std::string path = temporaryPath("move");
+    writeFile(path, "mapped");
+    MappedFile file = MappedFile(path, FileAccess::RANDOM);
+    MappedFile moved = std::move(file);
+
+    // Assertion
+    EXPECT_EQ(moved.view(), "mapped");
+    EXPECT_TRUE(file.isEmpty());
+    file = std::move(moved);
+    EXPECT_EQ(file.view(), "mapped");
+    std::remove(path.c_str());
+}
+
+
+// Reading
+
+TEST(MappedFile, pipe) {
+    // Setup
+    int descriptors[2];
+    ASSERT_EQ(::pipe(descriptors), 0);
+    std::string contents = "piped\ncontents\n";
+    ASSERT_EQ(::write(descriptors[1], contents.data(), contents.length()), static_cast<ssize_t>(contents.length()));
+    ::close(descriptors[1]);
+    MappedFile file = MappedFile(descriptors[0]);
+    ::close(descriptors[0]);
+
+    // Assertion
+    EXPECT_FALSE(file.isMapped());
+    EXPECT_EQ(file.view(), contents);
+}
+
+TEST(MappedFile, move_read) {
+    // Setup
+    int descriptors[2];
+    ASSERT_EQ(::pipe(descriptors), 0);
+    ASSERT_EQ(::write(descriptors[1], "short", 5), 5);
+    ::close(descriptors[1]);
+    MappedFile file = MappedFile(descriptors[0]);
+    ::close(descriptors[0]);
+    MappedFile moved = std::move(file);
+
+    // Assertion
+    EXPECT_EQ(moved.view(), "short");
+    EXPECT_EQ(moved.data()[4], 't');
+}
+
+TEST(MappedFile, proc_file) {
+    // Setup
+    std::ifstream check("/proc/self/status");
+    if (!check) return;
+    MappedFile file = MappedFile("/proc/self/status");
+
+    // Assertion
+    EXPECT_FALSE(file.isMapped());
+    EXPECT_FALSE(file.isEmpty());
+    EXPECT_TRUE(file.view().contains("Name:"));
+}
@@ -0,0 +1,171 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "JsonCursor.hpp"
+#include "Exception.hpp"
+#include "JsonDocument.hpp"
+#include <string>
+#include <vector>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    const char* EVENTS = R"({
+        "source": "api",
+        "events": [
+            {"level": "info", "message": "started", "tags": ["a", {"b": [1, 2]}]},
+            {"level": "error", "message": "failed \"badly\"", "code": 500},
+            {"level": "error", "message": "timeout", "code": 504}
+        ],
+        "count": 3,
+        "ratio": 0.5,
+        "ok": false,
+        "extra": null
+    })";
+}
+
+
+// Navigation
+
+TEST(JsonCursor, scalars) {
+    // Setup
+    JsonIndex index = JsonIndex(EVENTS);
+    JsonCursor root = JsonCursor(index);
+
+    // Assertion
+    EXPECT_EQ(root["source"].asString(), "api");
+    EXPECT_EQ(root["count"].asInteger(), 3);
+    EXPECT_EQ(root["ratio"].asDouble(), 0.5);
+    EXPECT_FALSE(root["ok"].asBool());
+    EXPECT_TRUE(root["extra"].isNull());
+    EXPECT_EQ(root["count"].type(), JsonType::INTEGER);
+    EXPECT_EQ(root["ratio"].type(), JsonType::DOUBLE);
+    EXPECT_TRUE(root["ratio"].isNumber());
+    EXPECT_TRUE(root["ok"].isBool());
+    EXPECT_TRUE(root["events"].isArray());
+    EXPECT_TRUE(root.isObject());
+    EXPECT_TRUE(root["source"].isString());
+}
+
+TEST(JsonCursor, invalid_scalars) {
+    // Setup
+    JsonIndex index = JsonIndex(R"({"a": tru, "b": 1.5, "c": "3", "d": 01, "e": 99999999999999999999})");
+    JsonCursor root = JsonCursor(index);
+
+    // Assertion
+    EXPECT_THROW(root["a"].asBool(), InvalidValueException);
+    EXPECT_THROW(root["a"].type(), InvalidValueException);
+    EXPECT_THROW(root["b"].asInteger(), InvalidValueException);
+    EXPECT_THROW(root["c"].asDouble(), InvalidValueException);
+    EXPECT_THROW(root["d"].asInteger(), InvalidValueException);
+    EXPECT_THROW(root.asBool(), InvalidValueException);
+    EXPECT_EQ(root["e"].type(), JsonType::DOUBLE);
+    EXPECT_EQ(root["e"].asDouble(), 1e20);
+    EXPECT_THROW(root["e"].asUnsigned(), InvalidValueException);
+}
+
+TEST(JsonCursor, containers) {
+    // Setup
+    JsonIndex index = JsonIndex(EVENTS);
+    JsonCursor root = JsonCursor(index);
+    JsonCursor events = root["events"];
+
+    // Assertion
+    EXPECT_EQ(root.size(), 6);
+    EXPECT_EQ(events.size(), 3);
+    EXPECT_EQ(events[1]["message"].asString(), "failed \"badly\"");
+    EXPECT_EQ(events[0]["tags"][1]["b"][1].asInteger(), 2);
+    EXPECT_EQ(events[2]["code"].asInteger(), 504);
+    EXPECT_THROW(events[3], OutOfBoundsException);
+    EXPECT_THROW(root["missing"], InvalidValueException);
+    EXPECT_THROW(root[0], InvalidValueException);
+    EXPECT_THROW(events["level"], InvalidValueException);
+}
+
+TEST(JsonCursor, find) {
+    // Setup
+    JsonIndex index = JsonIndex(R"({"plain": 1, "escaped": 2, "quote\"": 3})");
+    JsonCursor root = JsonCursor(index);
+    JsonCursor value;
+
+    // Assertion
+    ASSERT_TRUE(root.find("escaped", value));
+    EXPECT_EQ(value.asInteger(), 2);
+    ASSERT_TRUE(root.find("quote\"", value));
+    EXPECT_EQ(value.asInteger(), 3);
+    EXPECT_EQ(value.key(), "quote\"");
+    EXPECT_FALSE(root.find("missing", value));
+    EXPECT_THROW(root.key(), InvalidValueException);
+}
+
+TEST(JsonCursor, iteration) {
+    // Setup
+    JsonIndex index = JsonIndex(EVENTS);
+    JsonCursor root = JsonCursor(index);
+    std::vector<std::string> keys;
+    size_t errors = 0;
+
+    for (const JsonCursor& event : root["events"]) {
+        if (event["level"].asString() == "error") ++errors;
+    }
+    for (const JsonCursor& member : root) {
+        keys.push_back(member.key().std_string());
+    }
+
+    // Assertion
+    EXPECT_EQ(errors, 2);
+    EXPECT_EQ(keys, (std::vector<std::string>{"source", "events", "count", "ratio", "ok", "extra"}));
+    EXPECT_TRUE(JsonCursor(JsonIndex("[]")).begin() == JsonCursor(JsonIndex("[]")).end());
+}
+
+TEST(JsonCursor, raw) {
+    // Setup
+    JsonIndex index = JsonIndex(R"({"a": [1, {"b": 2}] , "c": "text" , "d": -1.5 })");
+    JsonCursor root = JsonCursor(index);
+
+    // Assertion
+    EXPECT_EQ(root["a"].raw(), R"([1, {"b": 2}])");
+    EXPECT_EQ(root["c"].raw(), R"("text")");
+    EXPECT_EQ(root["d"].raw(), "-1.5");
+    EXPECT_EQ(root.raw(), index.text());
+}
+
+
+// Laziness
+
+TEST(JsonCursor, skipped_values_unchecked) {
+    // Setup
+    JsonIndex index = JsonIndex(R"({"bad": [01, tru, {"x" 1}], "good": 5})");
+    JsonCursor root = JsonCursor(index);
+
+    // Assertion
+    EXPECT_EQ(root["good"].asInteger(), 5);
+    EXPECT_THROW(root["bad"][0].asInteger(), InvalidValueException);
+    EXPECT_THROW(JsonDocument{root["bad"]}, InvalidValueException);
+}
+
+TEST(JsonCursor, unbalanced) {
+    // Setup
+    JsonIndex index = JsonIndex(R"({"a": [1, 2, "b": 3})");
+    JsonCursor root = JsonCursor(index);
+
+    // Assertion
+    EXPECT_THROW(root["b"], InvalidValueException);
+    EXPECT_THROW(JsonCursor(JsonIndex(" ")), InvalidValueException);
+}
+
+TEST(JsonCursor, materialize) {
+    // Setup
+    JsonIndex index = JsonIndex(EVENTS);
+    JsonCursor root = JsonCursor(index);
+    JsonDocument event = JsonDocument(root["events"][1]);
+
+    // Assertion
+    EXPECT_EQ(event.root().size(), 3);
+    EXPECT_EQ(event.root()["code"].asInteger(), 500);
+    EXPECT_EQ(event.root()["message"].asString(), "failed \"badly\"");
+}
@@ -0,0 +1,179 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "JsonDocument.hpp"
+#include "Exception.hpp"
+#include <string>
+#include <utility>
+
+using namespace abraham;
+
+
+// Scalars
+
+TEST(JsonDocument, literals) {
+    // Setup
+    JsonDocument null_value = JsonDocument("null");
+    JsonDocument true_value = JsonDocument(" true ");
+    JsonDocument false_value = JsonDocument("\nfalse");
+
+    // Assertion
+    EXPECT_TRUE(null_value.root().isNull());
+    EXPECT_EQ(null_value.root().type(), JsonType::NULL_VALUE);
+    EXPECT_TRUE(true_value.root().asBool());
+    EXPECT_FALSE(false_value.root().asBool());
+    EXPECT_TRUE(false_value.root().isBool());
+}
+
+TEST(JsonDocument, numbers) {
+    // Setup
+    JsonDocument integers = JsonDocument("[0, -0, 42, -17, 9223372036854775807, -9223372036854775808]");
+    JsonDocument doubles = JsonDocument("[1.5, -0.25, 1e3, 2.5E-2, 18446744073709551616, 1E+2]");
+    JsonDocument unsigned_integers = JsonDocument("[9223372036854775808, 18446744073709551615, 5, -1]");
+
+    // Assertion
+    EXPECT_EQ(integers.root()[0].asInteger(), 0);
+    EXPECT_EQ(integers.root()[1].asInteger(), 0);
+    EXPECT_EQ(integers.root()[2].asInteger(), 42);
+    EXPECT_EQ(integers.root()[3].asInteger(), -17);
+    EXPECT_EQ(integers.root()[4].asInteger(), INT64_MAX);
+    EXPECT_EQ(integers.root()[5].asInteger(), INT64_MIN);
+    EXPECT_EQ(integers.root()[2].asDouble(), 42.0);
+    EXPECT_TRUE(integers.root()[2].isNumber());
+
+    EXPECT_EQ(doubles.root()[0].asDouble(), 1.5);
+    EXPECT_EQ(doubles.root()[1].asDouble(), -0.25);
+    EXPECT_EQ(doubles.root()[2].asDouble(), 1000.0);
+    EXPECT_EQ(doubles.root()[3].asDouble(), 0.025);
+    EXPECT_TRUE(doubles.root()[4].isDouble());
+    EXPECT_EQ(doubles.root()[4].asDouble(), 18446744073709551616.0);
+    EXPECT_EQ(doubles.root()[5].asDouble(), 100.0);
+    EXPECT_THROW(doubles.root()[0].asInteger(), InvalidValueException);
+    EXPECT_THROW(doubles.root()[4].asUnsigned(), InvalidValueException);
+
+    EXPECT_TRUE(unsigned_integers.root()[0].isInteger());
+    EXPECT_TRUE(unsigned_integers.root()[0].isUnsigned());
+    EXPECT_EQ(unsigned_integers.root()[0].asUnsigned(), 9223372036854775808ULL);
+    EXPECT_EQ(unsigned_integers.root()[1].asUnsigned(), UINT64_MAX);
+    EXPECT_EQ(unsigned_integers.root()[1].asDouble(), 18446744073709551615.0);
+    EXPECT_THROW(unsigned_integers.root()[1].asInteger(), InvalidValueException);
+    EXPECT_FALSE(unsigned_integers.root()[2].isUnsigned());
+    EXPECT_EQ(unsigned_integers.root()[2].asUnsigned(), 5);
+    EXPECT_THROW(unsigned_integers.root()[3].asUnsigned(), InvalidValueException);
+}
+
+TEST(JsonDocument, strings) {
+    // Setup
+    JsonDocument document = JsonDocument(R"(["", "plain", "tab\tquote\"", "\u00e9\ud83d\ude00"])");
+
+    // Assertion
+    EXPECT_EQ(document.root()[0].asString(), "");
+    EXPECT_EQ(document.root()[1].asString(), "plain");
+    EXPECT_EQ(document.root()[2].asString(), "tab\tquote\"");
+    EXPECT_EQ(document.root()[3].asString(), "\xC3\xA9\xF0\x9F\x98\x80");
+    EXPECT_TRUE(document.root()[1].isString());
+}
+
+
+// Containers
+
+TEST(JsonDocument, objects) {
+    // Setup
+    JsonDocument document = JsonDocument(R"({"name": "abraham", "tags": ["c++", "json"], "meta": {}, "id": 7})");
+    const JsonValue& root = document.root();
+
+    // Assertion
+    EXPECT_TRUE(root.isObject());
+    EXPECT_EQ(root.size(), 4);
+    EXPECT_EQ(root["name"].asString(), "abraham");
+    EXPECT_EQ(root["tags"].size(), 2);
+    EXPECT_EQ(root["tags"][1].asString(), "json");
+    EXPECT_EQ(root["meta"].size(), 0);
+    EXPECT_EQ(root.key(3), "id");
+    EXPECT_EQ(root.value(3).asInteger(), 7);
+    EXPECT_TRUE(root.containsKey("tags"));
+    EXPECT_FALSE(root.containsKey("missing"));
+    EXPECT_EQ(root.find("missing"), nullptr);
+    EXPECT_THROW(root["missing"], InvalidValueException);
+    EXPECT_THROW(root.key(4), OutOfBoundsException);
+}
+
+TEST(JsonDocument, arrays) {
+    // Setup
+    JsonDocument document = JsonDocument("[[], [1, [2, [3]]], {\"a\": [null]}]");
+    const JsonValue& root = document.root();
+
+    // Assertion
+    EXPECT_EQ(root.size(), 3);
+    EXPECT_EQ(root[0].size(), 0);
+    EXPECT_EQ(root[1][1][1][0].asInteger(), 3);
+    EXPECT_TRUE(root[2]["a"][0].isNull());
+    EXPECT_THROW(root[3], OutOfBoundsException);
+    EXPECT_THROW(root["a"], InvalidValueException);
+}
+
+TEST(JsonDocument, repeated_keys) {
+    // Setup
+    JsonDocument document = JsonDocument(R"({"a": 1, "a": 2})");
+
+    // Assertion
+    EXPECT_EQ(document.root().size(), 2);
+    EXPECT_EQ(document.root()["a"].asInteger(), 1);
+}
+
+TEST(JsonDocument, deep_nesting) {
+    // Setup
+    const size_t depth = 100000;
+    const std::string text = std::string(depth, '[') + std::string(depth, ']');
+    JsonDocument document = JsonDocument(text);
+
+    // Assertion
+    const JsonValue* value = &document.root();
+    for (size_t i = 1; i < depth; ++i) {
+        ASSERT_EQ(value->size(), 1);
+        value = &(*value)[0];
+    }
+    EXPECT_EQ(value->size(), 0);
+}
+
+TEST(JsonDocument, independent_of_text) {
+    // Setup
+    std::string text = R"({"key": "value"})";
+    JsonDocument document = JsonDocument(text);
+    text.assign(text.length(), 'x');
+    JsonDocument moved = std::move(document);
+
+    // Assertion
+    EXPECT_EQ(moved.root().key(0), "key");
+    EXPECT_EQ(moved.root()["key"].asString(), "value");
+}
+
+TEST(JsonDocument, wrong_type) {
+    // Setup
+    JsonDocument document = JsonDocument(R"({"a": "text"})");
+
+    // Assertion
+    EXPECT_THROW(document.root()["a"].asBool(), InvalidValueException);
+    EXPECT_THROW(document.root()["a"].asDouble(), InvalidValueException);
+    EXPECT_THROW(document.root()["a"].size(), InvalidValueException);
+    EXPECT_THROW(document.root()[0], InvalidValueException);
+    EXPECT_THROW(document.root().asString(), InvalidValueException);
+}
+
+
+// Errors
+
+TEST(JsonDocument, invalid) {
+    // Setup
+    const char* texts[] = {
+            "", "   ", "[", "]", "{", "[1,]", "[1 2]", "{\"a\" 1}", "{\"a\":}", "{\"a\":1,}", "{1: 2}", "[1}",
+            "{\"a\": 1]", "tru", "truex", "nul", "[True]", "01", "-", "1.", ".5", "1e", "1e+", "+1", "--1", "0x10",
+            "\"abc", "\"a\tb\"", "\"\\x\"", "[1] 2", "{} {}", "\"a\" \"b\"", "1e999", "[\"a\"b]", "[,1]", "{,}", ":"};
+
+    // Assertion
+    for (const char* text : texts) {
+        EXPECT_THROW(JsonDocument{StringView(text)}, InvalidValueException) << text;
+    }
+}
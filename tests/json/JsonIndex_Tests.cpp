@@ -0,0 +1,202 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "JsonIndex.hpp"
+#include "Exception.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace abraham;
+
+
+// Helpers
+namespace {
+    std::vector<uint32_t> positions(const JsonIndex& index) {
+        std::vector<uint32_t> result;
+        for (size_t i = 0; i < index.size(); ++i) {
+            result.push_back(index[i]);
+        }
+        return result;
+    }
+
+    bool isOperator(char c) {
+        return c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',';
+    }
+
+    bool isWhitespace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    /**
+     * Finds the structural characters a character at a time. As in the index, a backslash escapes the character
+     * after it even outside of a string, where it can only be an error.
+     * @return false if the last string isn't closed.
+     */
+    bool referencePositions(const std::string& text, std::vector<uint32_t>& result) {
+        bool in_string = false;
+        bool is_escaped = false;
+        bool in_scalar = false;
+
+        for (size_t i = 0; i < text.length(); ++i) {
+            const char c = text[i];
+            const bool is_quote = c == '"' && !is_escaped;
+            is_escaped = c == '\\' && !is_escaped;
+
+            if (in_string) {
+                if (is_quote) in_string = false;
+            } else if (is_quote) {
+                result.push_back(static_cast<uint32_t>(i));
+                in_string = true;
+                in_scalar = false;
+            } else if (isOperator(c)) {
+                result.push_back(static_cast<uint32_t>(i));
+                in_scalar = false;
+            } else if (isWhitespace(c)) {
+                in_scalar = false;
+            } else {
+                if (!in_scalar) result.push_back(static_cast<uint32_t>(i));
+                in_scalar = true;
+            }
+        }
+
+        return !in_string;
+    }
+
+    std::string unescape(const std::string& string) {
+        std::string output = std::string(string.length(), '\0');
+        output.resize(JsonIndex::unescape(string.data(), string.data() + string.length(), &output[0]));
+        return output;
+    }
+}
+
+
+// Indexing
+
+TEST(JsonIndex, structurals) {
+    // Setup
+    JsonIndex index = JsonIndex(R"({"a": [1, true, "x,]"], "b" : null})");
+
+    // Assertion
+    EXPECT_EQ(positions(index), (std::vector<uint32_t>{0, 1, 4, 6, 7, 8, 10, 14, 16, 21, 22, 24, 28, 30, 34}));
+    EXPECT_EQ(index.text().length(), 35);
+}
+
+TEST(JsonIndex, scalar_starts) {
+    // Setup
+    JsonIndex number = JsonIndex("  -12.5e3  ");
+    JsonIndex literal = JsonIndex("[false,null]");
+
+    // Assertion
+    EXPECT_EQ(positions(number), std::vector<uint32_t>{2});
+    EXPECT_EQ(positions(literal), (std::vector<uint32_t>{0, 1, 6, 7, 11}));
+}
+
+TEST(JsonIndex, escaped_quotes) {
+    // Setup
+    JsonIndex escaped = JsonIndex(R"(["a\"b", "c\\", "d"])");
+
+    // Assertion
+    EXPECT_EQ(positions(escaped), (std::vector<uint32_t>{0, 1, 7, 9, 14, 16, 19}));
+}
+
+TEST(JsonIndex, escapes_across_blocks) {
+    // Setup
+    // Runs of backslashes of each length end at each position around the first block boundary
+    for (size_t run = 1; run <= 6; ++run) {
+        for (size_t end = 56; end <= 72; ++end) {
+            std::string text = "[\"" + std::string(end - run - 2, 'x') + std::string(run, '\\') + "\"";
+            if (run % 2 == 1) text += "\"";
+            text += ", 1]";
+
+            std::vector<uint32_t> expected;
+            ASSERT_TRUE(referencePositions(text, expected));
+
+            // Assertion
+            EXPECT_EQ(positions(JsonIndex(text)), expected) << text;
+        }
+    }
+}
+
+TEST(JsonIndex, matches_reference) {
+    // Setup
+    const char alphabet[] = {'"', '"', '\\', '{', '}', '[', ']', ':', ',', ' ', '\n', 'a', '1', '-'};
+    std::mt19937 random = std::mt19937(49);
+
+    for (size_t trial = 0; trial < 2000; ++trial) {
+        std::string text;
+        const size_t length = random() % 300;
+        for (size_t i = 0; i < length; ++i) {
+            text.push_back(alphabet[random() % sizeof(alphabet)]);
+        }
+
+        std::vector<uint32_t> expected;
+
+        // Assertion
+        if (referencePositions(text, expected)) {
+            EXPECT_EQ(positions(JsonIndex(text)), expected) << text;
+        } else {
+            EXPECT_THROW(JsonIndex{StringView(text)}, InvalidValueException) << text;
+        }
+    }
+}
+
+TEST(JsonIndex, empty) {
+    // Setup
+    JsonIndex empty = JsonIndex("");
+    JsonIndex whitespace = JsonIndex(" \n\t ");
+
+    // Assertion
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_EQ(whitespace.size(), 0);
+}
+
+TEST(JsonIndex, invalid) {
+    // Assertion
+    EXPECT_THROW(JsonIndex("[\"abc]"), InvalidValueException);
+    EXPECT_THROW(JsonIndex("\"abc\\\""), InvalidValueException);
+    EXPECT_THROW(JsonIndex("[\"\xC3\x28\"]"), InvalidValueException);
+    EXPECT_NO_THROW(JsonIndex("[\"\xC3\xA9\"]"));
+}
+
+
+// Strings
+
+TEST(JsonIndex, find_escapable) {
+    // Setup
+    const std::string plain = std::string(100, 'x');
+    std::string quoted = plain;
+    quoted[70] = '"';
+    std::string control = plain;
+    control[33] = '\x1F';
+    std::string high = plain + "\xC3\xA9";
+
+    // Assertion
+    EXPECT_EQ(JsonIndex::findEscapable(plain.data(), plain.data() + plain.length()), plain.data() + plain.length());
+    EXPECT_EQ(JsonIndex::findEscapable(quoted.data(), quoted.data() + quoted.length()), quoted.data() + 70);
+    EXPECT_EQ(JsonIndex::findEscapable(control.data(), control.data() + control.length()), control.data() + 33);
+    EXPECT_EQ(JsonIndex::findEscapable(high.data(), high.data() + high.length()), high.data() + high.length());
+}
+
+TEST(JsonIndex, unescape) {
+    // Assertion
+    EXPECT_EQ(unescape("plain"), "plain");
+    EXPECT_EQ(unescape(R"(a\"b\\c\/d)"), "a\"b\\c/d");
+    EXPECT_EQ(unescape(R"(\b\f\n\r\t)"), "\b\f\n\r\t");
+    EXPECT_EQ(unescape(R"(\u0041\u00e9\u20AC)"), "A\xC3\xA9\xE2\x82\xAC");
+    EXPECT_EQ(unescape(R"(\ud83d\ude00!)"), "\xF0\x9F\x98\x80!");
+}
+
+TEST(JsonIndex, unescape_invalid) {
+    // Assertion
+    EXPECT_THROW(unescape(R"(\x)"), InvalidValueException);
+    EXPECT_THROW(unescape(R"(\u12)"), InvalidValueException);
+    EXPECT_THROW(unescape(R"(\u12g4)"), InvalidValueException);
+    EXPECT_THROW(unescape(R"(\ud83d)"), InvalidValueException);
+    EXPECT_THROW(unescape(R"(\ud83dA)"), InvalidValueException);
+    EXPECT_THROW(unescape(R"(\ude00)"), InvalidValueException);
+    EXPECT_THROW(unescape("tab\there"), InvalidValueException);
+    EXPECT_THROW(unescape("end\\"), InvalidValueException);
+}
@@ -0,0 +1,125 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "JsonWriter.hpp"
+#include "Exception.hpp"
+#include "JsonDocument.hpp"
+#include <cmath>
+#include <limits>
+#include <string>
+
+using namespace abraham;
+
+
+// Writing
+
+TEST(JsonWriter, objects) {
+    // Setup
+    JsonWriter writer = JsonWriter();
+    writer.beginObject().key("name").value("abraham").key("version").value(1).key("tags").beginArray()
+          .value("c++").value(true).null().endArray().key("empty").beginObject().endObject().endObject();
+
+    // Assertion
+    EXPECT_TRUE(writer.isComplete());
+    EXPECT_EQ(writer.build(), R"({"name":"abraham","version":1,"tags":["c++",true,null],"empty":{}})");
+    EXPECT_FALSE(writer.isComplete());
+    EXPECT_EQ(writer.view(), "");
+}
+
+TEST(JsonWriter, numbers) {
+    // Setup
+    JsonWriter writer = JsonWriter(64);
+    writer.beginArray().value(-42).value(18446744073709551615ULL).value(1.5).value(0.1f).value(1e300)
+          .value(-9223372036854775807LL - 1).endArray();
+
+    // Assertion
+    EXPECT_EQ(writer.build(), "[-42,18446744073709551615,1.5,0.1,1e+300,-9223372036854775808]");
+    EXPECT_THROW(writer.value(std::numeric_limits<double>::infinity()), InvalidArgumentException);
+    EXPECT_THROW(writer.value(std::numeric_limits<float>::quiet_NaN()), InvalidArgumentException);
+}
+
+TEST(JsonWriter, integral_doubles) {
+    // Setup
+    JsonWriter writer = JsonWriter();
+    writer.beginArray().value(3.0).value(-0.0).value(48193646583476385.0).value(2.0f).value(1e21).endArray();
+    const String json = writer.build();
+    const JsonDocument document = JsonDocument(json);
+    const JsonValue& root = document.root();
+
+    // Assertion
+    EXPECT_EQ(json, "[3.0,-0.0,48193646583476380.0,2.0,1e+21]");
+    for (size_t i = 0; i < root.size(); ++i) {
+        EXPECT_EQ(root[i].type(), JsonType::DOUBLE);
+    }
+    EXPECT_EQ(root[0].asDouble(), 3.0);
+    EXPECT_TRUE(std::signbit(root[1].asDouble()));
+    EXPECT_EQ(root[2].asDouble(), 48193646583476385.0);
+}
+
+TEST(JsonWriter, escaping) {
+    // Setup
+    const std::string control = std::string("nul\0bell\x07", 9);
+    JsonWriter writer = JsonWriter();
+    writer.beginArray().value("quote\" backslash\\ slash/").value("\b\f\n\r\t").value(StringView(control))
+          .value("\xC3\xA9").value(std::string(100, 'x') + "\n").endArray();
+
+    // Assertion
+    EXPECT_EQ(writer.build(), "[\"quote\\\" backslash\\\\ slash/\",\"\\b\\f\\n\\r\\t\",\"nul\\u0000bell\\u0007\","
+                              "\"\xC3\xA9\",\"" + std::string(100, 'x') + "\\n\"]");
+}
+
+TEST(JsonWriter, escaped_keys) {
+    // Setup
+    JsonWriter writer = JsonWriter();
+    writer.beginObject().key("a\"b").value(1).endObject();
+
+    // Assertion
+    EXPECT_EQ(writer.build(), R"({"a\"b":1})");
+}
+
+TEST(JsonWriter, parsed_values) {
+    // Setup
+    const char* text = R"({"a":[1,-2.5,"x\ny",null,{"b":false}],"c":{}})";
+    JsonDocument document = JsonDocument(text);
+    JsonWriter writer = JsonWriter();
+    writer.value(document.root());
+
+    // Assertion
+    EXPECT_EQ(writer.build(), text);
+}
+
+
+// Misuse
+
+TEST(JsonWriter, invalid_calls) {
+    // Setup
+    JsonWriter writer = JsonWriter();
+
+    // Assertion
+    EXPECT_THROW(writer.key("a"), InvalidArgumentException);
+    EXPECT_THROW(writer.endArray(), InvalidArgumentException);
+    EXPECT_THROW(writer.build(), InvalidArgumentException);
+
+    writer.beginObject();
+    EXPECT_THROW(writer.value(1), InvalidArgumentException);
+    EXPECT_THROW(writer.endArray(), InvalidArgumentException);
+    writer.key("a");
+    EXPECT_THROW(writer.key("b"), InvalidArgumentException);
+    EXPECT_THROW(writer.endObject(), InvalidArgumentException);
+    writer.value(1).endObject();
+    EXPECT_THROW(writer.value(2), InvalidArgumentException);
+    EXPECT_EQ(writer.build(), R"({"a":1})");
+}
+
+TEST(JsonWriter, clear) {
+    // Setup
+    JsonWriter writer = JsonWriter();
+    writer.beginArray().value(1);
+    writer.clear();
+    writer.value("fresh");
+
+    // Assertion
+    EXPECT_EQ(writer.build(), "\"fresh\"");
+}
@@ -0,0 +1,113 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Json.hpp"
+#include <climits>
+#include <cstdint>
+
+using namespace abraham;
+
+
+// Parsing
+
+TEST(Json, parse_scalars) {
+    // Assertion
+    EXPECT_EQ(Json::parse<int>("42"), 42);
+    EXPECT_EQ(Json::parse<int64_t>("-9000000000"), -9000000000LL);
+    EXPECT_EQ(Json::parse<double>("2.5"), 2.5);
+    EXPECT_EQ(Json::parse<double>("2"), 2.0);
+    EXPECT_EQ(Json::parse<float>("0.5"), 0.5f);
+    EXPECT_TRUE(Json::parse<bool>("true"));
+    EXPECT_EQ(Json::parse<String>(R"("abc")"), "abc");
+}
+
+TEST(Json, parse_containers) {
+    // Setup
+    Array<int> numbers = Json::parse<Array<int>>("[1, 2, 3]");
+    Dictionary<String, Array<String>> groups = Json::parse<Dictionary<String, Array<String>>>(
+            R"({"admins": ["ann"], "users": ["bob", "cy"], "guests": []})");
+
+    // Assertion
+    EXPECT_EQ(numbers, Array<int>({1, 2, 3}));
+    EXPECT_EQ(groups.size(), 3);
+    EXPECT_EQ(groups["users"], Array<String>({"bob", "cy"}));
+    EXPECT_EQ(groups["guests"].size(), 0);
+}
+
+TEST(Json, parse_repeated_keys) {
+    // Setup
+    Dictionary<String, int> values = Json::parse<Dictionary<String, int>>(R"({"a": 1, "b": 2, "a": 3})");
+
+    // Assertion
+    EXPECT_EQ(values.size(), 2);
+    EXPECT_EQ(values["a"], 3);
+}
+
+TEST(Json, parse_invalid) {
+    // Assertion
+    EXPECT_THROW(Json::parse<int>("3000000000"), InvalidValueException);
+    EXPECT_THROW(Json::parse<unsigned>("-1"), InvalidValueException);
+    EXPECT_THROW(Json::parse<uint8_t>("256"), InvalidValueException);
+    EXPECT_THROW(Json::parse<int>("1.5"), InvalidValueException);
+    EXPECT_THROW(Json::parse<String>("1"), InvalidValueException);
+    EXPECT_THROW(Json::parse<Array<int>>(R"({"a": 1})"), InvalidValueException);
+    EXPECT_THROW((Json::parse<Dictionary<String, int>>("[1]")), InvalidValueException);
+    EXPECT_THROW(Json::parse<Array<int>>("[1, \"2\"]"), InvalidValueException);
+    EXPECT_THROW(Json::parse<Array<int>>("[1, 2"), InvalidValueException);
+}
+
+TEST(Json, parse_cursor) {
+    // Setup
+    JsonIndex index = JsonIndex(R"({"skipped": [[[1]]], "ids": [4, 5, 6]})");
+    JsonCursor root = JsonCursor(index);
+
+    // Assertion
+    EXPECT_EQ(Json::parse<Array<int>>(root["ids"]), Array<int>({4, 5, 6}));
+}
+
+
+// Serializing
+
+TEST(Json, serialize) {
+    // Setup
+    Dictionary<String, Array<double>> series = Dictionary<String, Array<double>>();
+    series.addObject("b", Array<double>({0.5, -1.0}));
+    series.addObject("a", Array<double>());
+
+    // Assertion
+    EXPECT_EQ(Json::serialize(42), "42");
+    EXPECT_EQ(Json::serialize(String("say \"hi\"")), R"("say \"hi\"")");
+    EXPECT_EQ(Json::serialize(Array<bool>({true, false})), "[true,false]");
+    EXPECT_EQ(Json::serialize(series), R"({"a":[],"b":[0.5,-1.0]})");
+}
+
+TEST(Json, round_trip) {
+    // Setup
+    Dictionary<String, Dictionary<String, int64_t>> original = Dictionary<String, Dictionary<String, int64_t>>();
+    original.addObject("limits", Dictionary<String, int64_t>({{"min", INT64_MIN}, {"max", INT64_MAX}}));
+    original.addObject("é\n", Dictionary<String, int64_t>({{"zero", 0}}));
+
+    const String json = Json::serialize(original);
+    Dictionary<String, Dictionary<String, int64_t>> parsed =
+            Json::parse<Dictionary<String, Dictionary<String, int64_t>>>(json);
+
+    // Assertion
+    EXPECT_EQ(parsed, original);
+}
+
+TEST(Json, round_trip_unsigned) {
+    // Setup
+    const Array<unsigned long long> original = Array<unsigned long long>({ULLONG_MAX, 1, 9223372036854775808ULL});
+    const String json = Json::serialize(original);
+    const Array<unsigned long long> parsed = Json::parse<Array<unsigned long long>>(json);
+
+    // Assertion
+    EXPECT_EQ(json, "[18446744073709551615,1,9223372036854775808]");
+    EXPECT_EQ(parsed, original);
+    EXPECT_EQ(Json::serialize(JsonDocument(json).root()), json);
+    EXPECT_THROW(Json::parse<unsigned>("4294967296"), InvalidValueException);
+    EXPECT_THROW(Json::parse<unsigned long long>("-1"), InvalidValueException);
+    EXPECT_THROW(Json::parse<long long>("18446744073709551615"), InvalidValueException);
+}
@@ -0,0 +1,171 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Arena.hpp"
+#include <cstdint>
+#include <cstring>
+
+using namespace abraham;
+
+
+// Helper type for checking create
+struct Point {
+    int x;
+    int y;
+
+    Point(int x, int y) : x(x), y(y) {}
+};
+
+
+// Constructor
+
+TEST(Arena, constructor) {
+    // Setup
+    Arena arena(128);
+
+    // Assertion
+    EXPECT_EQ(0, arena.used());
+    EXPECT_EQ(0, arena.capacity());
+}
+
+
+// Allocation
+
+TEST(Arena, allocate) {
+    // Setup
+    Arena arena(128);
+    char* first = static_cast<char*>(arena.allocate(10, 1));
+    char* second = static_cast<char*>(arena.allocate(10, 1));
+    std::memset(first, 'a', 10);
+    std::memset(second, 'b', 10);
+
+    // Assertion
+    EXPECT_EQ(first + 10, second);
+    EXPECT_EQ('a', first[9]);
+    EXPECT_EQ('b', second[0]);
+    EXPECT_EQ(20, arena.used());
+    EXPECT_EQ(128, arena.capacity());
+}
+
+TEST(Arena, allocate_alignment) {
+    // Setup
+    Arena arena(128);
+    arena.allocate(1, 1);
+    void* aligned8 = arena.allocate(8, 8);
+    arena.allocate(3, 1);
+    void* aligned64 = arena.allocate(8, 64);
+
+    // Assertion
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(aligned8) % 8);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(aligned64) % 64);
+}
+
+TEST(Arena, allocate_new_block) {
+    // Setup
+    Arena arena(64);
+    char* first = static_cast<char*>(arena.allocate(48, 1));
+    char* second = static_cast<char*>(arena.allocate(48, 1));
+    std::memset(first, 'a', 48);
+    std::memset(second, 'b', 48);
+
+    // Assertion
+    EXPECT_EQ('a', first[47]);
+    EXPECT_EQ(96, arena.used());
+    EXPECT_EQ(64 + 128, arena.capacity());
+}
+
+TEST(Arena, allocate_larger_than_block) {
+    // Setup
+    Arena arena(64);
+    char* memory = static_cast<char*>(arena.allocate(1000, 1));
+    std::memset(memory, 'a', 1000);
+
+    // Assertion
+    EXPECT_EQ(1000, arena.used());
+    EXPECT_LE(1000, arena.capacity());
+}
+
+TEST(Arena, create) {
+    // Setup
+    Arena arena;
+    Point* point = arena.create<Point>(3, 4);
+
+    // Assertion
+    EXPECT_EQ(3, point->x);
+    EXPECT_EQ(4, point->y);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(point) % alignof(Point));
+}
+
+
+// Reallocation
+
+TEST(Arena, reallocate_in_place) {
+    // Setup
+    Arena arena(128);
+    char* memory = static_cast<char*>(arena.allocate(10, 1));
+    std::memcpy(memory, "0123456789", 10);
+    char* resized = static_cast<char*>(arena.reallocate(memory, 10, 40, 1));
+
+    // Assertion
+    EXPECT_EQ(memory, resized);
+    EXPECT_EQ(0, std::memcmp(resized, "0123456789", 10));
+    EXPECT_EQ(40, arena.used());
+}
+
+TEST(Arena, reallocate_moves) {
+    // Setup
+    Arena arena(128);
+    char* memory = static_cast<char*>(arena.allocate(10, 1));
+    std::memcpy(memory, "0123456789", 10);
+    arena.allocate(10, 1);
+    char* resized = static_cast<char*>(arena.reallocate(memory, 10, 20, 1));
+
+    // Assertion
+    EXPECT_NE(memory, resized);
+    EXPECT_EQ(0, std::memcmp(resized, "0123456789", 10));
+}
+
+TEST(Arena, reallocate_null) {
+    // Setup
+    Arena arena(128);
+    void* memory = arena.reallocate(nullptr, 0, 16, 1);
+
+    // Assertion
+    EXPECT_NE(nullptr, memory);
+    EXPECT_EQ(16, arena.used());
+}
+
+
+// Reset
+
+TEST(Arena, reset) {
+    // Setup
+    Arena arena(64);
+    void* first = arena.allocate(48, 1);
+    arena.allocate(48, 1);
+    size_t capacity = arena.capacity();
+    arena.reset();
+
+    // Assertion
+    EXPECT_EQ(0, arena.used());
+    EXPECT_EQ(capacity, arena.capacity());
+    EXPECT_EQ(first, arena.allocate(48, 1));
+    arena.allocate(48, 1);
+    EXPECT_EQ(capacity, arena.capacity());
+}
+
+TEST(Arena, reset_reuses_larger_block) {
+    // Setup
+    Arena arena(64);
+    arena.allocate(32, 1);
+    arena.allocate(1000, 1);
+    size_t capacity = arena.capacity();
+    arena.reset();
+    arena.allocate(32, 1);
+    arena.allocate(1000, 1);
+
+    // Assertion
+    EXPECT_EQ(capacity, arena.capacity());
+}
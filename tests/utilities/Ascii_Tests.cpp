@@ -0,0 +1,135 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Ascii.hpp"
+#include "String.hpp"
+#include <map>
+#include <unordered_map>
+
+using namespace abraham;
+
+
+namespace {
+    /**
+     * Every byte value, repeated so each one lands in a different lane of the vector and word loops.
+     */
+    std::string allBytes() {
+        std::string bytes;
+        for (int repeat = 0; repeat < 3; ++repeat) {
+            for (int c = 0; c < 256; ++c) {
+                bytes.push_back(static_cast<char>(c));
+            }
+            bytes.push_back('x');
+        }
+
+        return bytes;
+    }
+
+    char referenceLower(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 32) : c; }
+
+    char referenceUpper(char c) { return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 32) : c; }
+}
+
+
+// Case Mapping
+
+TEST(Ascii, case_characters) {
+    // Assertion
+    EXPECT_EQ('a', Ascii::toLowerCase('A'));
+    EXPECT_EQ('z', Ascii::toLowerCase('Z'));
+    EXPECT_EQ('@', Ascii::toLowerCase('@'));
+    EXPECT_EQ('[', Ascii::toLowerCase('['));
+    EXPECT_EQ('A', Ascii::toUpperCase('a'));
+    EXPECT_EQ('`', Ascii::toUpperCase('`'));
+    EXPECT_EQ('{', Ascii::toUpperCase('{'));
+    EXPECT_EQ('\xC9', Ascii::toUpperCase('\xC9'));
+}
+
+TEST(Ascii, case_ranges_match_reference) {
+    // Setup
+    const std::string bytes = allBytes();
+
+    // Assertion
+    for (size_t length = 0; length <= bytes.length(); length += 7) {
+        std::string lower = bytes.substr(0, length);
+        std::string upper = lower;
+        std::string swapped = lower;
+        Ascii::toLowerCase(&lower[0], length);
+        Ascii::toUpperCase(&upper[0], length);
+        Ascii::swapCase(&swapped[0], length);
+
+        for (size_t i = 0; i < length; ++i) {
+            ASSERT_EQ(referenceLower(bytes[i]), lower[i]) << "index " << i;
+            ASSERT_EQ(referenceUpper(bytes[i]), upper[i]) << "index " << i;
+            char expected = bytes[i] == referenceLower(bytes[i]) ? referenceUpper(bytes[i]) : referenceLower(bytes[i]);
+            ASSERT_EQ(expected, swapped[i]) << "index " << i;
+        }
+    }
+}
+
+// Comparison
+
+TEST(Ascii, is_equal_ignoring_case) {
+    // Setup
+    std::string lower = "the quick brown fox jumps over the lazy dog 0123456789 []{}@`";
+    std::string mixed = "The QUICK brown FOX jumps OVER the LAZY dog 0123456789 []{}@`";
+
+    // Assertion
+    EXPECT_TRUE(Ascii::isEqualIgnoringCase(lower.data(), mixed.data(), lower.length()));
+    for (size_t i = 0; i < lower.length(); ++i) {
+        std::string different = mixed;
+        different[i] = '#';
+        ASSERT_FALSE(Ascii::isEqualIgnoringCase(lower.data(), different.data(), lower.length())) << "index " << i;
+    }
+    EXPECT_FALSE(Ascii::isEqualIgnoringCase("[", "{", 1));
+    EXPECT_FALSE(Ascii::isEqualIgnoringCase("@", "`", 1));
+}
+
+TEST(Ascii, compare_ignoring_case) {
+    // Setup
+    std::string left = "Content-Length: 1234567890 abcdefghijklmnopqrstuvwxyz";
+    std::string right = "CONTENT-LENGTH: 1234567890 ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+    // Assertion
+    EXPECT_EQ(0, Ascii::compareIgnoringCase(left.data(), left.length(), right.data(), right.length()));
+    EXPECT_EQ(-1, Ascii::compareIgnoringCase(left.data(), left.length() - 1, right.data(), right.length()));
+    EXPECT_EQ(1, Ascii::compareIgnoringCase(left.data(), left.length(), right.data(), right.length() - 1));
+    right[40] = '~';
+    EXPECT_EQ(-1, Ascii::compareIgnoringCase(left.data(), left.length(), right.data(), right.length()));
+    EXPECT_EQ(1, Ascii::compareIgnoringCase(right.data(), right.length(), left.data(), left.length()));
+    EXPECT_EQ(-1, Ascii::compareIgnoringCase("A", 1, "\xC9", 1));
+}
+
+// Hashing
+
+TEST(Ascii, hash_ignoring_case) {
+    // Setup
+    std::string lower = "x-forwarded-for-some-longer-header-name";
+    std::string upper = "X-FORWARDED-FOR-SOME-LONGER-HEADER-NAME";
+
+    // Assertion
+    EXPECT_EQ(Ascii::hashIgnoringCase(lower.data(), lower.length()), Ascii::hashIgnoringCase(upper.data(), upper.length()));
+    EXPECT_NE(Ascii::hashIgnoringCase("host", 4), Ascii::hashIgnoringCase("hosts", 5));
+    EXPECT_NE(Ascii::hashIgnoringCase("a", 1), Ascii::hashIgnoringCase("a\0", 2));
+    EXPECT_NE(Ascii::hashIgnoringCase("[", 1), Ascii::hashIgnoringCase("{", 1));
+}
+
+TEST(Ascii, case_insensitive_keys) {
+    // Setup
+    std::unordered_map<String, int, CaseInsensitiveHash, CaseInsensitiveEqual> hashed;
+    std::map<String, int, CaseInsensitiveLess> ordered;
+    hashed["Content-Type"] = 1;
+    hashed["CONTENT-TYPE"] = 2;
+    ordered["Accept"] = 1;
+    ordered["accept"] = 2;
+    ordered["HOST"] = 3;
+
+    // Assertion
+    EXPECT_EQ(1, hashed.size());
+    EXPECT_EQ(2, hashed["content-type"]);
+    EXPECT_EQ(2, ordered.size());
+    EXPECT_EQ(2, ordered["ACCEPT"]);
+    EXPECT_EQ(String("HOST"), ordered.rbegin()->first);
+}
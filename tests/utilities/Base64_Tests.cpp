@@ -0,0 +1,142 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Base64.hpp"
+#include "Exception.hpp"
+#include <random>
+#include <string>
+
+using namespace abraham;
+
+
+// Helper that decodes to a std::string
+namespace {
+    std::string decoded(const std::string& text, Base64Alphabet alphabet = Base64Alphabet::STANDARD) {
+        return Base64::decode(StringView(text), alphabet).std_string();
+    }
+}
+
+
+// Encoding
+
+TEST(Base64, encode) {
+    // Assertion, with the test vectors of RFC 4648
+    EXPECT_EQ(Base64::encode(StringView("")), "");
+    EXPECT_EQ(Base64::encode(StringView("f")), "Zg==");
+    EXPECT_EQ(Base64::encode(StringView("fo")), "Zm8=");
+    EXPECT_EQ(Base64::encode(StringView("foo")), "Zm9v");
+    EXPECT_EQ(Base64::encode(StringView("foob")), "Zm9vYg==");
+    EXPECT_EQ(Base64::encode(StringView("fooba")), "Zm9vYmE=");
+    EXPECT_EQ(Base64::encode(StringView("foobar")), "Zm9vYmFy");
+}
+
+TEST(Base64, encode_unpadded) {
+    // Assertion
+    EXPECT_EQ(Base64::encode(StringView("f"), Base64Alphabet::STANDARD, false), "Zg");
+    EXPECT_EQ(Base64::encode(StringView("fo"), Base64Alphabet::STANDARD, false), "Zm8");
+    EXPECT_EQ(Base64::encode(StringView("foo"), Base64Alphabet::STANDARD, false), "Zm9v");
+    EXPECT_EQ(Base64::encodedLength(4, false), 6);
+    EXPECT_EQ(Base64::encodedLength(4), 8);
+}
+
+TEST(Base64, alphabets) {
+    // Setup
+    std::string bytes = "\xfb\xff\xbf\xfb\xef\xfe";
+
+    // Assertion
+    EXPECT_EQ(Base64::encode(StringView(bytes)), "+/+/++/+");
+    EXPECT_EQ(Base64::encode(StringView(bytes), Base64Alphabet::URL), "-_-_--_-");
+    EXPECT_EQ(decoded("-_-_--_-", Base64Alphabet::URL), bytes);
+    EXPECT_THROW(decoded("-_-_--_-"), InvalidValueException);
+    EXPECT_THROW(decoded("+/+/++/+", Base64Alphabet::URL), InvalidValueException);
+}
+
+
+// Decoding
+
+TEST(Base64, decode) {
+    // Assertion
+    EXPECT_EQ(decoded(""), "");
+    EXPECT_EQ(decoded("Zg=="), "f");
+    EXPECT_EQ(decoded("Zg"), "f");
+    EXPECT_EQ(decoded("Zm8="), "fo");
+    EXPECT_EQ(decoded("Zm8"), "fo");
+    EXPECT_EQ(decoded("Zm9vYmFy"), "foobar");
+}
+
+TEST(Base64, decode_buffer) {
+    // Setup
+    char output[6];
+    size_t length = Base64::decode("Zm9vYmE=", 8, output);
+
+    // Assertion
+    EXPECT_EQ(Base64::maxDecodedLength(8), 6);
+    EXPECT_EQ(Base64::maxDecodedLength(7), 5);
+    EXPECT_EQ(length, 5);
+    EXPECT_EQ(std::string(output, length), "fooba");
+}
+
+TEST(Base64, decode_invalid) {
+    // Assertion
+    EXPECT_THROW(decoded("Z"), InvalidValueException);
+    EXPECT_THROW(decoded("Zm9vY"), InvalidValueException);
+    EXPECT_THROW(decoded("Zg="), InvalidValueException);
+    EXPECT_THROW(decoded("Z==="), InvalidValueException);
+    EXPECT_THROW(decoded("===="), InvalidValueException);
+    EXPECT_THROW(decoded("Zg==Zg=="), InvalidValueException);
+    EXPECT_THROW(decoded("Zm9v YmFy"), InvalidValueException);
+    EXPECT_THROW(decoded("Zm9v\nYmFy"), InvalidValueException);
+    EXPECT_THROW(decoded("Zh=="), InvalidValueException);
+    EXPECT_THROW(decoded("Zm9="), InvalidValueException);
+    EXPECT_FALSE(Base64::isValid("Zh=="));
+    EXPECT_FALSE(Base64::isValid("Z"));
+    EXPECT_TRUE(Base64::isValid("Zm9vYmE="));
+    EXPECT_TRUE(Base64::isValid(""));
+}
+
+TEST(Base64, every_character) {
+    // Setup
+    std::string characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    // Assertion
+    for (int c = 0; c < 256; ++c) {
+        for (size_t position : {0, 17, 40, 63}) {
+            std::string text = std::string(64, 'A');
+            text[position] = static_cast<char>(c);
+            bool is_padding = c == '=' && position == 63;
+            bool is_valid = characters.find(static_cast<char>(c)) != std::string::npos || is_padding;
+            EXPECT_EQ(Base64::isValid(text), is_valid);
+            if (is_padding) {
+                EXPECT_EQ(decoded(text).length(), 47);
+            } else if (is_valid) {
+                EXPECT_EQ(Base64::encode(StringView(decoded(text))), text);
+            } else {
+                EXPECT_THROW(decoded(text), InvalidValueException);
+            }
+        }
+    }
+}
+
+TEST(Base64, round_trip) {
+    // Setup
+    std::mt19937 generator(248);
+
+    // Assertion
+    for (size_t length = 0; length < 300; ++length) {
+        std::string bytes(length, '\0');
+        for (char& c : bytes) {
+            c = static_cast<char>(generator());
+        }
+
+        for (Base64Alphabet alphabet : {Base64Alphabet::STANDARD, Base64Alphabet::URL}) {
+            for (bool padding : {true, false}) {
+                String encoded = Base64::encode(StringView(bytes), alphabet, padding);
+                EXPECT_EQ(encoded.length(), Base64::encodedLength(length, padding));
+                EXPECT_TRUE(Base64::isValid(encoded.std_string(), alphabet));
+                EXPECT_EQ(decoded(encoded.std_string(), alphabet), bytes);
+            }
+        }
+    }
+}
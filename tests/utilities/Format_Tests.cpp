@@ -0,0 +1,152 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Format.hpp"
+#include "Exception.hpp"
+#include "SharedString.hpp"
+#include "String.hpp"
+#include <string>
+
+using namespace abraham;
+
+
+// Compile Time Format
+
+TEST(Format, placeholders) {
+    // Setup
+    String message = String::format(ABRAHAM_FORMAT("{} took {}ms"), "parse", 42);
+
+    // Assertion
+    EXPECT_EQ(message, "parse took 42ms");
+}
+
+TEST(Format, no_arguments) {
+    // Setup
+    String message = String::format(ABRAHAM_FORMAT("nothing to format"));
+
+    // Assertion
+    EXPECT_EQ(message, "nothing to format");
+}
+
+TEST(Format, empty) {
+    // Setup
+    String message = String::format(ABRAHAM_FORMAT(""));
+
+    // Assertion
+    EXPECT_EQ(message.length(), 0);
+}
+
+TEST(Format, escaped_braces) {
+    // Setup
+    String message = String::format(ABRAHAM_FORMAT("{{{}}} }}{{"), 7);
+
+    // Assertion
+    EXPECT_EQ(message, "{7} }{");
+}
+
+TEST(Format, adjacent_placeholders) {
+    // Setup
+    String message = String::format(ABRAHAM_FORMAT("{}{}{}"), 'a', 'b', 'c');
+
+    // Assertion
+    EXPECT_EQ(message, "abc");
+}
+
+TEST(Format, argument_types) {
+    // Setup
+    const char* cstring = "cstring";
+    String message = String::format(ABRAHAM_FORMAT("{} {} {} {} {} {} {} {} {}"), String("string"),
+                                    StringView("view"), std::string("std"), cstring, SharedString("shared"), true,
+                                    false, '!', "literal");
+
+    // Assertion
+    EXPECT_EQ(message, "string view std cstring shared true false ! literal");
+}
+
+TEST(Format, numbers) {
+    // Setup
+    short s = -12;
+    unsigned char uc = 200;
+    String message = String::format(ABRAHAM_FORMAT("{} {} {} {} {} {} {}"), s, uc, -2147483647 - 1,
+                                    18446744073709551615ULL, 1.5, 0.1f, -0.25);
+
+    // Assertion
+    EXPECT_EQ(message, "-12 200 -2147483648 18446744073709551615 1.5 0.1 -0.25");
+}
+
+TEST(Format, format_to) {
+    // Setup
+    String string = "values:";
+    String& result = String::formatTo(string, ABRAHAM_FORMAT(" {}, {}"), 1, 2);
+
+    // Assertion
+    EXPECT_EQ(&result, &string);
+    EXPECT_EQ(string, "values: 1, 2");
+}
+
+TEST(Format, format_to_self) {
+    // Setup
+    String string = "ab";
+    String::formatTo(string, ABRAHAM_FORMAT("{}"), StringView("cd"));
+    String::formatTo(string, ABRAHAM_FORMAT("{}{}"), 1, String("x"));
+
+    // Assertion
+    EXPECT_EQ(string, "abcd1x");
+}
+
+TEST(Format, long_arguments) {
+    // Setup
+    std::string long_text = std::string(1000, 'x');
+    String message = String::format(ABRAHAM_FORMAT("[{}]"), long_text);
+
+    // Assertion
+    EXPECT_EQ(message.length(), 1002);
+    EXPECT_EQ(message, "[" + long_text + "]");
+}
+
+
+// Runtime Format
+
+TEST(Format, runtime) {
+    // Setup
+    String format = "{} + {} = {}";
+    String message = String::format(format.std_string(), 1, 2, 3);
+
+    // Assertion
+    EXPECT_EQ(message, "1 + 2 = 3");
+}
+
+TEST(Format, runtime_format_to) {
+    // Setup
+    String string = "x";
+    String::formatTo(string, StringView("{{{}}}"), "y");
+
+    // Assertion
+    EXPECT_EQ(string, "x{y}");
+}
+
+TEST(Format, runtime_errors) {
+    // Assertion
+    EXPECT_THROW(String::format("{} {}", 1), InvalidArgumentException);
+    EXPECT_THROW(String::format("{}", 1, 2), InvalidArgumentException);
+    EXPECT_THROW(String::format("{", 1), InvalidArgumentException);
+    EXPECT_THROW(String::format("}"), InvalidArgumentException);
+    EXPECT_THROW(String::format("{x}", 1), InvalidArgumentException);
+}
+
+
+// Placeholder Counting
+
+TEST(Format, count_placeholders) {
+    // Setup
+    constexpr size_t count = details::countPlaceholders("{} {{ }} {}", 11);
+
+    // Assertion
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(details::countPlaceholders("", 0), 0);
+    EXPECT_EQ(details::countPlaceholders("{", 1), details::MALFORMED_FORMAT);
+    EXPECT_EQ(details::countPlaceholders("}{", 2), details::MALFORMED_FORMAT);
+    EXPECT_EQ(details::countPlaceholders("{{}", 3), details::MALFORMED_FORMAT);
+}
@@ -0,0 +1,148 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Hash.hpp"
+#include "Array.hpp"
+#include "Dictionary.hpp"
+#include "InlineString.hpp"
+#include "String.hpp"
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace abraham;
+
+
+// Hasher
+
+TEST(Hash, deterministic) {
+    // Setup
+    std::string text = std::string(200, 'x');
+
+    // Assertion
+    for (size_t length = 0; length <= text.length(); ++length) {
+        EXPECT_EQ(Hasher::hash(text.data(), length), Hasher::hash(std::string(text, 0, length).data(), length));
+    }
+}
+
+TEST(Hash, lengths_differ) {
+    // Setup
+    std::string text = std::string(200, '\0');
+    std::unordered_set<uint64_t> hashes;
+    for (size_t length = 0; length <= text.length(); ++length) {
+        hashes.insert(Hasher::hash(text.data(), length));
+    }
+
+    // Assertion
+    EXPECT_EQ(text.length() + 1, hashes.size());
+}
+
+TEST(Hash, every_byte_matters) {
+    // Setup
+    const size_t lengths[] = {1, 2, 3, 4, 7, 8, 15, 16, 17, 31, 48, 49, 64, 100, 200};
+    for (size_t length : lengths) {
+        std::string text = std::string(length, 'a');
+        uint64_t hash = Hasher::hash(text.data(), length);
+
+        // Assertion
+        for (size_t i = 0; i < length; ++i) {
+            std::string changed = text;
+            changed[i] = 'b';
+            EXPECT_NE(hash, Hasher::hash(changed.data(), length)) << "length " << length << " index " << i;
+        }
+    }
+}
+
+TEST(Hash, seed) {
+    // Setup
+    const char* text = "some text";
+
+    // Assertion
+    EXPECT_EQ(Hasher::hash(text, 9, 42), Hasher::hash(text, 9, 42));
+    EXPECT_NE(Hasher::hash(text, 9, 1), Hasher::hash(text, 9, 2));
+}
+
+TEST(Hash, distribution) {
+    // Setup
+    std::unordered_set<uint64_t> low_bits;
+    for (int i = 0; i < 4096; ++i) {
+        std::string key = "key" + std::to_string(i);
+        low_bits.insert(Hasher::hash(key.data(), key.length()) & 0xFFFF);
+    }
+
+    // Assertion
+    EXPECT_LT(3900, low_bits.size());
+}
+
+TEST(Hash, integer_and_combine) {
+    // Setup
+    uint64_t ab = Hasher::combine(Hasher::combine(0, 1), 2);
+    uint64_t ba = Hasher::combine(Hasher::combine(0, 2), 1);
+
+    // Assertion
+    EXPECT_NE(Hasher::hashInteger(1), Hasher::hashInteger(2));
+    EXPECT_EQ(Hasher::hashInteger(7), Hasher::hashInteger(7));
+    EXPECT_NE(ab, ba);
+}
+
+
+// Strings
+
+TEST(Hash, strings_agree) {
+    // Setup
+    String string = String("metrics.requests.count");
+    StringView view = StringView("metrics.requests.count");
+    InlineString<32> inline_string = InlineString<32>("metrics.requests.count");
+
+    // Assertion
+    EXPECT_EQ(string.hash(), view.hash());
+    EXPECT_EQ(string.hash(), inline_string.hash());
+    EXPECT_EQ(string.hash(), std::hash<String>()(string));
+    EXPECT_EQ(string.hash(), std::hash<StringView>()(view));
+    EXPECT_EQ(string.hash(), Hash<String>()(string));
+    EXPECT_NE(string.hash(), String("metrics.requests.bytes").hash());
+}
+
+TEST(Hash, string_unordered_map) {
+    // Setup
+    std::unordered_map<String, int> counts;
+    counts[String("a")] += 1;
+    counts[String("b")] += 1;
+    counts[String("a")] += 1;
+
+    // Assertion
+    EXPECT_EQ(2, counts.size());
+    EXPECT_EQ(2, counts[String("a")]);
+}
+
+
+// Containers
+
+TEST(Hash, array) {
+    // Setup
+    Array<String> first = Array<String>({"a", "b"});
+    Array<String> same = Array<String>({"a", "b"});
+    Array<String> reversed = Array<String>({"b", "a"});
+    Hash<Array<String>> hash;
+
+    // Assertion
+    EXPECT_EQ(first.hash(), same.hash());
+    EXPECT_EQ(first.hash(), hash(same));
+    EXPECT_NE(first.hash(), reversed.hash());
+    EXPECT_NE(Array<int>().hash(), Array<int>({0}).hash());
+}
+
+TEST(Hash, dictionary) {
+    // Setup
+    Dictionary<String, int> first = Dictionary<String, int>({{"a", 1}, {"b", 2}});
+    Dictionary<String, int> same = Dictionary<String, int>({{"b", 2}, {"a", 1}});
+    Dictionary<String, int> other = Dictionary<String, int>({{"a", 2}, {"b", 1}});
+    Hash<Dictionary<String, int>> hash;
+
+    // Assertion
+    EXPECT_EQ(first.hash(), same.hash());
+    EXPECT_EQ(first.hash(), hash(same));
+    EXPECT_NE(first.hash(), other.hash());
+}
@@ -0,0 +1,100 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Hex.hpp"
+#include "Exception.hpp"
+#include <random>
+#include <string>
+
+using namespace abraham;
+
+
+// Encoding
+
+TEST(Hex, encode) {
+    // Assertion
+    EXPECT_EQ(Hex::encode(StringView("")), "");
+    EXPECT_EQ(Hex::encode(StringView("\x01\xAB\xff", 3)), "01abff");
+    EXPECT_EQ(Hex::encode(StringView("\x01\xAB\xff", 3), true), "01ABFF");
+    EXPECT_EQ(Hex::encode(StringView("hello")), "68656c6c6f");
+}
+
+TEST(Hex, encode_buffer) {
+    // Setup
+    const unsigned char bytes[] = {0xDE, 0xAD, 0xBE, 0xEF};
+    char output[8];
+    size_t length = Hex::encode(bytes, sizeof(bytes), output, true);
+
+    // Assertion
+    EXPECT_EQ(length, 8);
+    EXPECT_EQ(Hex::encodedLength(4), 8);
+    EXPECT_EQ(std::string(output, length), "DEADBEEF");
+}
+
+
+// Decoding
+
+TEST(Hex, decode) {
+    // Assertion
+    EXPECT_EQ(Hex::decode(StringView("68656c6C6F")), "hello");
+    EXPECT_EQ(Hex::decode(StringView("")), "");
+    EXPECT_EQ(Hex::decode(StringView("00ff")).std_string(), std::string("\x00\xff", 2));
+}
+
+TEST(Hex, decode_buffer) {
+    // Setup
+    unsigned char output[4];
+    size_t length = Hex::decode("DeadBeef", 8, output);
+
+    // Assertion
+    EXPECT_EQ(length, 4);
+    EXPECT_EQ(Hex::decodedLength(8), 4);
+    EXPECT_EQ(output[0], 0xDE);
+    EXPECT_EQ(output[3], 0xEF);
+}
+
+TEST(Hex, decode_invalid) {
+    // Assertion
+    EXPECT_THROW(Hex::decode(StringView("abc")), InvalidValueException);
+    EXPECT_THROW(Hex::decode(StringView("0g")), InvalidValueException);
+    EXPECT_THROW(Hex::decode(StringView(" 0")), InvalidValueException);
+    EXPECT_THROW(Hex::decode(StringView(std::string(40, 'a') + "G" + std::string(23, 'a'))), InvalidValueException);
+    EXPECT_FALSE(Hex::isValid("abc"));
+    EXPECT_FALSE(Hex::isValid(std::string(100, '0') + "x0"));
+    EXPECT_TRUE(Hex::isValid(""));
+    EXPECT_TRUE(Hex::isValid("0123456789abcdefABCDEF00"));
+}
+
+TEST(Hex, every_character) {
+    // Assertion
+    for (int c = 0; c < 256; ++c) {
+        std::string text = std::string(63, '0') + static_cast<char>(c);
+        bool is_digit = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        EXPECT_EQ(Hex::isValid(text), is_digit);
+        if (is_digit) {
+            EXPECT_NO_THROW(Hex::decode(StringView(text)));
+        } else {
+            EXPECT_THROW(Hex::decode(StringView(text)), InvalidValueException);
+        }
+    }
+}
+
+TEST(Hex, round_trip) {
+    // Setup
+    std::mt19937 generator(48);
+
+    // Assertion
+    for (size_t length = 0; length < 200; ++length) {
+        std::string bytes(length, '\0');
+        for (char& c : bytes) {
+            c = static_cast<char>(generator());
+        }
+
+        String encoded = Hex::encode(StringView(bytes));
+        EXPECT_EQ(encoded.length(), 2 * length);
+        EXPECT_EQ(Hex::decode(StringView(encoded.std_string())).std_string(), bytes);
+        EXPECT_EQ(Hex::decode(StringView(Hex::encode(StringView(bytes), true).std_string())).std_string(), bytes);
+    }
+}
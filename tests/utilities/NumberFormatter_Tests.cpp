@@ -0,0 +1,114 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "NumberFormatter.hpp"
+#include "NumberParser.hpp"
+#include "InlineString.hpp"
+#include "String.hpp"
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+using namespace abraham;
+
+
+namespace {
+    template<typename T>
+    std::string format(T value) {
+        char buffer[NumberFormatter::MAX_LENGTH];
+        return std::string(buffer, NumberFormatter::format(value, buffer));
+    }
+}
+
+// Integers
+
+TEST(NumberFormatter, format_integers) {
+    // Assertion
+    EXPECT_EQ("0", format(0));
+    EXPECT_EQ("7", format(7));
+    EXPECT_EQ("-42", format(-42));
+    EXPECT_EQ("100", format(100u));
+    EXPECT_EQ("-2147483648", format(INT_MIN));
+    EXPECT_EQ("-9223372036854775808", format(LLONG_MIN));
+    EXPECT_EQ("18446744073709551615", format(ULLONG_MAX));
+}
+
+TEST(NumberFormatter, format_integers_matches_to_string) {
+    // Setup
+    std::mt19937 generator = std::mt19937(38);
+
+    // Assertion
+    for (int i = 0; i < 2000; ++i) {
+        long long value = static_cast<long long>(generator()) << 32 | generator();
+        value >>= generator() % 63;
+        ASSERT_EQ(std::to_string(value), format(value));
+    }
+}
+
+// Floating Point
+
+TEST(NumberFormatter, format_doubles) {
+    // Assertion
+    EXPECT_EQ("0", format(0.0));
+    EXPECT_EQ("-0", format(-0.0));
+    EXPECT_EQ("1", format(1.0));
+    EXPECT_EQ("0.1", format(0.1));
+    EXPECT_EQ("0.30000000000000004", format(0.1 + 0.2));
+    EXPECT_EQ("-1234.5", format(-1234.5));
+    EXPECT_EQ("100000000000000000000", format(1e20));
+    EXPECT_EQ("1e+21", format(1e21));
+    EXPECT_EQ("0.000001", format(1e-6));
+    EXPECT_EQ("1.5e-7", format(1.5e-7));
+    EXPECT_EQ("5e-324", format(4.9e-324));
+    EXPECT_EQ("1.7976931348623157e+308", format(1.7976931348623157e308));
+    EXPECT_EQ("inf", format(INFINITY));
+    EXPECT_EQ("-inf", format(-INFINITY));
+    EXPECT_EQ("nan", format(NAN));
+}
+
+TEST(NumberFormatter, format_floats) {
+    // Assertion
+    EXPECT_EQ("0.1", format(0.1f));
+    EXPECT_EQ("16777216", format(16777216.0f));
+    EXPECT_EQ("3.4028235e+38", format(3.4028235e38f));
+    EXPECT_EQ("1e-45", format(1.4e-45f));
+}
+
+TEST(NumberFormatter, format_doubles_round_trips) {
+    // Setup
+    std::mt19937_64 generator = std::mt19937_64(38);
+
+    // Assertion
+    for (int i = 0; i < 20000; ++i) {
+        uint64_t bits = generator();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isnan(value)) continue;
+
+        std::string text = format(value);
+        double parsed = 0;
+        ASSERT_EQ(ParseError::NONE, NumberParser::parseValue(text, parsed)) << text;
+        ASSERT_EQ(0, std::memcmp(&value, &parsed, sizeof(value))) << text;
+    }
+}
+
+// Strings
+
+TEST(NumberFormatter, string_append) {
+    // Setup
+    String string = String("count=");
+    string.append(42).append(',').append(-1.5).append(',').append(size_t(7));
+    InlineString<15> field = "v";
+    field.append(2.5f).append(10ULL);
+
+    // Assertion
+    EXPECT_STREQ("count=42,-1.5,7", string.c_string());
+    EXPECT_STREQ("v2.510", field.c_string());
+    EXPECT_STREQ("-12", String::fromInt(-12).c_string());
+    EXPECT_STREQ("18446744073709551615", String::fromUnsigned(ULLONG_MAX).c_string());
+    EXPECT_STREQ("0.2", String::fromDouble(0.2).c_string());
+    EXPECT_STREQ("0.2", String::fromFloat(0.2f).c_string());
+}
@@ -0,0 +1,218 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "NumberParser.hpp"
+#include "InlineString.hpp"
+#include "String.hpp"
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using namespace abraham;
+
+
+// Integers
+
+TEST(NumberParser, parse_integers) {
+    // Setup
+    int value = 7;
+    long long long_value = 0;
+    ParseResult prefix = NumberParser::parse("-1234abc", value);
+    ParseResult empty = NumberParser::parse("abc", value);
+
+    // Assertion
+    EXPECT_EQ(ParseError::NONE, prefix.error);
+    EXPECT_EQ(5, prefix.length);
+    EXPECT_EQ(-1234, value);
+    EXPECT_EQ(ParseError::INVALID, empty.error);
+    EXPECT_EQ(0, empty.length);
+    EXPECT_EQ(-1234, value);
+    EXPECT_TRUE(NumberParser::parse("+000000000000000000000042", value).isValid());
+    EXPECT_EQ(42, value);
+    EXPECT_TRUE(NumberParser::parse("-9223372036854775808", long_value).isValid());
+    EXPECT_EQ(LLONG_MIN, long_value);
+    EXPECT_TRUE(NumberParser::parse("1234567890123456789", long_value).isValid());
+    EXPECT_EQ(1234567890123456789LL, long_value);
+}
+
+TEST(NumberParser, parse_integers_out_of_range) {
+    // Setup
+    int value = 7;
+    unsigned unsigned_value = 7;
+    unsigned long long wide_value = 0;
+    ParseResult too_large = NumberParser::parse("2147483648,", value);
+
+    // Assertion
+    EXPECT_EQ(ParseError::OUT_OF_RANGE, too_large.error);
+    EXPECT_EQ(10, too_large.length);
+    EXPECT_EQ(7, value);
+    EXPECT_TRUE(NumberParser::parse("-2147483648", value).isValid());
+    EXPECT_EQ(INT_MIN, value);
+    EXPECT_EQ(ParseError::OUT_OF_RANGE, NumberParser::parse("-2147483649", value).error);
+    EXPECT_EQ(ParseError::INVALID, NumberParser::parse("-1", unsigned_value).error);
+    EXPECT_EQ(ParseError::OUT_OF_RANGE, NumberParser::parse("4294967296", unsigned_value).error);
+    EXPECT_TRUE(NumberParser::parse("18446744073709551615", wide_value).isValid());
+    EXPECT_EQ(ULLONG_MAX, wide_value);
+    EXPECT_EQ(ParseError::OUT_OF_RANGE, NumberParser::parse("18446744073709551616", wide_value).error);
+    EXPECT_EQ(ParseError::OUT_OF_RANGE, NumberParser::parse("100000000000000000000000", wide_value).error);
+}
+
+TEST(NumberParser, parse_integers_matches_strtoll) {
+    // Setup
+    std::mt19937 generator = std::mt19937(36);
+
+    // Assertion
+    for (int i = 0; i < 2000; ++i) {
+        long long expected = static_cast<long long>(generator()) << 32 | generator();
+        expected >>= generator() % 63;
+        std::string text = std::to_string(expected);
+
+        long long value = 0;
+        ParseResult result = NumberParser::parse(text, value);
+        ASSERT_TRUE(result.isValid()) << text;
+        ASSERT_EQ(text.length(), result.length) << text;
+        ASSERT_EQ(std::strtoll(text.c_str(), nullptr, 10), value) << text;
+    }
+}
+
+// Floating Point
+
+TEST(NumberParser, parse_doubles) {
+    // Setup
+    double value = 0;
+    ParseResult prefix = NumberParser::parse("1.5e3x", value);
+    ParseResult dangling_exponent = NumberParser::parse("2e+", value);
+
+    // Assertion
+    EXPECT_EQ(5, prefix.length);
+    EXPECT_EQ(1, dangling_exponent.length);
+    EXPECT_EQ(2.0, value);
+    EXPECT_TRUE(NumberParser::parse(".25", value).isValid());
+    EXPECT_EQ(0.25, value);
+    EXPECT_TRUE(NumberParser::parse("5.", value).isValid());
+    EXPECT_EQ(5.0, value);
+    EXPECT_TRUE(NumberParser::parse("-0", value).isValid());
+    EXPECT_TRUE(std::signbit(value));
+    EXPECT_TRUE(NumberParser::parse("-Infinity", value).isValid());
+    EXPECT_EQ(-INFINITY, value);
+    EXPECT_TRUE(NumberParser::parse("nan", value).isValid());
+    EXPECT_TRUE(std::isnan(value));
+    EXPECT_EQ(ParseError::INVALID, NumberParser::parse(".", value).error);
+    EXPECT_EQ(ParseError::INVALID, NumberParser::parse("-e5", value).error);
+    EXPECT_EQ(ParseError::OUT_OF_RANGE, NumberParser::parse("1e309", value).error);
+    EXPECT_TRUE(NumberParser::parse("1e-400", value).isValid());
+    EXPECT_EQ(0.0, value);
+}
+
+TEST(NumberParser, parse_doubles_matches_strtod) {
+    // Setup
+    std::mt19937 generator = std::mt19937(37);
+    std::vector<std::string> texts = {"2.2250738585072011e-308", "2.2250738585072014e-308", "4.9e-324",
+                                      "1.7976931348623157e308", "9007199254740993", "0.1", "123456789012345678901234",
+                                      "3.14159265358979323846264338327950288", "7.038531e-26", "1e23"};
+    for (int i = 0; i < 5000; ++i) {
+        std::string text = std::to_string(generator() % 100000000);
+        text += '.';
+        text += std::to_string(generator());
+        text += 'e';
+        text += std::to_string(static_cast<int>(generator() % 630) - 330);
+        texts.push_back(text);
+    }
+
+    // Assertion
+    for (const std::string& text : texts) {
+        double value = 0;
+        ParseResult result = NumberParser::parse(text, value);
+        ASSERT_TRUE(result.isValid()) << text;
+        ASSERT_EQ(text.length(), result.length) << text;
+        double expected = std::strtod(text.c_str(), nullptr);
+        ASSERT_EQ(0, std::memcmp(&expected, &value, sizeof(value))) << text;
+    }
+}
+
+TEST(NumberParser, parse_floats_matches_strtof) {
+    // Setup
+    std::mt19937 generator = std::mt19937(38);
+    std::vector<std::string> texts = {"1.17549435e-38", "1.4e-45", "3.4028234e38", "16777217", "0.1", "1e10"};
+    for (int i = 0; i < 5000; ++i) {
+        std::string text = std::to_string(generator() % 1000000);
+        text += '.';
+        text += std::to_string(generator() % 100000);
+        text += 'e';
+        text += std::to_string(static_cast<int>(generator() % 75) - 45);
+        texts.push_back(text);
+    }
+
+    // Assertion
+    for (const std::string& text : texts) {
+        float value = 0;
+        ASSERT_TRUE(NumberParser::parse(text, value).isValid()) << text;
+        float expected = std::strtof(text.c_str(), nullptr);
+        ASSERT_EQ(0, std::memcmp(&expected, &value, sizeof(value))) << text;
+    }
+}
+
+// Whole Values
+
+TEST(NumberParser, parse_value) {
+    // Setup
+    int value = 7;
+    bool flag = false;
+
+    // Assertion
+    EXPECT_EQ(ParseError::NONE, NumberParser::parseValue(" 12\t", value));
+    EXPECT_EQ(12, value);
+    EXPECT_EQ(ParseError::INVALID, NumberParser::parseValue("12abc", value));
+    EXPECT_EQ(ParseError::INVALID, NumberParser::parseValue("", value));
+    EXPECT_EQ(ParseError::INVALID, NumberParser::parseValue("1 2", value));
+    EXPECT_EQ(12, value);
+    EXPECT_EQ(ParseError::NONE, NumberParser::parseValue(" YES ", flag));
+    EXPECT_TRUE(flag);
+    EXPECT_EQ(ParseError::INVALID, NumberParser::parseValue("yess", flag));
+    EXPECT_THROW(NumberParser::valueOf<double>("1.5.5", "double"), InvalidValueException);
+}
+
+TEST(NumberParser, parse_column) {
+    // Setup
+    Array<double> values = Array<double>();
+    Array<int> partial = Array<int>();
+    ParseError error = NumberParser::parseColumn("1.5, 2,-3e2\n", ',', values);
+    ParseError bad_field = NumberParser::parseColumn("4\n5\nsix\n7\n", '\n', partial);
+
+    // Assertion
+    EXPECT_EQ(ParseError::NONE, error);
+    EXPECT_EQ(3, values.size());
+    EXPECT_EQ(1.5, values[0]);
+    EXPECT_EQ(-300.0, values[2]);
+    EXPECT_EQ(ParseError::INVALID, bad_field);
+    EXPECT_EQ(2, partial.size());
+    EXPECT_EQ(ParseError::INVALID, NumberParser::parseColumn("1,,2", ',', partial));
+}
+
+// Strings
+
+TEST(NumberParser, try_value) {
+    // Setup
+    String string = String("42");
+    InlineString<15> field = InlineString<15>("2.5");
+    int integer = 0;
+    double decimal = 0;
+    unsigned long long wide = 0;
+
+    // Assertion
+    EXPECT_TRUE(string.tryIntValue(integer));
+    EXPECT_EQ(42, integer);
+    EXPECT_FALSE(String("forty two").tryIntValue(integer));
+    EXPECT_EQ(42, integer);
+    EXPECT_TRUE(field.tryDoubleValue(decimal));
+    EXPECT_EQ(2.5, decimal);
+    EXPECT_TRUE(StringView("18446744073709551615").tryUnsignedLongLongValue(wide));
+    EXPECT_EQ(ULLONG_MAX, wide);
+    EXPECT_FALSE(StringView("-1").tryUnsignedLongLongValue(wide));
+    EXPECT_THROW(String("12abc").intValue(), InvalidValueException);
+    EXPECT_THROW(String("4294967296").unsignedValue(), InvalidValueException);
+}
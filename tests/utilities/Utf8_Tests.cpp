@@ -0,0 +1,218 @@
+//
+// Created by Matthew Remmel on 10/18/26.
+//
+
+#include "gtest/gtest.h"
+#include "Utf8.hpp"
+#include "Exception.hpp"
+#include <random>
+#include <string>
+
+using namespace abraham;
+
+
+// Helper that validates one code point at a time, to check the block validator against
+bool isValidOneAtATime(const std::string& text) {
+    size_t i = 0;
+    while (i < text.length()) {
+        const unsigned char lead = static_cast<unsigned char>(text[i]);
+        size_t length;
+        unsigned long code_point;
+        if (lead < 0x80) { length = 1; code_point = lead; }
+        else if (lead >= 0xC0 && lead < 0xE0) { length = 2; code_point = lead & 0x1F; }
+        else if (lead >= 0xE0 && lead < 0xF0) { length = 3; code_point = lead & 0x0F; }
+        else if (lead >= 0xF0 && lead < 0xF8) { length = 4; code_point = lead & 0x07; }
+        else return false;
+
+        if (i + length > text.length()) return false;
+        for (size_t j = 1; j < length; ++j) {
+            const unsigned char c = static_cast<unsigned char>(text[i + j]);
+            if ((c & 0xC0) != 0x80) return false;
+            code_point = (code_point << 6) | (c & 0x3F);
+        }
+
+        const unsigned long minimum[] = {0, 0, 0x80, 0x800, 0x10000};
+        if (code_point < minimum[length] || code_point > 0x10FFFF) return false;
+        if (code_point >= 0xD800 && code_point <= 0xDFFF) return false;
+        i += length;
+    }
+
+    return true;
+}
+
+
+// Validation
+
+TEST(Utf8, is_valid) {
+    // Setup
+    const std::string valid[] = {"", "hello", "caf\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xEF\xBF\xBF",
+                                 "\xF4\x8F\xBF\xBF", "\xED\x9F\xBF", std::string(1, '\0')};
+    const std::string invalid[] = {"\x80", "\xC3", "\xC0\xAF", "\xC1\xBF", "\xE0\x80\xAF", "\xED\xA0\x80",
+                                   "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF", "\xE2\x82", "\xF0\x9F\x98",
+                                   "a\xC3\xA9\xA9"};
+
+    // Assertion
+    for (const std::string& text : valid) {
+        EXPECT_TRUE(Utf8::isValid(text.data(), text.length())) << text;
+        EXPECT_EQ(text.length(), Utf8::validLength(text.data(), text.length()));
+    }
+    for (const std::string& text : invalid) {
+        EXPECT_FALSE(Utf8::isValid(text.data(), text.length())) << text;
+        EXPECT_GT(text.length(), Utf8::validLength(text.data(), text.length()));
+    }
+}
+
+TEST(Utf8, is_valid_across_blocks) {
+    // Setup
+    const std::string euro = "\xE2\x82\xAC";
+    const std::string emoji = "\xF0\x9F\x98\x80";
+
+    // Assertion
+    for (size_t offset = 0; offset < 40; ++offset) {
+        std::string prefix = std::string(offset, 'a');
+        EXPECT_TRUE(Utf8::isValid((prefix + euro + emoji + prefix).data(), offset * 2 + 7));
+        EXPECT_FALSE(Utf8::isValid((prefix + euro.substr(0, 2)).data(), offset + 2));
+        EXPECT_FALSE(Utf8::isValid((prefix + emoji.substr(0, 3) + "a").data(), offset + 4));
+        EXPECT_EQ(offset, Utf8::validLength((prefix + "\xC0\x80" + prefix).data(), offset * 2 + 2));
+    }
+}
+
+TEST(Utf8, is_valid_random) {
+    // Setup
+    std::mt19937 generator = std::mt19937(42);
+    const std::string pieces[] = {"a", "z", " ", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\x80", "\xBF",
+                                  "\xC0", "\xC2", "\xE0", "\xE0\xA0", "\xED", "\xED\xA0", "\xF0", "\xF4", "\xF4\x90",
+                                  "\xF5", "\xFF"};
+    std::uniform_int_distribution<size_t> piece = std::uniform_int_distribution<size_t>(0, 18);
+    std::uniform_int_distribution<size_t> count = std::uniform_int_distribution<size_t>(0, 60);
+    std::uniform_int_distribution<int> valid_only = std::uniform_int_distribution<int>(0, 1);
+
+    // Assertion
+    for (int trial = 0; trial < 20000; ++trial) {
+        std::string text;
+        const size_t limit = valid_only(generator) == 0 ? 6 : 19;
+        for (size_t i = count(generator); i > 0; --i) {
+            text += pieces[piece(generator) % limit];
+        }
+
+        EXPECT_EQ(isValidOneAtATime(text), Utf8::isValid(text.data(), text.length())) << trial;
+        EXPECT_EQ(isValidOneAtATime(text), Utf8::validLength(text.data(), text.length()) == text.length());
+    }
+}
+
+
+// Code points
+
+TEST(Utf8, count_code_points) {
+    // Setup
+    std::string text;
+    for (int i = 0; i < 100; ++i) {
+        text += "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    }
+
+    // Assertion
+    EXPECT_EQ(0, Utf8::countCodePoints("", 0));
+    EXPECT_EQ(5, Utf8::countCodePoints("hello", 5));
+    EXPECT_EQ(400, Utf8::countCodePoints(text.data(), text.length()));
+}
+
+TEST(Utf8, offset_of_code_point) {
+    // Setup
+    std::string text;
+    for (int i = 0; i < 20; ++i) {
+        text += "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    }
+
+    // Assertion
+    for (size_t index = 0; index < 80; ++index) {
+        EXPECT_EQ((index / 4) * 10 + std::vector<size_t>({0, 1, 3, 6})[index % 4],
+                  Utf8::offsetOfCodePoint(text.data(), text.length(), index));
+    }
+    EXPECT_EQ(text.length(), Utf8::offsetOfCodePoint(text.data(), text.length(), 80));
+    EXPECT_EQ(Utf8::NO_INDEX, Utf8::offsetOfCodePoint(text.data(), text.length(), 81));
+}
+
+TEST(Utf8, reverse_code_points) {
+    // Setup
+    std::string text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z";
+    Utf8::reverseCodePoints(&text[0], text.length());
+
+    // Assertion
+    EXPECT_EQ("z\xF0\x9F\x98\x80\xE2\x82\xAC\xC3\xA9" "a", text);
+}
+
+
+// Transcoding
+
+TEST(Utf8, to_utf16) {
+    // Setup
+    std::u16string result = Utf8::toUtf16("ascii text longer than sixteen, caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80");
+
+    // Assertion
+    EXPECT_EQ(u"ascii text longer than sixteen, café € \U0001F600", result);
+    EXPECT_THROW(Utf8::toUtf16("bad \xC3"), InvalidValueException);
+}
+
+TEST(Utf8, to_utf32) {
+    // Setup
+    std::u32string result = Utf8::toUtf32("ascii text longer than sixteen, caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80");
+
+    // Assertion
+    EXPECT_EQ(U"ascii text longer than sixteen, café € \U0001F600", result);
+    EXPECT_THROW(Utf8::toUtf32("\xED\xA0\x80"), InvalidValueException);
+}
+
+TEST(Utf8, from_utf16) {
+    // Setup
+    String result = Utf8::fromUtf16(u"ascii text longer than sixteen, café € \U0001F600");
+
+    // Assertion
+    EXPECT_STREQ("ascii text longer than sixteen, caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80", result.c_string());
+    EXPECT_THROW(Utf8::fromUtf16(std::u16string(1, char16_t(0xD800))), InvalidValueException);
+    EXPECT_THROW(Utf8::fromUtf16(std::u16string(1, char16_t(0xDC00))), InvalidValueException);
+}
+
+TEST(Utf8, from_utf32) {
+    // Setup
+    String result = Utf8::fromUtf32(U"café € \U0001F600");
+
+    // Assertion
+    EXPECT_STREQ("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80", result.c_string());
+    EXPECT_THROW(Utf8::fromUtf32(std::u32string(1, char32_t(0x110000))), InvalidValueException);
+}
+
+TEST(Utf8, round_trip) {
+    // Setup
+    std::u32string code_points;
+    for (char32_t c = 1; c < 0x110000; c += 97) {
+        if (c < 0xD800 || c > 0xDFFF) code_points += c;
+    }
+    String utf8 = Utf8::fromUtf32(code_points);
+
+    // Assertion
+    EXPECT_TRUE(utf8.isValidUtf8());
+    EXPECT_EQ(code_points.length(), utf8.codePointLength());
+    EXPECT_EQ(code_points, Utf8::toUtf32(utf8));
+    EXPECT_STREQ(utf8.c_string(), Utf8::fromUtf16(Utf8::toUtf16(utf8)).c_string());
+}
+
+
+// String
+
+TEST(Utf8, string_functions) {
+    // Setup
+    String string = String("na\xC3\xAFve caf\xC3\xA9");
+    String reversed = string;
+    reversed.reverseCodePoints();
+
+    // Assertion
+    EXPECT_TRUE(string.isValidUtf8());
+    EXPECT_FALSE(String("\xC3").isValidUtf8());
+    EXPECT_EQ(12, string.length());
+    EXPECT_EQ(10, string.codePointLength());
+    EXPECT_STREQ("\xC3\xA9" "fac ev\xC3\xAF" "an", reversed.c_string());
+    EXPECT_STREQ("caf\xC3\xA9", string.codePointSubstring(6, 10).c_string());
+    EXPECT_EQ(StringView("a\xC3\xAFv"), string.view().codePointSubstring(1, 4));
+    EXPECT_THROW(string.codePointSubstring(6, 11), OutOfBoundsException);
+    EXPECT_THROW(string.codePointSubstring(4, 3), InvalidArgumentException);
+}